@@ -0,0 +1,112 @@
+/**
+ * @file bench_allocations.cpp
+ * @brief Verifica que la simulación en régimen estable no reserve memoria
+ * del heap en cada tick.
+ *
+ * Reemplaza los operadores new globales por versiones que cuentan las
+ * reservas del hilo de simulación. La carga se simula una vez completa para
+ * que colas, tablas y búferes alcancen su tamaño máximo; luego se recarga la
+ * misma carga y, tras un calentamiento, cada iteración avanza un tick y el
+ * benchmark falla si alguno reservó memoria.
+ */
+
+#include "bench_workload.hpp"
+#include "metrics/metrics_collector.hpp"
+#include <benchmark/benchmark.h>
+#include <cstdlib>
+#include <new>
+
+namespace {
+
+thread_local bool counting = false; //!< Contar las reservas de este hilo.
+thread_local int64_t allocations = 0; //!< Reservas contadas en este hilo.
+
+void *counted_alloc(std::size_t size) {
+  if (counting)
+    ++allocations;
+  if (void *ptr = std::malloc(size == 0 ? 1 : size))
+    return ptr;
+  throw std::bad_alloc();
+}
+
+} // namespace
+
+void *operator new(std::size_t size) { return counted_alloc(size); }
+void *operator new[](std::size_t size) { return counted_alloc(size); }
+void operator delete(void *ptr) noexcept { std::free(ptr); }
+void operator delete[](void *ptr) noexcept { std::free(ptr); }
+void operator delete(void *ptr, std::size_t) noexcept { std::free(ptr); }
+void operator delete[](void *ptr, std::size_t) noexcept { std::free(ptr); }
+
+using namespace OSSimulator;
+
+namespace {
+
+constexpr size_t PROCESS_COUNT = 2000;
+constexpr double ARRIVAL_RATE = 100.0;
+constexpr int WARMUP_TICKS = 200;
+constexpr int MEASURED_TICKS = 2000;
+
+/**
+ * Avanza la simulación tick a tick contando las reservas de cada uno. El
+ * segundo argumento activa las métricas, escritas en /dev/null.
+ */
+void BM_SteadyStateAllocations(benchmark::State &state,
+                               const std::string &cpu) {
+  SimulatorConfig config;
+  config.scheduling_algorithm = cpu;
+  config.total_memory_frames = 64;
+
+  // Todos los procesos llegan durante el calentamiento: las reservas propias
+  // de cada proceso (tabla de páginas, registro) quedan fuera de la medición.
+  BenchSimulation sim(config, make_workload(PROCESS_COUNT, ARRIVAL_RATE));
+  std::shared_ptr<MetricsCollector> metrics;
+  if (state.range(0) != 0) {
+    metrics = std::make_shared<MetricsCollector>();
+    if (!metrics->enable_file_output("/dev/null")) {
+      state.SkipWithError("No se pudo abrir /dev/null");
+      return;
+    }
+    sim.scheduler.set_metrics_collector(metrics);
+  }
+  sim.scheduler.run_until_completion();
+  sim.scheduler.load_processes(make_workload(PROCESS_COUNT, ARRIVAL_RATE));
+  sim.scheduler.run_until(WARMUP_TICKS);
+
+  int64_t total = 0;
+  int64_t dirty_ticks = 0;
+  for (auto _ : state) {
+    Tick tick = sim.scheduler.get_current_time() + 1;
+    allocations = 0;
+    counting = true;
+    sim.scheduler.run_until(tick);
+    counting = false;
+    total += allocations;
+    dirty_ticks += allocations != 0;
+  }
+  if (metrics)
+    metrics->disable_output();
+
+  state.counters["allocs_per_tick"] = benchmark::Counter(
+      static_cast<double>(total), benchmark::Counter::kAvgIterations);
+  state.counters["ticks_with_allocs"] = static_cast<double>(dirty_ticks);
+  if (!sim.scheduler.has_pending_processes())
+    state.SkipWithError("La carga terminó antes de medir todos los ticks");
+  else if (total != 0)
+    state.SkipWithError("La simulación reservó memoria en régimen estable");
+}
+
+const bool registered = [] {
+  for (const auto &cpu : cpu_scheduler_registry().names()) {
+    benchmark::RegisterBenchmark(
+        ("BM_SteadyStateAllocations/" + cpu).c_str(),
+        BM_SteadyStateAllocations, cpu)
+        ->ArgName("metrics")
+        ->Arg(0)
+        ->Arg(1)
+        ->Iterations(MEASURED_TICKS);
+  }
+  return true;
+}();
+
+} // namespace
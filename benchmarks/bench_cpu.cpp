@@ -0,0 +1,79 @@
+/**
+ * @file bench_cpu.cpp
+ * @brief Benchmarks del planificador: un paso de simulación y las colas de
+ * listos de cada política.
+ */
+
+#include "bench_workload.hpp"
+#include <benchmark/benchmark.h>
+
+using namespace OSSimulator;
+
+namespace {
+
+/**
+ * Un paso de CPUScheduler::execute_step con N procesos que llegan más rápido
+ * de lo que se atienden, de modo que la cola de listos crece hasta N.
+ */
+void BM_ExecuteStep(benchmark::State &state) {
+  const auto count = static_cast<size_t>(state.range(0));
+  SimulatorConfig config;
+  config.scheduling_algorithm = "RoundRobin";
+  config.page_replacement_algorithm = "LRU";
+  config.total_memory_frames = 4096;
+
+  std::unique_ptr<BenchSimulation> sim;
+  int64_t ticks = 0;
+  for (auto _ : state) {
+    if (!sim || !sim->scheduler.has_pending_processes()) {
+      state.PauseTiming();
+      if (sim)
+        ticks += sim->scheduler.get_current_time();
+      sim.reset();
+      sim = std::make_unique<BenchSimulation>(config,
+                                              make_workload(count, 1.0));
+      state.ResumeTiming();
+    }
+    sim->scheduler.execute_step(0);
+  }
+  ticks += sim ? sim->scheduler.get_current_time() : 0;
+  state.SetItemsProcessed(state.iterations());
+  state.counters["ticks"] =
+      benchmark::Counter(static_cast<double>(ticks), benchmark::Counter::kIsRate);
+}
+BENCHMARK(BM_ExecuteStep)->RangeMultiplier(8)->Range(64, 4096);
+
+/**
+ * Scheduler::add_process de N procesos seguido de su despacho en orden
+ * (get_next_process y remove_process, como CPUScheduler), con cada política
+ * registrada.
+ */
+void BM_SchedulerAddProcess(benchmark::State &state,
+                            const std::string &algorithm) {
+  const auto count = static_cast<size_t>(state.range(0));
+  SimulatorConfig config;
+  auto policy = cpu_scheduler_registry().create(algorithm, config);
+  auto processes = make_workload(count);
+
+  for (auto _ : state) {
+    for (const auto &process : processes)
+      policy->add_process(process);
+    while (policy->has_processes()) {
+      auto next = policy->get_next_process();
+      policy->remove_process(next->pid);
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(count));
+}
+
+const bool registered = [] {
+  for (const auto &name : cpu_scheduler_registry().names()) {
+    benchmark::RegisterBenchmark(("BM_SchedulerAddProcess/" + name).c_str(),
+                                 BM_SchedulerAddProcess, name)
+        ->RangeMultiplier(8)
+        ->Range(64, 32768);
+  }
+  return true;
+}();
+
+} // namespace
@@ -0,0 +1,83 @@
+/**
+ * @file bench_io.cpp
+ * @brief Benchmarks del gestor de E/S con varios dispositivos ocupados.
+ */
+
+#include "bench_workload.hpp"
+#include "io/io_request.hpp"
+#include <benchmark/benchmark.h>
+#include <random>
+#include <string>
+
+using namespace OSSimulator;
+
+namespace {
+
+constexpr int QUEUE_DEPTH = 32;
+constexpr int CYLINDERS = 200;
+
+/**
+ * Un tick de IOManager::execute_all_devices con D dispositivos que mantienen
+ * QUEUE_DEPTH solicitudes cada uno: cada solicitud terminada se reemplaza
+ * por otra a un cilindro al azar.
+ */
+void BM_ExecuteAllDevices(benchmark::State &state,
+                          const std::string &algorithm) {
+  const int device_count = static_cast<int>(state.range(0));
+  IOManager manager;
+  for (int d = 0; d < device_count; ++d) {
+    std::string name = "dev" + std::to_string(d);
+    IODeviceConfig config{name, algorithm, 4, 1, 8, CYLINDERS};
+    auto device = std::make_shared<IODevice>(name);
+    device->set_scheduler(
+        io_scheduler_registry().create(config.scheduling_algorithm, config));
+    device->set_seek_speed(config.seek_speed);
+    manager.add_device(name, device);
+  }
+
+  std::vector<std::shared_ptr<Process>> completed;
+  manager.set_batch_completion_callback(
+      [&completed](const std::vector<IOCompletion> &batch) {
+        for (const auto &completion : batch)
+          completed.push_back(completion.process);
+      });
+
+  std::mt19937 generator(1);
+  auto submit = [&](const std::shared_ptr<Process> &process, int time) {
+    int device = (process->pid - 1) / QUEUE_DEPTH;
+    Burst burst(BurstType::IO, 1 + static_cast<int>(generator() % 8),
+                "dev" + std::to_string(device),
+                static_cast<int>(generator() % CYLINDERS));
+    manager.submit_io_request(std::make_shared<IORequest>(process, burst, time));
+  };
+  for (int pid = 1; pid <= device_count * QUEUE_DEPTH; ++pid)
+    submit(std::make_shared<Process>(pid, "P" + std::to_string(pid), 0, 1, 0, 1),
+           0);
+
+  int time = 0;
+  int64_t completions = 0;
+  for (auto _ : state) {
+    manager.execute_all_devices(1, time);
+    ++time;
+    completions += static_cast<int64_t>(completed.size());
+    for (const auto &process : completed)
+      submit(process, time);
+    completed.clear();
+  }
+  state.SetItemsProcessed(state.iterations());
+  state.counters["completions"] = benchmark::Counter(
+      static_cast<double>(completions), benchmark::Counter::kIsRate);
+}
+
+const bool registered = [] {
+  for (const char *name : {"FCFS", "SSTF", "SCAN", "CLOOK"}) {
+    benchmark::RegisterBenchmark(
+        (std::string("BM_ExecuteAllDevices/") + name).c_str(),
+        BM_ExecuteAllDevices, std::string(name))
+        ->RangeMultiplier(4)
+        ->Range(1, 64);
+  }
+  return true;
+}();
+
+} // namespace
@@ -0,0 +1,76 @@
+/**
+ * @file bench_memory.cpp
+ * @brief Benchmarks de los algoritmos de reemplazo con la memoria llena.
+ */
+
+#include "bench_workload.hpp"
+#include <benchmark/benchmark.h>
+#include <unordered_map>
+
+using namespace OSSimulator;
+
+namespace {
+
+constexpr int PAGES_PER_PROCESS = 16;
+
+/**
+ * Ciclo de reemplazo en régimen: con todos los marcos ocupados se elige una
+ * víctima con ReplacementAlgorithm::select_victim, se libera y se vuelve a
+ * cargar, y su proceso sale de CPU, con las mismas notificaciones que envía
+ * MemoryManager.
+ */
+void BM_SelectVictim(benchmark::State &state, const std::string &algorithm) {
+  const int frame_count = static_cast<int>(state.range(0));
+  SimulatorConfig config;
+  auto replacement = replacement_registry().create(algorithm, config);
+
+  std::vector<Frame> frames;
+  std::unordered_map<int, std::shared_ptr<Process>> process_map;
+  for (int pid = 1; (pid - 1) * PAGES_PER_PROCESS < frame_count; ++pid) {
+    auto process = std::make_shared<Process>(pid, "P" + std::to_string(pid),
+                                             0, 10, 0, PAGES_PER_PROCESS);
+    process->page_table.reset(PAGES_PER_PROCESS, 0, 1,
+                              replacement->uses_access_times());
+    process_map[pid] = process;
+  }
+  for (int frame = 0; frame < frame_count; ++frame) {
+    int pid = frame / PAGES_PER_PROCESS + 1;
+    int page = frame % PAGES_PER_PROCESS;
+    frames.push_back({frame, pid, page, true});
+    auto &entry = process_map[pid]->page_table[page];
+    entry.set_valid(true);
+    entry.set_frame_number(frame);
+    replacement->on_page_access(frame);
+  }
+  for (const auto &[pid, process] : process_map)
+    replacement->on_process_referenced(*process, false);
+
+  int time = 0;
+  for (auto _ : state) {
+    int victim = replacement->select_victim(frames, process_map, time);
+    if (victim >= 0) {
+      Process &owner = *process_map[frames[victim].process_id];
+      replacement->on_frame_release(victim);
+      owner.page_table.touch(frames[victim].page_id, time);
+      replacement->on_page_access(victim);
+      replacement->on_process_referenced(owner, false);
+    } else {
+      state.SkipWithError("Sin víctima con la memoria llena");
+      break;
+    }
+    ++time;
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+const bool registered = [] {
+  for (const auto &name : replacement_registry().names()) {
+    benchmark::RegisterBenchmark(("BM_SelectVictim/" + name).c_str(),
+                                 BM_SelectVictim, name)
+        ->RangeMultiplier(16)
+        ->Range(64, 16384);
+  }
+  return true;
+}();
+
+} // namespace
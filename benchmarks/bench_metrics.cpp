@@ -0,0 +1,52 @@
+/**
+ * @file bench_metrics.cpp
+ * @brief Benchmarks del registro de métricas por tick.
+ */
+
+#include "metrics/metrics_collector.hpp"
+#include <benchmark/benchmark.h>
+#include <numeric>
+#include <vector>
+
+using namespace OSSimulator;
+
+namespace {
+
+/**
+ * Registra un tick típico (CPU, transición y cola de N procesos) y deja que
+ * MetricsCollector serialice y escriba los ticks que salen de la ventana.
+ * El segundo argumento elige la traza JSONL (0) o binaria (1).
+ */
+void BM_MetricsTick(benchmark::State &state) {
+  const auto queue_length = static_cast<size_t>(state.range(0));
+  auto format = state.range(1) == 0 ? MetricsCollector::TraceFormat::JSONL
+                                    : MetricsCollector::TraceFormat::BINARY;
+  MetricsCollector metrics;
+  if (!metrics.enable_file_output("/dev/null", format)) {
+    state.SkipWithError("No se pudo abrir /dev/null");
+    return;
+  }
+
+  std::vector<int> ready(queue_length);
+  std::iota(ready.begin(), ready.end(), 1);
+  const std::vector<int> blocked;
+  const NameId name = name_table().intern("P1");
+
+  int tick = 0;
+  for (auto _ : state) {
+    metrics.log_cpu(tick, "EXEC", 1, name, 5, ready.size(), tick % 4 == 0);
+    if (tick % 4 == 0)
+      metrics.log_state_transition(tick, 1, name, ProcessState::READY,
+                                   ProcessState::RUNNING, "dispatched");
+    metrics.log_queue_snapshot(tick, ready, blocked, blocked, 1);
+    ++tick;
+  }
+  metrics.flush_all();
+  metrics.disable_output();
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_MetricsTick)
+    ->ArgsProduct({{16, 256, 4096}, {0, 1}})
+    ->ArgNames({"queue", "binary"});
+
+} // namespace
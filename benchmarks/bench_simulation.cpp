@@ -0,0 +1,51 @@
+/**
+ * @file bench_simulation.cpp
+ * @brief Benchmark de la simulación completa: ticks simulados por segundo
+ * para cada combinación de algoritmo de CPU y de reemplazo.
+ */
+
+#include "bench_workload.hpp"
+#include <benchmark/benchmark.h>
+
+using namespace OSSimulator;
+
+namespace {
+
+constexpr size_t PROCESS_COUNT = 500;
+
+void BM_Simulation(benchmark::State &state, const std::string &cpu,
+                   const std::string &replacement) {
+  SimulatorConfig config;
+  config.scheduling_algorithm = cpu;
+  config.page_replacement_algorithm = replacement;
+  config.total_memory_frames = 64;
+
+  int64_t ticks = 0;
+  for (auto _ : state) {
+    state.PauseTiming();
+    auto sim = std::make_unique<BenchSimulation>(
+        config, make_workload(PROCESS_COUNT));
+    state.ResumeTiming();
+    sim->scheduler.run_until_completion();
+    ticks += sim->scheduler.get_current_time();
+    state.PauseTiming();
+    sim.reset();
+    state.ResumeTiming();
+  }
+  state.counters["ticks"] =
+      benchmark::Counter(static_cast<double>(ticks), benchmark::Counter::kIsRate);
+}
+
+const bool registered = [] {
+  for (const auto &cpu : cpu_scheduler_registry().names()) {
+    for (const auto &replacement : replacement_registry().names()) {
+      benchmark::RegisterBenchmark(
+          ("BM_Simulation/" + cpu + "/" + replacement).c_str(), BM_Simulation,
+          cpu, replacement)
+          ->Unit(benchmark::kMillisecond);
+    }
+  }
+  return true;
+}();
+
+} // namespace
@@ -0,0 +1,85 @@
+/**
+ * @file bench_workload.hpp
+ * @brief Cargas y simulaciones compartidas por los benchmarks.
+ */
+
+#ifndef BENCH_WORKLOAD_HPP
+#define BENCH_WORKLOAD_HPP
+
+#include "core/config_parser.hpp"
+#include "core/policy_registry.hpp"
+#include "core/workload_generator.hpp"
+#include "cpu/cpu_scheduler.hpp"
+#include "io/io_device.hpp"
+#include "io/io_manager.hpp"
+#include "memory/memory_manager.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string_view>
+#include <vector>
+
+namespace OSSimulator {
+
+/**
+ * Genera una carga sintética reproducible.
+ *
+ * @param count Procesos a generar.
+ * @param arrival_rate Llegadas promedio por tick.
+ * @param seed Semilla del generador.
+ * @return Procesos en orden de llegada.
+ */
+inline std::vector<std::shared_ptr<Process>>
+make_workload(size_t count, double arrival_rate = 0.06, uint32_t seed = 1) {
+  WorkloadSpec spec;
+  spec.processes = count;
+  spec.arrival_rate = arrival_rate;
+  spec.seed = seed;
+  WorkloadGenerator generator(spec);
+  std::vector<std::shared_ptr<Process>> processes;
+  processes.reserve(count);
+  std::string_view line;
+  while (generator.next_line(line))
+    processes.push_back(ConfigParser::parse_process_line(line));
+  return processes;
+}
+
+/**
+ * Simulación completa armada como en main, en modo inline y sin métricas.
+ */
+struct BenchSimulation {
+  CPUScheduler scheduler;
+  std::shared_ptr<MemoryManager> memory_manager;
+  std::shared_ptr<IOManager> io_manager;
+
+  BenchSimulation(const SimulatorConfig &config,
+                  const std::vector<std::shared_ptr<Process>> &processes) {
+    scheduler.set_execution_mode(ExecutionMode::INLINE);
+    scheduler.set_event_driven(config.simulation_engine == "event");
+    scheduler.set_scheduler(
+        cpu_scheduler_registry().create(config.scheduling_algorithm, config));
+
+    memory_manager = std::make_shared<MemoryManager>(
+        config.total_memory_frames,
+        replacement_registry().create(config.page_replacement_algorithm,
+                                      config),
+        1);
+
+    IODeviceConfig disk{"disk", config.io_scheduling_algorithm,
+                        config.io_quantum, 1, config.io_seek_speed,
+                        config.io_cylinders};
+    auto device = std::make_shared<IODevice>("disk");
+    device->set_scheduler(
+        io_scheduler_registry().create(disk.scheduling_algorithm, disk));
+    io_manager = std::make_shared<IOManager>();
+    io_manager->add_device("disk", device);
+
+    scheduler.set_memory_manager(memory_manager);
+    scheduler.set_io_manager(io_manager);
+    scheduler.load_processes(processes);
+  }
+};
+
+} // namespace OSSimulator
+
+#endif // BENCH_WORKLOAD_HPP
@@ -30,6 +30,7 @@
               gdb
               ninja
               cmake
+              gbenchmark
               just
               plantuml
               inkscape
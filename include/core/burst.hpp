@@ -1,6 +1,7 @@
 #ifndef BURST_HPP
 #define BURST_HPP
 
+#include "core/tick.hpp"
 #include <string>
 
 namespace OSSimulator {
@@ -8,7 +9,7 @@ namespace OSSimulator {
 /**
  * Tipos de ráfaga que puede tener un proceso.
  */
-enum class BurstType {
+enum class BurstType : uint8_t {
   CPU, //!< Ráfaga de CPU
   IO   //!< Ráfaga de E/S
 };
@@ -17,10 +18,11 @@ enum class BurstType {
  * Representa una ráfaga de CPU o E/S de un proceso.
  */
 struct Burst {
-  BurstType type;        //!< Tipo de ráfaga (CPU o IO).
-  int duration;          //!< Duración total de la ráfaga.
-  int remaining_time;    //!< Tiempo restante para completar la ráfaga.
+  Tick duration;         //!< Duración total de la ráfaga.
+  Tick remaining_time;   //!< Tiempo restante para completar la ráfaga.
   std::string io_device; //!< Nombre del dispositivo de E/S (si aplica).
+  int cylinder;          //!< Cilindro destino de la E/S (si aplica).
+  BurstType type;        //!< Tipo de ráfaga (CPU o IO).
 
   /**
    * Constructor por defecto.
@@ -32,8 +34,9 @@ struct Burst {
    * @param t Tipo de ráfaga.
    * @param d Duración de la ráfaga.
    * @param device Nombre del dispositivo de E/S (opcional).
+   * @param cyl Cilindro destino de la E/S (opcional).
    */
-  Burst(BurstType t, int d, const std::string &device = "");
+  Burst(BurstType t, Tick d, const std::string &device = "", int cyl = 0);
 
   /**
    * Indica si la ráfaga ha finalizado.
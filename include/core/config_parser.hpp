@@ -3,23 +3,89 @@
 
 #include "core/burst.hpp"
 #include "core/process.hpp"
+#include "core/workload_generator.hpp"
 #include <memory>
 #include <string>
+#include <string_view>
+#include <utility>
 #include <vector>
 
 namespace OSSimulator {
 
+/**
+ * Declaración de un dispositivo de E/S en la configuración.
+ */
+struct IODeviceConfig {
+  std::string name;                          //!< Nombre usado en E/S[nombre](n).
+  std::string scheduling_algorithm = "FCFS"; //!< Algoritmo (FCFS, SCAN, ...).
+  int quantum = 4;      //!< Quantum para Round Robin de E/S.
+  int service_rate = 1; //!< Unidades de ráfaga atendidas por tick.
+  int seek_speed = 0;   //!< Cilindros recorridos por tick (0 = sin búsqueda).
+  int cylinders = 200;  //!< Cilindros del disco para SCAN y C-SCAN.
+};
+
 /**
  * Parámetros de configuración del simulador.
  */
 struct SimulatorConfig {
   int total_memory_frames = 0;
   int frame_size = 4096;
+  int huge_page_size = 0;   //!< Bytes por página grande (0 = sin páginas grandes).
+  int huge_page_frames = 0; //!< Marcos grandes reservados de la memoria.
   std::string scheduling_algorithm;
   std::string page_replacement_algorithm;
   std::string io_scheduling_algorithm = "FCFS";
   int quantum = 4;
+  int priority_aging_interval = 0; //!< Ticks de espera por nivel (0 = no).
+  std::vector<int> mlfq_quanta = {2, 4, 8}; //!< Quantum de cada nivel MLFQ.
+  int mlfq_boost_interval = 50; //!< Ticks entre elevaciones MLFQ (0 = nunca).
+  int cfs_target_latency = 12;  //!< Periodo objetivo de CFS en ticks.
+  int cfs_min_granularity = 2;  //!< Turno mínimo de CFS en ticks.
+  std::string sjf_prediction = "oracle"; //!< oracle o exponential.
+  double sjf_alpha = 0.5;       //!< Peso de la última ráfaga en la predicción.
+  int sjf_initial_estimate = 5; //!< Estimación de la primera ráfaga en ticks.
   int io_quantum = 4;
+  int io_seek_speed = 0;  //!< Velocidad del cabezal de "disk" (0 = sin búsqueda).
+  int io_cylinders = 200; //!< Cilindros de "disk".
+  int io_merge_limit = 0; //!< Unidades máximas al fusionar solicitudes (0 = sin fusión).
+  std::string execution_mode = "threaded"; //!< "threaded" o "inline".
+  std::string simulation_engine = "tick";  //!< "tick" o "event".
+  std::string core_locking = "none";       //!< "none" o "coarse".
+  std::string process_loading = "eager";   //!< "eager" o "stream".
+  uint32_t replacement_seed = 0; //!< Semilla de los reemplazos aleatorios (NRU).
+  int working_set_window = 10;   //!< Ventana del conjunto de trabajo (WSClock).
+  int page_fault_channels = 1;   //!< Cargas de página simultáneas.
+  int page_prefetch = 0;         //!< Páginas por lote de carga (0 = sin precarga).
+  std::string paging_mode = "full"; //!< "full" (proceso completo) o "demand".
+  int locality_window = 4; //!< Páginas de la ventana de localidad (demand).
+  int locality_shift = 8;  //!< Accesos entre desplazamientos de la ventana.
+  std::string load_control = "none"; //!< "none" o "working_set".
+  int tlb_entries = 0;               //!< Entradas de la TLB (0 = sin TLB).
+  int tlb_ways = 4;                  //!< Entradas por conjunto de la TLB.
+  std::string tlb_mode = "flush";    //!< "flush" o "asid".
+  int numa_nodes = 1;                //!< Nodos de memoria (1 = sin NUMA).
+  std::string numa_policy = "first_touch"; //!< first_touch, interleave o bind.
+  int numa_remote_latency = 0;       //!< Ticks extra de un acceso remoto.
+  size_t metrics_buffer_size = 65536; //!< Búfer de métricas en bytes (0 = sin búfer).
+  std::string metrics_writer = "sync";       //!< "sync" o "async".
+  std::string metrics_backpressure = "block"; //!< "block" o "drop".
+  size_t metrics_queue_capacity = 16384;      //!< Eventos en la cola asíncrona.
+  int metrics_keyframe_interval = 50; //!< Ticks entre instantáneas completas de memoria.
+  std::string metrics_categories = "all"; //!< Categorías registradas, separadas por comas.
+  int metrics_sample_rate = 1;            //!< Se registra 1 de cada N ticks.
+  std::vector<int> metrics_aggregate_windows; //!< Anchos de las series agregadas (vacío = no).
+  std::string metrics_aggregate_file; //!< Archivo de las series (vacío = junto a las métricas).
+  int cpu_cores = 1;           //!< Núcleos de CPU simulados.
+  int core_migration_cost = 0; //!< Ticks perdidos al cambiar de núcleo.
+  Tick checkpoint_tick = 0;    //!< Tick en que se guarda el punto de control.
+  std::string checkpoint_file; //!< Punto de control a guardar (vacío = no).
+  std::string restore_file;    //!< Punto de control del que continuar.
+  std::string profile_trace_file; //!< Traza de perfilado de Chrome (vacío = no).
+  int live_metrics_interval = 0; //!< Milisegundos entre muestras en vivo (0 = no).
+  std::string live_metrics_file; //!< Archivo de Prometheus (vacío = línea de resumen).
+  std::string result_cache_dir; //!< Directorio de la caché de resultados (vacío = no).
+  uint64_t result_cache_max_bytes = 256u << 20; //!< Tamaño máximo de la caché.
+  std::vector<IODeviceConfig> io_devices; //!< Dispositivos declarados; "disk" existe siempre.
 };
 
 /**
@@ -32,7 +98,8 @@ public:
   /**
    * Carga procesos desde un archivo de texto.
    * Formato esperado: PID tiempo_llegada rafagas prioridad paginas_requeridas
-   * Ejemplo: P1 0 CPU(4),E/S(3),CPU(5) 1 4
+   * [rastro_de_accesos]
+   * Ejemplo: P1 0 CPU(4),E/S(3),CPU(5) 1 4 0,1,2,1,3
    *
    * @param filename Ruta del archivo de procesos.
    * @return Vector de procesos cargados.
@@ -47,24 +114,132 @@ public:
    */
   static SimulatorConfig load_simulator_config(const std::string &filename);
 
+  /**
+   * Asigna un parámetro de configuración a partir de su clave.
+   * @param config Configuración a modificar.
+   * @param key Nombre del parámetro, como en el archivo de configuración.
+   * @param value Valor en texto.
+   * @return false si la clave no es reconocida.
+   */
+  static bool apply_config_value(SimulatorConfig &config,
+                                 const std::string &key,
+                                 const std::string &value);
+
+  /**
+   * Carga una rejilla de parámetros para un barrido. Cada línea tiene la
+   * forma clave=valor1,valor2,... con las claves del archivo de
+   * configuración.
+   * Ejemplo: scheduling_algorithm=FCFS,SJF,RoundRobin
+   *
+   * @param filename Ruta del archivo de la rejilla.
+   * @return Parámetros con sus valores, en el orden del archivo.
+   */
+  static std::vector<std::pair<std::string, std::vector<std::string>>>
+  load_parameter_grid(const std::string &filename);
+
+  /**
+   * Parsea la parte de un barrido que ejecuta una máquina.
+   * Formato: i/N, con 0 <= i < N (por ejemplo 2/8 es la tercera de ocho).
+   * @param value Cadena con la parte.
+   * @param index Recibe el índice de la parte.
+   * @param count Recibe el número de partes.
+   * @return false si el formato es inválido.
+   */
+  static bool parse_shard(std::string_view value, int &index, int &count);
+
   /**
    * Parsea una línea de proceso individual.
    * @param line Línea de texto con información del proceso.
    * @return Proceso creado o nullptr si la línea es inválida.
    */
-  static std::shared_ptr<Process> parse_process_line(const std::string &line);
+  static std::shared_ptr<Process> parse_process_line(std::string_view line);
 
   /**
    * Parsea la secuencia de ráfagas de un proceso.
-   * Formato: CPU(4),E/S(3),CPU(5)
+   * Formato: CPU(4),E/S(3),CPU(5),E/S[nvme0](2),E/S[disk@120](6)
    * @param burst_str Cadena con la secuencia de ráfagas.
    * @return Vector de ráfagas parseadas.
    */
-  static std::vector<Burst> parse_burst_sequence(const std::string &burst_str);
+  static std::vector<Burst> parse_burst_sequence(std::string_view burst_str);
+
+  /**
+   * Parsea el rastro de accesos a memoria de un proceso.
+   * Formato: 0,1w,2,1,3 (índices de página separados por comas; la w final
+   * marca un acceso de escritura).
+   * @param trace_str Cadena con el rastro de accesos.
+   * @param writes Si no es nulo, recibe qué accesos escriben; queda vacío si
+   * ninguno lo hace.
+   * @return Vector de índices de página, vacío si el formato es inválido.
+   */
+  static std::vector<int>
+  parse_access_trace(std::string_view trace_str,
+                     std::vector<bool> *writes = nullptr);
+
+  /**
+   * Parsea el mapeo de una región compartida en un proceso.
+   * Formato: nombre@página:cantidad (por ejemplo libc@4:2 mapea las páginas
+   * 4 y 5 del proceso a las páginas 0 y 1 de la región libc).
+   * @param token Cadena con el mapeo.
+   * @param mapping Mapeo leído.
+   * @return false si el formato es inválido.
+   */
+  static bool parse_shared_mapping(std::string_view token,
+                                   SharedMapping &mapping);
+
+  /**
+   * Parsea la declaración de un dispositivo de E/S.
+   * Formato: nombre[:algoritmo[:quantum[:tasa[:velocidad[:cilindros]]]]]
+   * Ejemplo: nvme0:RoundRobin:4:2, hdd1:SCAN:4:1:50:500
+   * @param value Valor de la clave io_device.
+   * @return Dispositivo declarado.
+   */
+  static IODeviceConfig parse_io_device(const std::string &value);
+
+  /**
+   * Parsea los quanta de los niveles MLFQ.
+   * Formato: 2:4:8 (del nivel más prioritario al menos).
+   * @param value Valor de la clave mlfq_quanta.
+   * @return Quantum de cada nivel.
+   */
+  static std::vector<int> parse_mlfq_quanta(const std::string &value);
+
+  /**
+   * Parsea los anchos de ventana de las series agregadas.
+   * @param value Cadena con formato "w0:w1:...:wn"; "0" o vacía las desactiva.
+   * @return Anchos de ventana en ticks.
+   */
+  static std::vector<int> parse_aggregate_windows(const std::string &value);
+
+  /**
+   * Carga los parámetros de una carga sintética para WorkloadGenerator.
+   * Cada línea tiene la forma clave=valor.
+   * Ejemplo: arrival=bursty, cpu_burst=exponential:6, pages=uniform:1:8
+   *
+   * @param filename Ruta del archivo de la carga.
+   * @return Parámetros de la carga.
+   */
+  static WorkloadSpec load_workload_spec(const std::string &filename);
+
+  /**
+   * Asigna un parámetro de la carga sintética a partir de su clave.
+   * @param spec Parámetros a modificar.
+   * @param key Nombre del parámetro, como en el archivo de la carga.
+   * @param value Valor en texto.
+   * @return false si la clave no es reconocida.
+   */
+  static bool apply_workload_value(WorkloadSpec &spec, const std::string &key,
+                                   const std::string &value);
+
+  /**
+   * Parsea la distribución de un parámetro de la carga sintética.
+   * Formato: constant:n, uniform:min:max, exponential:media o n.
+   * @param value Valor de la clave.
+   * @return Distribución parseada.
+   */
+  static Distribution parse_distribution(const std::string &value);
 
 private:
   static std::string trim(const std::string &str);
-  static bool starts_with(const std::string &str, const std::string &prefix);
 };
 
 } // namespace OSSimulator
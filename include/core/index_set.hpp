@@ -0,0 +1,112 @@
+#ifndef INDEX_SET_HPP
+#define INDEX_SET_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <vector>
+
+namespace OSSimulator {
+
+/**
+ * Conjunto de índices densos sobre un mapa de bits.
+ *
+ * Sustituye a std::set<size_t> cuando los índices son posiciones de una
+ * tabla: insertar y eliminar no reservan memoria salvo al crecer la tabla, y
+ * el recorrido sigue en orden ascendente. Eliminar el índice actual durante
+ * un recorrido es válido, ya que el iterador busca el siguiente a partir de
+ * su posición.
+ */
+class IndexSet {
+private:
+  std::vector<uint64_t> words; //!< Un bit por índice.
+  size_t count = 0;            //!< Índices presentes.
+
+public:
+  /// Valor de next() cuando no quedan índices.
+  static constexpr size_t npos = static_cast<size_t>(-1);
+
+  class const_iterator {
+  private:
+    const IndexSet *set = nullptr;
+    size_t index = npos;
+
+  public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = size_t;
+    using difference_type = std::ptrdiff_t;
+    using pointer = const size_t *;
+    using reference = size_t;
+
+    const_iterator() = default;
+    const_iterator(const IndexSet *set, size_t index)
+        : set(set), index(index) {}
+
+    size_t operator*() const { return index; }
+    const_iterator &operator++() {
+      index = set->next(index + 1);
+      return *this;
+    }
+    const_iterator operator++(int) {
+      const_iterator copy = *this;
+      ++*this;
+      return copy;
+    }
+    bool operator==(const const_iterator &other) const {
+      return index == other.index;
+    }
+    bool operator!=(const const_iterator &other) const {
+      return index != other.index;
+    }
+  };
+
+  /**
+   * Agrega un índice.
+   *
+   * @param index Índice a agregar.
+   * @return true si no estaba presente.
+   */
+  bool insert(size_t index);
+
+  /**
+   * Elimina un índice.
+   *
+   * @param index Índice a eliminar.
+   * @return true si estaba presente.
+   */
+  bool erase(size_t index);
+
+  bool contains(size_t index) const {
+    return index / 64 < words.size() &&
+           (words[index / 64] >> (index % 64) & 1ULL) != 0;
+  }
+
+  /**
+   * Obtiene el menor índice presente mayor o igual que uno dado.
+   *
+   * @param from Índice desde el que se busca.
+   * @return Índice encontrado o npos.
+   */
+  size_t next(size_t from) const;
+
+  size_t size() const { return count; }
+  bool empty() const { return count == 0; }
+
+  /// Vacía el conjunto conservando la capacidad.
+  void clear();
+
+  /**
+   * Reserva espacio para los índices menores que un límite, de modo que
+   * insertarlos no reserve memoria.
+   *
+   * @param limit Límite de los índices.
+   */
+  void reserve(size_t limit);
+
+  const_iterator begin() const { return const_iterator(this, next(0)); }
+  const_iterator end() const { return const_iterator(this, npos); }
+};
+
+} // namespace OSSimulator
+
+#endif // INDEX_SET_HPP
@@ -0,0 +1,63 @@
+#ifndef NAME_TABLE_HPP
+#define NAME_TABLE_HPP
+
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+namespace OSSimulator {
+
+/// Identificador de un nombre internado en NameTable.
+using NameId = uint32_t;
+
+/**
+ * Tabla de nombres internados.
+ *
+ * Los nombres de procesos y dispositivos se internan una vez al crearlos y
+ * el registro de métricas trabaja con su identificador; la cadena solo se
+ * recupera al serializar. La tabla solo crece, así que un identificador y la
+ * referencia que devuelve name() siguen siendo válidos mientras exista.
+ */
+class NameTable {
+public:
+  static constexpr NameId EMPTY = 0; //!< Identificador de la cadena vacía.
+
+  NameTable();
+
+  /**
+   * Obtiene el identificador de un nombre, agregándolo si no existía.
+   *
+   * @param name Nombre a internar.
+   * @return Identificador del nombre.
+   */
+  NameId intern(const std::string &name);
+
+  /**
+   * Obtiene el nombre de un identificador.
+   *
+   * @param id Identificador devuelto por intern().
+   * @return Nombre internado; la cadena vacía si el identificador no existe.
+   */
+  const std::string &name(NameId id) const;
+
+  /// Cantidad de nombres internados, incluida la cadena vacía.
+  size_t size() const;
+
+private:
+  mutable std::mutex mutex;
+  std::deque<std::string> names; //!< Las referencias no se invalidan al crecer.
+  std::unordered_map<std::string, NameId> ids;
+};
+
+/**
+ * Obtiene la tabla de nombres compartida por el simulador.
+ *
+ * @return Tabla compartida.
+ */
+NameTable &name_table();
+
+} // namespace OSSimulator
+
+#endif // NAME_TABLE_HPP
@@ -0,0 +1,110 @@
+#ifndef POLICY_REGISTRY_HPP
+#define POLICY_REGISTRY_HPP
+
+#include "core/config_parser.hpp"
+#include "cpu/scheduler.hpp"
+#include "io/io_scheduler.hpp"
+#include "memory/replacement_algorithm.hpp"
+#include <functional>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace OSSimulator {
+
+/**
+ * Registro de políticas por nombre.
+ *
+ * Asocia el nombre usado en el archivo de configuración con una fábrica que
+ * construye la política a partir de sus parámetros. Una política nueva se
+ * agrega registrando su fábrica, sin tocar el simulador: el bucle principal
+ * solo usa la interfaz virtual de la política.
+ *
+ * @tparam Policy Interfaz de la política (Scheduler, IOScheduler, ...).
+ * @tparam Params Parámetros que recibe la fábrica.
+ */
+template <typename Policy, typename Params> class PolicyRegistry {
+public:
+  using Factory = std::function<std::unique_ptr<Policy>(const Params &)>;
+
+  /**
+   * Registra una fábrica; si el nombre ya existía, la reemplaza.
+   *
+   * @param name Nombre de la política en la configuración.
+   * @param factory Fábrica que construye la política.
+   */
+  void add(const std::string &name, Factory factory) {
+    factories[name] = std::move(factory);
+  }
+
+  /**
+   * Indica si hay una política registrada con ese nombre.
+   *
+   * @param name Nombre de la política.
+   * @return true si está registrada.
+   */
+  bool contains(const std::string &name) const {
+    return factories.count(name) > 0;
+  }
+
+  /**
+   * Construye una política.
+   *
+   * @param name Nombre de la política.
+   * @param params Parámetros para la fábrica.
+   * @return Política nueva, o nullptr si el nombre no está registrado.
+   */
+  std::unique_ptr<Policy> create(const std::string &name,
+                                 const Params &params) const {
+    auto it = factories.find(name);
+    return it != factories.end() ? it->second(params) : nullptr;
+  }
+
+  /**
+   * Obtiene los nombres registrados, en orden alfabético.
+   *
+   * @return Nombres de las políticas.
+   */
+  std::vector<std::string> names() const {
+    std::vector<std::string> result;
+    for (const auto &entry : factories)
+      result.push_back(entry.first);
+    return result;
+  }
+
+private:
+  std::map<std::string, Factory> factories; //!< Fábricas por nombre.
+};
+
+using CPUSchedulerRegistry = PolicyRegistry<Scheduler, SimulatorConfig>;
+using ReplacementRegistry = PolicyRegistry<ReplacementAlgorithm, SimulatorConfig>;
+using IOSchedulerRegistry = PolicyRegistry<IOScheduler, IODeviceConfig>;
+
+/**
+ * Obtiene el registro de planificadores de CPU (scheduling_algorithm), con
+ * los algoritmos del simulador ya registrados.
+ *
+ * @return Registro compartido.
+ */
+CPUSchedulerRegistry &cpu_scheduler_registry();
+
+/**
+ * Obtiene el registro de algoritmos de reemplazo de páginas
+ * (page_replacement_algorithm), con los del simulador ya registrados.
+ *
+ * @return Registro compartido.
+ */
+ReplacementRegistry &replacement_registry();
+
+/**
+ * Obtiene el registro de planificadores de E/S (io_scheduling_algorithm y
+ * algoritmo de io_device), con los del simulador ya registrados.
+ *
+ * @return Registro compartido.
+ */
+IOSchedulerRegistry &io_scheduler_registry();
+
+} // namespace OSSimulator
+
+#endif // POLICY_REGISTRY_HPP
@@ -2,7 +2,8 @@
 #define PROCESS_HPP
 
 #include "core/burst.hpp"
-#include "memory/page.hpp"
+#include "core/name_table.hpp"
+#include "memory/page_table.hpp"
 #include <atomic>
 #include <condition_variable>
 #include <cstdint>
@@ -14,10 +15,13 @@
 
 namespace OSSimulator {
 
+class SnapshotReader;
+class SnapshotWriter;
+
 /**
  * Estados posibles de un proceso en la simulación.
  */
-enum class ProcessState {
+enum class ProcessState : uint8_t {
   NEW,            //!< Proceso recién creado.
   READY,          //!< Proceso listo para ejecutarse.
   MEMORY_WAITING, //!< Proceso bloqueado esperando carga de páginas.
@@ -26,6 +30,19 @@ enum class ProcessState {
   TERMINATED      //!< Proceso terminado.
 };
 
+/**
+ * Mapeo de una región de memoria compartida en el espacio de un proceso.
+ *
+ * Los procesos que mapean la misma región por nombre (una biblioteca
+ * compartida, o los trabajadores creados con fork a partir de un mismo
+ * padre) comparten los marcos de sus páginas hasta que la escriben.
+ */
+struct SharedMapping {
+  std::string region; //!< Nombre de la región compartida.
+  int first_page;     //!< Primera página del proceso mapeada a la región.
+  int pages;          //!< Páginas mapeadas, desde la página 0 de la región.
+};
+
 /**
  * Representa un proceso dentro de la simulación del sistema operativo.
  * Esta estructura contiene toda la información relevante sobre un proceso,
@@ -34,30 +51,35 @@ enum class ProcessState {
  *
  */
 struct Process {
-  int pid;             //!< Identificador único del proceso.
-  std::string name;    //!< Nombre del proceso.
-  int arrival_time;    //!< Tiempo de llegada del proceso.
-  int burst_time;      //!< Duración total de la ráfaga del proceso.
-  int remaining_time;  //!< Tiempo restante para completar la ráfaga.
-  int completion_time; //!< Tiempo en que el proceso finaliza su ejecución.
-  int waiting_time;    //!< Tiempo que el proceso ha estado esperando.
-  int turnaround_time; //!< Tiempo total desde la llegada hasta la finalización.
-  int response_time;   //!< Tiempo desde la llegada hasta la primera ejecución.
-  int start_time;      //!< Tiempo en que el proceso comienza su ejecución.
-  int priority;        //!< Prioridad del proceso.
+  int pid;              //!< Identificador único del proceso.
+  int priority;         //!< Prioridad del proceso.
+  std::string name;     //!< Nombre del proceso.
+  NameId name_id;       //!< Nombre internado al construir, para las métricas.
   std::atomic<ProcessState> state; //!< Estado actual del proceso.
   bool
       first_execution; //!< Indica si el proceso ha sido ejecutado por primera vez.
-  int last_execution_time;  //!< Último tiempo en que el proceso fue ejecutado.
+  bool memory_allocated; //!< Indica si la memoria ha sido asignada.
+  Tick arrival_time;     //!< Tiempo de llegada del proceso.
+  Tick burst_time;       //!< Duración total de la ráfaga del proceso.
+  Tick remaining_time;   //!< Tiempo restante para completar la ráfaga.
+  Tick completion_time;  //!< Tiempo en que el proceso finaliza su ejecución.
+  Tick waiting_time;     //!< Tiempo que el proceso ha estado esperando.
+  Tick turnaround_time;  //!< Tiempo total desde la llegada hasta el final.
+  Tick response_time;    //!< Tiempo hasta la primera ejecución.
+  Tick start_time;       //!< Tiempo en que el proceso comienza su ejecución.
+  Tick last_execution_time; //!< Último tiempo en que el proceso fue ejecutado.
   uint32_t memory_required; //!< Memoria requerida por el proceso.
   uint32_t memory_base;     //!< Dirección base de la memoria asignada.
-  bool memory_allocated;    //!< Indica si la memoria ha sido asignada.
 
-  std::vector<Page> page_table; //!< Tabla de páginas asignadas al proceso.
+  PageTable page_table; //!< Tabla de páginas asignadas al proceso.
   std::vector<int>
       memory_access_trace; //!< Rastro de accesos a memoria (índices de página).
   size_t current_access_index =
       0; //!< Índice actual dentro del rastro de accesos.
+  std::vector<bool>
+      memory_write_trace; //!< Accesos del rastro que escriben la página.
+  std::vector<SharedMapping>
+      shared_mappings; //!< Regiones compartidas mapeadas por el proceso.
 
   int page_faults = 0;        //!< Contador de fallos de página del proceso.
   int replacements = 0;       //!< Contador de reemplazos de páginas realizados.
@@ -66,8 +88,8 @@ struct Process {
   std::vector<Burst>
       burst_sequence;         //!< Secuencia de ráfagas (CPU/E/S) del proceso.
   size_t current_burst_index; //!< Índice de la ráfaga actual.
-  int total_cpu_time;         //!< Tiempo total consumido por CPU.
-  int total_io_time;          //!< Tiempo total consumido en E/S.
+  Tick total_cpu_time;        //!< Tiempo total consumido por CPU.
+  Tick total_io_time;         //!< Tiempo total consumido en E/S.
   std::unique_ptr<std::thread> process_thread; //!< Hilo asociado al proceso.
   mutable std::mutex process_mutex; //!< Mutex para sincronización del proceso.
   mutable std::condition_variable
@@ -111,7 +133,7 @@ struct Process {
    * @param prio Prioridad del proceso.
    * @param mem Memoria requerida por el proceso.
    */
-  Process(int p, const std::string &n, int arrival, int burst, int prio = 0,
+  Process(int p, const std::string &n, Tick arrival, Tick burst, int prio = 0,
           uint32_t mem = 0);
 
   /**
@@ -123,7 +145,7 @@ struct Process {
    * @param prio Prioridad del proceso.
    * @param mem Memoria requerida por el proceso.
    */
-  Process(int p, const std::string &n, int arrival,
+  Process(int p, const std::string &n, Tick arrival,
           const std::vector<Burst> &bursts, int prio = 0, uint32_t mem = 0);
 
   Process(const Process &other) = delete;
@@ -148,7 +170,7 @@ struct Process {
    * @param current_time Tiempo actual de la simulación.
    * @return true si el proceso ha llegado, false en caso contrario.
    */
-  bool has_arrived(int current_time) const;
+  bool has_arrived(Tick current_time) const;
 
   /**
    * Verifica si el proceso ha completado su ejecución.
@@ -164,13 +186,29 @@ struct Process {
    * @param current_time Tiempo actual de la simulación.
    * @return Tiempo realmente ejecutado.
    */
-  int execute(int quantum, int current_time);
+  Tick execute(Tick quantum, Tick current_time);
 
   /**
    * Reinicia el estado del proceso.
    */
   void reset();
 
+  /**
+   * Guarda el progreso del proceso en una instantánea: estado, tiempos,
+   * avance de cada ráfaga, del rastro de accesos y la tabla de páginas. Los
+   * datos de entrada (nombre, llegada, ráfagas y rastro) no se guardan.
+   *
+   * @param out Instantánea de destino.
+   */
+  void save_state(SnapshotWriter &out) const;
+
+  /**
+   * Restaura el progreso guardado con save_state(). No modifica el hilo.
+   *
+   * @param in Instantánea de origen.
+   */
+  void load_state(SnapshotReader &in);
+
   /**
    * Verifica si el proceso tiene más ráfagas por ejecutar.
    *
@@ -216,7 +254,7 @@ struct Process {
    *
    * @return Tiempo total de ráfaga.
    */
-  int get_total_burst_time() const;
+  Tick get_total_burst_time() const;
 
   /**
    * Destructor del proceso.
@@ -0,0 +1,102 @@
+#ifndef PROCESS_STREAM_HPP
+#define PROCESS_STREAM_HPP
+
+#include "core/process.hpp"
+#include <cstddef>
+#include <fstream>
+#include <functional>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace OSSimulator {
+
+/**
+ * Lector incremental de un archivo de procesos.
+ *
+ * Lee el archivo por bloques y entrega los procesos de a uno, en el orden del
+ * archivo, sin copiar cada línea. Siempre tiene leído el proceso siguiente,
+ * de modo que se puede consultar su llegada sin consumirlo. Con él el
+ * planificador crea cada proceso recién al llegar su tiempo de llegada, en
+ * lugar de cargar el archivo completo al inicio. Las líneas también pueden
+ * venir de otra fuente, como el generador de cargas sintéticas.
+ */
+class ProcessStream {
+public:
+  using Validator = std::function<void(const Process &)>;
+  using LineSource = std::function<bool(std::string_view &)>;
+
+  /**
+   * Abre el archivo y lee el primer proceso.
+   *
+   * @param filename Ruta del archivo de procesos.
+   * @param validator Función que revisa cada proceso leído y lanza
+   * std::runtime_error si no es válido (opcional).
+   * @throws std::runtime_error Si no se puede abrir el archivo.
+   */
+  explicit ProcessStream(const std::string &filename,
+                         Validator validator = nullptr);
+
+  /**
+   * Lee los procesos de una fuente de líneas en lugar de un archivo, como
+   * WorkloadGenerator::next_line().
+   *
+   * @param source Función que obtiene la próxima línea, válida hasta la
+   * siguiente llamada, y devuelve false al terminar.
+   * @param validator Función que revisa cada proceso leído (opcional).
+   */
+  explicit ProcessStream(LineSource source, Validator validator = nullptr);
+
+  ProcessStream(const ProcessStream &) = delete;
+  ProcessStream &operator=(const ProcessStream &) = delete;
+
+  /**
+   * Entrega el proceso siguiente y lee el posterior.
+   *
+   * @return Proceso, o nullptr si no quedan.
+   */
+  std::shared_ptr<Process> next();
+
+  /**
+   * Obtiene el tiempo de llegada del proceso siguiente sin consumirlo.
+   *
+   * @return Tiempo de llegada, o -1 si no quedan procesos.
+   */
+  Tick peek_arrival() const { return pending ? pending->arrival_time : -1; }
+
+  /**
+   * Indica si ya se entregaron todos los procesos.
+   *
+   * @return true si no quedan procesos.
+   */
+  bool done() const { return pending == nullptr; }
+
+private:
+  /**
+   * Lee el próximo proceso válido del archivo en pending.
+   */
+  void read_pending();
+
+  /**
+   * Obtiene la próxima línea del archivo. La vista es válida hasta la
+   * siguiente llamada.
+   *
+   * @param line Línea sin el salto de línea.
+   * @return false al terminar el archivo.
+   */
+  bool read_line(std::string_view &line);
+
+  std::ifstream file;              //!< Archivo de procesos.
+  std::vector<char> buffer;        //!< Bloque leído del archivo.
+  size_t begin = 0;                //!< Inicio de la línea siguiente.
+  size_t end = 0;                  //!< Fin de los datos del bloque.
+  bool eof = false;                //!< Ya se leyó todo el archivo.
+  LineSource source;               //!< Fuente de líneas (vacía = archivo).
+  Validator validator;             //!< Validación de cada proceso.
+  std::shared_ptr<Process> pending; //!< Proceso siguiente, ya leído.
+};
+
+} // namespace OSSimulator
+
+#endif // PROCESS_STREAM_HPP
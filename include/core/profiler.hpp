@@ -0,0 +1,169 @@
+#ifndef PROFILER_HPP
+#define PROFILER_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace OSSimulator {
+
+/**
+ * Perfilador interno del simulador.
+ *
+ * Acumula, por fase, el número de llamadas y el tiempo real (reloj de pared)
+ * que miden los temporizadores OSSIM_PROFILE_SCOPE, y los contadores
+ * OSSIM_PROFILE_COUNT. Cada hilo registra en su propia tabla, de modo que el
+ * registro no compite entre hilos; el informe suma las tablas de todos.
+ * Opcionalmente guarda cada medición como evento para exportarla en el
+ * formato de trazas de Chrome (chrome://tracing, Perfetto).
+ *
+ * Las macros solo registran si el simulador se compila con OSSIM_PROFILING
+ * (opción ENABLE_PROFILING de CMake); sin ella no generan código.
+ */
+class Profiler {
+public:
+  /// Totales de una fase.
+  struct PhaseStats {
+    std::string name;
+    uint64_t calls = 0;
+    uint64_t total_ns = 0;
+    uint64_t max_ns = 0;
+  };
+
+  /// Valor final de un contador.
+  struct CounterStats {
+    std::string name;
+    uint64_t value = 0;
+  };
+
+  /// Perfilador global, compartido por todos los módulos.
+  static Profiler &instance();
+
+  /// Tiempo monótono en nanosegundos.
+  static uint64_t now_ns();
+
+  Profiler();
+  Profiler(const Profiler &) = delete;
+  Profiler &operator=(const Profiler &) = delete;
+
+  /**
+   * Registra una ejecución de una fase.
+   *
+   * @param phase Nombre de la fase; debe ser un literal, se compara por
+   * dirección.
+   * @param start_ns Inicio según now_ns().
+   * @param end_ns Fin según now_ns().
+   */
+  void record(const char *phase, uint64_t start_ns, uint64_t end_ns);
+
+  /**
+   * Suma a un contador.
+   *
+   * @param counter Nombre del contador; debe ser un literal.
+   * @param amount Cantidad a sumar.
+   */
+  void count(const char *counter, uint64_t amount = 1);
+
+  /**
+   * Guarda también cada medición como evento de traza.
+   *
+   * @param max_events Eventos máximos; los siguientes se descartan y se
+   * cuentan (0 = no guardar eventos).
+   */
+  void enable_trace(size_t max_events);
+
+  /// Fases registradas, de mayor a menor tiempo total.
+  std::vector<PhaseStats> phases() const;
+
+  /// Contadores registrados, por nombre.
+  std::vector<CounterStats> counters() const;
+
+  /// Nanosegundos desde la creación o el último reset().
+  uint64_t elapsed_ns() const;
+
+  /// Eventos de traza que no se guardaron por superar el máximo.
+  uint64_t get_dropped_events() const;
+
+  /**
+   * Imprime el desglose por fase: llamadas, tiempo total, medio y máximo, y
+   * porcentaje del tiempo transcurrido. Las fases anidadas se cuentan
+   * también dentro de la fase que las contiene.
+   *
+   * @param out Flujo de salida.
+   */
+  void print_report(std::ostream &out) const;
+
+  /**
+   * Escribe los eventos guardados en el formato JSON de trazas de Chrome
+   * (eventos completos "X", con tiempos en microsegundos).
+   *
+   * @param filename Ruta del archivo.
+   * @throws std::runtime_error Si no se puede escribir el archivo.
+   */
+  void write_chrome_trace(const std::string &filename) const;
+
+  /// Descarta fases, contadores y eventos, y reinicia el reloj.
+  void reset();
+
+private:
+  struct ThreadLog;
+
+  ThreadLog &local_log();
+
+  const uint64_t id; //!< Identifica las tablas de este perfilador en cada hilo.
+  mutable std::mutex registry_mutex;
+  std::vector<std::shared_ptr<ThreadLog>> thread_logs;
+  std::atomic<size_t> trace_capacity{0};
+  std::atomic<size_t> trace_size{0};
+  std::atomic<uint64_t> dropped_events{0};
+  std::atomic<uint64_t> start_ns{0};
+};
+
+/**
+ * Temporizador de ámbito: mide desde su construcción hasta su destrucción y
+ * lo registra en Profiler::instance().
+ */
+class ScopedTimer {
+public:
+  explicit ScopedTimer(const char *phase)
+      : phase(phase), start(Profiler::now_ns()) {}
+  ~ScopedTimer() { Profiler::instance().record(phase, start, Profiler::now_ns()); }
+
+  ScopedTimer(const ScopedTimer &) = delete;
+  ScopedTimer &operator=(const ScopedTimer &) = delete;
+
+private:
+  const char *phase;
+  uint64_t start;
+};
+
+#ifdef OSSIM_PROFILING
+constexpr bool PROFILING_ENABLED = true;
+#else
+constexpr bool PROFILING_ENABLED = false;
+#endif
+
+} // namespace OSSimulator
+
+#define OSSIM_PROFILE_CONCAT_IMPL(a, b) a##b
+#define OSSIM_PROFILE_CONCAT(a, b) OSSIM_PROFILE_CONCAT_IMPL(a, b)
+
+#ifdef OSSIM_PROFILING
+/// Mide el resto del ámbito actual como la fase @p phase.
+#define OSSIM_PROFILE_SCOPE(phase)                                             \
+  ::OSSimulator::ScopedTimer OSSIM_PROFILE_CONCAT(ossim_profile_scope_,        \
+                                                  __LINE__)(phase)
+/// Suma @p amount al contador @p counter.
+#define OSSIM_PROFILE_COUNT(counter, amount)                                   \
+  ::OSSimulator::Profiler::instance().count(counter, amount)
+#else
+#define OSSIM_PROFILE_SCOPE(phase) static_cast<void>(0)
+#define OSSIM_PROFILE_COUNT(counter, amount) static_cast<void>(0)
+#endif
+
+#endif // PROFILER_HPP
@@ -0,0 +1,151 @@
+#ifndef RESULT_CACHE_HPP
+#define RESULT_CACHE_HPP
+
+#include "core/config_parser.hpp"
+#include "core/process.hpp"
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace OSSimulator {
+
+/// Versión del simulador incluida en las claves de la caché de resultados.
+/// Se incrementa con cada cambio que altere el resultado de una misma
+/// configuración, para que las entradas anteriores dejen de coincidir.
+constexpr const char *SIMULATOR_VERSION = "1.0";
+
+/**
+ * Clave de una entrada de la caché: dos hashes FNV-1a de 64 bits, con bases
+ * distintas, del texto normalizado de la simulación. El primero nombra la
+ * entrada y el segundo se guarda en ella para descartar colisiones.
+ */
+struct CacheKey {
+  uint64_t hash = 0xcbf29ce484222325ULL;  //!< Hash que nombra la entrada.
+  uint64_t check = 0x84222325cbf29ce4ULL; //!< Hash de verificación.
+
+  /**
+   * Agrega texto a la clave.
+   * @param text Texto a agregar.
+   */
+  void add(std::string_view text);
+
+  /**
+   * @return Nombre de la entrada: el primer hash en hexadecimal.
+   */
+  std::string name() const;
+};
+
+/**
+ * Caché de resultados direccionada por contenido.
+ *
+ * Cada entrada guarda el resumen de una simulación y, opcionalmente, su
+ * traza de métricas, bajo la clave de su configuración normalizada, su lista
+ * de procesos y la versión del simulador. Repetir una simulación idéntica
+ * devuelve el resultado guardado sin ejecutarla. Las entradas son archivos
+ * <nombre>.result y <nombre>.trace en un directorio; cuando su tamaño total
+ * supera el límite se eliminan las usadas hace más tiempo.
+ *
+ * Es segura entre hilos. Varios procesos pueden compartir el directorio:
+ * las entradas se escriben en un archivo temporal y se renombran.
+ */
+class ResultCache {
+public:
+  /**
+   * @param directory Directorio de la caché (se crea al guardar).
+   * @param max_bytes Tamaño máximo de las entradas en bytes.
+   */
+  ResultCache(std::string directory, uint64_t max_bytes);
+
+  /**
+   * Indica si una simulación puede guardarse en la caché. No se guardan las
+   * que leen los procesos al llegar (process_loading=stream), las que
+   * guardan o restauran un punto de control ni, con traza, las que escriben
+   * series agregadas o pueden descartar eventos de métricas.
+   * @param config Configuración de la simulación.
+   * @param with_trace true si la entrada incluye la traza de métricas.
+   * @return true si el resultado depende solo de la clave.
+   */
+  static bool cacheable(const SimulatorConfig &config, bool with_trace);
+
+  /**
+   * Normaliza una configuración: sus parámetros con efecto en el resultado
+   * o la traza, uno por línea como clave=valor y en orden fijo. Se omiten
+   * el modo de ejecución, el bloqueo del núcleo, el escritor de métricas
+   * (búfer, cola y contrapresión), el monitor en vivo, la traza de
+   * perfilado y la propia caché.
+   * @param config Configuración.
+   * @return Texto normalizado.
+   */
+  static std::string describe(const SimulatorConfig &config);
+
+  /**
+   * Normaliza una lista de procesos ya parseada, uno por línea y en su
+   * orden: el formato del archivo (espacios, comentarios) no cambia la clave.
+   * @param processes Procesos sin simular.
+   * @return Texto normalizado.
+   */
+  static std::string
+  describe(const std::vector<std::shared_ptr<Process>> &processes);
+
+  /**
+   * Construye la clave de una simulación.
+   * @param config Configuración normalizada con describe().
+   * @param processes Procesos normalizados con describe().
+   * @param variant Distingue entradas con y sin traza (y su formato).
+   * @return Clave que incluye la versión del simulador.
+   */
+  static CacheKey make_key(std::string_view config, std::string_view processes,
+                           std::string_view variant);
+
+  /**
+   * Busca una entrada y la marca como usada.
+   * @param key Clave de la simulación.
+   * @param summary Recibe el resumen guardado.
+   * @param with_trace true si la entrada debe tener traza.
+   * @return false si no hay entrada (o su traza) para la clave.
+   */
+  bool load(const CacheKey &key, std::string &summary, bool with_trace = false);
+
+  /**
+   * Copia la traza de una entrada.
+   * @param key Clave de la simulación.
+   * @param destination Archivo de destino (se reemplaza).
+   * @return false si la traza no existe o no se pudo copiar.
+   */
+  bool copy_trace(const CacheKey &key, const std::string &destination) const;
+
+  /**
+   * Guarda una entrada y elimina las más antiguas si se supera el límite.
+   * @param key Clave de la simulación.
+   * @param summary Resumen a guardar.
+   * @param trace_file Traza de métricas a copiar (vacío = sin traza).
+   * @return false si no se pudo escribir.
+   */
+  bool store(const CacheKey &key, const std::string &summary,
+             const std::string &trace_file = "");
+
+  /**
+   * @return Bytes ocupados por las entradas del directorio.
+   */
+  uint64_t size_bytes() const;
+
+private:
+  std::filesystem::path entry_path(const CacheKey &key,
+                                   const char *extension) const;
+  void evict();
+
+  std::filesystem::path directory; //!< Directorio de las entradas.
+  uint64_t max_bytes;              //!< Límite del tamaño total.
+  uint64_t used_bytes = 0; //!< Tamaño estimado; se recalcula al desalojar.
+  bool scanned = false;    //!< Indica si used_bytes se leyó del directorio.
+  uint64_t temp_counter = 0; //!< Distingue los archivos temporales.
+  std::mutex mutex;          //!< Protege used_bytes y el desalojo.
+};
+
+} // namespace OSSimulator
+
+#endif // RESULT_CACHE_HPP
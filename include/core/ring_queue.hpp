@@ -0,0 +1,219 @@
+#ifndef RING_QUEUE_HPP
+#define RING_QUEUE_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace OSSimulator {
+
+/**
+ * Cola circular sobre un vector que conserva su capacidad.
+ *
+ * Reemplaza a std::deque en las colas que se recorren en cada tick: una vez
+ * alcanzado su tamaño máximo no vuelve a reservar memoria, mientras que
+ * std::deque libera y reserva bloques a medida que los elementos rotan. Los
+ * huecos guardan elementos construidos por defecto, de modo que al retirar
+ * un puntero compartido se libera su referencia. Borrar en el medio desplaza
+ * el lado más corto, igual que std::deque.
+ *
+ * @tparam T Tipo de los elementos; construible por defecto y movible.
+ */
+template <typename T> class RingQueue {
+private:
+  std::vector<T> slots; //!< Huecos; su tamaño es potencia de dos o cero.
+  size_t head = 0;      //!< Hueco del primer elemento.
+  size_t count = 0;     //!< Elementos en la cola.
+
+  size_t slot(size_t index) const {
+    return (head + index) & (slots.size() - 1);
+  }
+
+  void grow() {
+    std::vector<T> bigger(slots.empty() ? 8 : slots.size() * 2);
+    for (size_t i = 0; i < count; ++i)
+      bigger[i] = std::move(slots[slot(i)]);
+    slots.swap(bigger);
+    head = 0;
+  }
+
+  template <bool Const> class Iterator {
+  private:
+    using Queue = std::conditional_t<Const, const RingQueue, RingQueue>;
+    Queue *queue = nullptr;
+    std::ptrdiff_t index = 0;
+
+    friend class RingQueue;
+    friend class Iterator<!Const>;
+
+  public:
+    using iterator_category = std::random_access_iterator_tag;
+    using value_type = T;
+    using difference_type = std::ptrdiff_t;
+    using pointer = std::conditional_t<Const, const T *, T *>;
+    using reference = std::conditional_t<Const, const T &, T &>;
+
+    Iterator() = default;
+    Iterator(Queue *queue, std::ptrdiff_t index)
+        : queue(queue), index(index) {}
+    template <bool C = Const, typename = std::enable_if_t<C>>
+    Iterator(const Iterator<false> &other)
+        : queue(other.queue), index(other.index) {}
+
+    reference operator*() const { return (*queue)[index]; }
+    pointer operator->() const { return &(*queue)[index]; }
+    reference operator[](difference_type n) const {
+      return (*queue)[index + n];
+    }
+
+    Iterator &operator++() {
+      ++index;
+      return *this;
+    }
+    Iterator operator++(int) {
+      Iterator copy = *this;
+      ++index;
+      return copy;
+    }
+    Iterator &operator--() {
+      --index;
+      return *this;
+    }
+    Iterator operator--(int) {
+      Iterator copy = *this;
+      --index;
+      return copy;
+    }
+    Iterator &operator+=(difference_type n) {
+      index += n;
+      return *this;
+    }
+    Iterator &operator-=(difference_type n) {
+      index -= n;
+      return *this;
+    }
+    friend Iterator operator+(Iterator it, difference_type n) {
+      return it += n;
+    }
+    friend Iterator operator+(difference_type n, Iterator it) {
+      return it += n;
+    }
+    friend Iterator operator-(Iterator it, difference_type n) {
+      return it -= n;
+    }
+    friend difference_type operator-(const Iterator &a, const Iterator &b) {
+      return a.index - b.index;
+    }
+    friend bool operator==(const Iterator &a, const Iterator &b) {
+      return a.index == b.index;
+    }
+    friend bool operator!=(const Iterator &a, const Iterator &b) {
+      return a.index != b.index;
+    }
+    friend bool operator<(const Iterator &a, const Iterator &b) {
+      return a.index < b.index;
+    }
+    friend bool operator>(const Iterator &a, const Iterator &b) {
+      return a.index > b.index;
+    }
+    friend bool operator<=(const Iterator &a, const Iterator &b) {
+      return a.index <= b.index;
+    }
+    friend bool operator>=(const Iterator &a, const Iterator &b) {
+      return a.index >= b.index;
+    }
+  };
+
+public:
+  using value_type = T;
+  using size_type = size_t;
+  using iterator = Iterator<false>;
+  using const_iterator = Iterator<true>;
+
+  bool empty() const { return count == 0; }
+  size_t size() const { return count; }
+  size_t capacity() const { return slots.size(); }
+
+  T &operator[](size_t index) { return slots[slot(index)]; }
+  const T &operator[](size_t index) const { return slots[slot(index)]; }
+  T &front() { return slots[head]; }
+  const T &front() const { return slots[head]; }
+  T &back() { return slots[slot(count - 1)]; }
+  const T &back() const { return slots[slot(count - 1)]; }
+
+  iterator begin() { return iterator(this, 0); }
+  iterator end() { return iterator(this, static_cast<std::ptrdiff_t>(count)); }
+  const_iterator begin() const { return const_iterator(this, 0); }
+  const_iterator end() const {
+    return const_iterator(this, static_cast<std::ptrdiff_t>(count));
+  }
+
+  void push_back(const T &value) { push_back(T(value)); }
+
+  void push_back(T &&value) {
+    if (count == slots.size())
+      grow();
+    slots[slot(count)] = std::move(value);
+    ++count;
+  }
+
+  void pop_front() {
+    slots[head] = T();
+    head = slot(1);
+    --count;
+  }
+
+  void pop_back() {
+    slots[slot(count - 1)] = T();
+    --count;
+  }
+
+  /**
+   * Elimina un elemento desplazando el lado más corto de la cola.
+   *
+   * @param pos Elemento a eliminar.
+   * @return Iterador al elemento siguiente.
+   */
+  iterator erase(const_iterator pos) {
+    const size_t index = static_cast<size_t>(pos.index);
+    if (index < count / 2) {
+      for (size_t i = index; i > 0; --i)
+        (*this)[i] = std::move((*this)[i - 1]);
+      pop_front();
+    } else {
+      for (size_t i = index; i + 1 < count; ++i)
+        (*this)[i] = std::move((*this)[i + 1]);
+      pop_back();
+    }
+    return iterator(this, pos.index);
+  }
+
+  /**
+   * Elimina un rango desplazando los elementos posteriores.
+   *
+   * @param first Primer elemento a eliminar.
+   * @param last Elemento siguiente al último.
+   * @return Iterador al elemento que seguía al rango.
+   */
+  iterator erase(const_iterator first, const_iterator last) {
+    iterator to(this, first.index);
+    std::move(iterator(this, last.index), end(), to);
+    for (std::ptrdiff_t n = last - first; n > 0; --n)
+      pop_back();
+    return to;
+  }
+
+  /// Vacía la cola sin liberar los huecos.
+  void clear() {
+    while (count > 0)
+      pop_back();
+    head = 0;
+  }
+};
+
+} // namespace OSSimulator
+
+#endif // RING_QUEUE_HPP
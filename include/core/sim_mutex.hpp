@@ -0,0 +1,54 @@
+#ifndef SIM_MUTEX_HPP
+#define SIM_MUTEX_HPP
+
+#include <mutex>
+
+namespace OSSimulator {
+
+/**
+ * Mutex de los componentes del núcleo (planificador, memoria y E/S).
+ *
+ * El motor avanza siempre desde un solo hilo, así que por defecto lock() y
+ * unlock() no hacen nada. set_enabled(true) activa el bloqueo para cuando
+ * otros hilos consultan los componentes durante la simulación
+ * (core_locking=coarse). Compilado con OSSIM_SINGLE_THREADED el mutex no
+ * existe y el bloqueo no puede activarse.
+ *
+ * Cumple BasicLockable: se usa con std::lock_guard y std::unique_lock. El
+ * estado solo debe cambiarse mientras nadie lo tiene tomado.
+ */
+class SimMutex {
+#ifdef OSSIM_SINGLE_THREADED
+public:
+  void set_enabled(bool) {}
+  bool enabled() const { return false; }
+  void lock() {}
+  void unlock() {}
+#else
+private:
+  std::mutex mutex;    //!< Mutex real, usado solo si está activo.
+  bool active = false; //!< Bloqueo activado.
+
+public:
+  void set_enabled(bool enabled) { active = enabled; }
+  bool enabled() const { return active; }
+  void lock() {
+    if (active)
+      mutex.lock();
+  }
+  void unlock() {
+    if (active)
+      mutex.unlock();
+  }
+#endif
+};
+
+#ifdef OSSIM_SINGLE_THREADED
+constexpr bool CORE_LOCKING_AVAILABLE = false;
+#else
+constexpr bool CORE_LOCKING_AVAILABLE = true;
+#endif
+
+} // namespace OSSimulator
+
+#endif // SIM_MUTEX_HPP
@@ -0,0 +1,193 @@
+#ifndef SNAPSHOT_HPP
+#define SNAPSHOT_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace OSSimulator {
+
+struct Process;
+struct IORequest;
+
+/**
+ * Escritor de instantáneas binarias del estado de la simulación.
+ *
+ * Cada componente escribe su estado dinámico en orden y lo lee en el mismo
+ * orden al restaurar. Los enteros se codifican en varint (zigzag los que
+ * tienen signo), los procesos por su PID y las solicitudes de E/S por un
+ * identificador: la primera referencia escribe la solicitud completa y las
+ * siguientes solo el identificador, así las solicitudes compartidas entre
+ * la cola, el dispositivo y las fusiones se restauran como un único objeto.
+ */
+class SnapshotWriter {
+public:
+  void put_uint(uint64_t value);
+  void put_int(int64_t value);
+  void put_bool(bool value);
+  void put_double(double value);
+  void put_string(const std::string &value);
+
+  /**
+   * Escribe una referencia a un proceso.
+   *
+   * @param process Proceso, o nullptr.
+   */
+  void put_process(const Process *process);
+  void put_process(const std::shared_ptr<Process> &process) {
+    put_process(process.get());
+  }
+
+  /**
+   * Escribe una lista de procesos en orden.
+   *
+   * @param processes Contenedor de std::shared_ptr<Process>.
+   */
+  template <typename Container> void put_processes(const Container &processes) {
+    put_uint(processes.size());
+    for (const auto &process : processes)
+      put_process(process);
+  }
+
+  /**
+   * Escribe un vector de enteros o booleanos.
+   *
+   * @param values Valores a escribir.
+   */
+  template <typename T> void put_vector(const std::vector<T> &values) {
+    put_uint(values.size());
+    for (auto value : values)
+      put_int(static_cast<int64_t>(value));
+  }
+
+  /**
+   * Escribe una referencia a una solicitud de E/S.
+   *
+   * @param request Solicitud, o nullptr.
+   */
+  void put_request(const std::shared_ptr<IORequest> &request);
+
+  /**
+   * Guarda la instantánea con su cabecera.
+   *
+   * @param filename Ruta del archivo.
+   * @throws std::runtime_error Si no se puede escribir el archivo.
+   */
+  void save(const std::string &filename) const;
+
+private:
+  std::string data; //!< Contenido sin la cabecera.
+  std::unordered_map<const IORequest *, uint64_t>
+      request_ids; //!< Identificador de cada solicitud ya escrita.
+};
+
+/**
+ * Lector de instantáneas escritas por SnapshotWriter. Un archivo truncado o
+ * que no coincide con la configuración actual lanza std::runtime_error.
+ */
+class SnapshotReader {
+public:
+  /**
+   * Carga una instantánea y valida su cabecera.
+   *
+   * @param filename Ruta del archivo.
+   * @throws std::runtime_error Si no se puede abrir o no es una instantánea.
+   */
+  explicit SnapshotReader(const std::string &filename);
+
+  uint64_t get_uint();
+  int get_int();
+  int64_t get_int64();
+  bool get_bool();
+  double get_double();
+  std::string get_string();
+
+  /**
+   * Lee la cantidad de elementos de una lista, que no puede superar los
+   * bytes restantes.
+   *
+   * @return Cantidad de elementos.
+   */
+  size_t get_count();
+
+  /**
+   * Lee un valor y verifica que coincida con el de la configuración actual.
+   *
+   * @param expected Valor esperado.
+   * @param what Descripción del valor para el mensaje de error.
+   */
+  void expect(int64_t expected, const std::string &what);
+
+  /**
+   * Lee una cadena y verifica que coincida con la esperada.
+   *
+   * @param expected Cadena esperada.
+   * @param what Descripción del valor para el mensaje de error.
+   */
+  void expect(const std::string &expected, const std::string &what);
+
+  /**
+   * Establece los procesos a los que se resuelven las referencias por PID.
+   *
+   * @param processes Procesos cargados en la simulación.
+   */
+  void set_processes(const std::vector<std::shared_ptr<Process>> &processes);
+
+  /**
+   * Lee una referencia a un proceso.
+   *
+   * @return Proceso, o nullptr si la referencia era nula.
+   */
+  std::shared_ptr<Process> get_process();
+
+  /**
+   * Lee una lista de procesos escrita con put_processes().
+   *
+   * @param processes Contenedor que recibe los procesos, vaciado antes.
+   */
+  template <typename Container> void get_processes(Container &processes) {
+    processes.clear();
+    for (size_t i = get_count(); i > 0; --i)
+      processes.push_back(get_process());
+  }
+
+  /**
+   * Lee un vector escrito con put_vector().
+   *
+   * @param values Vector que recibe los valores.
+   */
+  template <typename T> void get_vector(std::vector<T> &values) {
+    values.assign(get_count(), T());
+    for (size_t i = 0; i < values.size(); ++i)
+      values[i] = static_cast<T>(get_int64());
+  }
+
+  /**
+   * Lee una referencia a una solicitud de E/S.
+   *
+   * @return Solicitud, o nullptr si la referencia era nula.
+   */
+  std::shared_ptr<IORequest> get_request();
+
+  /**
+   * Indica si se leyó toda la instantánea.
+   *
+   * @return true si no quedan bytes.
+   */
+  bool at_end() const { return offset == data.size(); }
+
+private:
+  std::string data;  //!< Contenido sin la cabecera.
+  size_t offset = 0; //!< Posición de lectura.
+  std::unordered_map<int, std::shared_ptr<Process>>
+      processes_by_pid; //!< Procesos por PID.
+  std::vector<std::shared_ptr<IORequest>>
+      requests; //!< Solicitudes leídas, por identificador.
+};
+
+} // namespace OSSimulator
+
+#endif // SNAPSHOT_HPP
@@ -0,0 +1,20 @@
+#ifndef TICK_HPP
+#define TICK_HPP
+
+#include <cstdint>
+
+namespace OSSimulator {
+
+/**
+ * Instante o duración de la simulación, en ticks.
+ *
+ * Es de 64 bits para que las trazas largas (semanas de actividad a
+ * resolución fina) no desborden el reloj ni los acumulados de tiempo. Los
+ * parámetros pequeños de configuración (quantums, latencias, costos) siguen
+ * siendo int y se promueven a Tick al operar con el reloj.
+ */
+using Tick = int64_t;
+
+} // namespace OSSimulator
+
+#endif // TICK_HPP
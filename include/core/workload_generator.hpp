@@ -0,0 +1,107 @@
+#ifndef WORKLOAD_GENERATOR_HPP
+#define WORKLOAD_GENERATOR_HPP
+
+#include "core/tick.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+#include <random>
+#include <string>
+#include <string_view>
+
+namespace OSSimulator {
+
+/**
+ * Distribución de un parámetro entero de la carga sintética.
+ */
+struct Distribution {
+  enum class Kind {
+    CONSTANT,   //!< Siempre el valor a.
+    UNIFORM,    //!< Entero uniforme entre a y b (inclusive).
+    EXPONENTIAL //!< Exponencial de media a, redondeada.
+  };
+
+  Kind kind = Kind::CONSTANT;
+  double a = 1.0;
+  double b = 1.0;
+};
+
+/**
+ * Parámetros de una carga sintética de procesos.
+ */
+struct WorkloadSpec {
+  uint32_t seed = 1;              //!< Semilla del generador.
+  size_t processes = 1000;        //!< Procesos a generar.
+  std::string arrival = "poisson"; //!< "poisson" o "bursty".
+  double arrival_rate = 0.06;     //!< Llegadas promedio por tick.
+  int burst_size = 8;             //!< Llegadas promedio por ráfaga (bursty).
+  Distribution cpu_bursts{Distribution::Kind::UNIFORM, 1, 3}; //!< Ráfagas de CPU por proceso.
+  Distribution cpu_burst{Distribution::Kind::EXPONENTIAL, 6, 0}; //!< Ticks por ráfaga de CPU.
+  Distribution io_burst{Distribution::Kind::EXPONENTIAL, 4, 0}; //!< Ticks por ráfaga de E/S.
+  Distribution priority{Distribution::Kind::UNIFORM, 1, 5}; //!< Prioridad.
+  Distribution pages{Distribution::Kind::UNIFORM, 1, 8};    //!< Páginas requeridas.
+};
+
+/**
+ * Generador reproducible de cargas sintéticas.
+ *
+ * Produce líneas del formato del archivo de procesos ordenadas por llegada,
+ * de a una y sin guardar las anteriores, de modo que una carga de millones de
+ * procesos puede escribirse a un archivo o leerse con ProcessStream durante
+ * la simulación. Las llegadas siguen un proceso de Poisson o llegan en ráfagas
+ * (grupos en el mismo tick separados por intervalos exponenciales, con la
+ * misma tasa promedio). Los valores se derivan directamente de la salida de
+ * std::mt19937_64 y no de las distribuciones de la biblioteca estándar, que
+ * dependen de la implementación: una misma semilla produce el mismo archivo
+ * en cualquier plataforma.
+ */
+class WorkloadGenerator {
+public:
+  /**
+   * Constructor.
+   *
+   * @param spec Parámetros de la carga.
+   * @throws std::invalid_argument Si algún parámetro no es válido.
+   */
+  explicit WorkloadGenerator(const WorkloadSpec &spec);
+
+  /**
+   * Genera la línea del proceso siguiente.
+   *
+   * @param text Línea sin salto de línea, válida hasta la siguiente llamada.
+   * @return false si ya se generaron todos los procesos.
+   * @throws std::runtime_error Si la llegada supera el tiempo representable.
+   */
+  bool next_line(std::string_view &text);
+
+  /**
+   * Escribe los procesos restantes con una cabecera que describe la carga.
+   *
+   * @param out Flujo de salida.
+   */
+  void write(std::ostream &out);
+
+  /**
+   * Indica si ya se generaron todos los procesos.
+   *
+   * @return true si no quedan procesos.
+   */
+  bool done() const { return generated == spec.processes; }
+
+private:
+  double uniform();
+  double exponential(double mean);
+  int sample(const Distribution &distribution, int minimum);
+  Tick next_arrival();
+
+  WorkloadSpec spec;      //!< Parámetros de la carga.
+  std::mt19937_64 engine; //!< Generador, con secuencia fijada por el estándar.
+  size_t generated = 0;   //!< Procesos ya generados.
+  double clock = 0.0;     //!< Tiempo de la última llegada.
+  int group_left = 0;     //!< Llegadas restantes de la ráfaga actual.
+  std::string line;       //!< Última línea generada.
+};
+
+} // namespace OSSimulator
+
+#endif // WORKLOAD_GENERATOR_HPP
@@ -0,0 +1,131 @@
+#ifndef CFS_SCHEDULER_HPP
+#define CFS_SCHEDULER_HPP
+
+#include "cpu/scheduler.hpp"
+#include <cstdint>
+#include <set>
+#include <unordered_map>
+#include <vector>
+
+namespace OSSimulator {
+
+/**
+ * Planificador completamente justo (CFS).
+ *
+ * Cada proceso acumula un tiempo virtual de ejecución (vruntime): los ticks
+ * de CPU escalados por el inverso de su peso, que se obtiene de la prioridad
+ * tomada como valor nice (menor número, más peso). Los procesos listos se
+ * ordenan por vruntime en un árbol rojo-negro (std::set), así que insertar
+ * cuesta O(log n) y elegir el de menor vruntime, el extremo izquierdo, O(1).
+ *
+ * El turno no es fijo: target_latency ticks se reparten entre los procesos
+ * listos en proporción a su peso, con un mínimo de min_granularity ticks
+ * (si hay muchos procesos el periodo se alarga para respetarlo).
+ */
+class CFSScheduler final : public Scheduler {
+public:
+  static constexpr int NICE_0_WEIGHT = 1024; //!< Peso de prioridad 0.
+
+  /**
+   * Constructor.
+   *
+   * @param target_latency Ticks en los que cada proceso listo debería
+   * ejecutarse una vez.
+   * @param min_granularity Turno mínimo en ticks.
+   */
+  explicit CFSScheduler(int target_latency = 12, int min_granularity = 2);
+
+  void add_process(const std::shared_ptr<Process> &process) override;
+  std::shared_ptr<Process> get_next_process() override;
+  std::shared_ptr<Process> get_last_process() override;
+  bool has_processes() const override;
+  void remove_process(int pid) override;
+  size_t size() const override;
+  void clear() override;
+  SchedulingAlgorithm get_algorithm() const override;
+  std::unique_ptr<Scheduler> create_empty() const override;
+  void save_state(SnapshotWriter &out) const override;
+  void load_state(SnapshotReader &in) override;
+
+  /**
+   * Calcula el turno del proceso según su peso y los procesos listos.
+   *
+   * @param process Proceso a despachar.
+   * @return Ticks del turno (al menos min_granularity).
+   */
+  int get_quantum(const Process &process) const override;
+  bool is_time_sliced() const override { return true; }
+
+  /**
+   * Un proceso desaloja al que se ejecuta si su vruntime es menor por más
+   * de min_granularity ticks virtuales.
+   */
+  bool should_preempt(const Process &candidate,
+                      const Process &running) const override;
+
+  /**
+   * Suma los ticks ponderados al vruntime del proceso y lo reubica en el
+   * árbol.
+   */
+  void on_cpu_time(const Process &process, Tick ticks) override;
+
+  /**
+   * Descarta el vruntime del proceso.
+   */
+  void on_process_exit(int pid) override;
+
+  /**
+   * Obtiene el vruntime de un proceso.
+   *
+   * @param pid Identificador del proceso.
+   * @return vruntime en ticks virtuales; 0 si el proceso no es conocido.
+   */
+  double get_vruntime(int pid) const;
+
+  /**
+   * Obtiene el peso que corresponde a una prioridad.
+   *
+   * @param priority Prioridad del proceso, tomada como nice entre -20 y 19.
+   * @return Peso relativo (NICE_0_WEIGHT para la prioridad 0).
+   */
+  static int weight_for(int priority);
+
+private:
+  static constexpr uint64_t SCALE = 1024; //!< Unidades de vruntime por tick.
+
+  struct Node {
+    uint64_t vruntime;                //!< Tiempo virtual escalado al insertar.
+    uint64_t sequence;                //!< Orden de inserción para desempates.
+    int pid;                          //!< Proceso del nodo.
+    std::shared_ptr<Process> process; //!< Proceso en cola (no ordena).
+
+    bool operator<(const Node &other) const;
+  };
+
+  /// Estado de un proceso. No guarda el proceso: solo el árbol lo retiene,
+  /// mientras está en cola.
+  struct Entry {
+    uint64_t vruntime = 0;      //!< Tiempo virtual escalado.
+    uint64_t sequence = 0;      //!< Orden de su última inserción.
+    int weight = NICE_0_WEIGHT; //!< Peso del proceso.
+    bool queued = false;        //!< El proceso está en el árbol.
+  };
+
+  std::set<Node> timeline;                //!< Procesos listos por vruntime.
+  std::vector<std::set<Node>::node_type>
+      spare_nodes; //!< Nodos retirados del árbol, reutilizados al insertar.
+  std::unordered_map<int, Entry> entries; //!< Estado de cada proceso vivo.
+  uint64_t min_vruntime = 0;              //!< Mínimo vruntime, monótono.
+  uint64_t next_sequence = 0;             //!< Siguiente número de inserción.
+  long long total_weight = 0;             //!< Suma de pesos en el árbol.
+  int target_latency;                     //!< Periodo objetivo en ticks.
+  int min_granularity;                    //!< Turno mínimo en ticks.
+
+  void insert(const std::shared_ptr<Process> &process, Entry &entry);
+  std::shared_ptr<Process> unlink(int pid, Entry &entry);
+  void update_min_vruntime();
+};
+
+} // namespace OSSimulator
+
+#endif // CFS_SCHEDULER_HPP
@@ -1,19 +1,47 @@
 #ifndef CPU_SCHEDULER_HPP
 #define CPU_SCHEDULER_HPP
 
+#include "core/index_set.hpp"
 #include "core/process.hpp"
+#include "core/sim_mutex.hpp"
 #include "cpu/scheduler.hpp"
+#include "io/io_request_pool.hpp"
 #include "memory/memory_manager.hpp"
+#include "metrics/latency_histogram.hpp"
+#include "metrics/live_exporter.hpp"
 #include "metrics/metrics_collector.hpp"
+#include <array>
 #include <atomic>
 #include <functional>
 #include <memory>
 #include <mutex>
+#include <unordered_map>
 #include <vector>
 
 namespace OSSimulator {
 
+class IODevice;
 class IOManager;
+class ProcessStream;
+struct IOCompletion;
+
+/**
+ * Modos de ejecución de los pasos de los procesos.
+ */
+enum class ExecutionMode {
+  THREADED, //!< Un hilo por proceso con sincronización por pasos.
+  INLINE    //!< Pasos ejecutados en el hilo del planificador, sin hilos ni esperas.
+};
+
+/**
+ * Bloqueo del planificador, la memoria y la E/S durante la simulación. El
+ * motor avanza desde un solo hilo; el bloqueo solo hace falta si otros hilos
+ * consultan esos componentes mientras corre.
+ */
+enum class CoreLocking {
+  NONE,  //!< Sin bloqueo.
+  COARSE //!< Un bloqueo del planificador por paso y uno por componente.
+};
 
 /**
  * Clase que representa el planificador de CPU en la simulación.
@@ -27,52 +55,133 @@ private:
       all_processes; //!< Todos los procesos cargados.
   std::vector<std::shared_ptr<Process>>
       completed_processes; //!< Procesos completados.
+  ProcessLatencyStats
+      latency_stats; //!< Latencias de los procesos completados, por prioridad.
+  size_t completed_count = 0; //!< Procesos completados, liberados o no.
+  bool release_completed =
+      false; //!< Libera los procesos terminados (carga incremental).
 
-  int current_time; //!< Tiempo actual de la simulación.
+  Tick current_time; //!< Tiempo actual de la simulación.
   std::shared_ptr<Process>
       running_process; //!< Proceso que se está ejecutando actualmente.
 
-  int context_switches; //!< Número de cambios de contexto realizados.
+  int64_t context_switches; //!< Número de cambios de contexto realizados.
 
   using MemoryCheckCallback = std::function<bool(
       const Process &)>; //!< Tipo de función para verificar la memoria.
   MemoryCheckCallback
       memory_check_callback; //!< Función para verificar la disponibilidad de memoria.
 
-  std::mutex
-      scheduler_mutex; //!< Mutex para proteger el acceso al planificador.
+  SimMutex scheduler_mutex; //!< Tomado durante cada paso completo.
   std::atomic<bool>
       simulation_running; //!< Indica si la simulación está en ejecución.
 
   std::shared_ptr<MemoryManager> memory_manager; //!< Gestor de memoria.
   std::shared_ptr<IOManager> io_manager;         //!< Gestor de E/S.
+  IORequestPool io_requests; //!< Reserva de las solicitudes de E/S emitidas.
   std::shared_ptr<MetricsCollector>
       metrics_collector; //!< Recolector de métricas.
+  std::shared_ptr<LiveStats>
+      live_stats; //!< Contadores del monitor en vivo (opcional).
+  std::vector<std::pair<std::shared_ptr<IODevice>, LiveStats::Device *>>
+      live_devices; //!< Dispositivos publicados en live_stats.
+  std::vector<std::shared_ptr<IODevice>>
+      aggregate_devices; //!< Dispositivos sumados en las series agregadas.
+  std::array<std::vector<int>, 3>
+      queue_pids; //!< PIDs del snapshot de colas, reutilizados entre ticks.
   bool pending_preemption =
       false;              //!< Indica si se debe preemptar el proceso actual.
-  int total_cpu_time = 0; //!< Tiempo total de CPU utilizado.
+  Tick total_cpu_time = 0; //!< Tiempo total de CPU utilizado.
   bool last_tick_was_idle = false; //!< Indica si el último tick fue idle.
+  ExecutionMode execution_mode =
+      ExecutionMode::THREADED; //!< Modo de ejecución de los procesos.
+  CoreLocking core_locking = CoreLocking::NONE; //!< Bloqueo del núcleo.
+  bool event_driven =
+      false; //!< Salta los ticks ociosos hasta el próximo evento.
+
+  static constexpr size_t STATE_COUNT =
+      static_cast<size_t>(ProcessState::TERMINATED) + 1;
+  /**
+   * Campos de planificación de los procesos cargados en arreglos paralelos,
+   * con la misma posición que en all_processes. Los recorridos de cada tick
+   * leen estos arreglos contiguos sin tocar la estructura Process, que
+   * contiene el hilo, sus primitivas de sincronización y los rastros.
+   */
+  struct ProcessTable {
+    std::vector<int> pids;           //!< Identificador de cada proceso.
+    std::vector<Tick> arrival_times; //!< Tiempo de llegada de cada proceso.
+    std::vector<ProcessState> states; //!< Último estado registrado.
+    std::vector<int> cores; //!< Último núcleo usado (-1 = ninguno).
+
+    void clear() {
+      pids.clear();
+      arrival_times.clear();
+      states.clear();
+      cores.clear();
+    }
+
+    size_t size() const { return states.size(); }
+  };
+
+  ProcessTable process_table; //!< Datos calientes de los procesos cargados.
+  std::unordered_map<const Process *, size_t>
+      process_index; //!< Posición de cada proceso en all_processes.
+  std::array<IndexSet, STATE_COUNT>
+      state_members; //!< Posiciones de los procesos en cada estado.
+  size_t active_process_count = 0; //!< Procesos no terminados.
+  std::vector<size_t>
+      arrival_order; //!< Posiciones de los procesos nuevos por llegada.
+  size_t arrival_cursor = 0; //!< Primera llegada aún no alcanzada.
+  IndexSet arrived_new; //!< Procesos que ya llegaron y esperan ser admitidos.
+  bool admission_deferred =
+      false; //!< El control de carga retiene las llegadas pendientes.
+  std::unique_ptr<ProcessStream>
+      process_stream; //!< Procesos aún no leídos (carga incremental).
+  Tick last_streamed_arrival = 0; //!< Llegada del último proceso leído.
+
+  /**
+   * Núcleo simulado del modo multinúcleo. Cada núcleo tiene su propia cola
+   * de listos con la estrategia configurada; el proceso asignado sale de la
+   * cola mientras ocupa el núcleo.
+   */
+  struct Core {
+    std::unique_ptr<Scheduler> queue; //!< Cola de listos del núcleo.
+    std::shared_ptr<Process> running; //!< Proceso asignado al núcleo.
+    Tick slice_used = 0;    //!< Ticks consumidos del quantum actual.
+    Tick busy_ticks = 0;    //!< Ticks ejecutando procesos.
+    int64_t context_switches = 0; //!< Cambios de contexto del núcleo.
+    int64_t migrations = 0;       //!< Procesos recibidos desde otro núcleo.
+    int64_t steals = 0;           //!< Procesos robados a otros núcleos.
+    int last_pid = -1;      //!< Último proceso ejecutado en el núcleo.
+    int quantum = 0;        //!< Quantum del proceso asignado (0 = sin límite).
+    int migration_left = 0; //!< Ticks pendientes del costo de migración.
+    Tick remote_left = 0;   //!< Ticks pendientes de un acceso NUMA remoto.
+    bool preempt = false;   //!< Desalojar al proceso al terminar el tick.
+  };
+
+  std::vector<Core> cores; //!< Núcleos simulados (vacío = un solo núcleo).
+  int migration_cost = 0;  //!< Ticks perdidos al cambiar de núcleo.
 
   /**
    * Crea y lanza un hilo para el proceso dado.
    *
    * @param proc Proceso para el cual se crea el hilo.
    */
-  void spawn_process_thread(std::shared_ptr<Process> proc);
+  void spawn_process_thread(const std::shared_ptr<Process> &proc);
 
   /**
    * Notifica que un proceso está en ejecución.
    *
    * @param proc Proceso que está en ejecución.
    */
-  void notify_process_running(std::shared_ptr<Process> proc);
+  void notify_process_running(const std::shared_ptr<Process> &proc);
 
   /**
    * Espera a que un proceso complete su paso de ejecución.
    *
    * @param proc Proceso que está esperando completar su paso.
    */
-  void wait_for_process_step(std::shared_ptr<Process> proc);
+  void wait_for_process_step(const std::shared_ptr<Process> &proc);
 
   /**
    * Termina todos los hilos de los procesos en ejecución.
@@ -80,54 +189,237 @@ private:
   void terminate_all_threads();
 
   /**
-    * Maneja la finalización de una operación de E/S.
+   * Maneja un lote de finalizaciones de E/S. Se invoca desde el paso en
+   * curso, que ya tiene tomado el mutex del planificador.
+   *
+   * @param completions Finalizaciones en orden de ocurrencia.
+   */
+  void handle_io_completions(const std::vector<IOCompletion> &completions);
+
+  /**
+    * Maneja la finalización de una operación de E/S. Requiere el mutex del
+    * planificador tomado.
     *
     * @param proc Proceso que completó la E/S.
     * @param completion_time Tiempo de finalización de la E/S.
     */
-  void handle_io_completion(std::shared_ptr<Process> proc, int completion_time);
+  void handle_io_completion(const std::shared_ptr<Process> &proc,
+                            Tick completion_time);
 
   /**
    * Avanza los dispositivos de E/S en el tiempo.
    *
    * @param time_slice Quantum de tiempo para avanzar.
    * @param step_start_time Tiempo de inicio del paso actual.
-   * @param lock Mutex bloqueado para sincronización.
    */
-  void advance_io_devices(int time_slice, int step_start_time,
-                          std::unique_lock<std::mutex> &lock);
+  void advance_io_devices(Tick time_slice, Tick step_start_time);
 
   /**
-   * Maneja la preparación de la memoria para un proceso.
+   * Maneja la preparación de la memoria para un proceso. Se invoca desde el
+   * paso en curso, que ya tiene tomado el mutex del planificador.
    *
    * @param proc Proceso que está listo para la memoria.
+   * @param ready_time Tick en que se cargó su última página.
    */
-  void handle_memory_ready(std::shared_ptr<Process> proc);
+  void handle_memory_ready(const std::shared_ptr<Process> &proc,
+                           Tick ready_time);
 
   /**
    * Avanza el gestor de memoria en el tiempo.
    *
    * @param time_slice Quantum de tiempo para avanzar.
    * @param step_start_time Tiempo de inicio del paso actual.
-   * @param lock Mutex bloqueado para sincronización.
    */
-  void advance_memory_manager(int time_slice, int step_start_time,
-                              std::unique_lock<std::mutex> &lock);
+  void advance_memory_manager(Tick time_slice, Tick step_start_time);
 
   /**
    * Solicita la preempción si es necesario.
    *
    * @param proc Proceso que podría ser preemptado.
    */
-  void request_preemption_if_needed(std::shared_ptr<Process> proc);
+  void request_preemption_if_needed(const std::shared_ptr<Process> &proc);
 
   /**
-   * Verifica si se debe preemptar un proceso basado en la prioridad.
+   * Indica si el planificador configurado reparte la CPU en turnos que
+   * devuelven el proceso a la cola al agotar el quantum.
    *
-   * @param candidate Proceso candidato para preempción.
-   * @return true si se debe preemptar, false en caso contrario.
+   * @return true si el algoritmo usa turnos.
    */
-  bool should_preempt_priority(std::shared_ptr<Process> candidate) const;
+  bool is_time_sliced() const;
+
+  /**
+   * Indica si el planificador configurado desaloja al proceso en ejecución
+   * cuando pasa a listo uno que debe ir antes.
+   *
+   * @return true si el algoritmo es expulsivo.
+   */
+  bool is_preemptive() const;
+
+  /**
+   * Calcula el quantum efectivo de un proceso: el del planificador, acotado
+   * por el quantum del paso si este es positivo.
+   *
+   * @param queue Planificador del proceso.
+   * @param proc Proceso a despachar.
+   * @param quantum Quantum del paso (0 = el del planificador).
+   * @return Ticks del turno (0 = sin límite).
+   */
+  int quantum_for(const Scheduler &queue, const Process &proc,
+                  int quantum) const;
+
+  /**
+   * Calcula el próximo instante en que la CPU ociosa podría tener trabajo:
+   * la siguiente llegada, el fin de una carga de página o de una E/S.
+   *
+   * @return Tick del próximo evento, o -1 si no hay eventos previstos.
+   */
+  Tick get_next_event_time() const;
+
+  /**
+   * Reconstruye el registro de estados a partir de all_processes.
+   */
+  void rebuild_state_tracking();
+
+  /**
+   * Agrega un proceso terminado a completed_processes (salvo que se liberen
+   * los terminados), registra sus latencias y avisa al planificador para que
+   * descarte sus datos. Sus métricas ya deben estar calculadas.
+   *
+   * @param proc Proceso terminado.
+   */
+  void record_completion(const std::shared_ptr<Process> &proc);
+
+  /**
+   * Copia los contadores actuales en live_stats, si está configurado.
+   */
+  void publish_live_stats();
+
+  /**
+   * Envía el estado actual a las series agregadas del recolector, si están
+   * activas.
+   */
+  void collect_aggregate_sample();
+
+  /**
+   * Toma los dispositivos de E/S y envía la muestra base de las series
+   * agregadas al iniciar run_until_completion o run_until.
+   */
+  void start_aggregate_samples();
+
+  /**
+   * Quita de all_processes los procesos terminados y compacta los registros
+   * de estado, si son más de la mitad de los cargados: cada compactación
+   * recorre la tabla una vez y se reparte entre las terminaciones que la
+   * provocaron. Solo se usa en la carga incremental.
+   */
+  void release_terminated();
+
+  /**
+   * Registra un proceso recién agregado a all_processes.
+   *
+   * @param proc Proceso agregado.
+   */
+  void track_new_process(const std::shared_ptr<Process> &proc);
+
+  /**
+   * Ejecuta un tick en todos los núcleos del modo multinúcleo.
+   *
+   * @param quantum Quantum de Round Robin (0 = sin límite).
+   */
+  void execute_multicore_step(int quantum);
+
+  /**
+   * Asigna un proceso de su cola al núcleo si está libre y ejecuta un tick
+   * en él.
+   *
+   * @param index Índice del núcleo.
+   * @param quantum Quantum del paso (0 = el del planificador).
+   */
+  void run_core_tick(size_t index, int quantum);
+
+  /**
+   * Envía a E/S el proceso del núcleo si su ráfaga actual es de E/S.
+   *
+   * @param index Índice del núcleo.
+   * @return true si el proceso dejó el núcleo.
+   */
+  bool start_core_io(size_t index);
+
+  /**
+   * Resuelve el proceso de un núcleo al final del tick: terminación,
+   * solicitud de E/S o desalojo.
+   *
+   * @param index Índice del núcleo.
+   */
+  void finish_core_tick(size_t index);
+
+  /**
+   * Indica si el proceso de un núcleo agotó su quantum.
+   *
+   * @param core Núcleo a consultar.
+   * @return true si el algoritmo usa turnos y el quantum se consumió.
+   */
+  bool core_quantum_expired(const Core &core) const;
+
+  /**
+   * Roba el último proceso de la cola más cargada para un núcleo sin
+   * trabajo.
+   *
+   * @param index Índice del núcleo ocioso.
+   */
+  void steal_work(size_t index);
+
+  /**
+   * Coloca un proceso listo en la cola de un núcleo: el último que lo
+   * ejecutó o, si nunca se ejecutó, el menos cargado.
+   *
+   * @param proc Proceso listo.
+   */
+  void enqueue_on_core(const std::shared_ptr<Process> &proc);
+
+  /**
+   * Vacía las colas y contadores de los núcleos.
+   */
+  void reset_cores();
+
+  /**
+   * Indica si algún núcleo tiene un proceso asignado o en cola.
+   *
+   * @return true si hay trabajo en los núcleos.
+   */
+  bool cores_have_work() const;
+
+  /**
+   * Agrega un proceso nuevo al índice de llegadas, detrás del cursor.
+   *
+   * @param index Posición del proceso en all_processes.
+   */
+  void index_arrival(size_t index);
+
+  /**
+   * Actualiza los conjuntos de pertenencia si el estado del proceso cambió
+   * desde el último registro.
+   *
+   * @param proc Proceso a sincronizar.
+   */
+  void sync_process_state(const Process &proc);
+
+  /**
+   * Cambia el estado de un proceso y actualiza los conjuntos de pertenencia.
+   *
+   * @param proc Proceso a modificar.
+   * @param new_state Nuevo estado.
+   */
+  void set_process_state(const std::shared_ptr<Process> &proc,
+                         ProcessState new_state);
+
+  /**
+   * Obtiene los PIDs de los procesos en un estado, en orden de carga.
+   *
+   * @param state Estado a consultar.
+   * @param pids Recibe los PIDs; se vacía antes y conserva su capacidad.
+   */
+  void get_pids_in_state(ProcessState state, std::vector<int> &pids) const;
 
 public:
   /**
@@ -169,6 +461,15 @@ public:
    */
   void set_metrics_collector(std::shared_ptr<MetricsCollector> collector);
 
+  /**
+   * Establece los contadores que se publican después de cada paso de
+   * run_until_completion y run_until, para un LiveExporter. Registra en ellos
+   * los dispositivos del gestor de E/S, que debe estar configurado antes.
+   *
+   * @param stats Contadores a publicar (nullptr para dejar de publicar).
+   */
+  void set_live_stats(std::shared_ptr<LiveStats> stats);
+
   /**
    * Establece la función de verificación de memoria.
    *
@@ -176,12 +477,87 @@ public:
    */
   void set_memory_callback(MemoryCheckCallback callback);
 
+  /**
+   * Establece el modo de ejecución de los procesos.
+   * Al pasar a INLINE se detienen los hilos existentes; al volver a THREADED
+   * se lanzan los hilos de los procesos no terminados.
+   *
+   * @param mode Modo de ejecución.
+   */
+  void set_execution_mode(ExecutionMode mode);
+
+  /**
+   * Obtiene el modo de ejecución de los procesos.
+   *
+   * @return Modo de ejecución actual.
+   */
+  ExecutionMode get_execution_mode() const;
+
+  /**
+   * Establece el bloqueo del planificador y de los gestores de memoria y E/S,
+   * también los que se asignen después. Debe llamarse antes de simular.
+   *
+   * @param mode Bloqueo del núcleo.
+   * @throws std::runtime_error Si se pide COARSE y el simulador se compiló
+   * con SINGLE_THREADED_CORE.
+   */
+  void set_core_locking(CoreLocking mode);
+
+  /**
+   * Obtiene el bloqueo del núcleo.
+   *
+   * @return Bloqueo actual.
+   */
+  CoreLocking get_core_locking() const;
+
+  /**
+   * Activa o desactiva el motor dirigido por eventos.
+   * Con la CPU ociosa el reloj salta directamente al próximo evento en lugar
+   * de avanzar tick a tick; las métricas resultantes son las mismas.
+   *
+   * @param enabled true para saltar los ticks ociosos.
+   */
+  void set_event_driven(bool enabled);
+
+  /**
+   * Indica si el motor dirigido por eventos está activo.
+   *
+   * @return true si se saltan los ticks ociosos.
+   */
+  bool is_event_driven() const;
+
+  /**
+   * Establece el número de núcleos simulados. Con más de uno, cada núcleo
+   * recibe una cola propia creada a partir de la estrategia actual, los
+   * procesos vuelven al núcleo donde se ejecutaron y los núcleos sin trabajo
+   * roban de la cola más cargada. Debe llamarse antes de cargar los
+   * procesos; set_scheduler recrea las colas de los núcleos.
+   *
+   * @param count Número de núcleos (1 = modelo de un solo núcleo).
+   */
+  void set_core_count(int count);
+
+  /**
+   * Obtiene el número de núcleos simulados.
+   *
+   * @return Número de núcleos.
+   */
+  int get_core_count() const;
+
+  /**
+   * Establece los ticks que pierde un núcleo al ejecutar un proceso que se
+   * ejecutó por última vez en otro núcleo.
+   *
+   * @param ticks Costo de migración en ticks.
+   */
+  void set_migration_cost(int ticks);
+
   /**
    * Agrega un proceso al planificador y lanza su hilo.
    *
    * @param process Proceso a agregar.
    */
-  void add_process(std::shared_ptr<Process> process);
+  void add_process(const std::shared_ptr<Process> &process);
 
   /**
    * Carga múltiples procesos en el planificador.
@@ -190,6 +566,18 @@ public:
    */
   void load_processes(const std::vector<std::shared_ptr<Process>> &processes);
 
+  /**
+   * Carga los procesos de forma incremental: cada proceso se lee del
+   * archivo y se agrega al llegar su tiempo de llegada, y se libera poco
+   * después de terminar, cuando sus métricas ya se sumaron a los promedios
+   * y percentiles. Así la memoria depende de los procesos en el sistema y
+   * no del tamaño del archivo. El archivo debe estar ordenado por tiempo de
+   * llegada.
+   *
+   * @param stream Lector del archivo de procesos.
+   */
+  void stream_processes(std::unique_ptr<ProcessStream> stream);
+
   /**
    * Verifica y asigna memoria para un proceso.
    *
@@ -199,14 +587,20 @@ public:
   bool check_and_allocate_memory(Process &process);
 
   /**
-   * Agrega los procesos que han llegado al planificador.
+   * Agrega los procesos que han llegado al planificador. Si el control de
+   * carga difiere una admisión, las llegadas posteriores esperan detrás de
+   * ella para conservar el orden.
+   *
+   * @throws std::runtime_error Si la carga incremental encuentra un proceso
+   * que llega antes que el anterior.
    */
   void add_arrived_processes();
 
   /**
    * Ejecuta un paso de la simulación con un quantum dado.
    *
-   * @param quantum Quantum de tiempo para el paso de ejecución.
+   * @param quantum Límite de ticks del paso; 0 usa el quantum que el
+   * planificador asigna a cada proceso.
    */
   void execute_step(int quantum = 1);
 
@@ -215,6 +609,15 @@ public:
    */
   void run_until_completion();
 
+  /**
+   * Ejecuta la simulación hasta alcanzar un tick o completar todos los
+   * procesos. Con el motor dirigido por eventos el reloj puede quedar
+   * después del tick pedido si lo saltó estando ociosa la CPU.
+   *
+   * @param tick Tick en el que detenerse.
+   */
+  void run_until(Tick tick);
+
   /**
    * Verifica si hay procesos pendientes por ejecutar.
    *
@@ -227,24 +630,33 @@ public:
    *
    * @return Tiempo actual de la simulación.
    */
-  int get_current_time() const;
+  Tick get_current_time() const;
 
   /**
    * Obtiene el número de cambios de contexto realizados.
    *
    * @return Número de cambios de contexto realizados.
    */
-  int get_context_switches() const;
+  int64_t get_context_switches() const;
 
   /**
-   * Obtiene los procesos completados.
+   * Obtiene los procesos completados. En la carga incremental no se
+   * conservan y el vector queda vacío: use get_completed_count().
    *
    * @return Vector de procesos completados.
    */
   const std::vector<std::shared_ptr<Process>> &get_completed_processes() const;
 
   /**
-   * Obtiene todos los procesos cargados.
+   * Obtiene el número de procesos completados.
+   *
+   * @return Procesos completados, también los ya liberados.
+   */
+  size_t get_completed_count() const;
+
+  /**
+   * Obtiene todos los procesos cargados. En la carga incremental solo
+   * incluye los leídos que aún no se liberaron.
    *
    * @return Vector de todos los procesos cargados.
    */
@@ -271,6 +683,15 @@ public:
    */
   double get_average_response_time() const;
 
+  /**
+   * Obtiene los percentiles de espera, retorno y respuesta de los procesos
+   * completados, en total y por prioridad, y de la espera en cola de cada
+   * dispositivo de E/S.
+   *
+   * @return Filas de percentiles para log_cpu_summary.
+   */
+  std::vector<LatencySummary> get_latency_summaries() const;
+
   /**
    * Calcula la utilización de CPU.
    *
@@ -325,6 +746,53 @@ public:
    */
   void reset();
 
+  /**
+   * Contadores de un núcleo simulado.
+   */
+  struct CoreStats {
+    Tick busy_ticks = 0;          //!< Ticks ejecutando procesos.
+    int64_t context_switches = 0; //!< Cambios de contexto del núcleo.
+    int64_t migrations = 0;       //!< Procesos recibidos desde otro núcleo.
+    int64_t steals = 0;           //!< Procesos robados a otros núcleos.
+  };
+
+  /**
+   * Obtiene los contadores de cada núcleo.
+   *
+   * @return Contadores por núcleo (vacío en el modelo de un solo núcleo).
+   */
+  std::vector<CoreStats> get_core_stats() const;
+
+  /**
+   * Registra el resumen de cada núcleo en el recolector de métricas. No hace
+   * nada en el modelo de un solo núcleo.
+   */
+  void log_core_summaries();
+
+  /**
+   * Guarda el estado completo de la simulación en el tick actual: procesos,
+   * colas de listos, núcleos, memoria, TLB y dispositivos de E/S. Solo se
+   * guarda el estado dinámico; las políticas y sus parámetros salen de la
+   * configuración al restaurar.
+   *
+   * @param filename Ruta de la instantánea.
+   * @throws std::runtime_error Si no se puede escribir o alguna política no
+   * admite instantáneas.
+   */
+  void save_checkpoint(const std::string &filename);
+
+  /**
+   * Restaura una instantánea guardada con save_checkpoint(). Debe llamarse
+   * después de load_processes() con los mismos procesos y la misma
+   * configuración con que se guardó; la simulación continúa desde el tick
+   * guardado.
+   *
+   * @param filename Ruta de la instantánea.
+   * @throws std::runtime_error Si el archivo no es válido o no coincide con
+   * la configuración actual.
+   */
+  void restore_checkpoint(const std::string &filename);
+
 private:
   /**
    * Envía las métricas del tick actual al recolector.
@@ -333,7 +801,8 @@ private:
    * @param proc Proceso involucrado (puede ser nullptr).
    * @param context_switch Si hubo cambio de contexto.
    */
-  void send_cpu_metrics(const std::string &event, std::shared_ptr<Process> proc,
+  void send_cpu_metrics(const std::string &event,
+                        const std::shared_ptr<Process> &proc,
                         bool context_switch);
 
   /**
@@ -344,7 +813,14 @@ private:
   /**
    * Envía un snapshot del estado de las colas al recolector en un tick específico.
    */
-  void send_queue_snapshot(int tick);
+  void send_queue_snapshot(Tick tick);
+
+  /**
+   * Escribe el snapshot de las colas ya aceptado por el muestreo.
+   *
+   * @param tick Tick del snapshot.
+   */
+  void write_queue_snapshot(Tick tick);
 };
 
 } // namespace OSSimulator
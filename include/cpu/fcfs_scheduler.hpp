@@ -1,27 +1,31 @@
 #ifndef FCFS_SCHEDULER_HPP
 #define FCFS_SCHEDULER_HPP
 
+#include "core/ring_queue.hpp"
 #include "cpu/scheduler.hpp"
-#include <deque>
 
 namespace OSSimulator {
 
 /**
  * Clase que implementa el algoritmo de planificación FCFS.
  */
-class FCFSScheduler : public Scheduler {
+class FCFSScheduler final : public Scheduler {
 private:
-  std::deque<std::shared_ptr<Process>>
+  RingQueue<std::shared_ptr<Process>>
       ready_queue; //!< Cola de procesos listos.
 
 public:
-  void add_process(std::shared_ptr<Process> process) override;
+  void add_process(const std::shared_ptr<Process> &process) override;
   std::shared_ptr<Process> get_next_process() override;
+  std::shared_ptr<Process> get_last_process() override;
   bool has_processes() const override;
   void remove_process(int pid) override;
   size_t size() const override;
   void clear() override;
   SchedulingAlgorithm get_algorithm() const override;
+  std::unique_ptr<Scheduler> create_empty() const override;
+  void save_state(SnapshotWriter &out) const override;
+  void load_state(SnapshotReader &in) override;
 };
 
 } // namespace OSSimulator
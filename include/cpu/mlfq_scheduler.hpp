@@ -0,0 +1,127 @@
+#ifndef MLFQ_SCHEDULER_HPP
+#define MLFQ_SCHEDULER_HPP
+
+#include "core/ring_queue.hpp"
+#include "cpu/scheduler.hpp"
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+namespace OSSimulator {
+
+/**
+ * Planificador de colas multinivel con retroalimentación (MLFQ).
+ *
+ * Cada nivel es una cola Round Robin con su propio quantum; el nivel 0 es
+ * el de mayor prioridad. Un proceso nuevo entra al nivel 0 y baja un nivel
+ * al consumir el quantum de su nivel, sumando todos sus turnos en él (así
+ * ceder la CPU justo antes del quantum no evita el descenso). Cada
+ * boost_interval ticks todos los procesos vuelven al nivel 0.
+ *
+ * Un mapa de bits marca los niveles no vacíos: el nivel a despachar es su
+ * bit menos significativo, de modo que elegir el siguiente proceso cuesta
+ * O(1) sin importar cuántos procesos estén listos.
+ */
+class MLFQScheduler final : public Scheduler {
+public:
+  static constexpr int MAX_LEVELS = 64; //!< Niveles que caben en el mapa.
+
+  /**
+   * Constructor.
+   *
+   * @param quanta Quantum de cada nivel, del más prioritario al menos; se
+   * usan a lo sumo MAX_LEVELS y los no positivos se toman como 1.
+   * @param boost_interval Ticks entre elevaciones al nivel 0 (0 = nunca).
+   */
+  explicit MLFQScheduler(std::vector<int> quanta = {2, 4, 8},
+                         int boost_interval = 0);
+
+  void add_process(const std::shared_ptr<Process> &process) override;
+  std::shared_ptr<Process> get_next_process() override;
+  std::shared_ptr<Process> get_last_process() override;
+  bool has_processes() const override;
+  void remove_process(int pid) override;
+  size_t size() const override;
+  void clear() override;
+  SchedulingAlgorithm get_algorithm() const override;
+  std::unique_ptr<Scheduler> create_empty() const override;
+  void save_state(SnapshotWriter &out) const override;
+  void load_state(SnapshotReader &in) override;
+
+  /**
+   * Obtiene lo que le queda al proceso del quantum de su nivel.
+   *
+   * @param process Proceso a despachar.
+   * @return Ticks hasta agotar el quantum del nivel.
+   */
+  int get_quantum(const Process &process) const override;
+  bool is_time_sliced() const override { return true; }
+
+  /**
+   * Un proceso desaloja al que se ejecuta si está en un nivel superior.
+   */
+  bool should_preempt(const Process &candidate,
+                      const Process &running) const override;
+
+  /**
+   * Suma los ticks al consumo del proceso en su nivel y lo baja de nivel
+   * al agotar el quantum.
+   */
+  void on_cpu_time(const Process &process, Tick ticks) override;
+
+  /**
+   * Descarta el nivel y el consumo del proceso.
+   */
+  void on_process_exit(int pid) override;
+
+  /**
+   * Eleva todos los procesos al nivel 0 si venció el intervalo.
+   */
+  void advance_time(Tick current_time) override;
+
+  /**
+   * Obtiene el nivel actual de un proceso.
+   *
+   * @param pid Identificador del proceso.
+   * @return Nivel (0 = más prioritario); 0 si el proceso no es conocido.
+   */
+  int get_level(int pid) const;
+
+  /**
+   * Obtiene el número de niveles.
+   *
+   * @return Niveles configurados.
+   */
+  int get_level_count() const;
+
+  /**
+   * Obtiene el número de procesos de los que se guarda estado: los que
+   * pasaron por la cola y no terminaron.
+   *
+   * @return Procesos conocidos.
+   */
+  size_t get_tracked_count() const;
+
+private:
+  struct Entry {
+    int level = 0;       //!< Nivel actual del proceso.
+    int used = 0;        //!< Ticks consumidos en el nivel actual.
+    bool queued = false; //!< El proceso está en la cola de su nivel.
+  };
+
+  std::vector<int> quanta; //!< Quantum de cada nivel.
+  std::vector<RingQueue<std::shared_ptr<Process>>>
+      levels;                    //!< Cola de listos de cada nivel.
+  uint64_t non_empty = 0;        //!< Bit i activo si el nivel i tiene procesos.
+  std::unordered_map<int, Entry> entries; //!< Estado de cada proceso vivo.
+  size_t count = 0;              //!< Procesos en las colas.
+  int boost_interval;            //!< Ticks entre elevaciones (0 = nunca).
+  Tick next_boost;               //!< Tick de la próxima elevación.
+
+  void push(const std::shared_ptr<Process> &process, Entry &entry);
+  std::shared_ptr<Process> unlink(int pid, Entry &entry);
+};
+
+} // namespace OSSimulator
+
+#endif // MLFQ_SCHEDULER_HPP
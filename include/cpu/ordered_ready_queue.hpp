@@ -0,0 +1,109 @@
+#ifndef ORDERED_READY_QUEUE_HPP
+#define ORDERED_READY_QUEUE_HPP
+
+#include "core/process.hpp"
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <set>
+#include <unordered_map>
+#include <vector>
+
+namespace OSSimulator {
+
+/**
+ * Cola de listos ordenada por una clave del proceso.
+ *
+ * Los procesos se ordenan por la clave, luego por tiempo de llegada y
+ * finalmente por orden de inserción. Un índice por PID permite insertar,
+ * consultar el primero y eliminar cualquier proceso en O(log n). Los nodos
+ * del árbol y del índice se reutilizan, así que reencolar un proceso ya
+ * conocido no reserva memoria.
+ */
+class OrderedReadyQueue {
+public:
+  using KeyFunction = std::function<Tick(const Process &)>;
+
+private:
+  struct Entry {
+    Tick key;                      //!< Clave de ordenamiento al insertar.
+    Tick arrival_time;             //!< Tiempo de llegada del proceso.
+    uint64_t sequence;             //!< Orden de inserción para desempates.
+    std::shared_ptr<Process> proc; //!< Proceso almacenado.
+
+    bool operator<(const Entry &other) const;
+  };
+
+  KeyFunction key_of;      //!< Función que obtiene la clave.
+  std::set<Entry> entries; //!< Procesos ordenados.
+  std::unordered_map<int, std::set<Entry>::iterator>
+      index; //!< Índice PID -> entrada (end() si no está en la cola).
+  std::vector<std::set<Entry>::node_type>
+      spare_entries;          //!< Nodos retirados, reutilizados al insertar.
+  uint64_t next_sequence = 0; //!< Siguiente número de inserción.
+  int last_front_pid = -1;    //!< PID devuelto por última vez.
+
+  /**
+   * Reordena el último proceso devuelto si su clave cambió mientras
+   * ejecutaba (por ejemplo, su tiempo restante).
+   */
+  void refresh_last_front();
+
+public:
+  /**
+   * Constructor.
+   *
+   * @param key Función que obtiene la clave de ordenamiento de un proceso.
+   */
+  explicit OrderedReadyQueue(KeyFunction key);
+
+  /**
+   * Inserta un proceso; si ya estaba en la cola se reinserta.
+   *
+   * @param process Proceso a insertar.
+   */
+  void push(const std::shared_ptr<Process> &process);
+
+  /**
+   * Obtiene el proceso de menor clave sin retirarlo.
+   *
+   * @return Proceso al frente o nullptr si la cola está vacía.
+   */
+  std::shared_ptr<Process> front();
+
+  /**
+   * Obtiene el proceso de mayor clave sin retirarlo.
+   *
+   * @return Último proceso o nullptr si la cola está vacía.
+   */
+  std::shared_ptr<Process> back();
+
+  /**
+   * Elimina un proceso por su PID.
+   *
+   * @param pid Identificador del proceso.
+   */
+  void erase(int pid);
+
+  bool empty() const;
+  size_t size() const;
+  void clear();
+
+  /**
+   * Guarda los procesos en orden con la clave con que se insertaron.
+   *
+   * @param out Instantánea de destino.
+   */
+  void save_state(SnapshotWriter &out) const;
+
+  /**
+   * Restaura la cola guardada con save_state(), sin recalcular las claves.
+   *
+   * @param in Instantánea de origen.
+   */
+  void load_state(SnapshotReader &in);
+};
+
+} // namespace OSSimulator
+
+#endif // ORDERED_READY_QUEUE_HPP
@@ -1,27 +1,83 @@
 #ifndef PRIORITY_SCHEDULER_HPP
 #define PRIORITY_SCHEDULER_HPP
 
+#include "cpu/ordered_ready_queue.hpp"
 #include "cpu/scheduler.hpp"
-#include <vector>
+#include <unordered_map>
 
 namespace OSSimulator {
 
 /**
  * Clase que implementa el algoritmo de planificación por Prioridad.
+ *
+ * Con envejecimiento, un proceso gana un nivel de prioridad por cada
+ * aging_interval ticks que espera listo. Como todos los procesos en cola
+ * envejecen al mismo ritmo, comparar prioridad - espera / aging_interval
+ * equivale a comparar la clave fija prioridad * aging_interval + instante
+ * desde el que espera: la cola no se reordena con el paso del tiempo y solo
+ * cambia la clave del proceso que se ejecuta, que avanza un tick por cada
+ * tick de CPU.
  */
-class PriorityScheduler : public Scheduler {
+class PriorityScheduler final : public Scheduler {
 private:
-  std::vector<std::shared_ptr<Process>>
-      ready_queue; //!< Cola de procesos listos.
+  int aging_interval; //!< Ticks de espera por nivel ganado (0 = ninguno).
+  Tick now = 0;        //!< Último tiempo notificado.
+  std::unordered_map<int, Tick> ready_since; //!< Desde cuándo espera cada PID.
+  OrderedReadyQueue ready_queue;            //!< Cola de procesos listos.
+
+  Tick key_for(const Process &process) const;
 
 public:
-  void add_process(std::shared_ptr<Process> process) override;
+  /**
+   * Constructor.
+   *
+   * @param aging_interval Ticks de espera para ganar un nivel de prioridad
+   * (0 desactiva el envejecimiento).
+   */
+  explicit PriorityScheduler(int aging_interval = 0);
+
+  PriorityScheduler(const PriorityScheduler &) = delete;
+  PriorityScheduler &operator=(const PriorityScheduler &) = delete;
+
+  void add_process(const std::shared_ptr<Process> &process) override;
   std::shared_ptr<Process> get_next_process() override;
+  std::shared_ptr<Process> get_last_process() override;
   bool has_processes() const override;
   void remove_process(int pid) override;
   size_t size() const override;
   void clear() override;
   SchedulingAlgorithm get_algorithm() const override;
+  std::unique_ptr<Scheduler> create_empty() const override;
+  void save_state(SnapshotWriter &out) const override;
+  void load_state(SnapshotReader &in) override;
+
+  /**
+   * Los procesos se ejecutan de a un tick para reevaluar el desalojo.
+   */
+  int get_quantum(const Process &process) const override;
+  bool is_preemptive() const override { return true; }
+
+  /**
+   * Un proceso desaloja al que se ejecuta si tiene mejor prioridad efectiva
+   * (menor número, descontado el envejecimiento).
+   */
+  bool should_preempt(const Process &candidate,
+                      const Process &running) const override;
+
+  /**
+   * Descuenta de la espera del proceso los ticks que se ejecutó.
+   */
+  void on_cpu_time(const Process &process, Tick ticks) override;
+
+  void advance_time(Tick current_time) override;
+
+  /**
+   * Obtiene la prioridad efectiva de un proceso.
+   *
+   * @param process Proceso a consultar.
+   * @return Prioridad menos los niveles ganados esperando.
+   */
+  int get_effective_priority(const Process &process) const;
 };
 
 } // namespace OSSimulator
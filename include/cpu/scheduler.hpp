@@ -3,14 +3,18 @@
 
 #include "core/process.hpp"
 #include <memory>
+#include <stdexcept>
 
 namespace OSSimulator {
 
 enum class SchedulingAlgorithm {
   FCFS,        //!< Primero en llegar, primero en ser atendido (FCFS)
   SJF,         //!< Trabajo más corto primero (SJF)
+  SRTF,        //!< Menor tiempo restante primero (SJF expulsivo)
   ROUND_ROBIN, //!< Round Robin (quantum rotativo)
-  PRIORITY     //!< Planificación por prioridad
+  PRIORITY,    //!< Planificación por prioridad
+  MLFQ,        //!< Colas multinivel con retroalimentación
+  CFS          //!< Planificación completamente justa por vruntime
 };
 
 /**
@@ -25,7 +29,7 @@ public:
    *
    * @param process Proceso a agregar.
    */
-  virtual void add_process(std::shared_ptr<Process> process) = 0;
+  virtual void add_process(const std::shared_ptr<Process> &process) = 0;
 
   /**
    * Obtiene el siguiente proceso a ejecutar.
@@ -34,6 +38,16 @@ public:
    */
   virtual std::shared_ptr<Process> get_next_process() = 0;
 
+  /**
+   * Obtiene el último proceso de la cola de listos: el que se despacharía
+   * después de todos los demás. El robo de trabajo del modo multinúcleo se
+   * lleva este proceso, así el núcleo conserva el que ejecutaría a
+   * continuación.
+   *
+   * @return Último proceso, o nullptr si la cola está vacía.
+   */
+  virtual std::shared_ptr<Process> get_last_process() = 0;
+
   /**
    * Verifica si hay procesos en la cola de listos.
    *
@@ -66,6 +80,106 @@ public:
    * @return Algoritmo de planificación.
    */
   virtual SchedulingAlgorithm get_algorithm() const = 0;
+
+  /**
+   * Crea un planificador vacío con el mismo algoritmo y parámetros. El modo
+   * multinúcleo lo usa para dar a cada núcleo su propia cola de listos.
+   *
+   * @return Nuevo planificador sin procesos.
+   */
+  virtual std::unique_ptr<Scheduler> create_empty() const = 0;
+
+  /**
+   * Obtiene el quantum de un proceso: los ticks que ejecuta antes de volver
+   * a la cola de listos.
+   *
+   * @param process Proceso a despachar.
+   * @return Ticks del turno, o 0 si se ejecuta hasta bloquearse o terminar.
+   */
+  virtual int get_quantum(const Process & /*process*/) const { return 0; }
+
+  /**
+   * Indica si el algoritmo reparte la CPU en turnos que devuelven el
+   * proceso al final de la cola al agotar su quantum.
+   *
+   * @return true si el algoritmo usa turnos.
+   */
+  virtual bool is_time_sliced() const { return false; }
+
+  /**
+   * Indica si el algoritmo desaloja al proceso en ejecución cuando
+   * should_preempt() lo pide, sin esperar al fin del turno.
+   *
+   * @return true si el algoritmo es expulsivo.
+   */
+  virtual bool is_preemptive() const { return false; }
+
+  /**
+   * Indica si el proceso en ejecución debe ceder la CPU al terminar el paso
+   * cada vez que otro proceso pasa a listo (Round Robin de un núcleo).
+   *
+   * @return true si cede ante cualquier proceso listo.
+   */
+  virtual bool yields_on_ready() const { return false; }
+
+  /**
+   * Indica si un proceso que pasa a listo debe desalojar al que se ejecuta.
+   *
+   * @param candidate Proceso que pasa a listo.
+   * @param running Proceso en ejecución.
+   * @return true si debe desalojarlo.
+   */
+  virtual bool should_preempt(const Process & /*candidate*/,
+                              const Process & /*running*/) const {
+    return false;
+  }
+
+  /**
+   * Notifica los ticks de CPU que ejecutó un proceso.
+   *
+   * @param process Proceso ejecutado.
+   * @param ticks Ticks ejecutados.
+   */
+  virtual void on_cpu_time(const Process & /*process*/, Tick /*ticks*/) {}
+
+  /**
+   * Notifica que un proceso terminó. No volverá a la cola, así que el
+   * algoritmo descarta los datos que guarde de él.
+   *
+   * @param pid Identificador del proceso terminado.
+   */
+  virtual void on_process_exit(int /*pid*/) {}
+
+  /**
+   * Notifica el avance del reloj al comienzo de cada paso.
+   *
+   * @param current_time Tiempo actual de la simulación.
+   */
+  virtual void advance_time(Tick /*current_time*/) {}
+
+  /**
+   * Guarda el estado dinámico (cola de listos y datos por proceso) en una
+   * instantánea. Los parámetros del algoritmo no se guardan: al restaurar se
+   * usan los del planificador configurado.
+   *
+   * @param out Instantánea de destino.
+   * @throws std::runtime_error Si el algoritmo no admite instantáneas.
+   */
+  virtual void save_state(SnapshotWriter & /*out*/) const {
+    throw std::runtime_error(
+        "El planificador de CPU no admite instantáneas");
+  }
+
+  /**
+   * Restaura el estado guardado con save_state().
+   *
+   * @param in Instantánea de origen.
+   * @throws std::runtime_error Si el algoritmo no admite instantáneas.
+   */
+  virtual void load_state(SnapshotReader & /*in*/) {
+    throw std::runtime_error(
+        "El planificador de CPU no admite instantáneas");
+  }
 };
 
 } // namespace OSSimulator
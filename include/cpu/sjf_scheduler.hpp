@@ -1,27 +1,95 @@
 #ifndef SJF_SCHEDULER_HPP
 #define SJF_SCHEDULER_HPP
 
+#include "cpu/ordered_ready_queue.hpp"
 #include "cpu/scheduler.hpp"
-#include <vector>
+#include <unordered_map>
 
 namespace OSSimulator {
 
+/**
+ * Origen de la duración de ráfaga con la que se ordena la cola.
+ */
+enum class BurstPrediction {
+  ORACLE,     //!< Tiempo de CPU restante real del proceso.
+  EXPONENTIAL //!< Promedio exponencial de las ráfagas de CPU anteriores.
+};
+
 /**
  * Clase que implementa el algoritmo de planificación "Trabajo más corto primero" (SJF).
+ *
+ * En modo expulsivo (SRTF) un proceso que pasa a listo desaloja al que se
+ * ejecuta si le queda menos tiempo. Con predicción exponencial la duración
+ * de la ráfaga actual se estima como tau = alpha * t + (1 - alpha) * tau
+ * sobre las ráfagas de CPU ya completadas, descontando lo ya ejecutado.
  */
-class SJFScheduler : public Scheduler {
+class SJFScheduler final : public Scheduler {
 private:
-  std::vector<std::shared_ptr<Process>>
-      ready_queue; //!< Cola de procesos listos.
+  struct Estimate {
+    size_t next_burst = 0; //!< Primera ráfaga aún no incorporada.
+    double tau = 0.0;      //!< Duración estimada de la próxima ráfaga.
+  };
+
+  bool preemptive;             //!< Modo SRTF.
+  BurstPrediction prediction;  //!< Origen de la duración de ráfaga.
+  double alpha;                //!< Peso de la última ráfaga observada.
+  int initial_estimate;        //!< Estimación sin historial.
+  mutable std::unordered_map<int, Estimate>
+      estimates;               //!< Estimación por PID.
+  OrderedReadyQueue ready_queue; //!< Cola de procesos listos.
+
+  Tick key_for(const Process &process) const;
 
 public:
-  void add_process(std::shared_ptr<Process> process) override;
+  /**
+   * Constructor.
+   *
+   * @param preemptive true para desalojar al llegar un proceso más corto.
+   * @param prediction Origen de la duración de ráfaga.
+   * @param alpha Peso de la última ráfaga en el promedio (entre 0 y 1).
+   * @param initial_estimate Estimación de la primera ráfaga en ticks.
+   */
+  explicit SJFScheduler(bool preemptive = false,
+                        BurstPrediction prediction = BurstPrediction::ORACLE,
+                        double alpha = 0.5, int initial_estimate = 5);
+
+  SJFScheduler(const SJFScheduler &) = delete;
+  SJFScheduler &operator=(const SJFScheduler &) = delete;
+
+  void add_process(const std::shared_ptr<Process> &process) override;
   std::shared_ptr<Process> get_next_process() override;
+  std::shared_ptr<Process> get_last_process() override;
   bool has_processes() const override;
   void remove_process(int pid) override;
   size_t size() const override;
   void clear() override;
   SchedulingAlgorithm get_algorithm() const override;
+  std::unique_ptr<Scheduler> create_empty() const override;
+  void save_state(SnapshotWriter &out) const override;
+  void load_state(SnapshotReader &in) override;
+
+  /**
+   * En modo SRTF los procesos se ejecutan de a un tick para reevaluar el
+   * desalojo.
+   */
+  int get_quantum(const Process &process) const override;
+  bool is_preemptive() const override { return preemptive; }
+
+  /**
+   * En modo SRTF un proceso desaloja al que se ejecuta si le queda menos
+   * tiempo (real o estimado).
+   */
+  bool should_preempt(const Process &candidate,
+                      const Process &running) const override;
+
+  /**
+   * Estima la duración de la ráfaga de CPU actual de un proceso.
+   *
+   * @param process Proceso a consultar.
+   * @return Promedio exponencial de sus ráfagas de CPU completadas, o la
+   * estimación inicial si aún no completó ninguna.
+   */
+  double predict_burst(const Process &process) const;
 };
 
 } // namespace OSSimulator
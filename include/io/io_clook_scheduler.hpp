@@ -0,0 +1,24 @@
+#ifndef IO_CLOOK_SCHEDULER_HPP
+#define IO_CLOOK_SCHEDULER_HPP
+
+#include "io/io_elevator_scheduler.hpp"
+
+namespace OSSimulator {
+
+/**
+ * Planificador de disco C-LOOK. Como C-SCAN, pero el cabezal solo llega hasta
+ * la última solicitud y salta directamente a la más baja.
+ */
+class IOCLOOKScheduler final : public IOElevatorScheduler {
+protected:
+  RequestMap::iterator select_next() override;
+
+public:
+  using IOElevatorScheduler::IOElevatorScheduler;
+
+  IOSchedulingAlgorithm get_algorithm() const override;
+};
+
+} // namespace OSSimulator
+
+#endif // IO_CLOOK_SCHEDULER_HPP
@@ -0,0 +1,24 @@
+#ifndef IO_CSCAN_SCHEDULER_HPP
+#define IO_CSCAN_SCHEDULER_HPP
+
+#include "io/io_elevator_scheduler.hpp"
+
+namespace OSSimulator {
+
+/**
+ * Planificador de disco C-SCAN. El cabezal sube hasta el extremo del disco y
+ * vuelve al cilindro 0 para seguir subiendo.
+ */
+class IOCSCANScheduler final : public IOElevatorScheduler {
+protected:
+  RequestMap::iterator select_next() override;
+
+public:
+  using IOElevatorScheduler::IOElevatorScheduler;
+
+  IOSchedulingAlgorithm get_algorithm() const override;
+};
+
+} // namespace OSSimulator
+
+#endif // IO_CSCAN_SCHEDULER_HPP
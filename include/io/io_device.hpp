@@ -1,33 +1,46 @@
 #ifndef IO_DEVICE_HPP
 #define IO_DEVICE_HPP
 
+#include "core/sim_mutex.hpp"
 #include "io/io_request.hpp"
 #include "io/io_scheduler.hpp"
+#include "metrics/latency_histogram.hpp"
 #include "metrics/metrics_collector.hpp"
 #include <functional>
+#include <map>
 #include <memory>
-#include <mutex>
 #include <string>
+#include <vector>
 
 namespace OSSimulator {
 
+/**
+ * Finalización de una solicitud de E/S pendiente de notificar.
+ */
+struct IOCompletion {
+  std::shared_ptr<Process> process; //!< Proceso cuya E/S terminó.
+  Tick completion_time;             //!< Tick de finalización.
+};
+
 /**
  * Clase que representa un dispositivo de entrada/salida.
  */
 class IODevice {
 private:
   std::string device_name;                //!< Nombre del dispositivo.
+  NameId device_name_id;                  //!< Nombre internado.
   std::unique_ptr<IOScheduler> scheduler; //!< Planificador de E/S.
   std::shared_ptr<IORequest>
       current_request; //!< Solicitud actualmente en ejecución.
 
-  int total_io_time;   //!< Tiempo total de E/S ejecutado.
-  int device_switches; //!< Número de cambios de contexto del dispositivo.
-  int total_requests_completed; //!< Total de solicitudes completadas.
+  Tick total_io_time;      //!< Tiempo total de E/S ejecutado.
+  int64_t device_switches; //!< Número de cambios de contexto del dispositivo.
+  int64_t total_requests_completed; //!< Total de solicitudes completadas.
 
-  mutable std::mutex device_mutex; //!< Mutex para sincronización.
+  mutable SimMutex device_mutex; //!< Activo solo con bloqueo del núcleo.
 
-  using CompletionCallback = std::function<void(std::shared_ptr<Process>, int)>;
+  using CompletionCallback =
+      std::function<void(const std::shared_ptr<Process> &, Tick)>;
   CompletionCallback
       completion_callback; //!< Callback al completar una solicitud.
 
@@ -38,12 +51,46 @@ private:
   bool
       last_event_was_step; //!< Indica si el último evento fue un paso de ejecución.
 
-  int last_completed_pid;          //!< PID del último proceso completado.
-  std::string last_completed_name; //!< Nombre del último proceso completado.
-  int last_step_pid;               //!< PID del último proceso con paso de E/S.
-  std::string last_step_name; //!< Nombre del último proceso con paso de E/S.
-  int last_step_remaining;    //!< Tiempo restante del último paso.
-  int current_quantum_used;   //!< Ticks usados del quantum actual (para RR).
+  int last_completed_pid;     //!< PID del último proceso completado.
+  NameId last_completed_name; //!< Nombre del último proceso completado.
+  int last_step_pid;          //!< PID del último proceso con paso de E/S.
+  NameId last_step_name;      //!< Nombre del último proceso con paso de E/S.
+  Tick last_step_remaining;   //!< Tiempo restante del último paso.
+  Tick current_quantum_used;  //!< Ticks usados del quantum actual (para RR).
+  int service_rate;           //!< Unidades de ráfaga atendidas por tick.
+  int seek_speed;      //!< Cilindros recorridos por tick (0 = sin búsqueda).
+  int seek_remaining;  //!< Ticks de búsqueda pendientes de la solicitud actual.
+  Tick total_seek_time; //!< Tiempo total dedicado a mover el cabezal.
+  bool last_event_was_seek; //!< Indica si el último paso fue solo búsqueda.
+  int merge_limit;  //!< Tamaño máximo de una fusión (0 = sin fusión).
+  int64_t total_merges; //!< Solicitudes absorbidas por otra en cola.
+  std::multimap<int, std::shared_ptr<IORequest>>
+      merge_candidates; //!< Solicitudes en cola sin empezar, por cilindro.
+  LatencyHistogram
+      queue_delay; //!< Ticks desde la llegada hasta el inicio de la transferencia.
+
+  /**
+   * Ejecuta un paso con el mutex del dispositivo ya tomado.
+   *
+   * @param quantum Quantum de tiempo a ejecutar.
+   * @param current_time Tiempo actual del sistema.
+   * @param completions Destino de la solicitud completada, si la hay.
+   */
+  void step_locked(Tick quantum, Tick current_time,
+                   std::vector<IOCompletion> &completions);
+
+  /**
+   * Intenta fusionar una solicitud nueva con una en cola que acceda a un
+   * rango adyacente o solapado, con el mutex ya tomado.
+   *
+   * @param request Solicitud recién llegada.
+   * @return true si la solicitud quedó absorbida por otra.
+   */
+  bool try_merge_locked(const std::shared_ptr<IORequest> &request);
+
+  Tick ticks_until_next_event_locked() const;
+  bool has_pending_requests_locked() const;
+  void send_log_metrics_locked(Tick current_time);
 
 public:
   /**
@@ -69,12 +116,68 @@ public:
   void set_completion_callback(CompletionCallback callback);
   void set_metrics_collector(std::shared_ptr<MetricsCollector> collector);
 
+  /**
+   * Activa o desactiva el bloqueo del dispositivo.
+   *
+   * @param enabled true si otros hilos lo consultan durante la simulación.
+   */
+  void set_locking(bool enabled);
+
+  /**
+   * Establece la tasa de servicio del dispositivo.
+   *
+   * @param rate Unidades de ráfaga atendidas por tick (mínimo 1).
+   */
+  void set_service_rate(int rate);
+
+  /**
+   * Obtiene la tasa de servicio del dispositivo.
+   *
+   * @return Unidades de ráfaga atendidas por tick.
+   */
+  int get_service_rate() const;
+
+  /**
+   * Establece la velocidad del cabezal. Al despachar una solicitud, el
+   * dispositivo dedica ceil(distancia / velocidad) ticks a la búsqueda antes
+   * de atenderla.
+   *
+   * @param speed Cilindros recorridos por tick (0 desactiva la búsqueda).
+   */
+  void set_seek_speed(int speed);
+
+  /**
+   * Obtiene la velocidad del cabezal.
+   *
+   * @return Cilindros recorridos por tick, 0 si no se modela la búsqueda.
+   */
+  int get_seek_speed() const;
+
+  /**
+   * Activa la fusión de solicitudes. Una solicitud accede al rango
+   * [cilindro, cilindro + unidades); al llegar se fusiona con una en cola,
+   * aún sin atender, cuyo rango sea adyacente o se solape, siempre que la
+   * unión no supere el límite. La solicitud resultante se atiende una vez y
+   * todas sus partes terminan a la vez.
+   *
+   * @param limit Unidades máximas de una solicitud fusionada (0 desactiva la
+   * fusión).
+   */
+  void set_merge_limit(int limit);
+
+  /**
+   * Obtiene el límite de fusión de solicitudes.
+   *
+   * @return Unidades máximas de una solicitud fusionada, 0 si no se fusiona.
+   */
+  int get_merge_limit() const;
+
   /**
    * Agrega una solicitud de E/S a la cola del dispositivo.
    *
    * @param request Solicitud de E/S a agregar.
    */
-  void add_io_request(std::shared_ptr<IORequest> request);
+  void add_io_request(const std::shared_ptr<IORequest> &request);
 
   /**
    * Ejecuta un paso de simulación del dispositivo.
@@ -82,7 +185,31 @@ public:
    * @param quantum Quantum de tiempo a ejecutar.
    * @param current_time Tiempo actual del sistema.
    */
-  void execute_step(int quantum, int current_time);
+  void execute_step(Tick quantum, Tick current_time);
+
+  /**
+   * Avanza el dispositivo varios ticks de forma independiente, en bloques
+   * hasta su propio próximo evento, tomando el mutex una sola vez. Las
+   * finalizaciones se acumulan en lugar de notificarse por el callback.
+   *
+   * @param ticks Ticks a avanzar.
+   * @param start_time Tiempo del primer tick.
+   * @param completions Destino de las solicitudes completadas, en orden.
+   */
+  void advance(Tick ticks, Tick start_time,
+               std::vector<IOCompletion> &completions);
+
+  /**
+   * Ejecuta un paso y registra las métricas del tick con una sola
+   * adquisición del mutex. Las finalizaciones se acumulan en lugar de
+   * notificarse por el callback.
+   *
+   * @param quantum Quantum de tiempo a ejecutar.
+   * @param current_time Tiempo actual del sistema.
+   * @param completions Destino de la solicitud completada, si la hay.
+   */
+  void step_and_log(Tick quantum, Tick current_time,
+                    std::vector<IOCompletion> &completions);
 
   /**
    * Verifica si hay solicitudes pendientes en la cola.
@@ -91,6 +218,22 @@ public:
    */
   bool has_pending_requests() const;
 
+  /**
+   * Obtiene cuántos ticks puede avanzar el dispositivo sin que ocurra un
+   * evento (finalización de una solicitud o rotación por quantum).
+   *
+   * @return Ticks hasta el próximo evento, 1 si debe despachar una solicitud,
+   * o -1 si el dispositivo está inactivo.
+   */
+  Tick get_ticks_until_next_event() const;
+
+  /**
+   * Indica si el dispositivo registra métricas por tick.
+   *
+   * @return true si hay un recolector de métricas habilitado.
+   */
+  bool is_logging_metrics() const;
+
   /**
    * Verifica si el dispositivo está ocupado ejecutando una solicitud.
    *
@@ -110,21 +253,45 @@ public:
    *
    * @return Tiempo total de E/S.
    */
-  int get_total_io_time() const { return total_io_time; }
+  Tick get_total_io_time() const { return total_io_time; }
 
   /**
    * Obtiene el número de cambios de contexto del dispositivo.
    *
    * @return Número de cambios de contexto.
    */
-  int get_device_switches() const { return device_switches; }
+  int64_t get_device_switches() const { return device_switches; }
 
   /**
    * Obtiene el total de solicitudes completadas.
    *
    * @return Total de solicitudes completadas.
    */
-  int get_total_requests_completed() const { return total_requests_completed; }
+  int64_t get_total_requests_completed() const {
+    return total_requests_completed;
+  }
+
+  /**
+   * Obtiene el tiempo total dedicado a mover el cabezal.
+   *
+   * @return Ticks de búsqueda acumulados.
+   */
+  Tick get_total_seek_time() const { return total_seek_time; }
+
+  /**
+   * Obtiene cuántas solicitudes se fusionaron con otra en cola.
+   *
+   * @return Solicitudes absorbidas.
+   */
+  int64_t get_total_merges() const { return total_merges; }
+
+  /**
+   * Obtiene la espera en cola de las solicitudes completadas: ticks desde su
+   * llegada hasta el inicio de la transferencia, búsqueda incluida.
+   *
+   * @return Copia del histograma de esperas.
+   */
+  LatencyHistogram get_queue_delay() const;
 
   /**
    * Obtiene el tamaño de la cola de solicitudes.
@@ -133,11 +300,26 @@ public:
    */
   size_t get_queue_size() const;
 
-  void send_log_metrics(int current_time);
+  void send_log_metrics(Tick current_time);
   /**
    * Reinicia las estadísticas del dispositivo.
    */
   void reset();
+
+  /**
+   * Guarda la cola, la solicitud en curso y los contadores en una
+   * instantánea.
+   *
+   * @param out Instantánea de destino.
+   */
+  void save_state(SnapshotWriter &out) const;
+
+  /**
+   * Restaura el estado guardado con save_state().
+   *
+   * @param in Instantánea de origen.
+   */
+  void load_state(SnapshotReader &in);
 };
 
 } // namespace OSSimulator
@@ -0,0 +1,69 @@
+#ifndef IO_ELEVATOR_SCHEDULER_HPP
+#define IO_ELEVATOR_SCHEDULER_HPP
+
+#include "io/io_scheduler.hpp"
+#include <map>
+#include <memory>
+
+namespace OSSimulator {
+
+/**
+ * Clase base de los planificadores de disco de la familia del ascensor.
+ *
+ * Las solicitudes se guardan ordenadas por cilindro; a igual cilindro se
+ * conserva el orden de llegada. Cada subclase elige la siguiente solicitud
+ * según la posición del cabezal en O(log n).
+ */
+class IOElevatorScheduler : public IOScheduler {
+protected:
+  using RequestMap = std::multimap<int, std::shared_ptr<IORequest>>;
+
+  RequestMap pending; //!< Solicitudes pendientes indexadas por cilindro.
+  int cylinders;      //!< Número de cilindros del disco.
+
+  /**
+   * Elige la siguiente solicitud a atender. Puede mover el cabezal a un
+   * extremo del disco antes de devolverla.
+   *
+   * @return Iterador a la solicitud elegida; pending no está vacío.
+   */
+  virtual RequestMap::iterator select_next() = 0;
+
+  /**
+   * Obtiene la primera solicitud en llegar de un cilindro.
+   *
+   * @param it Iterador a cualquier solicitud de ese cilindro.
+   * @return Iterador a la más antigua del mismo cilindro.
+   */
+  RequestMap::iterator oldest_at(RequestMap::iterator it);
+
+public:
+  /**
+   * Constructor.
+   *
+   * @param cyl Número de cilindros del disco (por defecto 200).
+   */
+  explicit IOElevatorScheduler(int cyl = 200);
+
+  void add_request(const std::shared_ptr<IORequest> &request) override;
+  std::shared_ptr<IORequest> get_next_request() override;
+  bool has_requests() const override;
+  void remove_request(const std::shared_ptr<IORequest> &request) override;
+  void update_request(const std::shared_ptr<IORequest> &request,
+                      int old_cylinder) override;
+  size_t size() const override;
+  void clear() override;
+  void save_state(SnapshotWriter &out) const override;
+  void load_state(SnapshotReader &in) override;
+
+  /**
+   * Obtiene el número de cilindros del disco.
+   *
+   * @return Número de cilindros.
+   */
+  int get_cylinders() const;
+};
+
+} // namespace OSSimulator
+
+#endif // IO_ELEVATOR_SCHEDULER_HPP
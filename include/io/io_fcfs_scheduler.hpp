@@ -1,8 +1,8 @@
 #ifndef IO_FCFS_SCHEDULER_HPP
 #define IO_FCFS_SCHEDULER_HPP
 
+#include "core/ring_queue.hpp"
 #include "io/io_scheduler.hpp"
-#include <deque>
 #include <memory>
 
 namespace OSSimulator {
@@ -10,18 +10,20 @@ namespace OSSimulator {
 /**
  * Clase que implementa el algoritmo de planificación First Come, First Served (FCFS) para E/S.
  */
-class IOFCFSScheduler : public IOScheduler {
+class IOFCFSScheduler final : public IOScheduler {
 private:
-  std::deque<std::shared_ptr<IORequest>> queue; //!< Cola de solicitudes de E/S.
+  RingQueue<std::shared_ptr<IORequest>> queue; //!< Cola de solicitudes de E/S.
 
 public:
-  void add_request(std::shared_ptr<IORequest> request) override;
+  void add_request(const std::shared_ptr<IORequest> &request) override;
   std::shared_ptr<IORequest> get_next_request() override;
   bool has_requests() const override;
-  void remove_request(std::shared_ptr<IORequest> request) override;
+  void remove_request(const std::shared_ptr<IORequest> &request) override;
   size_t size() const override;
   void clear() override;
   IOSchedulingAlgorithm get_algorithm() const override;
+  void save_state(SnapshotWriter &out) const override;
+  void load_state(SnapshotReader &in) override;
 };
 
 } // namespace OSSimulator
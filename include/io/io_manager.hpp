@@ -1,13 +1,14 @@
 #ifndef IO_MANAGER_HPP
 #define IO_MANAGER_HPP
 
+#include "core/sim_mutex.hpp"
 #include "io/io_device.hpp"
 #include "metrics/metrics_collector.hpp"
 #include <functional>
 #include <map>
 #include <memory>
-#include <mutex>
 #include <string>
+#include <vector>
 
 namespace OSSimulator {
 
@@ -18,14 +19,28 @@ class IOManager {
 private:
   std::map<std::string, std::shared_ptr<IODevice>>
       devices;                      //!< Mapa de dispositivos de E/S.
-  mutable std::mutex manager_mutex; //!< Mutex para sincronización.
+  mutable SimMutex manager_mutex; //!< Activo solo con bloqueo del núcleo.
 
-  using CompletionCallback = std::function<void(std::shared_ptr<Process>, int)>;
+  using CompletionCallback =
+      std::function<void(const std::shared_ptr<Process> &, Tick)>;
   CompletionCallback
       completion_callback; //!< Callback al completar una solicitud.
 
+  using BatchCompletionCallback =
+      std::function<void(const std::vector<IOCompletion> &)>;
+  BatchCompletionCallback
+      batch_completion_callback; //!< Callback por lote de finalizaciones.
+
+  std::vector<IOCompletion>
+      completion_batch; //!< Finalizaciones pendientes de notificar.
+
   std::shared_ptr<MetricsCollector> metrics_collector;
 
+  /**
+   * Notifica las finalizaciones acumuladas y vacía el lote.
+   */
+  void deliver_completions();
+
 public:
   IOManager() = default;
   ~IOManager() = default;
@@ -61,22 +76,53 @@ public:
    */
   void set_completion_callback(CompletionCallback callback);
 
+  /**
+   * Establece un callback que recibe juntas todas las finalizaciones de un
+   * paso. Si está definido, sustituye al callback individual en
+   * execute_all_devices().
+   *
+   * @param callback Función a llamar con las finalizaciones en orden.
+   */
+  void set_batch_completion_callback(BatchCompletionCallback callback);
+
   /**
    * Envía una solicitud de E/S al dispositivo correspondiente.
    *
    * @param request Solicitud de E/S a enviar.
    */
-  void submit_io_request(std::shared_ptr<IORequest> request);
+  void submit_io_request(const std::shared_ptr<IORequest> &request);
 
   /**
    * Ejecuta un paso de simulación en todos los dispositivos.
    *
+   * Cada dispositivo se bloquea una sola vez por lote: sin métricas por tick
+   * avanza el quantum completo de forma independiente y con métricas lo hace
+   * tick a tick. Las finalizaciones se notifican en lote al terminar cada
+   * tick o, sin métricas, al terminar el quantum, ordenadas por tiempo.
+   *
    * @param quantum Quantum de tiempo a ejecutar.
    * @param current_time Tiempo actual del sistema.
    */
-  void execute_all_devices(int quantum, int current_time);
+  void execute_all_devices(Tick quantum, Tick current_time);
 
   void set_metrics_collector(std::shared_ptr<MetricsCollector> collector);
+
+  /**
+   * Activa o desactiva el bloqueo del gestor y de sus dispositivos,
+   * incluidos los que se agreguen después.
+   *
+   * @param enabled true si otros hilos consultan la E/S durante la simulación.
+   */
+  void set_locking(bool enabled);
+
+  /**
+   * Obtiene el próximo tick en el que algún dispositivo producirá un evento.
+   *
+   * @param current_time Tiempo actual del sistema.
+   * @return Tick del próximo evento, o -1 si no hay E/S pendiente.
+   */
+  Tick get_next_event_time(Tick current_time) const;
+
   /**
    * Verifica si hay operaciones de E/S pendientes en algún dispositivo.
    *
@@ -89,13 +135,29 @@ public:
    */
   void reset_all_devices();
 
+  /**
+   * Guarda el estado de todos los dispositivos en una instantánea.
+   *
+   * @param out Instantánea de destino.
+   */
+  void save_state(SnapshotWriter &out) const;
+
+  /**
+   * Restaura el estado de los dispositivos. Los dispositivos declarados
+   * deben ser los mismos que al guardar.
+   *
+   * @param in Instantánea de origen.
+   * @throws std::runtime_error Si los dispositivos no coinciden.
+   */
+  void load_state(SnapshotReader &in);
+
   /**
    * Obtiene todos los dispositivos gestionados.
    *
    * @return Mapa con todos los dispositivos.
    */
   std::map<std::string, std::shared_ptr<IODevice>> get_all_devices() const {
-    std::lock_guard<std::mutex> lock(manager_mutex);
+    std::lock_guard<SimMutex> lock(manager_mutex);
     return devices;
   }
 };
@@ -4,6 +4,7 @@
 #include "core/burst.hpp"
 #include "core/process.hpp"
 #include <memory>
+#include <vector>
 
 namespace OSSimulator {
 
@@ -13,11 +14,14 @@ namespace OSSimulator {
 struct IORequest {
   std::shared_ptr<Process>
       process;         //!< Proceso que realiza la solicitud de E/S.
-  Burst burst;         //!< Ráfaga de E/S a ejecutar.
-  int arrival_time;    //!< Tiempo de llegada de la solicitud.
-  int completion_time; //!< Tiempo de finalización de la solicitud.
-  int start_time;      //!< Tiempo de inicio de ejecución.
-  int priority;        //!< Prioridad de la solicitud.
+  Burst burst;          //!< Ráfaga de E/S a ejecutar.
+  Tick arrival_time;    //!< Tiempo de llegada de la solicitud.
+  Tick completion_time; //!< Tiempo de finalización de la solicitud.
+  Tick start_time;      //!< Tiempo de inicio de ejecución.
+  int priority;         //!< Prioridad de la solicitud.
+  int cylinder;         //!< Cilindro (o LBA) al que accede la solicitud.
+  std::vector<std::shared_ptr<IORequest>>
+      merged; //!< Solicitudes fusionadas en esta; terminan con ella.
 
   /**
    * Constructor por defecto.
@@ -32,7 +36,7 @@ struct IORequest {
    * @param arrival Tiempo de llegada.
    * @param prio Prioridad de la solicitud (por defecto 0).
    */
-  IORequest(std::shared_ptr<Process> proc, const Burst &b, int arrival,
+  IORequest(const std::shared_ptr<Process> &proc, const Burst &b, Tick arrival,
             int prio = 0);
 
   /**
@@ -45,11 +49,20 @@ struct IORequest {
   /**
    * Ejecuta la solicitud de E/S por un quantum de tiempo.
    *
-   * @param quantum Tiempo máximo de ejecución.
+   * @param quantum Tiempo máximo de ejecución (0 = hasta completar).
    * @param current_time Tiempo actual del sistema.
-   * @return Tiempo efectivamente ejecutado.
+   * @param service_rate Unidades de ráfaga atendidas por tick.
+   * @return Tiempo efectivamente ejecutado, en ticks.
    */
-  int execute(int quantum, int current_time);
+  Tick execute(Tick quantum, Tick current_time, int service_rate = 1);
+
+  /**
+   * Obtiene los ticks que faltan para completar la solicitud.
+   *
+   * @param service_rate Unidades de ráfaga atendidas por tick.
+   * @return Ticks restantes.
+   */
+  Tick remaining_ticks(int service_rate = 1) const;
 };
 
 } // namespace OSSimulator
@@ -0,0 +1,104 @@
+#ifndef IO_REQUEST_POOL_HPP
+#define IO_REQUEST_POOL_HPP
+
+#include "io/io_request.hpp"
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace OSSimulator {
+
+/**
+ * Reserva de solicitudes de E/S reutilizables.
+ *
+ * Cada solicitud se crea con std::allocate_shared, de modo que el objeto y su
+ * bloque de control ocupan un único bloque de memoria. Al liberarse la última
+ * referencia el bloque vuelve a la reserva en lugar de devolverse al sistema,
+ * así una ráfaga de E/S no provoca una asignación en el montículo una vez que
+ * la reserva alcanzó el número máximo de solicitudes simultáneas.
+ *
+ * Los punteros entregados siguen siendo std::shared_ptr<IORequest> comunes:
+ * pueden sobrevivir a la reserva y liberarse desde cualquier hilo.
+ */
+class IORequestPool {
+private:
+  /**
+   * Bloques libres compartidos entre la reserva y sus asignadores.
+   */
+  struct Storage {
+    std::mutex mutex;               //!< Protege la lista de bloques libres.
+    std::vector<void *> free_blocks; //!< Bloques disponibles para reutilizar.
+    size_t block_size = 0;           //!< Tamaño de los bloques reservados.
+    size_t allocated_blocks = 0;     //!< Bloques creados desde el sistema.
+
+    ~Storage();
+
+    void *allocate(size_t bytes);
+    void deallocate(void *block, size_t bytes);
+  };
+
+  /**
+   * Asignador usado por std::allocate_shared sobre la reserva.
+   */
+  template <typename T> struct Allocator {
+    using value_type = T;
+
+    std::shared_ptr<Storage> storage; //!< Reserva de origen.
+
+    explicit Allocator(std::shared_ptr<Storage> s) : storage(std::move(s)) {}
+
+    template <typename U>
+    Allocator(const Allocator<U> &other) : storage(other.storage) {}
+
+    T *allocate(size_t n) {
+      return static_cast<T *>(storage->allocate(n * sizeof(T)));
+    }
+
+    void deallocate(T *p, size_t n) { storage->deallocate(p, n * sizeof(T)); }
+
+    template <typename U> bool operator==(const Allocator<U> &other) const {
+      return storage == other.storage;
+    }
+
+    template <typename U> bool operator!=(const Allocator<U> &other) const {
+      return storage != other.storage;
+    }
+  };
+
+  std::shared_ptr<Storage> storage; //!< Bloques de la reserva.
+
+public:
+  IORequestPool();
+
+  /**
+   * Crea una solicitud de E/S reutilizando un bloque libre si existe.
+   *
+   * @param proc Proceso que realiza la solicitud.
+   * @param burst Ráfaga de E/S.
+   * @param arrival Tiempo de llegada.
+   * @param priority Prioridad de la solicitud (por defecto 0).
+   * @return Puntero compartido a la solicitud creada.
+   */
+  std::shared_ptr<IORequest> acquire(const std::shared_ptr<Process> &proc,
+                                     const Burst &burst, Tick arrival,
+                                     int priority = 0);
+
+  /**
+   * Obtiene el número de bloques libres en la reserva.
+   *
+   * @return Bloques disponibles para nuevas solicitudes.
+   */
+  size_t available() const;
+
+  /**
+   * Obtiene el número de bloques creados por la reserva.
+   *
+   * @return Bloques reservados al sistema desde la creación.
+   */
+  size_t allocated() const;
+};
+
+} // namespace OSSimulator
+
+#endif // IO_REQUEST_POOL_HPP
@@ -1,8 +1,8 @@
 #ifndef IO_ROUND_ROBIN_SCHEDULER_HPP
 #define IO_ROUND_ROBIN_SCHEDULER_HPP
 
+#include "core/ring_queue.hpp"
 #include "io/io_scheduler.hpp"
-#include <deque>
 #include <memory>
 
 namespace OSSimulator {
@@ -10,38 +10,40 @@ namespace OSSimulator {
 /**
  * Clase que implementa el algoritmo de planificación Round Robin para E/S.
  */
-class IORoundRobinScheduler : public IOScheduler {
+class IORoundRobinScheduler final : public IOScheduler {
 private:
-  std::deque<std::shared_ptr<IORequest>> queue; //!< Cola de solicitudes de E/S.
+  RingQueue<std::shared_ptr<IORequest>> queue; //!< Cola de solicitudes de E/S.
   int quantum; //!< Quantum de tiempo para cada solicitud.
 
 public:
   /**
    * Constructor con parámetro opcional.
    *
-   * @param q Quantum de tiempo (por defecto 4).
+   * @param q Quantum de tiempo (por defecto 4, al menos 1).
    */
   explicit IORoundRobinScheduler(int q = 4);
 
-  void add_request(std::shared_ptr<IORequest> request) override;
+  void add_request(const std::shared_ptr<IORequest> &request) override;
   std::shared_ptr<IORequest> get_next_request() override;
   bool has_requests() const override;
-  void remove_request(std::shared_ptr<IORequest> request) override;
+  void remove_request(const std::shared_ptr<IORequest> &request) override;
   size_t size() const override;
   void clear() override;
   IOSchedulingAlgorithm get_algorithm() const override;
+  void save_state(SnapshotWriter &out) const override;
+  void load_state(SnapshotReader &in) override;
 
   /**
    * Obtiene el quantum de tiempo.
    *
    * @return Quantum de tiempo.
    */
-  int get_quantum() const;
+  int get_quantum() const override;
 
   /**
    * Establece el quantum de tiempo.
    *
-   * @param q Nuevo quantum de tiempo.
+   * @param q Nuevo quantum de tiempo (al menos 1).
    */
   void set_quantum(int q);
 };
@@ -0,0 +1,30 @@
+#ifndef IO_SCAN_SCHEDULER_HPP
+#define IO_SCAN_SCHEDULER_HPP
+
+#include "io/io_elevator_scheduler.hpp"
+
+namespace OSSimulator {
+
+/**
+ * Planificador de disco SCAN (ascensor). El cabezal recorre el disco hasta un
+ * extremo atendiendo las solicitudes a su paso y luego invierte el sentido.
+ */
+class IOSCANScheduler final : public IOElevatorScheduler {
+private:
+  bool moving_up = true; //!< Sentido actual del cabezal.
+
+protected:
+  RequestMap::iterator select_next() override;
+
+public:
+  using IOElevatorScheduler::IOElevatorScheduler;
+
+  void clear() override;
+  IOSchedulingAlgorithm get_algorithm() const override;
+  void save_state(SnapshotWriter &out) const override;
+  void load_state(SnapshotReader &in) override;
+};
+
+} // namespace OSSimulator
+
+#endif // IO_SCAN_SCHEDULER_HPP
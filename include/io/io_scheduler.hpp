@@ -2,30 +2,84 @@
 #define IO_SCHEDULER_HPP
 
 #include "io/io_request.hpp"
+#include <cstdlib>
 #include <memory>
+#include <stdexcept>
 
 namespace OSSimulator {
 
+class SnapshotReader;
+class SnapshotWriter;
+
 enum class IOSchedulingAlgorithm {
   FCFS,        //!< First Come, First Served
   SJF,         //!< Shortest Job First
   ROUND_ROBIN, //!< Round Robin
-  PRIORITY     //!< Priority
+  PRIORITY,    //!< Priority
+  SSTF,        //!< Shortest Seek Time First
+  SCAN,        //!< Ascensor de extremo a extremo
+  C_SCAN,      //!< Ascensor circular de extremo a extremo
+  C_LOOK       //!< Ascensor circular entre solicitudes
 };
 
 /**
  * Clase base abstracta para los algoritmos de planificación de E/S.
+ *
+ * Lleva la posición del cabezal: cada solicitud entregada por
+ * get_next_request() lo mueve a su cilindro y acumula la distancia
+ * recorrida, que el dispositivo convierte en tiempo de búsqueda.
  */
 class IOScheduler {
+protected:
+  int head_position = 0; //!< Cilindro actual del cabezal.
+  int seek_distance = 0; //!< Cilindros recorridos desde la última consulta.
+
+  /**
+   * Mueve el cabezal a un cilindro acumulando la distancia recorrida.
+   *
+   * @param cylinder Cilindro destino.
+   */
+  void move_head(int cylinder) {
+    seek_distance += std::abs(cylinder - head_position);
+    head_position = cylinder;
+  }
+
+  /**
+   * Devuelve el cabezal al cilindro 0 sin contar la distancia.
+   */
+  void reset_head() {
+    head_position = 0;
+    seek_distance = 0;
+  }
+
 public:
   virtual ~IOScheduler() = default;
 
+  /**
+   * Obtiene el cilindro actual del cabezal.
+   *
+   * @return Cilindro de la última solicitud entregada.
+   */
+  int get_head_position() const { return head_position; }
+
+  /**
+   * Obtiene los cilindros recorridos desde la última consulta y reinicia
+   * el contador.
+   *
+   * @return Distancia recorrida por el cabezal.
+   */
+  int take_seek_distance() {
+    int distance = seek_distance;
+    seek_distance = 0;
+    return distance;
+  }
+
   /**
    * Agrega una solicitud de E/S a la cola.
    *
    * @param request Solicitud de E/S a agregar.
    */
-  virtual void add_request(std::shared_ptr<IORequest> request) = 0;
+  virtual void add_request(const std::shared_ptr<IORequest> &request) = 0;
 
   /**
    * Obtiene la siguiente solicitud de E/S a ejecutar.
@@ -46,7 +100,20 @@ public:
    *
    * @param request Solicitud de E/S a eliminar.
    */
-  virtual void remove_request(std::shared_ptr<IORequest> request) = 0;
+  virtual void remove_request(const std::shared_ptr<IORequest> &request) = 0;
+
+  /**
+   * Notifica que una solicitud en cola cambió de cilindro al fusionarse con
+   * otra. Las colas que no ordenan por cilindro no necesitan hacer nada.
+   *
+   * @param request Solicitud modificada, aún en la cola.
+   * @param old_cylinder Cilindro con el que se agregó.
+   */
+  virtual void update_request(const std::shared_ptr<IORequest> &request,
+                              int old_cylinder) {
+    (void)request;
+    (void)old_cylinder;
+  }
 
   /**
    * Obtiene el número de solicitudes de E/S en la cola.
@@ -66,6 +133,36 @@ public:
    * @return Algoritmo de planificación de E/S.
    */
   virtual IOSchedulingAlgorithm get_algorithm() const = 0;
+
+  /**
+   * Obtiene los ticks que se atiende una solicitud antes de volver a la
+   * cola si hay otras esperando.
+   *
+   * @return Quantum en ticks, o 0 si cada solicitud se atiende hasta
+   * terminar.
+   */
+  virtual int get_quantum() const { return 0; }
+
+  /**
+   * Guarda las solicitudes en cola y la posición del cabezal en una
+   * instantánea.
+   *
+   * @param out Instantánea de destino.
+   * @throws std::runtime_error Si el algoritmo no admite instantáneas.
+   */
+  virtual void save_state(SnapshotWriter & /*out*/) const {
+    throw std::runtime_error("El planificador de E/S no admite instantáneas");
+  }
+
+  /**
+   * Restaura el estado guardado con save_state().
+   *
+   * @param in Instantánea de origen.
+   * @throws std::runtime_error Si el algoritmo no admite instantáneas.
+   */
+  virtual void load_state(SnapshotReader & /*in*/) {
+    throw std::runtime_error("El planificador de E/S no admite instantáneas");
+  }
 };
 
 } // namespace OSSimulator
@@ -0,0 +1,24 @@
+#ifndef IO_SSTF_SCHEDULER_HPP
+#define IO_SSTF_SCHEDULER_HPP
+
+#include "io/io_elevator_scheduler.hpp"
+
+namespace OSSimulator {
+
+/**
+ * Planificador de disco Shortest Seek Time First (SSTF). Atiende la solicitud
+ * más cercana al cabezal.
+ */
+class IOSSTFScheduler final : public IOElevatorScheduler {
+protected:
+  RequestMap::iterator select_next() override;
+
+public:
+  using IOElevatorScheduler::IOElevatorScheduler;
+
+  IOSchedulingAlgorithm get_algorithm() const override;
+};
+
+} // namespace OSSimulator
+
+#endif // IO_SSTF_SCHEDULER_HPP
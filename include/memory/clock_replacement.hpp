@@ -0,0 +1,56 @@
+#ifndef CLOCK_REPLACEMENT_HPP
+#define CLOCK_REPLACEMENT_HPP
+
+#include "memory/replacement_algorithm.hpp"
+#include <cstddef>
+
+namespace OSSimulator {
+
+/**
+ * Implementación del algoritmo de reemplazo Clock (segunda oportunidad).
+ *
+ * Una manecilla recorre los marcos en orden circular. Cada marco tiene un bit
+ * de uso que se activa al cargarlo o cuando su proceso entra en CPU; si la
+ * manecilla lo encuentra activo lo limpia y sigue, si no, el marco es la
+ * víctima. Los marcos cuya página está referenciada (proceso en CPU o
+ * esperando el resto de sus páginas) se saltan sin tocar su bit.
+ */
+class ClockReplacement : public ReplacementAlgorithm {
+public:
+  int select_victim(
+      const std::vector<Frame> &frames,
+      const std::unordered_map<int, std::shared_ptr<Process>> &process_map,
+      Tick current_time) override;
+
+  void on_page_access(int frame_id) override;
+  void on_frame_release(int frame_id) override;
+  void on_process_referenced(const Process &process, bool referenced) override;
+  void on_frame_referenced(int frame_id) override;
+  void save_state(SnapshotWriter &out) const override;
+  void load_state(SnapshotReader &in) override;
+
+protected:
+  std::vector<bool> use_bit; //!< Bit de uso de cada marco.
+  std::vector<bool> pinned;  //!< Marcos con la página referenciada.
+  std::size_t hand = 0;      //!< Posición de la manecilla.
+
+  /**
+   * Asegura que los vectores por marco cubran un índice.
+   *
+   * @param frame_id ID del marco.
+   */
+  void ensure_frame(int frame_id);
+
+  /**
+   * Indica si la manecilla debe saltar un marco por no ser reemplazable.
+   *
+   * @param frames Lista de marcos de memoria.
+   * @param frame_id ID del marco.
+   * @return true si el marco está libre o su página está referenciada.
+   */
+  bool is_skipped(const std::vector<Frame> &frames, std::size_t frame_id) const;
+};
+
+} // namespace OSSimulator
+
+#endif
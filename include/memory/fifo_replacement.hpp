@@ -2,26 +2,47 @@
 #define FIFO_REPLACEMENT_HPP
 
 #include "memory/replacement_algorithm.hpp"
-#include <list>
+#include <cstddef>
 
 namespace OSSimulator {
 
 /**
  * Implementación del algoritmo de reemplazo FIFO.
+ *
+ * El orden de llegada se guarda en un anillo de índices de marcos. Cada marco
+ * recuerda su posición en el anillo, así que encolarlo o retirarlo cuesta O(1):
+ * un marco liberado deja un hueco que se descarta al llegar a la cabeza o al
+ * compactar el anillo cuando se llena.
  */
-class FIFOReplacement : public ReplacementAlgorithm {
+class FIFOReplacement final : public ReplacementAlgorithm {
 public:
   int select_victim(
       const std::vector<Frame> &frames,
       const std::unordered_map<int, std::shared_ptr<Process>> &process_map,
-      int current_time) override;
+      Tick current_time) override;
 
   void on_page_access(int frame_id) override;
   void on_frame_release(int frame_id) override;
+  void save_state(SnapshotWriter &out) const override;
+  void load_state(SnapshotReader &in) override;
 
 private:
-  std::list<int>
-      fifo_queue; //!< Cola para mantener el orden de llegada de las páginas.
+  std::vector<int> ring;     //!< Marcos en orden de llegada (-1 si hueco).
+  std::vector<int> position; //!< Posición de cada marco en el anillo (-1 si no está).
+  std::size_t head = 0;      //!< Posición del marco más antiguo.
+  std::size_t used = 0;      //!< Posiciones ocupadas, incluidos huecos.
+  std::size_t live = 0;      //!< Marcos realmente encolados.
+
+  /**
+   * Avanza la cabeza sobre los huecos dejados por marcos liberados.
+   */
+  void skip_holes();
+
+  /**
+   * Reconstruye el anillo sin huecos, duplicando su capacidad si no había
+   * huecos que descartar.
+   */
+  void compact();
 };
 
 } // namespace OSSimulator
@@ -0,0 +1,74 @@
+#ifndef FREE_FRAME_SET_HPP
+#define FREE_FRAME_SET_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace OSSimulator {
+
+/**
+ * Conjunto de marcos libres basado en un mapa de bits jerárquico.
+ *
+ * Cada nivel resume 64 palabras del nivel inferior, de modo que obtener el
+ * marco libre de menor índice, ocuparlo o liberarlo cuesta O(log64 n),
+ * es decir, a lo sumo cuatro palabras para un millón de marcos.
+ */
+class FreeFrameSet {
+private:
+  std::vector<std::vector<uint64_t>>
+      levels;       //!< levels[0] marca los marcos libres; el resto resume.
+  int total_frames; //!< Número de marcos administrados.
+  int free_frames;  //!< Número de marcos libres.
+
+  void set_bit(int frame_id);
+  void clear_bit(int frame_id);
+
+public:
+  /**
+   * Constructor. Todos los marcos comienzan libres.
+   *
+   * @param total_frames Número de marcos administrados.
+   */
+  explicit FreeFrameSet(int total_frames = 0);
+
+  /**
+   * Obtiene el marco libre de menor índice.
+   *
+   * @return Índice del marco, o -1 si no hay marcos libres.
+   */
+  int first_free() const;
+
+  /**
+   * Marca un marco como ocupado.
+   *
+   * @param frame_id Índice del marco.
+   */
+  void mark_used(int frame_id);
+
+  /**
+   * Marca un marco como libre.
+   *
+   * @param frame_id Índice del marco.
+   */
+  void mark_free(int frame_id);
+
+  /**
+   * Verifica si un marco está libre.
+   *
+   * @param frame_id Índice del marco.
+   * @return true si el marco está libre.
+   */
+  bool is_free(int frame_id) const;
+
+  /**
+   * Obtiene el número de marcos libres.
+   *
+   * @return Cantidad de marcos libres.
+   */
+  int free_count() const;
+};
+
+} // namespace OSSimulator
+
+#endif
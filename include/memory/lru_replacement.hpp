@@ -7,13 +7,36 @@ namespace OSSimulator {
 
 /**
  * Implementación del algoritmo de reemplazo Least Recently Used (LRU).
+ *
+ * Mantiene los marcos en una lista intrusiva ordenada por recencia (del menos
+ * al más reciente), de modo que la víctima es el primer marco de la lista cuya
+ * página no esté referenciada, sin recorrer toda la memoria.
  */
-class LRUReplacement : public ReplacementAlgorithm {
+class LRUReplacement final : public ReplacementAlgorithm {
 public:
   int select_victim(
       const std::vector<Frame> &frames,
       const std::unordered_map<int, std::shared_ptr<Process>> &process_map,
-      int current_time) override;
+      Tick current_time) override;
+
+  void on_page_access(int frame_id) override;
+  void on_frame_release(int frame_id) override;
+  void save_state(SnapshotWriter &out) const override;
+  void load_state(SnapshotReader &in) override;
+
+private:
+  std::vector<int> prev;     //!< Marco anterior en la lista (-1 si ninguno).
+  std::vector<int> next;     //!< Marco siguiente en la lista (-1 si ninguno).
+  std::vector<bool> linked;  //!< Indica si el marco está en la lista.
+  int head = -1;             //!< Marco usado hace más tiempo.
+  int tail = -1;             //!< Marco usado más recientemente.
+
+  /**
+   * Quita un marco de la lista de recencia.
+   *
+   * @param frame_id ID del marco.
+   */
+  void unlink(int frame_id);
 };
 
 } // namespace OSSimulator
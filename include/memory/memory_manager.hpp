@@ -1,27 +1,42 @@
 #ifndef MEMORY_MANAGER_HPP
 #define MEMORY_MANAGER_HPP
 
+#include "core/ring_queue.hpp"
+#include "core/sim_mutex.hpp"
+#include "memory/free_frame_set.hpp"
 #include "memory/replacement_algorithm.hpp"
-#include <deque>
+#include "memory/tlb.hpp"
+#include "metrics/metrics_collector.hpp"
 #include <functional>
 #include <memory>
-#include <mutex>
-#include <optional>
+#include <string>
 #include <unordered_map>
-#include <unordered_set>
+#include <utility>
 #include <vector>
 
 namespace OSSimulator {
 
 struct Process;
-class MetricsCollector;
+class SnapshotReader;
+class SnapshotWriter;
+
+/**
+ * Política de colocación de las páginas en los nodos NUMA.
+ */
+enum class NumaPolicy {
+  FIRST_TOUCH, //!< Nodo del núcleo donde corre el proceso que falla.
+  INTERLEAVE,  //!< Nodos alternados por número de página.
+  BIND         //!< Nodo fijo de cada proceso (PID módulo nodos).
+};
 
 /**
  * Clase que gestiona la memoria en la simulación.
  */
 class MemoryManager {
 public:
-  using ProcessReadyCallback = std::function<void(std::shared_ptr<Process>)>;
+  /// Recibe el proceso y el tick en que se cargó su última página.
+  using ProcessReadyCallback =
+      std::function<void(const std::shared_ptr<Process> &, Tick)>;
 
   /**
    * Constructor parametrizado.
@@ -34,11 +49,116 @@ public:
                 int page_fault_latency = 1);
 
   /**
-   * Registra un proceso para gestión de memoria.
+   * Establece cuántas cargas de página pueden atenderse en paralelo, como
+   * las colas de un dispositivo de intercambio NVMe.
+   *
+   * @param channels Canales de carga simultáneos (mínimo 1).
+   */
+  void set_fault_channels(int channels);
+
+  /**
+   * Establece la precarga de páginas. Al iniciar una carga, el canal toma
+   * también otras páginas encoladas del mismo proceso, hasta completar el
+   * lote, y todas terminan tras una sola latencia de fallo.
+   *
+   * @param pages Páginas máximas por lote (0 o 1 desactivan la precarga).
+   */
+  void set_prefetch_pages(int pages);
+
+  /**
+   * Activa la paginación por demanda. En lugar de exigir todas las páginas
+   * del proceso residentes, cada tick de CPU accede a una página y solo
+   * falla la que se referencia. La página del acceso i es la posición i del
+   * rastro de accesos (que se repite al agotarse) o, sin rastro, la que da
+   * el modelo de localidad.
+   *
+   * @param enabled true para paginación por demanda.
+   */
+  void set_demand_paging(bool enabled);
+
+  /**
+   * Configura el modelo de localidad de los procesos sin rastro: los
+   * accesos recorren una ventana de páginas consecutivas que avanza una
+   * página cada cierto número de accesos.
+   *
+   * @param window Páginas de la ventana (mínimo 1).
+   * @param shift Accesos entre desplazamientos de la ventana (mínimo 1).
+   */
+  void set_locality(int window, int shift);
+
+  /**
+   * Activa el control de carga por conjunto de trabajo. Un proceso solo se
+   * admite si la suma de los conjuntos de trabajo admitidos, incluido el
+   * suyo, cabe en los marcos físicos; si no, su admisión se difiere hasta
+   * que termine otro proceso o se reduzca la demanda. Sin paginación por
+   * demanda el conjunto de trabajo son todas las páginas del proceso; con
+   * ella, las páginas distintas de los últimos accesos de la ventana.
+   *
+   * @param enabled true para diferir admisiones que provocarían hiperpaginación.
+   * @param window Accesos considerados en el conjunto de trabajo (mínimo 1).
+   */
+  void set_load_control(bool enabled, int window);
+
+  /**
+   * Reserva marcos de página grande. Cada marco grande ocupa page_size
+   * marcos base de la memoria, y los procesos mapean sus regiones alineadas
+   * de page_size páginas con una sola entrada de la tabla de páginas, que
+   * falla y se carga de una vez. Cada tamaño de marco tiene su propia
+   * instancia del algoritmo de reemplazo. Debe llamarse antes de asignar
+   * memoria a los procesos.
+   *
+   * @param page_size Páginas base por página grande (mínimo 2).
+   * @param count Marcos grandes a reservar; se limita para dejar al menos
+   * page_size marcos base.
+   * @param algo Algoritmo de reemplazo para los marcos grandes.
+   */
+  void set_huge_pages(int page_size, int count,
+                      std::unique_ptr<ReplacementAlgorithm> algo);
+
+  /**
+   * Activa una TLB por núcleo delante de las tablas de páginas. Cada
+   * acceso de access_pages consulta la TLB del núcleo y, en un fallo,
+   * recorre la tabla y carga la traducción.
+   *
+   * @param entries Entradas por TLB (0 la desactiva).
+   * @param ways Entradas por conjunto.
+   * @param tagged true para etiquetar las entradas con el proceso (ASID) en
+   * lugar de vaciar la TLB en cada cambio de contexto.
+   */
+  void set_tlb(int entries, int ways, bool tagged);
+
+  /**
+   * Reparte la memoria en nodos NUMA. Cada nodo recibe una parte contigua
+   * de los marcos base, con su propia lista de libres, y de los grandes, y
+   * los núcleos se reparten entre los nodos en bloques consecutivos. Una
+   * página base se coloca en el nodo que indica la política y, si no tiene
+   * marcos libres, en el primero de otro nodo que los tenga; las páginas
+   * grandes toman el primer marco grande libre y el reemplazo sigue siendo
+   * global. Debe llamarse antes de asignar memoria a los
+   * procesos y después de set_huge_pages().
+   *
+   * @param nodes Nodos de memoria (1 desactiva NUMA).
+   * @param policy Política de colocación de las páginas.
+   * @param remote_latency Ticks extra de un acceso o una carga remotos.
+   * @param cores Núcleos de CPU simulados.
+   */
+  void set_numa(int nodes, NumaPolicy policy, int remote_latency, int cores);
+
+  /**
+   * Notifica un cambio de contexto en un núcleo; sin ASID vacía su TLB.
+   *
+   * @param core Núcleo que cambió de proceso.
+   */
+  void switch_context(int core);
+
+  /**
+   * Registra un proceso para gestión de memoria. Sus mapeos compartidos se
+   * enlazan a las regiones del mismo nombre, que se crean con el primer
+   * proceso que las declara.
    *
    * @param process Proceso a registrar.
    */
-  void register_process(std::shared_ptr<Process> process);
+  void register_process(const std::shared_ptr<Process> &process);
 
   /**
    * Elimina el registro de un proceso.
@@ -61,6 +181,13 @@ public:
    */
   void set_metrics_collector(std::shared_ptr<MetricsCollector> collector);
 
+  /**
+   * Activa o desactiva el bloqueo interno del gestor.
+   *
+   * @param enabled true si otros hilos lo consultan durante la simulación.
+   */
+  void set_locking(bool enabled);
+
   /**
    * Intenta asignar memoria inicial al proceso.
     *
@@ -70,14 +197,50 @@ public:
   bool allocate_initial_memory(Process &process);
 
   /**
-   * Prepara un proceso para ser ejecutado en CPU.
+   * Decide la admisión de un proceso con memoria inicial asignada según el
+   * control de carga. Siempre se admite si no hay otro proceso admitido.
+   *
+   * @param process Proceso que llega.
+   * @param current_time Tiempo actual, para medir la espera de admisión.
+   * @return true si puede admitirse; siempre true sin control de carga.
+   */
+  bool admit_process(const Process &process, Tick current_time);
+
+  /**
+   * Prepara un proceso para ser ejecutado en CPU. Las páginas compartidas
+   * que ya cargó otro proceso se mapean sin fallo de página. Con paginación
+   * por demanda, si el próximo acceso escribe una página compartida se
+   * encola un fallo de copia al escribir. Con varios nodos NUMA, si el
+   * proceso queda listo y su próximo acceso cae en un marco de otro nodo,
+   * stall recibe la latencia remota, una sola vez por acceso.
    *
     * @param process Proceso a preparar.
    * @param current_time Tiempo actual de la simulación.
+   * @param core Núcleo que ejecutará el proceso (elige su nodo).
+   * @param stall Recibe los ticks de espera del acceso remoto, o 0.
    * @return true si el proceso está listo para CPU, false si hay faltas de página pendientes.
    */
-  bool prepare_process_for_cpu(std::shared_ptr<Process> process,
-                               int current_time);
+  bool prepare_process_for_cpu(const std::shared_ptr<Process> &process,
+                               Tick current_time, int core = 0,
+                               Tick *stall = nullptr);
+
+  /**
+   * Registra los accesos a memoria de los próximos ticks de CPU de un
+   * proceso ya preparado y devuelve cuántos pueden ejecutarse sin fallo.
+   * Un acceso de escritura marca la página como modificada, y se corta
+   * antes de escribir una página que otro proceso sigue compartiendo. Fuera
+   * de la paginación por demanda solo consulta la TLB. Con varios nodos
+   * NUMA cuenta además los accesos locales y remotos.
+   *
+   * @param process Proceso en ejecución.
+   * @param max_ticks Ticks que se pretende ejecutar.
+   * @param current_time Tiempo del primer acceso.
+   * @param core Núcleo que ejecuta el proceso (elige la TLB).
+   * @return Ticks consecutivos cuyas páginas están residentes, hasta
+   * max_ticks.
+   */
+  Tick access_pages(Process &process, Tick max_ticks, Tick current_time,
+                   int core = 0);
 
   /**
    * Avanza la cola de fallos de página en el tiempo.
@@ -85,7 +248,18 @@ public:
     * @param duration Duración del avance en ticks.
     * @param start_time Tiempo de inicio para el avance.
    */
-  void advance_fault_queue(int duration, int start_time);
+  void advance_fault_queue(Tick duration, Tick start_time);
+
+  /**
+   * Obtiene el próximo tick en el que la cola de fallos producirá un cambio.
+   * Si hay un canal libre y tareas encoladas es el tick actual (puede
+   * iniciarse una carga); si no, el tick en que termina la primera carga
+   * activa.
+   *
+   * @param current_time Tiempo actual de la simulación.
+   * @return Tick del próximo evento, o -1 si no hay cargas pendientes.
+   */
+  Tick get_next_event_time(Tick current_time) const;
 
   /**
    * Marca un proceso como inactivo respecto a la memoria.
@@ -106,14 +280,97 @@ public:
    *
     * @return Número total de fallos de página.
    */
-  int get_total_page_faults() const;
+  int64_t get_total_page_faults() const;
 
   /**
    * Obtiene el número total de reemplazos de páginas realizados.
     *
       * @return Número total de reemplazos.
    */
-  int get_total_replacements() const;
+  int64_t get_total_replacements() const;
+
+  /**
+   * Obtiene cuántos fallos de página fueron copias al escribir una página
+   * compartida. También cuentan en get_total_page_faults().
+   *
+   * @return Fallos de copia al escribir.
+   */
+  int64_t get_cow_faults() const;
+
+  /**
+   * Obtiene cuántos procesos vieron diferida su admisión.
+   *
+   * @return Número de admisiones diferidas.
+   */
+  int64_t get_deferred_admissions() const;
+
+  /**
+   * Obtiene la suma de los ticks que esperaron las admisiones diferidas.
+   *
+   * @return Ticks de espera de admisión.
+   */
+  Tick get_deferral_ticks() const;
+
+  /**
+   * Obtiene el máximo de memoria ocupada a la vez durante la simulación,
+   * en marcos base (un marco grande cuenta todas sus páginas).
+   *
+   * @return Marcos base ocupados en el pico de uso.
+   */
+  int get_peak_used_frames() const;
+
+  /**
+   * Obtiene las traducciones encontradas en las TLB de todos los núcleos.
+   *
+   * @return Aciertos de TLB.
+   */
+  int64_t get_tlb_hits() const;
+
+  /**
+   * Obtiene las traducciones que fallaron en la TLB y recorrieron la tabla.
+   *
+   * @return Fallos de TLB.
+   */
+  int64_t get_tlb_misses() const;
+
+  /**
+   * Contadores de un nodo NUMA. Los fallos y los accesos se atribuyen al
+   * nodo del núcleo que ejecutaba el proceso.
+   */
+  struct NumaStats {
+    int frames = 0;               //!< Memoria del nodo, en marcos base.
+    int64_t page_faults = 0;      //!< Fallos de página de sus núcleos.
+    int64_t local_accesses = 0;   //!< Accesos a marcos del mismo nodo.
+    int64_t remote_accesses = 0;  //!< Accesos a marcos de otro nodo.
+    int64_t remote_loads = 0;     //!< Cargas colocadas en otro nodo.
+    Tick remote_stall_ticks = 0;  //!< Ticks de espera por accesos remotos.
+  };
+
+  /**
+   * Obtiene los contadores de cada nodo NUMA (uno solo sin NUMA).
+   *
+   * @return Contadores por nodo.
+   */
+  const std::vector<NumaStats> &get_numa_stats() const;
+
+  /**
+   * Guarda el estado de la memoria en una instantánea: marcos, cargas en
+   * curso y encoladas, admisiones, TLB, contadores y el estado de los
+   * algoritmos de reemplazo. Las tablas de páginas se guardan con cada
+   * proceso.
+   *
+   * @param out Instantánea de destino.
+   */
+  void save_state(SnapshotWriter &out) const;
+
+  /**
+   * Restaura el estado guardado con save_state(). La cantidad de marcos y
+   * de marcos grandes debe coincidir con la configuración actual.
+   *
+   * @param in Instantánea de origen; resuelve los procesos por PID.
+   * @throws std::runtime_error Si la instantánea no coincide.
+   */
+  void load_state(SnapshotReader &in);
 
   /**
    * Registra el estado de la tabla de páginas de un proceso en las métricas.
@@ -121,58 +378,366 @@ public:
    * @param tick Tick actual.
    * @param pid ID del proceso.
    */
-  void log_process_page_table(int tick, int pid);
+  void log_process_page_table(Tick tick, int pid);
 
   /**
-   * Registra el estado de todos los marcos de memoria en las métricas.
+   * Registra en las métricas los marcos modificados desde el último registro.
    *
    * @param tick Tick actual.
    */
-  void log_all_frames_status(int tick);
+  void log_all_frames_status(Tick tick);
 
 private:
-  int total_frames; //!< Número de marcos físicos.
+  int total_frames; //!< Número de marcos físicos (base y grandes).
+  int memory_pages; //!< Memoria total en marcos base.
+  int base_frames;  //!< Marcos base; los grandes van a continuación.
+  int huge_page_size = 0;   //!< Páginas base por página grande.
+  int huge_frame_count = 0; //!< Marcos grandes reservados.
   std::unique_ptr<ReplacementAlgorithm>
       algorithm;          //!< Algoritmo de reemplazo usado.
+  std::unique_ptr<ReplacementAlgorithm>
+      huge_algorithm;     //!< Algoritmo de reemplazo de los marcos grandes.
   int page_fault_latency; //!< Latencia para cargar páginas.
 
   std::vector<Frame> frames; //!< Marcos físicos.
+  std::vector<FreeFrameSet>
+      free_frames; //!< Marcos base libres de cada nodo (índice relativo).
+  FreeFrameSet free_huge_frames; //!< Marcos grandes libres (índice relativo).
+  std::unordered_map<int, std::vector<int>>
+      frames_by_process;       //!< Marcos asignados a cada proceso.
+  std::vector<int> frame_slot; //!< Posición de cada marco en su lista.
+  std::vector<bool> frame_dirty; //!< Marcos cambiados desde el último registro.
+  std::vector<int> dirty_frames; //!< Índices de los marcos cambiados.
+  std::vector<int> mapper_scratch; //!< Mapeadores del marco expulsado.
   std::unordered_map<int, std::shared_ptr<Process>>
       process_map;   //!< Procesos registrados.
-  std::mutex mutex_; //!< Mutex para operaciones internas.
+  mutable SimMutex mutex_; //!< Activo solo con bloqueo del núcleo.
 
   std::shared_ptr<MetricsCollector>
       metrics_collector; //!< Recolector de métricas.
 
   struct PageLoadTask {
     std::shared_ptr<Process> process; //!< Proceso al que pertenece la página.
-    int page_id;                      //!< ID de la página a cargar.
+    Tick enqueue_time;  //!< Tiempo en que se encoló la tarea.
+    int page_id;        //!< ID de la página a cargar.
     int remaining_time; //!< Tiempo restante para completar la carga.
     int frame_id;       //!< Marco destino (si reservado).
-    int enqueue_time;   //!< Tiempo en que se encoló la tarea.
+    std::vector<std::pair<int, int>>
+        prefetched; //!< Páginas precargadas en el lote (página, marco).
+    bool copy = false; //!< Copia al escribir una página compartida.
+    int node = 0;      //!< Nodo preferido para el marco.
   };
 
-  std::deque<PageLoadTask>
+  RingQueue<PageLoadTask>
       fault_queue; //!< Cola de cargas pendientes por fallo de página.
-  std::optional<PageLoadTask>
-      active_task; //!< Tarea de carga activa (si existe).
-  std::unordered_map<int, std::unordered_set<int>>
-      pending_pages_by_process; //!< Páginas pendientes por proceso.
-  std::unordered_set<int>
-      processes_waiting_on_memory; //!< PIDs esperando memoria.
+  std::vector<PageLoadTask>
+      active_tasks;       //!< Cargas en curso, una por canal ocupado.
+  int fault_channels = 1; //!< Canales de carga simultáneos.
+  int prefetch_pages = 0; //!< Páginas máximas por lote (0 = sin precarga).
+  bool demand_paging = false; //!< Falla solo la página accedida en cada tick.
+  int locality_window = 4;    //!< Páginas de la ventana de localidad.
+  int locality_shift = 8;     //!< Accesos entre desplazamientos de la ventana.
+  std::vector<bool> frame_loading; //!< Marcos reservados por una carga en curso.
+  bool load_control = false;  //!< Difiere admisiones que exceden los marcos.
+  int working_set_window = 10; //!< Accesos del conjunto de trabajo.
+  std::unordered_map<int, int>
+      admitted_demand;    //!< Conjunto de trabajo de cada proceso admitido.
+  int admitted_frames = 0; //!< Suma de los conjuntos de trabajo admitidos.
+  std::unordered_map<int, Tick>
+      deferred_since;     //!< Tick de la primera admisión diferida por PID.
+  int64_t deferred_admissions = 0; //!< Procesos con la admisión diferida.
+  Tick deferral_ticks = 0;         //!< Ticks esperados por admisión diferida.
+  int peak_used_frames = 0;        //!< Máximo de marcos ocupados a la vez.
+  int tlb_entries = 0;             //!< Entradas por TLB (0 = sin TLB).
+  int tlb_ways = 1;                //!< Entradas por conjunto de la TLB.
+  bool tlb_tagged = false;         //!< TLB etiquetada con ASID.
+  std::vector<TLB> tlbs;           //!< TLB de cada núcleo, creadas al usarse.
+  int numa_nodes = 1;              //!< Nodos de memoria.
+  NumaPolicy numa_policy = NumaPolicy::FIRST_TOUCH; //!< Colocación.
+  int remote_latency = 0;          //!< Ticks extra de un acceso remoto.
+  int cpu_cores = 1;               //!< Núcleos repartidos entre los nodos.
+  std::vector<int> frame_node;     //!< Nodo de cada marco.
+  std::vector<int> node_first;     //!< Primer marco base de cada nodo.
+  std::vector<NumaStats> numa_stats; //!< Contadores de cada nodo.
+
+  /**
+   * Espera de memoria de un proceso. La entrada vive mientras el proceso
+   * esté registrado, así que los fallos repetidos reutilizan su capacidad.
+   */
+  struct MemoryWait {
+    std::vector<int> pending; //!< Páginas con carga pendiente, ordenadas.
+    bool waiting = false;     //!< El proceso espera a que terminen.
+    int node = 0;             //!< Nodo del núcleo donde se preparó.
+    Tick stalled_access = -1; //!< Último acceso remoto ya cobrado.
+  };
+
+  /**
+   * Región de memoria compartida. Cada página se carga una vez en un marco
+   * que mapean todos los procesos de la región que no la han copiado.
+   */
+  struct SharedRegion {
+    std::string name;           //!< Nombre declarado en los procesos.
+    std::vector<int> frames;    //!< Marco de cada página (-1 = sin cargar).
+    std::vector<int> mappers;   //!< Procesos registrados que la mapean.
+  };
+
+  /**
+   * Mapeo de una región compartida en la tabla de páginas de un proceso.
+   * Las páginas compartidas son siempre entradas de página base.
+   */
+  struct RegionMapping {
+    int region;               //!< Índice de la región compartida.
+    int first_entry;          //!< Entrada de la página 0 de la región.
+    std::vector<bool> copied; //!< Páginas ya copiadas al escribirlas.
+  };
+
+  std::unordered_map<int, MemoryWait>
+      memory_waits; //!< Espera de memoria por PID.
+  std::unordered_map<std::string, int>
+      region_ids; //!< Índice de cada región compartida por nombre.
+  std::vector<SharedRegion> shared_regions; //!< Regiones compartidas.
+  std::unordered_map<int, std::vector<RegionMapping>>
+      region_mappings; //!< Mapeos compartidos de cada proceso registrado.
+  std::vector<std::shared_ptr<Process>>
+      ready_scratch; //!< Procesos que un tick de carga dejó listos.
+  std::vector<MetricsCollector::PageTableEntry>
+      page_table_scratch; //!< Tabla de páginas enviada al recolector.
+  std::vector<MetricsCollector::FrameStatusEntry>
+      frame_status_scratch; //!< Marcos cambiados enviados al recolector.
   ProcessReadyCallback
-      ready_callback;  //!< Callback a invocar cuando un proceso quede listo.
-  int memory_time = 0; //!< Reloj interno para la gestión de memoria.
+      ready_callback;   //!< Callback a invocar cuando un proceso quede listo.
+  Tick memory_time = 0; //!< Reloj interno para la gestión de memoria.
 
-  int total_page_faults = 0;  //!< Contador total de fallos de página.
-  int total_replacements = 0; //!< Contador total de reemplazos.
+  int64_t total_page_faults = 0;  //!< Contador total de fallos de página.
+  int64_t total_replacements = 0; //!< Contador total de reemplazos.
+  int64_t total_cow_faults = 0;   //!< Fallos de copia al escribir.
+
+  /**
+   * Inicializa los marcos físicos, todos libres.
+   */
+  void reset_frames();
+
+  /**
+   * Obtiene la TLB de un núcleo, creándola si hace falta.
+   *
+   * @param core Núcleo.
+   * @return TLB del núcleo, o nullptr si no hay TLB.
+   */
+  TLB *tlb_for(int core);
 
   /**
-   * Busca un marco físico libre.
+   * Busca un marco físico libre del tamaño de una página, primero en el
+   * nodo preferido y luego en los siguientes.
    *
+   * @param page_size Páginas base de la página a cargar.
+   * @param node Nodo preferido.
    * @return Índice del marco libre, o -1 si no hay ninguno.
    */
-  int find_free_frame();
+  int find_free_frame(int page_size, int node = 0);
+
+  /**
+   * Obtiene el nodo NUMA de un núcleo.
+   *
+   * @param core Núcleo.
+   * @return Nodo del núcleo.
+   */
+  int node_of_core(int core) const;
+
+  /**
+   * Elige el nodo preferido para una página según la política NUMA.
+   *
+   * @param process Proceso que falla.
+   * @param page_id Entrada de su tabla de páginas.
+   * @param node Nodo del núcleo donde corre el proceso.
+   * @return Nodo preferido.
+   */
+  int placement_node(const Process &process, int page_id, int node);
+
+  /**
+   * Cobra la latencia remota si el próximo acceso de un proceso listo cae
+   * en un marco de otro nodo y aún no se cobró.
+   *
+   * @param process Proceso preparado.
+   * @return Ticks de espera, o 0.
+   */
+  Tick remote_stall(const Process &process);
+
+  /**
+   * Cuenta marcos base libres en todos los nodos.
+   *
+   * @return Marcos base libres.
+   */
+  int free_base_frames() const;
+
+  /**
+   * Obtiene el algoritmo de reemplazo que administra un marco.
+   *
+   * @param frame_idx Índice del marco.
+   * @return Algoritmo del tamaño del marco, o nullptr si no hay.
+   */
+  ReplacementAlgorithm *algorithm_for(int frame_idx) const;
+
+  /**
+   * Marca un marco como ocupado en el conjunto de libres de su tamaño.
+   *
+   * @param frame_idx Índice del marco.
+   */
+  void mark_frame_used(int frame_idx);
+
+  /**
+   * Marca un marco como libre en el conjunto de libres de su tamaño.
+   *
+   * @param frame_idx Índice del marco.
+   */
+  void mark_frame_free(int frame_idx);
+
+  /**
+   * Anota un marco como modificado para el siguiente registro de marcos.
+   *
+   * @param frame_idx Índice del marco.
+   */
+  void mark_frame_dirty(int frame_idx);
+
+  /**
+   * Asigna un marco libre a un proceso y actualiza los índices.
+   *
+   * @param frame_idx Índice del marco.
+   * @param pid Proceso propietario.
+   */
+  void assign_frame(int frame_idx, int pid);
+
+  /**
+   * Devuelve un marco a la lista de libres y lo quita del índice de su
+   * proceso propietario.
+   *
+   * @param frame_idx Índice del marco.
+   */
+  void release_frame(int frame_idx);
+
+  /**
+   * Agrega un marco a la lista de marcos de un proceso.
+   *
+   * @param frame_idx Índice del marco.
+   * @param pid Proceso propietario.
+   */
+  void link_frame(int frame_idx, int pid);
+
+  /**
+   * Quita un marco de la lista de marcos de su propietario actual.
+   *
+   * @param frame_idx Índice del marco.
+   */
+  void unlink_frame(int frame_idx);
+
+  /**
+   * Libera un marco sin reemplazo: su último mapeador lo dejó al copiarlo.
+   *
+   * @param frame_idx Índice del marco.
+   */
+  void free_frame(int frame_idx);
+
+  /**
+   * Enlaza los mapeos compartidos de un proceso recién registrado con sus
+   * regiones, creándolas si hace falta.
+   *
+   * @param process Proceso con su tabla de páginas creada.
+   */
+  void attach_shared_mappings(const Process &process);
+
+  /**
+   * Busca el mapeo compartido que cubre una entrada de un proceso.
+   *
+   * @param pid ID del proceso.
+   * @param entry Entrada de su tabla de páginas.
+   * @param region_page Recibe la página dentro de la región.
+   * @return Mapeo, o nullptr si la entrada es privada.
+   */
+  RegionMapping *mapping_for(int pid, int entry, int &region_page);
+
+  /**
+   * Recorre los procesos que mapean un marco compartido, con la entrada que
+   * apunta a él en cada tabla. Para un marco privado visita solo al dueño.
+   *
+   * @param frame_idx Índice del marco.
+   * @param visit Función llamada con (Process &, int entrada).
+   */
+  template <typename Visit> void for_each_mapper(int frame_idx, Visit visit);
+
+  /**
+   * Indica si alguno de los procesos que mapean un marco tiene la página
+   * referenciada.
+   *
+   * @param frame_idx Índice del marco.
+   * @return true si el marco no debe elegirse como víctima.
+   */
+  bool frame_referenced(int frame_idx);
+
+  /**
+   * Mapea una página compartida que otro proceso ya cargó, sin fallo.
+   *
+   * @param process Proceso que accede.
+   * @param page_id Entrada no residente de su tabla.
+   * @param current_time Tiempo del mapeo.
+   * @return true si la página quedó residente.
+   */
+  bool map_shared_page(const std::shared_ptr<Process> &process, int page_id,
+                       Tick current_time);
+
+  /**
+   * Prepara una página residente para ser escrita. Si el proceso es el
+   * único que mapea un marco compartido se queda con él sin copiarlo.
+   *
+   * @param process Proceso que escribe.
+   * @param page_id Entrada residente de su tabla.
+   * @return true si la escritura no necesita una copia.
+   */
+  bool claim_for_write(Process &process, int page_id);
+
+  /**
+   * Quita un mapeo de un marco. Si el proceso era el dueño y quedan otros
+   * mapeadores, el marco pasa a uno de ellos.
+   *
+   * @param frame_idx Índice del marco.
+   * @param pid Proceso que deja de mapearlo.
+   */
+  void drop_mapping(int frame_idx, int pid);
+
+  /**
+   * Indica si un acceso del proceso escribe la página, según su rastro.
+   *
+   * @param process Proceso que accede.
+   * @param access Índice del acceso.
+   * @return true para un acceso de escritura.
+   */
+  bool is_write_access(const Process &process, Tick access) const;
+
+  /**
+   * Obtiene la entrada de la tabla de páginas referenciada por un acceso
+   * del proceso. El rastro y el modelo de localidad usan páginas base, que
+   * se traducen a la entrada grande que las cubre.
+   *
+   * @param process Proceso que accede.
+   * @param access Índice del acceso (ticks de CPU ya ejecutados).
+   * @return Entrada accedida, o -1 si el proceso no tiene páginas.
+   */
+  int page_for_access(const Process &process, Tick access) const;
+
+  /**
+   * Estima el conjunto de trabajo de un proceso: todas sus páginas o, con
+   * paginación por demanda, las páginas distintas de los últimos accesos de
+   * la ventana (los primeros si aún no ha ejecutado).
+   *
+   * @param process Proceso con su tabla de páginas creada.
+   * @return Marcos que necesita el proceso para no hiperpaginar.
+   */
+  int working_set_size(const Process &process) const;
+
+  /**
+   * Actualiza la demanda registrada de un proceso admitido.
+   *
+   * @param process Proceso admitido.
+   */
+  void update_admitted_demand(const Process &process);
 
   /**   
    * Verifica si todas las páginas de un proceso están residentes en memoria.
@@ -183,38 +748,88 @@ private:
   bool are_all_pages_resident(const Process &process) const;
 
   /**
-    * Encola las páginas faltantes de un proceso para carga.
+   * Obtiene la espera de memoria de un proceso, creándola si no existía.
+   *
+   * @param process Proceso a consultar.
+   * @return Espera de memoria del proceso.
+   */
+  MemoryWait &wait_entry(const Process &process);
+
+  /**
+    * Encola la carga de una página faltante de un proceso.
     * 
-    * @param process Proceso al que pertenecen las páginas.
-    * @param missing_pages Vector con los IDs de las páginas faltantes.
+    * @param process Proceso al que pertenece la página.
+    * @param wait Espera de memoria del proceso.
+    * @param page_id ID de la página faltante.
     * @param current_time Tiempo actual para registrar el encolado.
+    * @param copy true para copiar una página compartida que se escribe.
     */
-  void enqueue_missing_pages(std::shared_ptr<Process> process,
-                             const std::vector<int> &missing_pages,
-                             int current_time);
+  void enqueue_missing_page(const std::shared_ptr<Process> &process,
+                            MemoryWait &wait, int page_id, Tick current_time,
+                            bool copy = false);
 
   /**   
-   * Inicia la siguiente tarea de carga si es posible.
+   * Inicia tareas de carga mientras haya canales libres y marcos disponibles.
    * 
-   * @param current_time Tiempo actual para iniciar la tarea.
+   * @param current_time Tiempo actual para iniciar las tareas.
    */
-  void start_next_task_if_possible(int current_time);
+  void start_next_tasks(Tick current_time);
+
+  /**
+   * Agrega a una tarea recién iniciada otras páginas encoladas del mismo
+   * proceso, hasta completar el lote de precarga.
+   *
+   * @param task Tarea iniciada, fuera ya de la cola.
+   */
+  void prefetch_into_task(PageLoadTask &task);
 
   /**   
-   * Reserva un marco para la tarea de carga dada.
+   * Reserva un marco para una página. Los marcos con una carga en curso no
+   * se eligen como víctima.
    * 
-   * @param task Tarea de carga para la cual se reserva el marco.
-   * @return true si se pudo reservar un marco, false en caso contrario.
+   * @param process Proceso dueño de la página.
+   * @param page_id Página a cargar.
+   * @param node Nodo NUMA preferido.
+   * @return Marco reservado, o -1 si no hay ninguno disponible.
+   */
+  int reserve_frame(const std::shared_ptr<Process> &process, int page_id,
+                    int node = 0);
+
+  /**
+   * Marca como residente una página cargada.
+   *
+   * @param process Proceso dueño de la página.
+   * @param page_id Página cargada.
+   * @param frame_id Marco donde se cargó.
+   * @param completion_time Tiempo en que se completa la carga.
+   * @param copy true si es la copia privada de una página compartida.
    */
-  bool reserve_frame_for_task(PageLoadTask &task);
+  void load_page(const std::shared_ptr<Process> &process, int page_id,
+                 int frame_id, Tick completion_time, bool copy = false);
 
   /**   
-   * Completa la tarea de carga activa y actualiza el estado del proceso.
+   * Completa una tarea de carga, con sus páginas precargadas, y actualiza el
+   * estado del proceso.
    * 
+   * @param task Tarea terminada.
    * @param completion_time Tiempo en que se completa la carga.
-   * @return Puntero al proceso que completó la carga.
+   * @return Puntero al proceso si quedó listo, nullptr en otro caso.
+   */
+  std::shared_ptr<Process> complete_task(const PageLoadTask &task,
+                                         Tick completion_time);
+
+  /**
+   * Quita una página de las pendientes de un proceso y, si era la última
+   * que esperaba, lo marca como listo.
+   *
+   * @param process Proceso dueño de la página.
+   * @param page_id Página resuelta.
+   * @param time Tiempo en que se resuelve.
+   * @return Puntero al proceso si quedó listo, nullptr en otro caso.
    */
-  std::shared_ptr<Process> complete_active_task(int completion_time);
+  std::shared_ptr<Process>
+  settle_page(const std::shared_ptr<Process> &process, int page_id,
+              Tick time);
 
   /**   
    * Libera un marco físico y actualiza el estado correspondiente.
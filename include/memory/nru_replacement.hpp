@@ -2,18 +2,55 @@
 #define NRU_REPLACEMENT_HPP
 
 #include "memory/replacement_algorithm.hpp"
+#include <cstdint>
+#include <random>
 
 namespace OSSimulator {
 
 /**
  * Implementación del algoritmo de reemplazo NRU.
+ *
+ * Los marcos no referenciados se agrupan en dos clases (sin modificar y
+ * modificados) mediante mapas de bits actualizados con las notificaciones del
+ * gestor de memoria. La víctima se elige al azar dentro de la clase más baja no
+ * vacía con un generador propio, de modo que una misma semilla reproduce la
+ * misma secuencia de reemplazos. Elegir cuesta O(marcos / 64).
  */
-class NRUReplacement : public ReplacementAlgorithm {
+class NRUReplacement final : public ReplacementAlgorithm {
 public:
+  /**
+   * Constructor.
+   *
+   * @param seed Semilla del generador aleatorio.
+   */
+  explicit NRUReplacement(uint32_t seed = 0);
+
   int select_victim(
       const std::vector<Frame> &frames,
       const std::unordered_map<int, std::shared_ptr<Process>> &process_map,
-      int current_time) override;
+      Tick current_time) override;
+
+  void on_frame_release(int frame_id) override;
+  void on_process_referenced(const Process &process, bool referenced) override;
+  void on_frame_referenced(int frame_id) override;
+  void save_state(SnapshotWriter &out) const override;
+  void load_state(SnapshotReader &in) override;
+
+private:
+  static constexpr int CLASS_COUNT = 2; //!< Clases de marcos no referenciados.
+
+  std::vector<uint64_t> classes[CLASS_COUNT]; //!< Marcos por clase.
+  int class_size[CLASS_COUNT] = {0, 0};       //!< Marcos en cada clase.
+  std::vector<int8_t> frame_class; //!< Clase de cada marco (-1 si ninguna).
+  std::mt19937 generator;          //!< Generador para elegir dentro de la clase.
+
+  /**
+   * Coloca un marco en una clase, quitándolo de la anterior.
+   *
+   * @param frame_id ID del marco.
+   * @param class_idx Clase destino, o -1 para no dejarlo en ninguna.
+   */
+  void set_class(int frame_id, int class_idx);
 };
 
 } // namespace OSSimulator
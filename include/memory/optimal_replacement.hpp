@@ -2,18 +2,74 @@
 #define OPTIMAL_REPLACEMENT_HPP
 
 #include "memory/replacement_algorithm.hpp"
+#include <set>
+#include <utility>
 
 namespace OSSimulator {
 
 /**
- * Implementación del algoritmo de reemplazo Óptimo.
+ * Implementación del algoritmo de reemplazo Óptimo (Belady).
+ *
+ * La víctima es la página cuyo próximo uso, según el rastro de accesos de su
+ * proceso, está más lejos. Una página que no vuelve a usarse se elige antes
+ * que cualquier otra; las páginas de procesos sin rastro se consideran de uso
+ * inmediato. El rastro de un proceso solo avanza mientras ejecuta en CPU, y en
+ * ese tiempo sus páginas están referenciadas, así que la distancia calculada
+ * al salir de CPU sigue siendo válida hasta que vuelva a entrar. Los marcos
+ * candidatos se mantienen ordenados por esa distancia y la selección cuesta
+ * O(log n).
  */
-class OptimalReplacement : public ReplacementAlgorithm {
+class OptimalReplacement final : public ReplacementAlgorithm {
 public:
   int select_victim(
       const std::vector<Frame> &frames,
       const std::unordered_map<int, std::shared_ptr<Process>> &process_map,
-      int current_time) override;
+      Tick current_time) override;
+
+  void on_frame_release(int frame_id) override;
+  void on_process_referenced(const Process &process, bool referenced) override;
+  void on_frame_referenced(int frame_id) override;
+  void save_state(SnapshotWriter &out) const override;
+  void load_state(SnapshotReader &in) override;
+
+private:
+  /**
+   * Índice del rastro de un proceso: posiciones del rastro en que aparece
+   * cada página, en orden creciente.
+   */
+  struct TraceIndex {
+    std::vector<std::vector<int>> positions; //!< Posiciones por página.
+  };
+
+  std::unordered_map<int, TraceIndex> traces; //!< Índices por PID.
+  std::set<std::pair<int, int>>
+      candidates;                //!< (-distancia, marco) de marcos elegibles.
+  std::vector<int> distance_of; //!< Distancia registrada por marco (-1 si no).
+
+  /**
+   * Obtiene (construyéndolo la primera vez) el índice del rastro de un
+   * proceso.
+   *
+   * @param process Proceso dueño del rastro.
+   * @return Índice de posiciones por página.
+   */
+  const TraceIndex &trace_index(const Process &process);
+
+  /**
+   * Calcula cuántos accesos del proceso faltan para volver a usar una página.
+   *
+   * @param process Proceso dueño de la página.
+   * @param entry Índice de la entrada en la tabla (página base o grande).
+   * @return Distancia en accesos, o INT_MAX si la página no vuelve a usarse.
+   */
+  int next_use_distance(const Process &process, int entry);
+
+  /**
+   * Quita un marco del conjunto de candidatos.
+   *
+   * @param frame_id ID del marco.
+   */
+  void remove_candidate(int frame_id);
 };
 
 } // namespace OSSimulator
@@ -1,35 +1,96 @@
 #ifndef PAGE_HPP
 #define PAGE_HPP
 
+#include <cstdint>
+
 namespace OSSimulator {
 
 /**
- * Representa una página lógica en el sistema.
+ * Entrada de la tabla de páginas empaquetada en una palabra de 32 bits: el
+ * marco físico y los bits de válida, referenciada y modificada.
+ *
+ * El identificador de la página es su posición en la tabla y el propietario
+ * es el proceso dueño de la tabla, por lo que no se almacenan.
  */
-struct Page {
-  int page_id;      //!< Identificador de la página.
-  int frame_number; //!< Marco físico donde está cargada (-1 si no está en memoria).
-  bool valid;       //!< Indica si la página está válida (cargada en memoria).
-  bool modified;   //!< Bit de modificado (dirty).
-  bool referenced; //!< Bit de referencia usado por algoritmos de reemplazo.
-  int last_access_time; //!< Último tiempo de acceso (para políticas LRU/óptimas).
-  int process_id;       //!< ID del proceso propietario de la página.
+class Page {
+public:
+  /**
+   * Constructor por defecto: página no cargada y sin bits activos.
+   */
+  Page() = default;
+
+  /**
+   * Obtiene el marco físico donde está cargada la página.
+   *
+   * @return Índice del marco, o -1 si no está en memoria.
+   */
+  int get_frame_number() const {
+    return static_cast<int>(bits & FRAME_MASK) - 1;
+  }
+
+  /**
+   * Establece el marco físico de la página.
+   *
+   * @param frame Índice del marco, o -1 si no está en memoria.
+   */
+  void set_frame_number(int frame) {
+    bits = (bits & ~FRAME_MASK) |
+           (static_cast<uint32_t>(frame + 1) & FRAME_MASK);
+  }
+
+  /**
+   * Indica si la página está cargada en memoria.
+   *
+   * @return true si la página es válida.
+   */
+  bool is_valid() const { return bits & VALID_BIT; }
+
+  /**
+   * Establece el bit de válida.
+   *
+   * @param value Nuevo valor.
+   */
+  void set_valid(bool value) { set_bit(VALID_BIT, value); }
+
+  /**
+   * Indica si la página está referenciada (bit usado por el reemplazo).
+   *
+   * @return true si el bit de referencia está activo.
+   */
+  bool is_referenced() const { return bits & REFERENCED_BIT; }
+
+  /**
+   * Establece el bit de referencia.
+   *
+   * @param value Nuevo valor.
+   */
+  void set_referenced(bool value) { set_bit(REFERENCED_BIT, value); }
 
   /**
-   * Constructor por defecto.
-    */
-  Page()
-      : page_id(-1), frame_number(-1), valid(false), modified(false),
-        referenced(false), last_access_time(0), process_id(-1) {}
+   * Indica si la página fue modificada (dirty).
+   *
+   * @return true si el bit de modificada está activo.
+   */
+  bool is_modified() const { return bits & MODIFIED_BIT; }
 
   /**
-   * Constructor parametrizado.
+   * Establece el bit de modificada.
    *
-   * @param id Identificador de la página.
+   * @param value Nuevo valor.
    */
-  Page(int id)
-      : page_id(id), frame_number(-1), valid(false), modified(false),
-        referenced(false), last_access_time(0), process_id(-1) {}
+  void set_modified(bool value) { set_bit(MODIFIED_BIT, value); }
+
+private:
+  static constexpr uint32_t FRAME_MASK = (1u << 29) - 1; //!< Marco + 1.
+  static constexpr uint32_t VALID_BIT = 1u << 29;
+  static constexpr uint32_t REFERENCED_BIT = 1u << 30;
+  static constexpr uint32_t MODIFIED_BIT = 1u << 31;
+
+  uint32_t bits = 0; //!< Marco + 1 en los bits bajos y los bits de estado.
+
+  void set_bit(uint32_t bit, bool value) {
+    bits = value ? (bits | bit) : (bits & ~bit);
+  }
 };
 
 } // namespace OSSimulator
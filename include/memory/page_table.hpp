@@ -0,0 +1,134 @@
+#ifndef PAGE_TABLE_HPP
+#define PAGE_TABLE_HPP
+
+#include "core/tick.hpp"
+#include "memory/page.hpp"
+#include <cstddef>
+#include <vector>
+
+namespace OSSimulator {
+
+class SnapshotReader;
+class SnapshotWriter;
+
+/**
+ * Tabla de páginas de un proceso.
+ *
+ * Guarda una entrada empaquetada de 4 bytes por página. Las primeras
+ * entradas pueden ser páginas grandes que cubren una región alineada de
+ * páginas base; el resto cubre una página base cada una, así que la página
+ * base de cualquier entrada se calcula sin almacenarla. Los tiempos de
+ * último acceso solo se guardan, en un arreglo aparte, si alguna política
+ * de reemplazo los necesita.
+ */
+class PageTable {
+public:
+  using iterator = std::vector<Page>::iterator;
+  using const_iterator = std::vector<Page>::const_iterator;
+
+  /**
+   * Reconstruye la tabla con todas las páginas sin cargar.
+   *
+   * @param pages Páginas base del proceso.
+   * @param huge_regions Regiones iniciales mapeadas con páginas grandes.
+   * @param huge_page_size Páginas base por página grande.
+   * @param access_times true para registrar el último acceso de cada entrada.
+   */
+  void reset(int pages, int huge_regions = 0, int huge_page_size = 1,
+             bool access_times = false);
+
+  /**
+   * Obtiene la primera página base cubierta por una entrada.
+   *
+   * @param entry Índice de la entrada.
+   * @return Página base.
+   */
+  int first_page(int entry) const;
+
+  /**
+   * Obtiene cuántas páginas base cubre una entrada.
+   *
+   * @param entry Índice de la entrada.
+   * @return Páginas base cubiertas (más de una en páginas grandes).
+   */
+  int entry_size(int entry) const {
+    return entry < huge_regions ? huge_page_size : 1;
+  }
+
+  /**
+   * Obtiene la entrada que cubre una página base.
+   *
+   * @param page Página base.
+   * @return Índice de la entrada, o -1 si la página no pertenece al proceso.
+   */
+  int entry_for_page(int page) const;
+
+  /**
+   * Obtiene el número de páginas base cubiertas por la tabla.
+   *
+   * @return Páginas base del proceso.
+   */
+  int base_pages() const { return base_page_count; }
+
+  /**
+   * Registra el último acceso a una entrada, si la tabla guarda tiempos.
+   *
+   * @param entry Índice de la entrada.
+   * @param time Tiempo del acceso.
+   */
+  void touch(int entry, Tick time) {
+    if (!access_times.empty())
+      access_times[entry] = time;
+  }
+
+  /**
+   * Obtiene el último acceso registrado de una entrada.
+   *
+   * @param entry Índice de la entrada.
+   * @return Tiempo del acceso, o -1 si la tabla no guarda tiempos.
+   */
+  Tick last_access_time(int entry) const {
+    return access_times.empty() ? -1 : access_times[entry];
+  }
+
+  /**
+   * Obtiene la memoria ocupada por las entradas y los tiempos de acceso.
+   *
+   * @return Bytes reservados por la tabla.
+   */
+  std::size_t memory_bytes() const;
+
+  /**
+   * Guarda las entradas, sus bits y los tiempos de acceso en una instantánea.
+   *
+   * @param out Instantánea de destino.
+   */
+  void save_state(SnapshotWriter &out) const;
+
+  /**
+   * Restaura la tabla desde una instantánea.
+   *
+   * @param in Instantánea de origen.
+   */
+  void load_state(SnapshotReader &in);
+
+  std::size_t size() const { return entries.size(); }
+  bool empty() const { return entries.empty(); }
+  Page &operator[](std::size_t entry) { return entries[entry]; }
+  const Page &operator[](std::size_t entry) const { return entries[entry]; }
+  iterator begin() { return entries.begin(); }
+  iterator end() { return entries.end(); }
+  const_iterator begin() const { return entries.begin(); }
+  const_iterator end() const { return entries.end(); }
+
+private:
+  std::vector<Page> entries;      //!< Entradas empaquetadas.
+  std::vector<Tick> access_times; //!< Último acceso por entrada (opcional).
+  int huge_regions = 0;           //!< Entradas iniciales de página grande.
+  int huge_page_size = 1;         //!< Páginas base por página grande.
+  int base_page_count = 0;        //!< Páginas base cubiertas.
+};
+
+} // namespace OSSimulator
+
+#endif
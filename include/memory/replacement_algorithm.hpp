@@ -1,22 +1,36 @@
 #ifndef REPLACEMENT_ALGORITHM_HPP
 #define REPLACEMENT_ALGORITHM_HPP
 
+#include "core/tick.hpp"
+#include <algorithm>
+#include <cstddef>
 #include <memory>
+#include <stdexcept>
 #include <unordered_map>
 #include <vector>
 
 namespace OSSimulator {
 
 struct Process;
+class SnapshotReader;
+class SnapshotWriter;
 
 /**
  * Estructura que representa un marco de memoria física.
+ *
+ * Un marco de una región compartida lo mapean varios procesos. process_id y
+ * page_id identifican entonces a uno de ellos, el dueño, que es quien lo
+ * cargó o lo heredó al salir los anteriores; ref_count cuenta las tablas de
+ * páginas que apuntan al marco.
  */
 struct Frame {
   int frame_id;   //!< Identificador del marco.
-  int process_id; //!< ID del proceso que ocupa el marco (-1 si está libre).
-  int page_id;    //!< ID de la página almacenada.
+  int process_id; //!< ID del proceso dueño del marco (-1 si está libre).
+  int page_id;    //!< ID de la página del dueño almacenada.
   bool occupied;  //!< Indica si el marco está ocupado.
+  int ref_count = 0;    //!< Tablas de páginas que mapean el marco.
+  int region = -1;      //!< Región compartida de la página (-1 = privada).
+  int region_page = -1; //!< Página dentro de la región compartida.
 };
 
 /**
@@ -37,7 +51,7 @@ public:
   virtual int select_victim(
       const std::vector<Frame> &frames,
       const std::unordered_map<int, std::shared_ptr<Process>> &process_map,
-      int current_time) = 0;
+      Tick current_time) = 0;
 
   /**
      * Notifica al algoritmo que una página ha sido cargada o accedida.
@@ -53,6 +67,97 @@ public:
      * @param frame_id ID del marco liberado.
      */
   virtual void on_frame_release(int /*frame_id*/) {}
+
+  /**
+     * Notifica que el bit de referencia de las páginas residentes de un
+     * proceso cambió, es decir, que el proceso entró o salió de CPU.
+     *
+     * @param process Proceso afectado.
+     * @param referenced Nuevo valor del bit de referencia.
+     */
+  virtual void on_process_referenced(const Process & /*process*/,
+                                     bool /*referenced*/) {}
+
+  /**
+     * Notifica que un marco compartido sigue referenciado por otro proceso
+     * después de que on_process_referenced() lo dejara sin referencia al
+     * salir de CPU uno de los procesos que lo mapean.
+     *
+     * @param frame_id ID del marco compartido.
+     */
+  virtual void on_frame_referenced(int /*frame_id*/) {}
+
+  /**
+     * Indica si el algoritmo lee el tiempo de último acceso de las páginas.
+     * Las tablas de páginas solo reservan ese arreglo cuando es necesario.
+     *
+     * @return true si el algoritmo necesita los tiempos de acceso.
+     */
+  virtual bool uses_access_times() const { return false; }
+
+  /**
+     * Guarda el estado del algoritmo (colas, bits y manecillas) en una
+     * instantánea.
+     *
+     * @param out Instantánea de destino.
+     * @throws std::runtime_error Si el algoritmo no admite instantáneas.
+     */
+  virtual void save_state(SnapshotWriter & /*out*/) const {
+    throw std::runtime_error(
+        "El algoritmo de reemplazo no admite instantáneas");
+  }
+
+  /**
+     * Restaura el estado guardado con save_state().
+     *
+     * @param in Instantánea de origen.
+     * @throws std::runtime_error Si el algoritmo no admite instantáneas.
+     */
+  virtual void load_state(SnapshotReader & /*in*/) {
+    throw std::runtime_error(
+        "El algoritmo de reemplazo no admite instantáneas");
+  }
+
+  /**
+     * Restringe el algoritmo a un rango contiguo de marcos. Con páginas
+     * grandes cada tamaño de marco tiene su propia instancia del algoritmo,
+     * y cada una elige víctimas solo entre sus marcos.
+     *
+     * @param first Primer marco del rango.
+     * @param count Número de marcos del rango.
+     */
+  void set_frame_range(int first, int count) {
+    first_frame = first;
+    frame_count = count;
+  }
+
+protected:
+  int first_frame = 0;  //!< Primer marco administrado.
+  int frame_count = -1; //!< Marcos administrados (-1 = todos).
+
+  /**
+   * Indica si un marco pertenece al rango del algoritmo.
+   *
+   * @param frame_id ID del marco.
+   * @return true si el algoritmo administra el marco.
+   */
+  bool owns_frame(int frame_id) const {
+    return frame_id >= first_frame &&
+           (frame_count < 0 || frame_id < first_frame + frame_count);
+  }
+
+  /**
+   * Obtiene el fin (exclusivo) del rango para una lista de marcos.
+   *
+   * @param frames Lista de marcos de memoria.
+   * @return Índice siguiente al último marco administrado.
+   */
+  std::size_t frame_end(const std::vector<Frame> &frames) const {
+    if (frame_count < 0)
+      return frames.size();
+    return std::min(frames.size(),
+                    static_cast<std::size_t>(first_frame + frame_count));
+  }
 };
 
 } // namespace OSSimulator
@@ -0,0 +1,99 @@
+#ifndef TLB_HPP
+#define TLB_HPP
+
+#include <cstdint>
+#include <vector>
+
+namespace OSSimulator {
+
+class SnapshotReader;
+class SnapshotWriter;
+
+/**
+ * TLB asociativa por conjuntos delante de la tabla de páginas.
+ *
+ * Cada entrada traduce una entrada de la tabla de páginas de un proceso, de
+ * modo que una página grande ocupa una sola entrada. El conjunto se elige
+ * por el número de página y, dentro de él, se reemplaza la entrada usada
+ * hace más tiempo. Sin etiquetas de espacio de direcciones (ASID) la TLB se
+ * vacía en cada cambio de contexto; con ellas, las entradas de varios
+ * procesos conviven.
+ */
+class TLB {
+private:
+  struct Entry {
+    int pid = -1;          //!< Proceso dueño, o -1 si la entrada está libre.
+    int page = -1;         //!< Entrada de la tabla de páginas traducida.
+    uint64_t last_use = 0; //!< Momento del último uso (LRU del conjunto).
+  };
+
+  std::vector<Entry> entries; //!< Entradas, agrupadas por conjunto.
+  int ways;                   //!< Entradas por conjunto.
+  int sets;                   //!< Número de conjuntos.
+  bool tagged;                //!< Entradas etiquetadas con el proceso.
+  uint64_t clock = 0;         //!< Contador de usos.
+  int64_t hits = 0;           //!< Traducciones encontradas.
+  int64_t misses = 0;         //!< Traducciones que recorrieron la tabla.
+
+public:
+  /**
+   * Constructor.
+   *
+   * @param entries Entradas totales (0 desactiva la TLB).
+   * @param ways Entradas por conjunto; se ajusta a un divisor de entries.
+   * @param tagged true para etiquetar las entradas con el proceso (ASID).
+   */
+  explicit TLB(int entries = 0, int ways = 1, bool tagged = false);
+
+  /**
+   * Traduce una página. En un fallo, la traducción se carga en el conjunto
+   * reemplazando la entrada usada hace más tiempo.
+   *
+   * @param pid Proceso que accede.
+   * @param page Entrada de la tabla de páginas accedida.
+   * @return true si la traducción estaba en la TLB.
+   */
+  bool translate(int pid, int page);
+
+  /**
+   * Notifica un cambio de contexto: sin ASID se vacía la TLB.
+   */
+  void switch_context();
+
+  /**
+   * Invalida la traducción de una página que dejó de estar residente.
+   *
+   * @param pid Proceso dueño de la página.
+   * @param page Entrada de la tabla de páginas.
+   */
+  void invalidate(int pid, int page);
+
+  /**
+   * Invalida todas las traducciones de un proceso.
+   *
+   * @param pid Proceso terminado.
+   */
+  void invalidate_process(int pid);
+
+  bool enabled() const { return !entries.empty(); }
+  int64_t get_hits() const { return hits; }
+  int64_t get_misses() const { return misses; }
+
+  /**
+   * Guarda las entradas y los contadores en una instantánea.
+   *
+   * @param out Instantánea de destino.
+   */
+  void save_state(SnapshotWriter &out) const;
+
+  /**
+   * Restaura las entradas y los contadores; la geometría debe coincidir.
+   *
+   * @param in Instantánea de origen.
+   */
+  void load_state(SnapshotReader &in);
+};
+
+} // namespace OSSimulator
+
+#endif
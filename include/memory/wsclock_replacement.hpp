@@ -0,0 +1,41 @@
+#ifndef WSCLOCK_REPLACEMENT_HPP
+#define WSCLOCK_REPLACEMENT_HPP
+
+#include "memory/clock_replacement.hpp"
+
+namespace OSSimulator {
+
+/**
+ * Implementación del algoritmo de reemplazo WSClock.
+ *
+ * Extiende Clock con el conjunto de trabajo: al limpiar el bit de uso de un
+ * marco se anota el tiempo actual como su último uso, y solo se reemplazan
+ * marcos cuya antigüedad supera la ventana del conjunto de trabajo. Entre los
+ * marcos fuera de la ventana se prefieren los no modificados; si en una vuelta
+ * completa no aparece ninguno, se elige el primero modificado fuera de la
+ * ventana y, en último caso, el primer marco reemplazable.
+ */
+class WSClockReplacement final : public ClockReplacement {
+public:
+  /**
+   * Constructor.
+   *
+   * @param window Ventana del conjunto de trabajo en ticks.
+   */
+  explicit WSClockReplacement(int window = 10);
+
+  int select_victim(
+      const std::vector<Frame> &frames,
+      const std::unordered_map<int, std::shared_ptr<Process>> &process_map,
+      Tick current_time) override;
+  void save_state(SnapshotWriter &out) const override;
+  void load_state(SnapshotReader &in) override;
+
+private:
+  int window;                 //!< Ventana del conjunto de trabajo.
+  std::vector<Tick> last_use; //!< Tiempo de último uso conocido por marco.
+};
+
+} // namespace OSSimulator
+
+#endif
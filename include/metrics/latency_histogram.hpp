@@ -0,0 +1,147 @@
+#ifndef LATENCY_HISTOGRAM_HPP
+#define LATENCY_HISTOGRAM_HPP
+
+#include "core/tick.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <string>
+#include <vector>
+
+namespace OSSimulator {
+
+class SnapshotWriter;
+class SnapshotReader;
+
+/**
+ * Histograma de latencias en ticks con precisión relativa acotada, al estilo
+ * de HDR Histogram.
+ *
+ * Los valores menores que 2^SUB_BUCKET_BITS se cuentan de forma exacta; los
+ * mayores caen en cubetas cuyo ancho crece con la potencia de dos del valor,
+ * con SUB_BUCKET_BITS bits de mantisa (error relativo menor que 0,8 %). La
+ * memoria está acotada por el mayor valor registrado, nunca por la cantidad de
+ * valores, y los percentiles se obtienen sin guardar las muestras.
+ */
+class LatencyHistogram {
+public:
+  static constexpr int SUB_BUCKET_BITS = 8;
+
+  /**
+   * Registra un valor; los negativos se cuentan como 0.
+   *
+   * @param value Latencia en ticks.
+   */
+  void record(int64_t value);
+
+  /**
+   * Suma los valores de otro histograma.
+   *
+   * @param other Histograma a sumar.
+   */
+  void merge(const LatencyHistogram &other);
+
+  /**
+   * Valor en el percentil dado, por rango más cercano: el mayor valor
+   * equivalente de la cubeta que contiene la muestra de rango
+   * ceil(p/100 * n), acotado al máximo registrado.
+   *
+   * @param percentile Percentil entre 0 y 100.
+   * @return Latencia en ticks (0 si no hay valores).
+   */
+  int64_t value_at_percentile(double percentile) const;
+
+  uint64_t count() const { return total_count; }
+  int64_t sum() const { return total_sum; }
+  int64_t min() const { return total_count ? min_value : 0; }
+  int64_t max() const { return total_count ? max_value : 0; }
+  double mean() const;
+
+  void clear();
+
+  void save_state(SnapshotWriter &out) const;
+  void load_state(SnapshotReader &in);
+
+private:
+  static size_t bucket_index(int64_t value);
+  static int64_t bucket_highest(size_t index);
+
+  std::vector<uint64_t> counts; //!< Cuentas por cubeta, hasta la mayor usada.
+  uint64_t total_count = 0;
+  int64_t total_sum = 0;
+  int64_t min_value = 0;
+  int64_t max_value = 0;
+};
+
+/**
+ * Percentiles de una latencia para un grupo, tal como se registran en el
+ * resumen CPU_METRICS.
+ */
+struct LatencySummary {
+  /// Grupo al que se refiere la fila.
+  enum class Scope : uint8_t { ALL, PRIORITY, DEVICE };
+
+  Scope scope = Scope::ALL;
+  std::string key;    //!< Prioridad o dispositivo (vacío en ALL).
+  std::string metric; //!< waiting, turnaround, response o queue_delay.
+  uint64_t count = 0;
+  int64_t p50 = 0;
+  int64_t p95 = 0;
+  int64_t p99 = 0;
+  int64_t max = 0;
+
+  /**
+   * Construye la fila a partir de un histograma.
+   *
+   * @param scope Grupo.
+   * @param key Prioridad o dispositivo.
+   * @param metric Nombre de la latencia.
+   * @param histogram Valores registrados.
+   */
+  static LatencySummary from(Scope scope, std::string key, std::string metric,
+                             const LatencyHistogram &histogram);
+};
+
+/**
+ * Latencias de los procesos terminados: espera, retorno y respuesta, en total
+ * y por prioridad. Se actualiza al terminar cada proceso.
+ */
+class ProcessLatencyStats {
+public:
+  /**
+   * Registra las latencias de un proceso terminado.
+   *
+   * @param priority Prioridad del proceso.
+   * @param waiting Tiempo de espera.
+   * @param turnaround Tiempo de retorno.
+   * @param response Tiempo de respuesta.
+   */
+  void record(int priority, Tick waiting, Tick turnaround, Tick response);
+
+  const LatencyHistogram &waiting() const { return overall.waiting; }
+  const LatencyHistogram &turnaround() const { return overall.turnaround; }
+  const LatencyHistogram &response() const { return overall.response; }
+
+  /// Filas de percentiles: primero el total y luego cada prioridad.
+  std::vector<LatencySummary> summarize() const;
+
+  void clear();
+
+private:
+  struct Histograms {
+    LatencyHistogram waiting;
+    LatencyHistogram turnaround;
+    LatencyHistogram response;
+  };
+
+  static void append(std::vector<LatencySummary> &rows,
+                     LatencySummary::Scope scope, const std::string &key,
+                     const Histograms &histograms);
+
+  Histograms overall;
+  std::map<int, Histograms> by_priority;
+};
+
+} // namespace OSSimulator
+
+#endif // LATENCY_HISTOGRAM_HPP
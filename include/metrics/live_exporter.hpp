@@ -0,0 +1,146 @@
+#ifndef LIVE_EXPORTER_HPP
+#define LIVE_EXPORTER_HPP
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace OSSimulator {
+
+/**
+ * Contadores de una simulación en curso.
+ *
+ * El hilo de la simulación los publica después de cada paso con escrituras
+ * atómicas relajadas y LiveExporter los lee desde su propio hilo, sin tomar
+ * ningún mutex de la simulación. Los valores son acumulados desde el inicio,
+ * salvo las colas, que son el largo actual.
+ */
+struct LiveStats {
+  /// Contadores de un dispositivo de E/S.
+  struct Device {
+    explicit Device(std::string name) : name(std::move(name)) {}
+
+    const std::string name;
+    std::atomic<int64_t> busy_ticks{0}; //!< Ticks atendiendo solicitudes.
+    std::atomic<int64_t> queue{0};      //!< Solicitudes en cola.
+  };
+
+  std::atomic<int64_t> tick{0};
+  std::atomic<int64_t> cpu_busy_ticks{0}; //!< Suma de todos los núcleos.
+  std::atomic<int64_t> cores{1};
+  std::atomic<int64_t> ready{0};
+  std::atomic<int64_t> memory_waiting{0};
+  std::atomic<int64_t> io_waiting{0};
+  std::atomic<int64_t> arrived{0};
+  std::atomic<int64_t> completed{0};
+  std::atomic<int64_t> context_switches{0};
+  std::atomic<int64_t> page_faults{0};
+  std::vector<std::unique_ptr<Device>> devices;
+
+  /**
+   * Agrega un dispositivo. Solo antes de iniciar el exportador.
+   *
+   * @param name Nombre del dispositivo.
+   * @return Contadores del dispositivo.
+   */
+  Device *add_device(const std::string &name);
+};
+
+/**
+ * Exportador en vivo de LiveStats.
+ *
+ * Cada intervalo toma una muestra de los contadores y, con la muestra
+ * anterior, calcula ticks por segundo y las tasas del intervalo. La muestra
+ * se escribe como una línea de resumen en un flujo o, si se indica un
+ * archivo, en el formato de texto de Prometheus: el archivo se reescribe
+ * completo cada vez (se escribe aparte y se renombra), como lo espera el
+ * colector de archivos de texto de node_exporter.
+ */
+class LiveExporter {
+public:
+  /// Valores leídos de LiveStats en un instante.
+  struct Sample {
+    std::chrono::steady_clock::time_point time;
+    int64_t tick = 0;
+    int64_t cpu_busy_ticks = 0;
+    int64_t cores = 1;
+    int64_t ready = 0;
+    int64_t memory_waiting = 0;
+    int64_t io_waiting = 0;
+    int64_t arrived = 0;
+    int64_t completed = 0;
+    int64_t context_switches = 0;
+    int64_t page_faults = 0;
+    std::vector<int64_t> device_busy_ticks;
+    std::vector<int64_t> device_queues;
+  };
+
+  /**
+   * Constructor.
+   *
+   * @param stats Contadores a exportar.
+   * @param interval Intervalo entre muestras.
+   * @param prometheus_file Archivo de Prometheus (vacío = línea en @p out).
+   * @param out Flujo de las líneas de resumen.
+   */
+  LiveExporter(std::shared_ptr<const LiveStats> stats,
+               std::chrono::milliseconds interval,
+               std::string prometheus_file, std::ostream &out);
+  ~LiveExporter();
+
+  LiveExporter(const LiveExporter &) = delete;
+  LiveExporter &operator=(const LiveExporter &) = delete;
+
+  /// Inicia el hilo del exportador.
+  void start();
+
+  /// Detiene el hilo y exporta una última muestra.
+  void stop();
+
+  /// Lee los contadores actuales.
+  static Sample sample(const LiveStats &stats);
+
+  /**
+   * Línea de resumen de una muestra.
+   *
+   * @param stats Contadores (para los nombres de los dispositivos).
+   * @param current Muestra actual.
+   * @param previous Muestra anterior; las tasas son del intervalo entre
+   * ambas.
+   */
+  static std::string summary_line(const LiveStats &stats,
+                                  const Sample &current,
+                                  const Sample &previous);
+
+  /// Texto en el formato de exposición de Prometheus de una muestra.
+  static std::string prometheus_text(const LiveStats &stats,
+                                     const Sample &current,
+                                     const Sample &previous);
+
+private:
+  void run();
+  void export_sample();
+
+  std::shared_ptr<const LiveStats> stats;
+  std::chrono::milliseconds interval;
+  std::string prometheus_file;
+  std::ostream &out;
+  Sample previous;
+
+  std::thread worker;
+  std::mutex wake_mutex;
+  std::condition_variable wake_cv;
+  bool stopping = false;
+  bool write_failed = false; //!< Solo se informa el primer error.
+};
+
+} // namespace OSSimulator
+
+#endif // LIVE_EXPORTER_HPP
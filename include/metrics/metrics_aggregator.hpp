@@ -0,0 +1,121 @@
+#ifndef METRICS_AGGREGATOR_HPP
+#define METRICS_AGGREGATOR_HPP
+
+#include "core/tick.hpp"
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace OSSimulator {
+
+/**
+ * Estado de la simulación tras un paso, entrada de MetricsAggregator.
+ *
+ * Los contadores son acumulados desde el inicio; las colas son el largo al
+ * terminar el paso y se consideran constantes durante los ticks que cubrió.
+ */
+struct AggregateSample {
+  Tick tick = 0; //!< Tick alcanzado: los anteriores ya se simularon.
+  int cores = 1; //!< Núcleos de CPU.
+  int64_t busy_ticks = 0;       //!< Ticks de CPU ocupados, sumando núcleos.
+  int64_t context_switches = 0; //!< Cambios de contexto.
+  int64_t page_faults = 0;      //!< Fallos de página.
+  int64_t io_completions = 0;   //!< Solicitudes de E/S atendidas.
+  int64_t completed = 0;        //!< Procesos terminados.
+  int ready = 0;                //!< Procesos listos.
+  int blocked_memory = 0;       //!< Procesos esperando páginas.
+  int blocked_io = 0;           //!< Procesos bloqueados en E/S.
+};
+
+/**
+ * Mínimo, máximo y suma ponderada por ticks del largo de una cola.
+ */
+struct AggregateGauge {
+  int min = 0;
+  int max = 0;
+  int64_t sum = 0; //!< Suma de largo × ticks.
+
+  void add(int value, Tick ticks, bool first);
+  double average(Tick ticks) const {
+    return ticks > 0 ? static_cast<double>(sum) / ticks : 0.0;
+  }
+};
+
+/**
+ * Resumen de una ventana de ticks.
+ */
+struct AggregateWindow {
+  int width = 0;  //!< Ancho configurado de la ventana.
+  Tick start = 0; //!< Primer tick cubierto.
+  Tick end = 0;   //!< Tick siguiente al último cubierto.
+  int cores = 1;
+  int64_t busy_ticks = 0;
+  int64_t context_switches = 0;
+  int64_t page_faults = 0;
+  int64_t io_completions = 0;
+  int64_t completed = 0;
+  AggregateGauge ready;
+  AggregateGauge blocked_memory;
+  AggregateGauge blocked_io;
+
+  Tick ticks() const { return end - start; }
+
+  /// Línea JSON de la ventana, con utilización y tasas por tick.
+  std::string to_json() const;
+};
+
+/**
+ * Reduce los pasos de la simulación a ventanas fijas de ticks.
+ *
+ * Cada ancho configurado forma una serie independiente de ventanas
+ * [k·ancho, (k+1)·ancho). Un paso que avanza varios ticks (motor de eventos)
+ * reparte los ticks ocupados de CPU y los largos de cola entre las ventanas
+ * que atraviesa; los contadores discretos van a la ventana de su último
+ * tick. La primera muestra solo fija la base, de modo que una simulación
+ * restaurada desde un punto de control empieza a acumular desde ahí.
+ */
+class MetricsAggregator {
+public:
+  /**
+   * Constructor.
+   *
+   * @param widths Anchos de ventana en ticks; se ignoran los no positivos y
+   * los repetidos.
+   */
+  explicit MetricsAggregator(const std::vector<int> &widths);
+
+  const std::vector<int> &get_widths() const { return widths; }
+
+  /**
+   * Acumula un paso.
+   *
+   * @param sample Estado tras el paso.
+   * @param closed Recibe las ventanas que el paso completó.
+   */
+  void add(const AggregateSample &sample, std::vector<AggregateWindow> &closed);
+
+  /**
+   * Cierra las ventanas parciales.
+   *
+   * @param closed Recibe las ventanas abiertas que cubren algún tick.
+   */
+  void finish(std::vector<AggregateWindow> &closed);
+
+private:
+  struct Series {
+    int width;
+    AggregateWindow current;
+    bool open = false;
+  };
+
+  std::vector<int> widths;
+  std::vector<Series> series;
+  AggregateSample last;
+  bool started = false;
+
+  static void open_window(Series &s, Tick tick, int cores);
+};
+
+} // namespace OSSimulator
+
+#endif // METRICS_AGGREGATOR_HPP
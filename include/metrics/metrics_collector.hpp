@@ -1,12 +1,22 @@
 #ifndef METRICS_COLLECTOR_HPP
 #define METRICS_COLLECTOR_HPP
 
+#include "core/name_table.hpp"
 #include "core/process.hpp"
+#include "metrics/latency_histogram.hpp"
+#include "metrics/metrics_aggregator.hpp"
+#include "metrics/mpsc_ring.hpp"
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
 #include <fstream>
-#include <map>
 #include <memory>
 #include <mutex>
 #include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
 
 namespace OSSimulator {
 
@@ -14,6 +24,37 @@ class MetricsCollector {
 public:
   enum class OutputMode { DISABLED, FILE, STDOUT };
 
+  /**
+   * Formato del archivo de métricas.
+   */
+  enum class TraceFormat {
+    JSONL, //!< Una línea JSON por tick o resumen.
+    BINARY //!< Registros binarios con varints y cadenas internadas.
+  };
+
+  /**
+   * Política cuando la cola del escritor asíncrono está llena.
+   */
+  enum class BackpressurePolicy {
+    BLOCK, //!< El productor espera a que haya espacio.
+    DROP   //!< El evento se descarta y se cuenta.
+  };
+
+  /**
+   * Categorías de registros por tick, combinables como máscara de bits. Los
+   * resúmenes se escriben siempre.
+   */
+  enum Category : uint32_t {
+    CATEGORY_CPU = 1u << 0,
+    CATEGORY_IO = 1u << 1,
+    CATEGORY_MEMORY = 1u << 2,
+    CATEGORY_STATE_TRANSITIONS = 1u << 3,
+    CATEGORY_QUEUES = 1u << 4,
+    CATEGORY_PAGE_TABLE = 1u << 5,
+    CATEGORY_FRAME_STATUS = 1u << 6,
+    CATEGORY_ALL = (1u << 7) - 1,
+  };
+
   struct PageTableEntry {
     int page_id = -1;
     int frame_id = -1;
@@ -32,39 +73,43 @@ public:
 private:
   mutable std::mutex output_mutex;
   std::unique_ptr<std::ofstream> file_out;
+  std::string output_path; //!< Archivo de métricas (vacío fuera de FILE).
   OutputMode mode;
+  uint32_t categories = CATEGORY_ALL; //!< Categorías registradas.
+  int sample_rate = 1;                //!< Se registra 1 de cada N ticks.
 
   struct CpuTickData {
     std::string event;
     int pid = -1;
-    std::string name;
-    int remaining = 0;
+    NameId name = NameTable::EMPTY;
+    Tick remaining = 0;
     size_t ready_queue_size = 0;
     bool context_switch = false;
+    int core = 0; //!< Núcleo, solo en los registros por núcleo.
   };
 
   struct IoTickData {
-    std::string device;
+    NameId device = NameTable::EMPTY;
     std::string event;
     int pid = -1;
-    std::string name;
-    int remaining = 0;
+    NameId name = NameTable::EMPTY;
+    Tick remaining = 0;
     size_t queue_size = 0;
   };
 
   struct MemoryTickData {
     std::string event;
     int pid = -1;
-    std::string name;
+    NameId name = NameTable::EMPTY;
     int page_id = -1;
     int frame_id = -1;
-    int total_page_faults = 0;
-    int total_replacements = 0;
+    int64_t total_page_faults = 0;
+    int64_t total_replacements = 0;
   };
 
   struct StateTransitionData {
     int pid = -1;
-    std::string name;
+    NameId name = NameTable::EMPTY;
     std::string from_state;
     std::string to_state;
     std::string reason;
@@ -79,17 +124,29 @@ private:
 
   struct PageTableSnapshot {
     int pid = -1;
-    std::string name;
+    NameId name = NameTable::EMPTY;
     std::vector<PageTableEntry> pages;
+    bool keyframe = true; //!< false si solo contiene las entradas cambiadas.
   };
 
   struct FrameStatusSnapshot {
     std::vector<FrameStatusEntry> frames;
+    bool keyframe = true; //!< false si solo contiene los marcos cambiados.
+  };
+
+  /**
+   * Última tabla de páginas emitida de un proceso, base de los deltas.
+   */
+  struct PageTableState {
+    Tick keyframe_tick = -1;           //!< Tick de la última instantánea.
+    std::vector<PageTableEntry> pages; //!< Entradas ya emitidas.
   };
 
   struct TickData {
     CpuTickData cpu;
+    std::vector<CpuTickData> cores; //!< Registros por núcleo (multinúcleo).
     IoTickData io;
+    std::vector<IoTickData> io_devices; //!< Demás dispositivos del tick.
     MemoryTickData memory;
     std::vector<StateTransitionData> state_transitions;
     QueueSnapshotData queue_snapshot;
@@ -101,13 +158,209 @@ private:
     bool has_queue_snapshot = false;
     bool has_page_table = false;
     bool has_frame_status = false;
+    Tick tick = -1; //!< Tick que ocupa la casilla del anillo (-1 = libre).
   };
 
-  std::map<int, TickData> tick_buffer;
-  int last_flushed_tick = -1;
+  /**
+   * Evento encolado hacia el escritor asíncrono. Las casillas de la cola se
+   * reutilizan, así que sus cadenas y vectores conservan la capacidad.
+   */
+  struct MetricsEvent {
+    enum class Kind : uint8_t {
+      CPU,
+      CORE,
+      IO,
+      MEMORY,
+      STATE_TRANSITION,
+      QUEUE_SNAPSHOT,
+      PAGE_TABLE,
+      FRAME_STATUS,
+      FRAME_CHANGES,
+      CPU_SUMMARY,
+      CORE_SUMMARY,
+      MEMORY_SUMMARY,
+      NUMA_SUMMARY,
+      FLUSH
+    };
+
+    // Campos de 8 bytes primero y los pequeños al final, sin relleno.
+    Tick tick = 0;
+    int64_t values[10] = {};                //!< Enteros según el tipo.
+    double reals[4] = {0.0, 0.0, 0.0, 0.0}; //!< Promedios de resumen.
+    size_t count = 0;                       //!< Tamaño de cola.
+    int pid = -1;
+    NameId name = NameTable::EMPTY;   //!< Proceso.
+    NameId device = NameTable::EMPTY; //!< Dispositivo de E/S.
+    ProcessState from_state = ProcessState::NEW;
+    ProcessState to_state = ProcessState::NEW;
+    Kind kind = Kind::FLUSH;
+    bool flag = false; //!< Cambio de contexto.
+    std::string event;
+    std::string text; //!< Motivo o algoritmo.
+    std::vector<int> ready_queue;
+    std::vector<int> blocked_memory_queue;
+    std::vector<int> blocked_io_queue;
+    std::vector<PageTableEntry> pages;
+    std::vector<FrameStatusEntry> frames;
+    std::vector<LatencySummary> latencies; //!< Percentiles del resumen.
+  };
+
+  static constexpr int TICK_WINDOW = 1024; //!< Ticks pendientes como máximo.
+  std::vector<TickData> tick_ring; //!< Casillas reutilizables, por tick.
+  Tick oldest_tick = 0;            //!< Menor tick pendiente.
+  Tick newest_tick = -1;           //!< Mayor tick pendiente.
+  size_t pending_ticks = 0;        //!< Casillas ocupadas.
+  Tick last_flushed_tick = -1;
+
+  std::unique_ptr<MpscRing<MetricsEvent>> event_ring; //!< Cola asíncrona.
+  std::thread writer_thread;               //!< Hilo escritor.
+  std::atomic<bool> async_active{false};   //!< Modo asíncrono activo.
+  std::atomic<bool> writer_stop{false};    //!< Pide terminar al escritor.
+  std::atomic<bool> writer_idle{false};    //!< El escritor está dormido.
+  BackpressurePolicy backpressure =
+      BackpressurePolicy::BLOCK;           //!< Política con la cola llena.
+  std::atomic<uint64_t> dropped_events{0}; //!< Eventos descartados.
+  std::mutex wake_mutex;                   //!< Protege el sueño del escritor.
+  std::condition_variable wake_cv;         //!< Despierta al escritor.
+  std::mutex flush_mutex;                  //!< Protege los contadores de vaciado.
+  std::condition_variable flush_cv;        //!< Avisa vaciados completados.
+  uint64_t flush_requested = 0;            //!< Vaciados pedidos.
+  uint64_t flush_completed = 0;            //!< Vaciados atendidos.
+
+  TraceFormat format = TraceFormat::JSONL; //!< Formato de salida.
+  std::unordered_map<std::string, uint32_t>
+      string_ids;           //!< Cadenas ya emitidas en la traza binaria.
+  std::vector<uint32_t>
+      name_string_ids; //!< Cadena emitida de cada NameId, más 1 (0 = ninguna).
+  Tick last_binary_tick = 0; //!< Último tick emitido en la traza binaria.
+
+  int keyframe_interval = 0; //!< Ticks entre instantáneas (0 = siempre).
+  std::vector<FrameStatusEntry> frame_state; //!< Estado actual de los marcos.
+  Tick last_frame_keyframe = -1; //!< Tick de la última instantánea de marcos.
+  std::unordered_map<int, PageTableState>
+      page_table_state; //!< Base de los deltas de cada tabla de páginas.
+  std::vector<PageTableEntry> changed_pages; //!< Delta de tabla en curso.
+  std::vector<FrameStatusEntry> changed_frames; //!< Delta de marcos en curso.
+  std::string tick_record; //!< Línea o registro del tick que se vacía.
+  std::string tick_body;   //!< Cuerpo del registro binario del tick.
+
+  std::unique_ptr<MetricsAggregator> aggregator; //!< Series por ventanas.
+  std::unique_ptr<std::ofstream> aggregate_out;  //!< Archivo de las series.
+  std::vector<AggregateWindow> closed_windows;   //!< Ventanas por escribir.
+
+  std::string write_buffer; //!< Líneas pendientes de escribir.
+  size_t buffer_size = 0;   //!< Bytes a acumular antes de escribir (0 = sin búfer).
 
   void write_line(const std::string &json_line);
-  void flush_tick(int tick);
+  void write_windows();
+  void write_raw(const std::string &bytes);
+  void flush_buffer();
+  TickData &tick_slot(Tick tick);
+  void flush_ticks_before(Tick limit);
+  void flush_slot(TickData &slot);
+  void reset_snapshot_state();
+  void emit_frame_status(Tick tick,
+                         const std::vector<FrameStatusEntry> &changed);
+
+  static void serialize_tick(std::string &out, Tick tick,
+                             const TickData &data);
+  static std::string
+  cpu_summary_line(Tick total_time, double cpu_utilization,
+                   double avg_waiting_time, double avg_turnaround_time,
+                   double avg_response_time, int64_t context_switches,
+                   const std::string &algorithm,
+                   const std::vector<LatencySummary> &latencies);
+  static std::string core_summary_line(int core, Tick total_time,
+                                       Tick busy_ticks,
+                                       int64_t context_switches,
+                                       int64_t migrations, int64_t steals);
+  static std::string memory_summary_line(int64_t total_page_faults,
+                                         int64_t total_replacements,
+                                         int total_frames, int used_frames,
+                                         const std::string &algorithm,
+                                         int64_t completed_processes,
+                                         Tick total_time,
+                                         int64_t deferred_admissions,
+                                         Tick deferral_ticks, int64_t tlb_hits,
+                                         int64_t tlb_misses);
+  static std::string numa_summary_line(int node, int frames,
+                                       int64_t page_faults,
+                                       int64_t local_accesses,
+                                       int64_t remote_accesses,
+                                       int64_t remote_loads,
+                                       Tick remote_stall_ticks);
+
+  void start_binary_trace();
+  void encode_string(std::string &out, const std::string &value);
+  void encode_name(std::string &out, NameId name);
+  void encode_tick(std::string &out, Tick tick, const TickData &data);
+  void encode_cpu_summary(std::string &out, Tick total_time,
+                          double cpu_utilization, double avg_waiting_time,
+                          double avg_turnaround_time, double avg_response_time,
+                          int64_t context_switches,
+                          const std::string &algorithm,
+                          const std::vector<LatencySummary> &latencies);
+  void encode_core_summary(std::string &out, int core, Tick total_time,
+                           Tick busy_ticks, int64_t context_switches,
+                           int64_t migrations, int64_t steals);
+  void encode_memory_summary(std::string &out, int64_t total_page_faults,
+                             int64_t total_replacements, int total_frames,
+                             int used_frames, const std::string &algorithm,
+                             int64_t completed_processes, Tick total_time,
+                             int64_t deferred_admissions, Tick deferral_ticks,
+                             int64_t tlb_hits, int64_t tlb_misses);
+  void encode_numa_summary(std::string &out, int node, int frames,
+                           int64_t page_faults, int64_t local_accesses,
+                           int64_t remote_accesses, int64_t remote_loads,
+                           Tick remote_stall_ticks);
+
+  void flush_pending();
+  template <typename Fill> bool push_event(Fill &&fill, bool force_block);
+  void writer_loop();
+  void apply_event(const MetricsEvent &ev);
+
+  void record_cpu(Tick tick, const std::string &event, int pid, NameId name,
+                  Tick remaining, size_t ready_queue_size,
+                  bool context_switch_occurred);
+  void record_core(Tick tick, int core, const std::string &event, int pid,
+                   NameId name, Tick remaining, size_t ready_queue_size,
+                   bool context_switch_occurred);
+  void record_io(Tick tick, NameId device_name, const std::string &event,
+                 int pid, NameId name, Tick remaining, size_t queue_size);
+  void record_memory(Tick tick, const std::string &event, int pid, NameId name,
+                     int page_id, int frame_id, int64_t total_page_faults,
+                     int64_t total_replacements);
+  void record_state_transition(Tick tick, int pid, NameId name,
+                               ProcessState from_state, ProcessState to_state,
+                               const std::string &reason);
+  void record_queue_snapshot(Tick tick, const std::vector<int> &ready_queue,
+                             const std::vector<int> &blocked_memory_queue,
+                             const std::vector<int> &blocked_io_queue,
+                             int running_pid);
+  void record_page_table(Tick tick, int pid, NameId name,
+                         const std::vector<PageTableEntry> &page_table);
+  void record_frame_status(Tick tick,
+                           const std::vector<FrameStatusEntry> &frame_status);
+  void record_frame_changes(Tick tick,
+                            const std::vector<FrameStatusEntry> &changed,
+                            int total_frames);
+  void write_cpu_summary(Tick total_time, double cpu_utilization,
+                         double avg_waiting_time, double avg_turnaround_time,
+                         double avg_response_time, int64_t context_switches,
+                         const std::string &algorithm,
+                         const std::vector<LatencySummary> &latencies);
+  void write_core_summary(int core, Tick total_time, Tick busy_ticks,
+                          int64_t context_switches, int64_t migrations,
+                          int64_t steals);
+  void write_memory_summary(int64_t total_page_faults,
+                            int64_t total_replacements, int total_frames,
+                            int used_frames, const std::string &algorithm,
+                            int64_t completed_processes, Tick total_time,
+                            int64_t deferred_admissions, Tick deferral_ticks,
+                            int64_t tlb_hits, int64_t tlb_misses);
+  void write_numa_summary(int node, int frames, int64_t page_faults,
+                          int64_t local_accesses, int64_t remote_accesses,
+                          int64_t remote_loads, Tick remote_stall_ticks);
 
   static std::string process_state_to_string(ProcessState state);
 
@@ -115,42 +368,301 @@ public:
   MetricsCollector();
   ~MetricsCollector();
 
-  bool enable_file_output(const std::string &path);
+  /**
+   * Habilita la salida a archivo.
+   *
+   * @param path Ruta del archivo.
+   * @param trace_format Formato del archivo (JSONL o binario).
+   * @return true si el archivo se abrió correctamente.
+   */
+  bool enable_file_output(const std::string &path,
+                          TraceFormat trace_format = TraceFormat::JSONL);
   void enable_stdout_output();
   void disable_output();
   bool is_enabled() const { return mode != OutputMode::DISABLED; }
+  /// Archivo de métricas (vacío si la salida no es a archivo).
+  const std::string &get_output_path() const { return output_path; }
+  TraceFormat get_trace_format() const { return format; }
+
+  /**
+   * Selecciona las categorías que se registran. Debe llamarse antes de
+   * comenzar la simulación.
+   *
+   * @param mask Combinación de valores de Category.
+   */
+  void set_categories(uint32_t mask) { categories = mask & CATEGORY_ALL; }
+  uint32_t get_categories() const { return categories; }
+
+  /**
+   * Registra solo uno de cada N ticks (los múltiplos de N). Debe llamarse
+   * antes de comenzar la simulación.
+   *
+   * @param every_n_ticks Tasa de muestreo; 1 registra todos los ticks.
+   */
+  void set_sample_rate(int every_n_ticks) {
+    sample_rate = std::max(1, every_n_ticks);
+  }
+  int get_sample_rate() const { return sample_rate; }
+
+  /**
+   * Indica si la salida está activa y la categoría se registra.
+   *
+   * @param category Categoría consultada.
+   * @return true si la categoría está habilitada.
+   */
+  bool logs_category(Category category) const {
+    return mode != OutputMode::DISABLED && (categories & category) != 0;
+  }
+
+  /**
+   * Indica si un registro de la categoría en el tick dado se escribiría. Los
+   * llamadores lo consultan antes de construir cadenas o vectores.
+   *
+   * @param category Categoría del registro.
+   * @param tick Tick del registro.
+   * @return true si el registro no se descartaría.
+   */
+  bool should_log(Category category, Tick tick) const {
+    return logs_category(category) &&
+           (sample_rate == 1 || tick % sample_rate == 0);
+  }
+
+  /**
+   * Convierte una lista separada por comas ("cpu,io,memory,transitions,
+   * queues,page_table,frame_status", "all" o "none") en una máscara.
+   *
+   * @param list Lista de categorías.
+   * @param mask Máscara resultante.
+   * @return false si algún nombre no es válido.
+   */
+  static bool parse_categories(const std::string &list, uint32_t &mask);
+
+  /**
+   * Establece el tamaño del búfer de escritura. Las líneas se acumulan en
+   * memoria y se escriben al superar el tamaño, en flush_all() o al
+   * deshabilitar la salida. Con 0 cada línea se escribe y se vuelca al
+   * instante.
+   *
+   * @param bytes Tamaño del búfer en bytes.
+   */
+  void set_buffer_size(size_t bytes);
+
+  /**
+   * Establece cada cuántos ticks se emiten instantáneas completas de la tabla
+   * de páginas y de los marcos. Entre ellas solo se registran las entradas
+   * que cambiaron ("page_table_delta" y "frame_status_delta"). Con 0 cada
+   * instantánea es completa.
+   *
+   * @param ticks Intervalo entre instantáneas completas.
+   */
+  void set_keyframe_interval(int ticks);
+
+  /**
+   * Activa el escritor asíncrono. Los registros se encolan sin tomar el mutex
+   * y un hilo dedicado los agrupa por tick, los serializa y los escribe.
+   *
+   * @param capacity Capacidad de la cola de eventos.
+   * @param policy Qué hacer cuando la cola está llena.
+   * @return true si el escritor quedó activo.
+   */
+  bool enable_async(size_t capacity = 16384,
+                    BackpressurePolicy policy = BackpressurePolicy::BLOCK);
+
+  /**
+   * Detiene el escritor asíncrono tras consumir los eventos encolados. Debe
+   * llamarse cuando ningún productor esté registrando.
+   */
+  void disable_async();
+
+  bool is_async() const { return async_active.load(); }
+
+  /**
+   * Obtiene cuántos eventos se descartaron por cola llena.
+   *
+   * @return Número de eventos descartados.
+   */
+  uint64_t get_dropped_events() const { return dropped_events.load(); }
 
   void flush_all();
 
-  void log_cpu(int tick, const std::string &event, int pid,
-               const std::string &name, int remaining, size_t ready_queue_size,
+  /**
+   * Activa las series agregadas: por cada ancho de ventana, una línea JSON
+   * por ventana con la utilización de CPU, el mínimo, promedio y máximo de
+   * cada cola, los fallos de página por tick y las solicitudes de E/S
+   * atendidas por tick. Se escriben en un archivo aparte, independiente de
+   * las categorías y de la tasa de muestreo, para dibujar tableros de
+   * simulaciones largas sin recorrer la traza completa.
+   *
+   * @param widths Anchos de ventana en ticks.
+   * @param path Archivo de salida; vacío usa el archivo de métricas con la
+   * extensión ".aggregates.jsonl".
+   * @return false si no hay anchos válidos o el archivo no pudo abrirse.
+   */
+  bool enable_aggregates(const std::vector<int> &widths,
+                         const std::string &path = "");
+  bool aggregates_enabled() const { return aggregator != nullptr; }
+
+  /**
+   * Acumula el estado tras un paso en las series agregadas. Solo desde el
+   * hilo de la simulación.
+   *
+   * @param sample Estado tras el paso.
+   */
+  void log_aggregate_sample(const AggregateSample &sample);
+
+  /// Escribe las ventanas parciales y cierra el archivo de las series.
+  void finish_aggregates();
+
+  /**
+   * Convierte una traza binaria al formato JSONL equivalente.
+   *
+   * @param input Ruta de la traza binaria.
+   * @param output Ruta del archivo JSONL a generar.
+   * @return true si la traza era válida y se escribió la salida.
+   */
+  static bool convert_binary_to_jsonl(const std::string &input,
+                                      const std::string &output);
+
+  /**
+   * Registra lo que hizo la CPU en un tick.
+   *
+   * Los nombres de procesos y dispositivos se reciben internados en
+   * name_table() (Process::name_id) y solo se resuelven al serializar; las
+   * sobrecargas con std::string internan el nombre en cada llamada.
+   */
+  void log_cpu(Tick tick, const std::string &event, int pid, NameId name,
+               Tick remaining, size_t ready_queue_size,
                bool context_switch_occurred);
+  void log_cpu(Tick tick, const std::string &event, int pid,
+               const std::string &name, Tick remaining, size_t ready_queue_size,
+               bool context_switch_occurred) {
+    log_cpu(tick, event, pid, name_table().intern(name), remaining,
+            ready_queue_size, context_switch_occurred);
+  }
 
-  void log_io(int tick, const std::string &device_name,
+  /**
+   * Registra lo que hizo un núcleo en un tick del modo multinúcleo. Los
+   * núcleos de un mismo tick se agrupan en la clave "cores".
+   *
+   * @param tick Tick actual.
+   * @param core Índice del núcleo.
+   * @param event EXEC, COMPLETE, PREEMPT, MIGRATE o IDLE.
+   * @param pid ID del proceso en el núcleo (-1 si está ocioso).
+   * @param name Nombre del proceso.
+   * @param remaining Tiempo restante de la ráfaga de CPU.
+   * @param ready_queue_size Procesos en la cola del núcleo.
+   * @param context_switch_occurred Si el núcleo cambió de proceso.
+   */
+  void log_core(Tick tick, int core, const std::string &event, int pid,
+                NameId name, Tick remaining, size_t ready_queue_size,
+                bool context_switch_occurred);
+  void log_core(Tick tick, int core, const std::string &event, int pid,
+                const std::string &name, Tick remaining,
+                size_t ready_queue_size, bool context_switch_occurred) {
+    log_core(tick, core, event, pid, name_table().intern(name), remaining,
+             ready_queue_size, context_switch_occurred);
+  }
+
+  void log_io(Tick tick, NameId device_name, const std::string &event, int pid,
+              NameId name, Tick remaining, size_t queue_size);
+  void log_io(Tick tick, const std::string &device_name,
               const std::string &event, int pid, const std::string &name,
-              int remaining, size_t queue_size);
+              Tick remaining, size_t queue_size) {
+    log_io(tick, name_table().intern(device_name), event, pid,
+           name_table().intern(name), remaining, queue_size);
+  }
 
-  void log_memory(int tick, const std::string &event, int pid,
+  void log_memory(Tick tick, const std::string &event, int pid, NameId name,
+                  int page_id, int frame_id, int64_t total_page_faults,
+                  int64_t total_replacements);
+  void log_memory(Tick tick, const std::string &event, int pid,
                   const std::string &name, int page_id, int frame_id,
-                  int total_page_faults, int total_replacements);
+                  int64_t total_page_faults, int64_t total_replacements) {
+    log_memory(tick, event, pid, name_table().intern(name), page_id, frame_id,
+               total_page_faults, total_replacements);
+  }
 
-  void log_state_transition(int tick, int pid, const std::string &name,
+  void log_state_transition(Tick tick, int pid, NameId name,
                             ProcessState from_state, ProcessState to_state,
                             const std::string &reason);
+  void log_state_transition(Tick tick, int pid, const std::string &name,
+                            ProcessState from_state, ProcessState to_state,
+                            const std::string &reason) {
+    log_state_transition(tick, pid, name_table().intern(name), from_state,
+                         to_state, reason);
+  }
 
-  void log_queue_snapshot(int tick, const std::vector<int> &ready_queue,
+  void log_queue_snapshot(Tick tick, const std::vector<int> &ready_queue,
                           const std::vector<int> &blocked_memory_queue,
                           const std::vector<int> &blocked_io_queue,
                           int running_pid);
 
-  void log_cpu_summary(int total_time, double cpu_utilization,
+  /**
+   * Registra el resumen de CPU al final de la simulación.
+   *
+   * @param latencies Percentiles de latencia (CPUScheduler::
+   * get_latency_summaries); si hay filas, se agregan en la clave "latency".
+   */
+  void log_cpu_summary(Tick total_time, double cpu_utilization,
                        double avg_waiting_time, double avg_turnaround_time,
-                       double avg_response_time, int context_switches,
-                       const std::string &algorithm);
+                       double avg_response_time, int64_t context_switches,
+                       const std::string &algorithm,
+                       const std::vector<LatencySummary> &latencies = {});
+
+  /**
+   * Registra el resumen de un núcleo al final de una simulación multinúcleo.
+   *
+   * @param core Índice del núcleo.
+   * @param total_time Duración de la simulación.
+   * @param busy_ticks Ticks ejecutando procesos.
+   * @param context_switches Cambios de contexto del núcleo.
+   * @param migrations Procesos recibidos desde otro núcleo.
+   * @param steals Procesos robados de la cola de otro núcleo.
+   */
+  void log_core_summary(int core, Tick total_time, Tick busy_ticks,
+                        int64_t context_switches, int64_t migrations,
+                        int64_t steals);
 
-  void log_memory_summary(int total_page_faults, int total_replacements,
+  /**
+   * Registra el resumen de memoria al final de la simulación, con el
+   * rendimiento (procesos completados por tick), la actividad del control
+   * de carga y los aciertos de la TLB.
+   *
+   * @param total_page_faults Fallos de página totales.
+   * @param total_replacements Reemplazos totales.
+   * @param total_frames Marcos físicos.
+   * @param used_frames Máximo de marcos ocupados a la vez.
+   * @param algorithm Algoritmo de reemplazo.
+   * @param completed_processes Procesos terminados.
+   * @param total_time Duración de la simulación.
+   * @param deferred_admissions Procesos con la admisión diferida.
+   * @param deferral_ticks Ticks de espera de las admisiones diferidas.
+   * @param tlb_hits Traducciones encontradas en la TLB.
+   * @param tlb_misses Traducciones que fallaron en la TLB.
+   */
+  void log_memory_summary(int64_t total_page_faults, int64_t total_replacements,
                           int total_frames, int used_frames,
-                          const std::string &algorithm);
+                          const std::string &algorithm,
+                          int64_t completed_processes = 0, Tick total_time = 0,
+                          int64_t deferred_admissions = 0,
+                          Tick deferral_ticks = 0, int64_t tlb_hits = 0,
+                          int64_t tlb_misses = 0);
+
+  /**
+   * Registra el resumen de un nodo NUMA al final de la simulación, con la
+   * localidad de sus accesos (porcentaje de accesos locales).
+   *
+   * @param node Índice del nodo.
+   * @param frames Memoria del nodo en marcos base.
+   * @param page_faults Fallos de página de los núcleos del nodo.
+   * @param local_accesses Accesos a marcos del mismo nodo.
+   * @param remote_accesses Accesos a marcos de otro nodo.
+   * @param remote_loads Cargas colocadas en la memoria de otro nodo.
+   * @param remote_stall_ticks Ticks de espera por accesos remotos.
+   */
+  void log_numa_summary(int node, int frames, int64_t page_faults,
+                        int64_t local_accesses, int64_t remote_accesses,
+                        int64_t remote_loads, Tick remote_stall_ticks);
 
   /**
    * Registra el estado completo de la tabla de páginas de un proceso.
@@ -160,8 +672,12 @@ public:
    * @param name Nombre del proceso.
    * @param page_table Vector de entradas de la tabla de páginas.
    */
-  void log_page_table(int tick, int pid, const std::string &name,
+  void log_page_table(Tick tick, int pid, NameId name,
                       const std::vector<PageTableEntry> &page_table);
+  void log_page_table(Tick tick, int pid, const std::string &name,
+                      const std::vector<PageTableEntry> &page_table) {
+    log_page_table(tick, pid, name_table().intern(name), page_table);
+  }
 
   /**
    * Registra el estado de todos los marcos de memoria.
@@ -169,8 +685,21 @@ public:
    * @param tick Tick actual.
    * @param frame_status Vector con el estado de cada marco.
    */
-  void log_frame_status(int tick,
+  void log_frame_status(Tick tick,
                         const std::vector<FrameStatusEntry> &frame_status);
+
+  /**
+   * Registra solo los marcos que cambiaron desde el último registro. El
+   * recolector mantiene el estado completo para emitir las instantáneas
+   * completas.
+   *
+   * @param tick Tick actual.
+   * @param changed Marcos modificados; frame_id es su índice.
+   * @param total_frames Número total de marcos.
+   */
+  void log_frame_changes(Tick tick,
+                         const std::vector<FrameStatusEntry> &changed,
+                         int total_frames);
 };
 
 } // namespace OSSimulator
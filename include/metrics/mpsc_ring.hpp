@@ -0,0 +1,119 @@
+#ifndef MPSC_RING_HPP
+#define MPSC_RING_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+
+namespace OSSimulator {
+
+/**
+ * Cola circular acotada, sin bloqueos, para varios productores y un único
+ * consumidor.
+ *
+ * Cada casilla lleva un número de secuencia que indica si está libre para el
+ * productor de una vuelta dada o publicada para el consumidor. Los elementos
+ * se escriben y leen en su casilla, de modo que la memoria de los valores
+ * (cadenas, vectores) se reutiliza entre vueltas.
+ *
+ * @tparam T Tipo de los elementos almacenados.
+ */
+template <typename T> class MpscRing {
+private:
+  struct Slot {
+    std::atomic<size_t> sequence; //!< Estado de la casilla.
+    T value;                      //!< Elemento almacenado.
+  };
+
+  std::unique_ptr<Slot[]> slots; //!< Casillas de la cola.
+  size_t mask;                   //!< Capacidad - 1 (potencia de dos).
+  alignas(64) std::atomic<size_t> enqueue_pos{0}; //!< Próxima casilla a llenar.
+  alignas(64) std::atomic<size_t> dequeue_pos{0}; //!< Próxima casilla a leer.
+
+public:
+  /**
+   * Constructor.
+   *
+   * @param capacity Capacidad mínima; se redondea a potencia de dos.
+   */
+  explicit MpscRing(size_t capacity) {
+    size_t size = 2;
+    while (size < capacity)
+      size <<= 1;
+    slots = std::make_unique<Slot[]>(size);
+    mask = size - 1;
+    for (size_t i = 0; i < size; ++i)
+      slots[i].sequence.store(i, std::memory_order_relaxed);
+  }
+
+  /**
+   * Reserva una casilla, la rellena y la publica.
+   *
+   * @param fill Función que escribe el elemento en la casilla.
+   * @return false si la cola está llena.
+   */
+  template <typename Fill> bool try_push(Fill &&fill) {
+    size_t pos = enqueue_pos.load(std::memory_order_relaxed);
+    Slot *slot;
+    while (true) {
+      slot = &slots[pos & mask];
+      size_t seq = slot->sequence.load(std::memory_order_acquire);
+      auto diff = static_cast<std::ptrdiff_t>(seq) -
+                  static_cast<std::ptrdiff_t>(pos);
+      if (diff == 0) {
+        if (enqueue_pos.compare_exchange_weak(pos, pos + 1,
+                                              std::memory_order_relaxed))
+          break;
+      } else if (diff < 0) {
+        return false;
+      } else {
+        pos = enqueue_pos.load(std::memory_order_relaxed);
+      }
+    }
+
+    fill(slot->value);
+    slot->sequence.store(pos + 1, std::memory_order_release);
+    return true;
+  }
+
+  /**
+   * Consume el elemento más antiguo si está publicado. Solo debe llamarse
+   * desde el hilo consumidor.
+   *
+   * @param drain Función que procesa el elemento en su casilla.
+   * @return false si la cola está vacía.
+   */
+  template <typename Drain> bool try_pop(Drain &&drain) {
+    size_t pos = dequeue_pos.load(std::memory_order_relaxed);
+    Slot &slot = slots[pos & mask];
+    if (slot.sequence.load(std::memory_order_acquire) != pos + 1)
+      return false;
+
+    drain(slot.value);
+    dequeue_pos.store(pos + 1, std::memory_order_relaxed);
+    slot.sequence.store(pos + mask + 1, std::memory_order_release);
+    return true;
+  }
+
+  /**
+   * Indica si hay elementos publicados pendientes de consumir.
+   *
+   * @return true si la cola parece vacía.
+   */
+  bool empty() const {
+    size_t pos = dequeue_pos.load(std::memory_order_relaxed);
+    return slots[pos & mask].sequence.load(std::memory_order_acquire) !=
+           pos + 1;
+  }
+
+  /**
+   * Obtiene la capacidad real de la cola.
+   *
+   * @return Número de casillas.
+   */
+  size_t capacity() const { return mask + 1; }
+};
+
+} // namespace OSSimulator
+
+#endif
@@ -3,10 +3,12 @@
 namespace OSSimulator {
 
 Burst::Burst()
-    : type(BurstType::CPU), duration(0), remaining_time(0), io_device("") {}
+    : duration(0), remaining_time(0), io_device(""), cylinder(0),
+      type(BurstType::CPU) {}
 
-Burst::Burst(BurstType t, int d, const std::string &device)
-    : type(t), duration(d), remaining_time(d), io_device(device) {}
+Burst::Burst(BurstType t, Tick d, const std::string &device, int cyl)
+    : duration(d), remaining_time(d), io_device(device), cylinder(cyl),
+      type(t) {}
 
 bool Burst::is_completed() const { return remaining_time <= 0; }
 
@@ -1,7 +1,12 @@
 #include "core/config_parser.hpp"
+#include "core/process_stream.hpp"
+#include "cpu/mlfq_scheduler.hpp"
+#include <algorithm>
 #include <cctype>
+#include <charconv>
+#include <cstdint>
 #include <fstream>
-#include <regex>
+#include <limits>
 #include <sstream>
 #include <stdexcept>
 
@@ -26,71 +31,312 @@ std::string ConfigParser::trim(const std::string &str) {
   return std::string(start, end + 1);
 }
 
+namespace {
+
+bool is_space(char c) {
+  return std::isspace(static_cast<unsigned char>(c)) != 0;
+}
+
+bool is_digit(char c) { return c >= '0' && c <= '9'; }
+
+std::string_view trim_view(std::string_view text) {
+  while (!text.empty() && is_space(text.front()))
+    text.remove_prefix(1);
+  while (!text.empty() && is_space(text.back()))
+    text.remove_suffix(1);
+  return text;
+}
+
 /**
- * Verifica si una cadena comienza con un prefijo dado.
- * @param str Cadena a verificar.
- * @param prefix Prefijo a buscar.
- * @return true si la cadena comienza con el prefijo, false en caso contrario.
+ * Convierte una secuencia de dígitos, como std::stoi.
+ * @throws std::out_of_range Si el valor no cabe en el tipo pedido.
  */
-bool ConfigParser::starts_with(const std::string &str,
-                               const std::string &prefix) {
-  return str.size() >= prefix.size() &&
-         str.compare(0, prefix.size(), prefix) == 0;
+template <typename Int = int> Int digits_to_int(std::string_view digits) {
+  Int value = 0;
+  auto result =
+      std::from_chars(digits.data(), digits.data() + digits.size(), value);
+  if (result.ec == std::errc::result_out_of_range) {
+    throw std::out_of_range("Número fuera de rango: " + std::string(digits));
+  }
+  return value;
 }
 
+/**
+ * Lee un entero con signo opcional al inicio del texto, como operator>> de
+ * un flujo: se detiene en el primer carácter que no es dígito y avanza el
+ * texto hasta él.
+ * @return false si no hay dígitos o el valor no cabe en el tipo de value.
+ */
+template <typename Int> bool read_int(std::string_view &text, Int &value) {
+  size_t digits = 0;
+  bool negative = false;
+  if (!text.empty() && (text.front() == '+' || text.front() == '-')) {
+    negative = text.front() == '-';
+    digits = 1;
+  }
+  if (digits >= text.size() || !is_digit(text[digits]))
+    return false;
+
+  int64_t magnitude = 0;
+  auto result = std::from_chars(text.data() + digits,
+                                text.data() + text.size(), magnitude);
+  text.remove_prefix(static_cast<size_t>(result.ptr - text.data()));
+  int64_t signed_value = negative ? -magnitude : magnitude;
+  if (result.ec == std::errc::result_out_of_range ||
+      signed_value < std::numeric_limits<Int>::min() ||
+      signed_value > std::numeric_limits<Int>::max()) {
+    return false;
+  }
+  value = static_cast<Int>(signed_value);
+  return true;
+}
+
+/**
+ * Extrae la siguiente palabra separada por espacios.
+ * @return Palabra, vacía si no quedan.
+ */
+std::string_view next_token(std::string_view &text) {
+  while (!text.empty() && is_space(text.front()))
+    text.remove_prefix(1);
+  size_t length = 0;
+  while (length < text.size() && !is_space(text[length]))
+    length++;
+  std::string_view token = text.substr(0, length);
+  text.remove_prefix(length);
+  return token;
+}
+
+/**
+ * Lee el entero que sigue a los espacios iniciales.
+ */
+template <typename Int> bool next_int(std::string_view &text, Int &value) {
+  while (!text.empty() && is_space(text.front()))
+    text.remove_prefix(1);
+  return read_int(text, value);
+}
+
+bool is_device_char(char c) {
+  return std::isalnum(static_cast<unsigned char>(c)) || c == '_' ||
+         c == '.' || c == '-';
+}
+
+/**
+ * Intenta reconocer una ráfaga "TIPO[dispositivo@cilindro](n)" en una
+ * posición.
+ * @param text Secuencia de ráfagas.
+ * @param pos Posición donde empieza la ráfaga.
+ * @param burst Ráfaga reconocida.
+ * @return Posición siguiente a la ráfaga, o std::string_view::npos si no hay
+ * una ráfaga en esa posición.
+ */
+size_t match_burst(std::string_view text, size_t pos, Burst &burst) {
+  BurstType type;
+  std::string_view head = text.substr(pos, 3);
+  if (head == "CPU") {
+    type = BurstType::CPU;
+  } else if (head == "E/S") {
+    type = BurstType::IO;
+  } else {
+    return std::string_view::npos;
+  }
+  size_t i = pos + 3;
+
+  std::string_view device;
+  std::string_view cylinder;
+  if (i < text.size() && text[i] == '[') {
+    size_t j = i + 1;
+    while (j < text.size() && is_device_char(text[j]))
+      j++;
+    device = text.substr(i + 1, j - i - 1);
+    if (j < text.size() && text[j] == '@') {
+      size_t k = j + 1;
+      while (k < text.size() && is_digit(text[k]))
+        k++;
+      if (k > j + 1) {
+        cylinder = text.substr(j + 1, k - j - 1);
+        j = k;
+      }
+    }
+    if (j >= text.size() || text[j] != ']')
+      return std::string_view::npos;
+    i = j + 1;
+  }
+
+  if (i >= text.size() || text[i] != '(')
+    return std::string_view::npos;
+  size_t digits_end = i + 1;
+  while (digits_end < text.size() && is_digit(text[digits_end]))
+    digits_end++;
+  if (digits_end == i + 1 || digits_end >= text.size() ||
+      text[digits_end] != ')') {
+    return std::string_view::npos;
+  }
+
+  Tick duration = digits_to_int<Tick>(text.substr(i + 1, digits_end - i - 1));
+  if (type == BurstType::IO) {
+    burst = Burst(type, duration,
+                  device.empty() ? std::string("disk") : std::string(device),
+                  cylinder.empty() ? 0 : digits_to_int(cylinder));
+  } else {
+    burst = Burst(type, duration);
+  }
+  return digits_end + 1;
+}
+
+} // namespace
+
 /**
  * Parsea una secuencia de ráfagas desde una cadena.
- * @param burst_str Cadena con formato "CPU(x),E/S(y),CPU(z)".
+ * @param burst_str Cadena con formato
+ * "CPU(x),E/S(y),E/S[dispositivo](z),E/S[dispositivo@cilindro](w)".
+ * Las ráfagas de E/S sin dispositivo usan "disk" y sin cilindro, el 0. El
+ * texto que no forma una ráfaga se ignora.
  * @return Vector de ráfagas parseadas.
  */
-std::vector<Burst>
-ConfigParser::parse_burst_sequence(const std::string &burst_str) {
+std::vector<Burst> ConfigParser::parse_burst_sequence(std::string_view burst_str) {
   std::vector<Burst> bursts;
-  std::regex burst_regex(R"((CPU|E/S)\((\d+)\))");
-  std::sregex_iterator iter(burst_str.begin(), burst_str.end(), burst_regex);
-  std::sregex_iterator end;
+  Burst burst;
+  size_t pos = 0;
+  while (pos < burst_str.size()) {
+    size_t next = match_burst(burst_str, pos, burst);
+    if (next == std::string_view::npos) {
+      pos++;
+      continue;
+    }
+    bursts.push_back(std::move(burst));
+    pos = next;
+  }
 
-  while (iter != end) {
-    std::smatch match = *iter;
-    std::string type_str = match[1].str();
-    int duration = std::stoi(match[2].str());
+  return bursts;
+}
 
-    BurstType type = (type_str == "CPU") ? BurstType::CPU : BurstType::IO;
-    std::string device = (type == BurstType::IO) ? "disk" : "";
+/**
+ * Parsea el rastro de accesos a memoria de un proceso.
+ * @param trace_str Cadena con formato "0,1w,2,1,3".
+ * @param writes Recibe qué accesos terminan en w, o nada si ninguno.
+ * @return Vector de índices de página, vacío si algún elemento no es un entero
+ * no negativo, con una w final opcional.
+ */
+std::vector<int> ConfigParser::parse_access_trace(std::string_view trace_str,
+                                                  std::vector<bool> *writes) {
+  std::vector<int> trace;
+  std::vector<bool> written;
+  bool any_write = false;
+  size_t pos = 0;
 
-    bursts.emplace_back(type, duration, device);
-    ++iter;
+  while (pos < trace_str.size()) {
+    size_t comma = trace_str.find(',', pos);
+    std::string_view item = trim_view(trace_str.substr(
+        pos, comma == std::string_view::npos ? std::string_view::npos
+                                             : comma - pos));
+    pos = comma == std::string_view::npos ? trace_str.size() : comma + 1;
+    bool write = !item.empty() && item.back() == 'w';
+    if (write) {
+      item.remove_suffix(1);
+      any_write = true;
+    }
+    if (item.empty() || !std::all_of(item.begin(), item.end(), is_digit)) {
+      return {};
+    }
+    trace.push_back(digits_to_int(item));
+    written.push_back(write);
   }
 
-  return bursts;
+  if (writes) {
+    if (any_write) {
+      *writes = std::move(written);
+    } else {
+      writes->clear();
+    }
+  }
+  return trace;
+}
+
+/**
+ * Parsea el mapeo de una región compartida.
+ * @param token Cadena con formato "nombre@página:cantidad".
+ * @param mapping Mapeo leído.
+ * @return false si falta el nombre, la página es negativa o la cantidad no
+ * es positiva.
+ */
+bool ConfigParser::parse_shared_mapping(std::string_view token,
+                                        SharedMapping &mapping) {
+  size_t at = token.find('@');
+  if (at == 0 || at == std::string_view::npos ||
+      !std::all_of(token.begin(), token.begin() + at, is_device_char)) {
+    return false;
+  }
+  std::string_view rest = token.substr(at + 1);
+  int first_page = 0;
+  int pages = 0;
+  if (rest.empty() || !is_digit(rest.front()) ||
+      !read_int(rest, first_page) || rest.empty() || rest.front() != ':') {
+    return false;
+  }
+  rest.remove_prefix(1);
+  if (rest.empty() || !is_digit(rest.front()) || !read_int(rest, pages) ||
+      !rest.empty() || pages <= 0) {
+    return false;
+  }
+  mapping = {std::string(token.substr(0, at)), first_page, pages};
+  return true;
 }
 
 /**
  * Parsea una línea del archivo de procesos.
- * @param line Línea a parsear con formato "PID tiempo_llegada ráfagas prioridad páginas".
+ * @param line Línea a parsear con formato "PID tiempo_llegada ráfagas prioridad
+ * páginas [rastro] [región@página:cantidad...]".
  * @return Puntero al proceso creado, o nullptr si la línea es inválida o un comentario.
  */
-std::shared_ptr<Process>
-ConfigParser::parse_process_line(const std::string &line) {
-  std::string trimmed_line = trim(line);
+std::shared_ptr<Process> ConfigParser::parse_process_line(std::string_view line) {
+  std::string_view rest = trim_view(line);
 
-  if (trimmed_line.empty() || trimmed_line[0] == '#') {
+  if (rest.empty() || rest.front() == '#') {
     return nullptr;
   }
 
-  std::istringstream iss(trimmed_line);
-  std::string pid_str;
-  int arrival_time;
-  std::string burst_str;
-  int priority = 0;
-  int pages_required = 0;
-
-  if (!(iss >> pid_str >> arrival_time >> burst_str)) {
+  // Los campos se leen como con operator>>: la prioridad, las páginas y el
+  // rastro son opcionales y un campo inválido descarta los siguientes.
+  std::string_view pid_str = next_token(rest);
+  Tick arrival_time = 0;
+  if (!next_int(rest, arrival_time)) {
+    return nullptr;
+  }
+  std::string_view burst_str = next_token(rest);
+  if (burst_str.empty()) {
     return nullptr;
   }
 
-  iss >> priority;
-  iss >> pages_required;
+  int priority = 0;
+  int pages_required = 0;
+  std::string_view trace_str;
+  std::vector<SharedMapping> mappings;
+  if (next_int(rest, priority) && next_int(rest, pages_required)) {
+    // Tras el rastro opcional vienen los mapeos compartidos, que se
+    // distinguen por la @; como antes, el texto que sigue se ignora.
+    for (std::string_view token = next_token(rest); !token.empty();
+         token = next_token(rest)) {
+      if (token.find('@') == std::string_view::npos) {
+        if (!trace_str.empty() || !mappings.empty())
+          break;
+        trace_str = token;
+        continue;
+      }
+      SharedMapping mapping;
+      if (!parse_shared_mapping(token, mapping) ||
+          mapping.first_page > pages_required - mapping.pages) {
+        return nullptr;
+      }
+      for (const auto &other : mappings) {
+        if (other.region == mapping.region ||
+            (mapping.first_page < other.first_page + other.pages &&
+             other.first_page < mapping.first_page + mapping.pages)) {
+          return nullptr;
+        }
+      }
+      mappings.push_back(std::move(mapping));
+    }
+  }
 
   std::vector<Burst> bursts = parse_burst_sequence(burst_str);
 
@@ -98,22 +344,35 @@ ConfigParser::parse_process_line(const std::string &line) {
     return nullptr;
   }
 
+  std::string_view pid_digits = pid_str;
+  if (!pid_digits.empty() && pid_digits.front() == 'P') {
+    pid_digits.remove_prefix(1);
+  }
   int pid = 0;
-  try {
-    if (starts_with(pid_str, "P")) {
-      pid = std::stoi(pid_str.substr(1));
-    } else {
-      pid = std::stoi(pid_str);
-    }
-  } catch (const std::exception &) {
+  if (!read_int(pid_digits, pid)) {
     return nullptr;
   }
 
+  std::vector<int> trace;
+  std::vector<bool> writes;
+  if (!trace_str.empty()) {
+    trace = parse_access_trace(trace_str, &writes);
+    if (trace.empty() || *std::max_element(trace.begin(), trace.end()) >=
+                             pages_required) {
+      return nullptr;
+    }
+  }
+
   uint32_t memory_required =
       pages_required > 0 ? static_cast<uint32_t>(pages_required) : 0;
 
-  return std::make_shared<Process>(pid, pid_str, arrival_time, bursts, priority,
-                                   memory_required);
+  auto process = std::make_shared<Process>(pid, std::string(pid_str),
+                                           arrival_time, bursts, priority,
+                                           memory_required);
+  process->memory_access_trace = std::move(trace);
+  process->memory_write_trace = std::move(writes);
+  process->shared_mappings = std::move(mappings);
+  return process;
 }
 
 /**
@@ -125,22 +384,187 @@ ConfigParser::parse_process_line(const std::string &line) {
 std::vector<std::shared_ptr<Process>>
 ConfigParser::load_processes_from_file(const std::string &filename) {
   std::vector<std::shared_ptr<Process>> processes;
-  std::ifstream file(filename);
+  ProcessStream stream(filename);
+  while (auto process = stream.next()) {
+    processes.push_back(std::move(process));
+  }
+  return processes;
+}
 
-  if (!file.is_open()) {
-    throw std::runtime_error("No se pudo abrir el archivo: " + filename);
+/**
+ * Parsea la declaración de un dispositivo de E/S.
+ * @param value Cadena con formato
+ * "nombre[:algoritmo[:quantum[:tasa[:velocidad[:cilindros]]]]]".
+ * @return Dispositivo declarado; los campos omitidos toman su valor por
+ * defecto.
+ * @throws std::invalid_argument Si el nombre está vacío, la tasa, el quantum
+ * o los cilindros no son positivos o la velocidad es negativa.
+ */
+IODeviceConfig ConfigParser::parse_io_device(const std::string &value) {
+  std::vector<std::string> fields;
+  std::istringstream iss(value);
+  std::string item;
+  while (std::getline(iss, item, ':')) {
+    fields.push_back(trim(item));
   }
 
-  std::string line;
-  while (std::getline(file, line)) {
-    auto process = parse_process_line(line);
-    if (process) {
-      processes.push_back(process);
-    }
+  IODeviceConfig device;
+  if (fields.empty() || fields[0].empty()) {
+    throw std::invalid_argument("Dispositivo de E/S sin nombre: " + value);
+  }
+  device.name = fields[0];
+  if (fields.size() > 1 && !fields[1].empty()) {
+    device.scheduling_algorithm = fields[1];
+  }
+  if (fields.size() > 2 && !fields[2].empty()) {
+    device.quantum = std::stoi(fields[2]);
+  }
+  if (fields.size() > 3 && !fields[3].empty()) {
+    device.service_rate = std::stoi(fields[3]);
   }
+  if (fields.size() > 4 && !fields[4].empty()) {
+    device.seek_speed = std::stoi(fields[4]);
+  }
+  if (fields.size() > 5 && !fields[5].empty()) {
+    device.cylinders = std::stoi(fields[5]);
+  }
+  if (device.quantum <= 0 || device.service_rate <= 0 ||
+      device.seek_speed < 0 || device.cylinders <= 0) {
+    throw std::invalid_argument("Dispositivo de E/S no válido: " + value);
+  }
+  return device;
+}
 
-  file.close();
-  return processes;
+/**
+ * Asigna un parámetro de configuración a partir de su clave.
+ * @param config Configuración a modificar.
+ * @param key Nombre del parámetro.
+ * @param value Valor en texto.
+ * @return false si la clave no es reconocida.
+ */
+bool ConfigParser::apply_config_value(SimulatorConfig &config,
+                                      const std::string &key,
+                                      const std::string &value) {
+  if (key == "total_memory_frames") {
+    config.total_memory_frames = std::stoi(value);
+  } else if (key == "frame_size") {
+    config.frame_size = std::stoi(value);
+  } else if (key == "huge_page_size") {
+    config.huge_page_size = std::stoi(value);
+  } else if (key == "huge_page_frames") {
+    config.huge_page_frames = std::stoi(value);
+  } else if (key == "scheduling_algorithm") {
+    config.scheduling_algorithm = value;
+  } else if (key == "page_replacement_algorithm") {
+    config.page_replacement_algorithm = value;
+  } else if (key == "quantum") {
+    config.quantum = std::stoi(value);
+  } else if (key == "priority_aging_interval") {
+    config.priority_aging_interval = std::stoi(value);
+  } else if (key == "mlfq_quanta") {
+    config.mlfq_quanta = parse_mlfq_quanta(value);
+  } else if (key == "mlfq_boost_interval") {
+    config.mlfq_boost_interval = std::stoi(value);
+  } else if (key == "cfs_target_latency") {
+    config.cfs_target_latency = std::stoi(value);
+  } else if (key == "cfs_min_granularity") {
+    config.cfs_min_granularity = std::stoi(value);
+  } else if (key == "sjf_prediction") {
+    config.sjf_prediction = value;
+  } else if (key == "sjf_alpha") {
+    config.sjf_alpha = std::stod(value);
+  } else if (key == "sjf_initial_estimate") {
+    config.sjf_initial_estimate = std::stoi(value);
+  } else if (key == "io_scheduling_algorithm") {
+    config.io_scheduling_algorithm = value;
+  } else if (key == "io_quantum") {
+    config.io_quantum = std::stoi(value);
+  } else if (key == "io_seek_speed") {
+    config.io_seek_speed = std::stoi(value);
+  } else if (key == "io_cylinders") {
+    config.io_cylinders = std::stoi(value);
+  } else if (key == "io_merge_limit") {
+    config.io_merge_limit = std::stoi(value);
+  } else if (key == "execution_mode") {
+    config.execution_mode = value;
+  } else if (key == "simulation_engine") {
+    config.simulation_engine = value;
+  } else if (key == "core_locking") {
+    config.core_locking = value;
+  } else if (key == "process_loading") {
+    config.process_loading = value;
+  } else if (key == "replacement_seed") {
+    config.replacement_seed = static_cast<uint32_t>(std::stoul(value));
+  } else if (key == "working_set_window") {
+    config.working_set_window = std::stoi(value);
+  } else if (key == "page_fault_channels") {
+    config.page_fault_channels = std::stoi(value);
+  } else if (key == "page_prefetch") {
+    config.page_prefetch = std::stoi(value);
+  } else if (key == "paging_mode") {
+    config.paging_mode = value;
+  } else if (key == "locality_window") {
+    config.locality_window = std::stoi(value);
+  } else if (key == "locality_shift") {
+    config.locality_shift = std::stoi(value);
+  } else if (key == "load_control") {
+    config.load_control = value;
+  } else if (key == "tlb_entries") {
+    config.tlb_entries = std::stoi(value);
+  } else if (key == "tlb_ways") {
+    config.tlb_ways = std::stoi(value);
+  } else if (key == "tlb_mode") {
+    config.tlb_mode = value;
+  } else if (key == "numa_nodes") {
+    config.numa_nodes = std::stoi(value);
+  } else if (key == "numa_policy") {
+    config.numa_policy = value;
+  } else if (key == "numa_remote_latency") {
+    config.numa_remote_latency = std::stoi(value);
+  } else if (key == "metrics_buffer_size") {
+    config.metrics_buffer_size = static_cast<size_t>(std::stoul(value));
+  } else if (key == "metrics_writer") {
+    config.metrics_writer = value;
+  } else if (key == "metrics_backpressure") {
+    config.metrics_backpressure = value;
+  } else if (key == "metrics_queue_capacity") {
+    config.metrics_queue_capacity = static_cast<size_t>(std::stoul(value));
+  } else if (key == "metrics_keyframe_interval") {
+    config.metrics_keyframe_interval = std::stoi(value);
+  } else if (key == "metrics_categories") {
+    config.metrics_categories = value;
+  } else if (key == "metrics_sample_rate") {
+    config.metrics_sample_rate = std::stoi(value);
+  } else if (key == "metrics_aggregate_windows") {
+    config.metrics_aggregate_windows = parse_aggregate_windows(value);
+  } else if (key == "metrics_aggregate_file") {
+    config.metrics_aggregate_file = value;
+  } else if (key == "cpu_cores") {
+    config.cpu_cores = std::stoi(value);
+  } else if (key == "core_migration_cost") {
+    config.core_migration_cost = std::stoi(value);
+  } else if (key == "checkpoint_tick") {
+    config.checkpoint_tick = std::stoll(value);
+  } else if (key == "checkpoint_file") {
+    config.checkpoint_file = value;
+  } else if (key == "restore_file") {
+    config.restore_file = value;
+  } else if (key == "profile_trace_file") {
+    config.profile_trace_file = value;
+  } else if (key == "live_metrics_interval") {
+    config.live_metrics_interval = std::stoi(value);
+  } else if (key == "live_metrics_file") {
+    config.live_metrics_file = value;
+  } else if (key == "result_cache_dir") {
+    config.result_cache_dir = value;
+  } else if (key == "result_cache_max_bytes") {
+    config.result_cache_max_bytes = std::stoull(value);
+  } else if (key == "io_device") {
+    config.io_devices.push_back(parse_io_device(value));
+  } else {
+    return false;
+  }
+  return true;
 }
 
 /**
@@ -172,21 +596,7 @@ ConfigParser::load_simulator_config(const std::string &filename) {
       key = trim(key);
       value = trim(value);
 
-      if (key == "total_memory_frames") {
-        config.total_memory_frames = std::stoi(value);
-      } else if (key == "frame_size") {
-        config.frame_size = std::stoi(value);
-      } else if (key == "scheduling_algorithm") {
-        config.scheduling_algorithm = value;
-      } else if (key == "page_replacement_algorithm") {
-        config.page_replacement_algorithm = value;
-      } else if (key == "quantum") {
-        config.quantum = std::stoi(value);
-      } else if (key == "io_scheduling_algorithm") {
-        config.io_scheduling_algorithm = value;
-      } else if (key == "io_quantum") {
-        config.io_quantum = std::stoi(value);
-      }
+      apply_config_value(config, key, value);
     }
   }
 
@@ -194,4 +604,238 @@ ConfigParser::load_simulator_config(const std::string &filename) {
   return config;
 }
 
+/**
+ * Carga una rejilla de parámetros para un barrido de simulaciones.
+ * @param filename Ruta al archivo de la rejilla.
+ * @return Parámetros con sus valores, en el orden del archivo.
+ * @throws std::runtime_error Si no se puede abrir el archivo o una clave no
+ * es un parámetro de configuración.
+ */
+std::vector<std::pair<std::string, std::vector<std::string>>>
+ConfigParser::load_parameter_grid(const std::string &filename) {
+  std::ifstream file(filename);
+  if (!file.is_open()) {
+    throw std::runtime_error("No se pudo abrir la rejilla de parámetros: " +
+                             filename);
+  }
+
+  std::vector<std::pair<std::string, std::vector<std::string>>> grid;
+  SimulatorConfig probe;
+  std::string line;
+  while (std::getline(file, line)) {
+    std::string trimmed = trim(line);
+    if (trimmed.empty() || trimmed[0] == '#') {
+      continue;
+    }
+
+    size_t eq = trimmed.find('=');
+    if (eq == std::string::npos) {
+      continue;
+    }
+    std::string key = trim(trimmed.substr(0, eq));
+
+    std::vector<std::string> values;
+    std::istringstream iss(trimmed.substr(eq + 1));
+    std::string item;
+    while (std::getline(iss, item, ',')) {
+      item = trim(item);
+      if (!item.empty()) {
+        values.push_back(item);
+      }
+    }
+    if (values.empty()) {
+      continue;
+    }
+
+    if (!apply_config_value(probe, key, values.front())) {
+      throw std::runtime_error("Parámetro desconocido en la rejilla: " + key);
+    }
+    grid.emplace_back(key, std::move(values));
+  }
+
+  return grid;
+}
+
+bool ConfigParser::parse_shard(std::string_view value, int &index,
+                               int &count) {
+  value = trim_view(value);
+  int shard = 0;
+  int shards = 0;
+  if (value.empty() || !is_digit(value.front()) || !read_int(value, shard) ||
+      value.empty() || value.front() != '/') {
+    return false;
+  }
+  value.remove_prefix(1);
+  if (value.empty() || !is_digit(value.front()) || !read_int(value, shards) ||
+      !value.empty() || shards < 1 || shard >= shards) {
+    return false;
+  }
+  index = shard;
+  count = shards;
+  return true;
+}
+
+/**
+ * Parsea los quanta de los niveles MLFQ.
+ * @param value Cadena con formato "q0:q1:...:qn".
+ * @return Quantum de cada nivel.
+ * @throws std::invalid_argument Si la lista está vacía, algún quantum no es
+ * positivo o hay más niveles de los que admite el planificador.
+ */
+std::vector<int> ConfigParser::parse_mlfq_quanta(const std::string &value) {
+  std::vector<int> quanta;
+  std::istringstream iss(value);
+  std::string item;
+  while (std::getline(iss, item, ':')) {
+    quanta.push_back(std::stoi(trim(item)));
+  }
+  if (quanta.empty() || quanta.size() > MLFQScheduler::MAX_LEVELS ||
+      *std::min_element(quanta.begin(), quanta.end()) <= 0) {
+    throw std::invalid_argument("Quanta MLFQ no válidos: " + value);
+  }
+  return quanta;
+}
+
+/**
+ * Parsea los anchos de ventana de las series agregadas.
+ * @param value Cadena con formato "w0:w1:...:wn"; "0" o vacía las desactiva.
+ * @return Anchos de ventana en ticks.
+ * @throws std::invalid_argument Si algún ancho es negativo.
+ */
+std::vector<int>
+ConfigParser::parse_aggregate_windows(const std::string &value) {
+  std::vector<int> widths;
+  std::istringstream iss(value);
+  std::string item;
+  while (std::getline(iss, item, ':')) {
+    item = trim(item);
+    if (item.empty())
+      continue;
+    int width = std::stoi(item);
+    if (width < 0) {
+      throw std::invalid_argument("Ventanas de agregación no válidas: " +
+                                  value);
+    }
+    if (width > 0)
+      widths.push_back(width);
+  }
+  return widths;
+}
+
+/**
+ * Parsea la distribución de un parámetro de la carga sintética.
+ * @param value Cadena con formato "constant:n", "uniform:min:max",
+ * "exponential:media" o solo "n".
+ * @return Distribución parseada.
+ * @throws std::invalid_argument Si el tipo no es reconocido o faltan valores.
+ */
+Distribution ConfigParser::parse_distribution(const std::string &value) {
+  std::vector<std::string> fields;
+  std::istringstream iss(value);
+  std::string item;
+  while (std::getline(iss, item, ':')) {
+    fields.push_back(trim(item));
+  }
+
+  Distribution distribution;
+  if (fields.size() == 1) {
+    distribution.a = distribution.b = std::stod(fields[0]);
+    return distribution;
+  }
+  if (fields.size() == 2 && fields[0] == "constant") {
+    distribution.a = distribution.b = std::stod(fields[1]);
+  } else if (fields.size() == 2 && fields[0] == "exponential") {
+    distribution.kind = Distribution::Kind::EXPONENTIAL;
+    distribution.a = std::stod(fields[1]);
+    distribution.b = 0;
+  } else if (fields.size() == 3 && fields[0] == "uniform") {
+    distribution.kind = Distribution::Kind::UNIFORM;
+    distribution.a = std::stod(fields[1]);
+    distribution.b = std::stod(fields[2]);
+  } else {
+    throw std::invalid_argument("Distribución no válida: " + value);
+  }
+  return distribution;
+}
+
+/**
+ * Asigna un parámetro de la carga sintética a partir de su clave.
+ * @param spec Parámetros a modificar.
+ * @param key Nombre del parámetro.
+ * @param value Valor en texto.
+ * @return false si la clave no es reconocida.
+ */
+bool ConfigParser::apply_workload_value(WorkloadSpec &spec,
+                                        const std::string &key,
+                                        const std::string &value) {
+  if (key == "seed") {
+    spec.seed = static_cast<uint32_t>(std::stoul(value));
+  } else if (key == "processes") {
+    spec.processes = static_cast<size_t>(std::stoull(value));
+  } else if (key == "arrival") {
+    spec.arrival = value;
+  } else if (key == "arrival_rate") {
+    spec.arrival_rate = std::stod(value);
+  } else if (key == "burst_size") {
+    spec.burst_size = std::stoi(value);
+  } else if (key == "cpu_bursts") {
+    spec.cpu_bursts = parse_distribution(value);
+  } else if (key == "cpu_burst") {
+    spec.cpu_burst = parse_distribution(value);
+  } else if (key == "io_burst") {
+    spec.io_burst = parse_distribution(value);
+  } else if (key == "priority") {
+    spec.priority = parse_distribution(value);
+  } else if (key == "pages") {
+    spec.pages = parse_distribution(value);
+  } else {
+    return false;
+  }
+  return true;
+}
+
+/**
+ * Carga los parámetros de una carga sintética.
+ * @param filename Ruta del archivo con líneas clave=valor.
+ * @return Parámetros de la carga; las claves ausentes conservan su valor por
+ * defecto.
+ * @throws std::runtime_error Si no se puede abrir el archivo, una clave es
+ * desconocida o un valor no es válido.
+ */
+WorkloadSpec ConfigParser::load_workload_spec(const std::string &filename) {
+  std::ifstream file(filename);
+  if (!file.is_open()) {
+    throw std::runtime_error("No se pudo abrir la carga sintética: " +
+                             filename);
+  }
+
+  WorkloadSpec spec;
+  std::string line;
+  while (std::getline(file, line)) {
+    std::string trimmed = trim(line);
+    if (trimmed.empty() || trimmed[0] == '#') {
+      continue;
+    }
+
+    size_t eq = trimmed.find('=');
+    if (eq == std::string::npos) {
+      continue;
+    }
+    std::string key = trim(trimmed.substr(0, eq));
+    std::string value = trim(trimmed.substr(eq + 1));
+    try {
+      if (!apply_workload_value(spec, key, value)) {
+        throw std::runtime_error("Parámetro desconocido en la carga "
+                                 "sintética: " +
+                                 key);
+      }
+    } catch (const std::logic_error &) {
+      throw std::runtime_error("Valor no válido en la carga sintética: " +
+                               key + "=" + value);
+    }
+  }
+
+  return spec;
+}
+
 } // namespace OSSimulator
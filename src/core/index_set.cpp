@@ -0,0 +1,67 @@
+#include "core/index_set.hpp"
+#include <algorithm>
+
+namespace OSSimulator {
+
+namespace {
+
+int lowest_bit(uint64_t word) {
+#if defined(__GNUC__) || defined(__clang__)
+  return __builtin_ctzll(word);
+#else
+  int bit = 0;
+  while ((word & 1ULL) == 0) {
+    word >>= 1;
+    ++bit;
+  }
+  return bit;
+#endif
+}
+
+} // namespace
+
+bool IndexSet::insert(size_t index) {
+  size_t word = index / 64;
+  if (word >= words.size())
+    words.resize(std::max(word + 1, words.size() * 2), 0);
+  uint64_t bit = 1ULL << (index % 64);
+  if (words[word] & bit)
+    return false;
+  words[word] |= bit;
+  ++count;
+  return true;
+}
+
+bool IndexSet::erase(size_t index) {
+  if (!contains(index))
+    return false;
+  words[index / 64] &= ~(1ULL << (index % 64));
+  --count;
+  return true;
+}
+
+size_t IndexSet::next(size_t from) const {
+  size_t word = from / 64;
+  if (word >= words.size())
+    return npos;
+  uint64_t bits = words[word] & (~0ULL << (from % 64));
+  while (bits == 0) {
+    if (++word == words.size())
+      return npos;
+    bits = words[word];
+  }
+  return word * 64 + static_cast<size_t>(lowest_bit(bits));
+}
+
+void IndexSet::reserve(size_t limit) {
+  size_t needed = (limit + 63) / 64;
+  if (needed > words.size())
+    words.resize(needed, 0);
+}
+
+void IndexSet::clear() {
+  std::fill(words.begin(), words.end(), 0);
+  count = 0;
+}
+
+} // namespace OSSimulator
@@ -0,0 +1,40 @@
+#include "core/name_table.hpp"
+
+namespace OSSimulator {
+
+NameTable::NameTable() {
+  names.emplace_back();
+  ids.emplace(std::string(), EMPTY);
+}
+
+NameId NameTable::intern(const std::string &name) {
+  if (name.empty())
+    return EMPTY;
+  std::lock_guard<std::mutex> lock(mutex);
+  auto it = ids.find(name);
+  if (it != ids.end())
+    return it->second;
+  NameId id = static_cast<NameId>(names.size());
+  names.push_back(name);
+  ids.emplace(name, id);
+  return id;
+}
+
+const std::string &NameTable::name(NameId id) const {
+  if (id == EMPTY)
+    return names.front();
+  std::lock_guard<std::mutex> lock(mutex);
+  return id < names.size() ? names[id] : names.front();
+}
+
+size_t NameTable::size() const {
+  std::lock_guard<std::mutex> lock(mutex);
+  return names.size();
+}
+
+NameTable &name_table() {
+  static NameTable table;
+  return table;
+}
+
+} // namespace OSSimulator
@@ -0,0 +1,126 @@
+#include "core/policy_registry.hpp"
+#include "cpu/cfs_scheduler.hpp"
+#include "cpu/fcfs_scheduler.hpp"
+#include "cpu/mlfq_scheduler.hpp"
+#include "cpu/priority_scheduler.hpp"
+#include "cpu/round_robin_scheduler.hpp"
+#include "cpu/sjf_scheduler.hpp"
+#include "io/io_clook_scheduler.hpp"
+#include "io/io_cscan_scheduler.hpp"
+#include "io/io_fcfs_scheduler.hpp"
+#include "io/io_round_robin_scheduler.hpp"
+#include "io/io_scan_scheduler.hpp"
+#include "io/io_sstf_scheduler.hpp"
+#include "memory/clock_replacement.hpp"
+#include "memory/fifo_replacement.hpp"
+#include "memory/lru_replacement.hpp"
+#include "memory/nru_replacement.hpp"
+#include "memory/optimal_replacement.hpp"
+#include "memory/wsclock_replacement.hpp"
+#include <stdexcept>
+
+namespace OSSimulator {
+
+namespace {
+
+/// @throws std::invalid_argument Si sjf_prediction no es oracle ni
+/// exponential.
+std::unique_ptr<Scheduler> make_sjf(const SimulatorConfig &config,
+                                    bool preemptive) {
+  BurstPrediction prediction = BurstPrediction::ORACLE;
+  if (config.sjf_prediction == "exponential") {
+    prediction = BurstPrediction::EXPONENTIAL;
+  } else if (config.sjf_prediction != "oracle") {
+    throw std::invalid_argument("Predicción de ráfagas no reconocida: " +
+                                config.sjf_prediction);
+  }
+  return std::make_unique<SJFScheduler>(preemptive, prediction,
+                                        config.sjf_alpha,
+                                        config.sjf_initial_estimate);
+}
+
+} // namespace
+
+CPUSchedulerRegistry &cpu_scheduler_registry() {
+  static CPUSchedulerRegistry registry = [] {
+    CPUSchedulerRegistry r;
+    r.add("FCFS", [](const SimulatorConfig &) {
+      return std::make_unique<FCFSScheduler>();
+    });
+    r.add("SJF",
+          [](const SimulatorConfig &config) { return make_sjf(config, false); });
+    r.add("SRTF",
+          [](const SimulatorConfig &config) { return make_sjf(config, true); });
+    r.add("RoundRobin", [](const SimulatorConfig &config) {
+      return std::make_unique<RoundRobinScheduler>(config.quantum);
+    });
+    r.add("Priority", [](const SimulatorConfig &config) {
+      return std::make_unique<PriorityScheduler>(
+          config.priority_aging_interval);
+    });
+    r.add("MLFQ", [](const SimulatorConfig &config) {
+      return std::make_unique<MLFQScheduler>(config.mlfq_quanta,
+                                             config.mlfq_boost_interval);
+    });
+    r.add("CFS", [](const SimulatorConfig &config) {
+      return std::make_unique<CFSScheduler>(config.cfs_target_latency,
+                                            config.cfs_min_granularity);
+    });
+    return r;
+  }();
+  return registry;
+}
+
+ReplacementRegistry &replacement_registry() {
+  static ReplacementRegistry registry = [] {
+    ReplacementRegistry r;
+    r.add("FIFO", [](const SimulatorConfig &) {
+      return std::make_unique<FIFOReplacement>();
+    });
+    r.add("LRU", [](const SimulatorConfig &) {
+      return std::make_unique<LRUReplacement>();
+    });
+    r.add("Optimal", [](const SimulatorConfig &) {
+      return std::make_unique<OptimalReplacement>();
+    });
+    r.add("NRU", [](const SimulatorConfig &config) {
+      return std::make_unique<NRUReplacement>(config.replacement_seed);
+    });
+    r.add("Clock", [](const SimulatorConfig &) {
+      return std::make_unique<ClockReplacement>();
+    });
+    r.add("WSClock", [](const SimulatorConfig &config) {
+      return std::make_unique<WSClockReplacement>(config.working_set_window);
+    });
+    return r;
+  }();
+  return registry;
+}
+
+IOSchedulerRegistry &io_scheduler_registry() {
+  static IOSchedulerRegistry registry = [] {
+    IOSchedulerRegistry r;
+    r.add("FCFS", [](const IODeviceConfig &) {
+      return std::make_unique<IOFCFSScheduler>();
+    });
+    r.add("RoundRobin", [](const IODeviceConfig &device) {
+      return std::make_unique<IORoundRobinScheduler>(device.quantum);
+    });
+    r.add("SSTF", [](const IODeviceConfig &device) {
+      return std::make_unique<IOSSTFScheduler>(device.cylinders);
+    });
+    r.add("SCAN", [](const IODeviceConfig &device) {
+      return std::make_unique<IOSCANScheduler>(device.cylinders);
+    });
+    r.add("CSCAN", [](const IODeviceConfig &device) {
+      return std::make_unique<IOCSCANScheduler>(device.cylinders);
+    });
+    r.add("CLOOK", [](const IODeviceConfig &device) {
+      return std::make_unique<IOCLOOKScheduler>(device.cylinders);
+    });
+    return r;
+  }();
+  return registry;
+}
+
+} // namespace OSSimulator
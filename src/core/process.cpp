@@ -1,40 +1,43 @@
 #include "core/process.hpp"
+#include "core/snapshot.hpp"
+#include <algorithm>
 #include <numeric>
 
 namespace OSSimulator {
 
 Process::Process()
-    : pid(0), name(""), arrival_time(0), burst_time(0), remaining_time(0),
+    : pid(0), priority(0), name(""), name_id(NameTable::EMPTY),
+      state(ProcessState::NEW), first_execution(true), memory_allocated(false),
+      arrival_time(0), burst_time(0), remaining_time(0), completion_time(0),
+      waiting_time(0), turnaround_time(0), response_time(-1), start_time(-1),
+      last_execution_time(0), memory_required(0), memory_base(0),
+      current_burst_index(0), total_cpu_time(0), total_io_time(0),
+      process_thread(nullptr), should_terminate(false), step_complete(false) {}
+
+Process::Process(int p, const std::string &n, Tick arrival, Tick burst,
+                 int prio, uint32_t mem)
+    : pid(p), priority(prio), name(n), name_id(name_table().intern(n)),
+      state(ProcessState::NEW), first_execution(true), memory_allocated(false),
+      arrival_time(arrival), burst_time(burst), remaining_time(burst),
       completion_time(0), waiting_time(0), turnaround_time(0),
-      response_time(-1), start_time(-1), priority(0), state(ProcessState::NEW),
-      first_execution(true), last_execution_time(0), memory_required(0),
-      memory_base(0), memory_allocated(false), current_burst_index(0),
+      response_time(-1), start_time(-1), last_execution_time(0),
+      memory_required(mem), memory_base(0), current_burst_index(0),
       total_cpu_time(0), total_io_time(0), process_thread(nullptr),
-      should_terminate(false), step_complete(false) {}
-
-Process::Process(int p, const std::string &n, int arrival, int burst, int prio,
-                 uint32_t mem)
-    : pid(p), name(n), arrival_time(arrival), burst_time(burst),
-      remaining_time(burst), completion_time(0), waiting_time(0),
-      turnaround_time(0), response_time(-1), start_time(-1), priority(prio),
-      state(ProcessState::NEW), first_execution(true), last_execution_time(0),
-      memory_required(mem), memory_base(0), memory_allocated(false),
-      current_burst_index(0), total_cpu_time(0), total_io_time(0),
-      process_thread(nullptr), should_terminate(false), step_complete(false) {
+      should_terminate(false), step_complete(false) {
   burst_sequence.push_back(Burst(BurstType::CPU, burst));
   total_cpu_time = burst;
 }
 
-Process::Process(int p, const std::string &n, int arrival,
+Process::Process(int p, const std::string &n, Tick arrival,
                  const std::vector<Burst> &bursts, int prio, uint32_t mem)
-    : pid(p), name(n), arrival_time(arrival), burst_time(0), remaining_time(0),
+    : pid(p), priority(prio), name(n), name_id(name_table().intern(n)),
+      state(ProcessState::NEW), first_execution(true), memory_allocated(false),
+      arrival_time(arrival), burst_time(0), remaining_time(0),
       completion_time(0), waiting_time(0), turnaround_time(0),
-      response_time(-1), start_time(-1), priority(prio),
-      state(ProcessState::NEW), first_execution(true), last_execution_time(0),
-      memory_required(mem), memory_base(0), memory_allocated(false),
-      burst_sequence(bursts), current_burst_index(0), total_cpu_time(0),
-      total_io_time(0), process_thread(nullptr), should_terminate(false),
-      step_complete(false) {
+      response_time(-1), start_time(-1), last_execution_time(0),
+      memory_required(mem), memory_base(0), burst_sequence(bursts),
+      current_burst_index(0), total_cpu_time(0), total_io_time(0),
+      process_thread(nullptr), should_terminate(false), step_complete(false) {
   for (const auto &burst : burst_sequence) {
     if (burst.type == BurstType::CPU) {
       total_cpu_time += burst.duration;
@@ -47,17 +50,17 @@ Process::Process(int p, const std::string &n, int arrival,
 }
 
 Process::Process(Process &&other) noexcept
-    : pid(other.pid), name(std::move(other.name)),
+    : pid(other.pid), priority(other.priority), name(std::move(other.name)),
+      name_id(other.name_id), state(other.state.load()),
+      first_execution(other.first_execution),
+      memory_allocated(other.memory_allocated),
       arrival_time(other.arrival_time), burst_time(other.burst_time),
       remaining_time(other.remaining_time),
       completion_time(other.completion_time), waiting_time(other.waiting_time),
       turnaround_time(other.turnaround_time),
       response_time(other.response_time), start_time(other.start_time),
-      priority(other.priority), state(other.state.load()),
-      first_execution(other.first_execution),
       last_execution_time(other.last_execution_time),
       memory_required(other.memory_required), memory_base(other.memory_base),
-      memory_allocated(other.memory_allocated),
       burst_sequence(std::move(other.burst_sequence)),
       current_burst_index(other.current_burst_index),
       total_cpu_time(other.total_cpu_time), total_io_time(other.total_io_time),
@@ -73,7 +76,7 @@ void Process::calculate_metrics() {
   }
 }
 
-bool Process::has_arrived(int current_time) const {
+bool Process::has_arrived(Tick current_time) const {
   return arrival_time <= current_time;
 }
 
@@ -82,7 +85,7 @@ bool Process::is_completed() const {
          (burst_sequence.empty() || remaining_time <= 0);
 }
 
-int Process::execute(int quantum, int current_time) {
+Tick Process::execute(Tick quantum, Tick current_time) {
   if (is_completed()) {
     return 0;
   }
@@ -94,7 +97,7 @@ int Process::execute(int quantum, int current_time) {
   }
 
   if (burst_sequence.empty()) {
-    int time_executed =
+    Tick time_executed =
         (quantum > 0) ? std::min(quantum, remaining_time) : remaining_time;
     {
       std::lock_guard<std::mutex> lock(process_mutex);
@@ -119,15 +122,19 @@ int Process::execute(int quantum, int current_time) {
 
   Burst &current_burst = burst_sequence[current_burst_index];
 
-  int time_executed = (quantum > 0)
-                          ? std::min(quantum, current_burst.remaining_time)
-                          : current_burst.remaining_time;
+  Tick time_executed = (quantum > 0)
+                           ? std::min(quantum, current_burst.remaining_time)
+                           : current_burst.remaining_time;
 
   {
     std::lock_guard<std::mutex> lock(process_mutex);
     current_burst.remaining_time -= time_executed;
     remaining_time -= time_executed;
     last_execution_time = current_time + time_executed;
+    // Cada tick de CPU consume un acceso del rastro de memoria.
+    current_access_index =
+        std::min(memory_access_trace.size(),
+                 current_access_index + static_cast<size_t>(time_executed));
   }
 
   if (current_burst.is_completed()) {
@@ -159,12 +166,65 @@ void Process::reset() {
   memory_allocated = false;
   memory_base = 0;
   current_burst_index = 0;
+  current_access_index = 0;
 
   for (auto &burst : burst_sequence) {
     burst.reset();
   }
 }
 
+void Process::save_state(SnapshotWriter &out) const {
+  std::lock_guard<std::mutex> lock(process_mutex);
+  out.put_int(static_cast<int>(state.load()));
+  out.put_int(remaining_time);
+  out.put_int(completion_time);
+  out.put_int(waiting_time);
+  out.put_int(turnaround_time);
+  out.put_int(response_time);
+  out.put_int(start_time);
+  out.put_int(priority);
+  out.put_bool(first_execution);
+  out.put_int(last_execution_time);
+  out.put_uint(memory_base);
+  out.put_bool(memory_allocated);
+  out.put_uint(current_access_index);
+  out.put_int(page_faults);
+  out.put_int(replacements);
+  out.put_int(active_pages_count);
+  out.put_uint(current_burst_index);
+  out.put_int(static_cast<int64_t>(burst_sequence.size()));
+  for (const auto &burst : burst_sequence)
+    out.put_int(burst.remaining_time);
+  page_table.save_state(out);
+}
+
+void Process::load_state(SnapshotReader &in) {
+  std::lock_guard<std::mutex> lock(process_mutex);
+  state = static_cast<ProcessState>(in.get_int());
+  remaining_time = in.get_int64();
+  completion_time = in.get_int64();
+  waiting_time = in.get_int64();
+  turnaround_time = in.get_int64();
+  response_time = in.get_int64();
+  start_time = in.get_int64();
+  priority = in.get_int();
+  first_execution = in.get_bool();
+  last_execution_time = in.get_int64();
+  memory_base = static_cast<uint32_t>(in.get_uint());
+  memory_allocated = in.get_bool();
+  current_access_index = static_cast<size_t>(in.get_uint());
+  page_faults = in.get_int();
+  replacements = in.get_int();
+  active_pages_count = in.get_int();
+  current_burst_index = static_cast<size_t>(in.get_uint());
+  in.expect(static_cast<int64_t>(burst_sequence.size()),
+            "ráfagas del proceso " + std::to_string(pid));
+  for (auto &burst : burst_sequence)
+    burst.remaining_time = in.get_int64();
+  page_table.load_state(in);
+  step_complete = false;
+}
+
 void Process::start_thread() {
   stop_thread();
   should_terminate = false;
@@ -251,10 +311,10 @@ bool Process::is_on_io_burst() const {
   return burst && burst->type == BurstType::IO;
 }
 
-int Process::get_total_burst_time() const {
+Tick Process::get_total_burst_time() const {
   return std::accumulate(
-      burst_sequence.begin(), burst_sequence.end(), 0,
-      [](int sum, const Burst &b) { return sum + b.duration; });
+      burst_sequence.begin(), burst_sequence.end(), Tick{0},
+      [](Tick sum, const Burst &b) { return sum + b.duration; });
 }
 
 } // namespace OSSimulator
@@ -0,0 +1,87 @@
+#include "core/process_stream.hpp"
+#include "core/config_parser.hpp"
+#include <cstring>
+#include <stdexcept>
+
+namespace OSSimulator {
+
+namespace {
+
+constexpr size_t BLOCK_SIZE = 1 << 16;
+
+} // namespace
+
+ProcessStream::ProcessStream(const std::string &filename, Validator validator)
+    : file(filename, std::ios::binary), buffer(BLOCK_SIZE),
+      validator(std::move(validator)) {
+  if (!file.is_open()) {
+    throw std::runtime_error("No se pudo abrir el archivo: " + filename);
+  }
+  read_pending();
+}
+
+ProcessStream::ProcessStream(LineSource source, Validator validator)
+    : source(std::move(source)), validator(std::move(validator)) {
+  read_pending();
+}
+
+std::shared_ptr<Process> ProcessStream::next() {
+  auto process = std::move(pending);
+  if (process) {
+    read_pending();
+  }
+  return process;
+}
+
+void ProcessStream::read_pending() {
+  pending = nullptr;
+  std::string_view line;
+  while (source ? source(line) : read_line(line)) {
+    pending = ConfigParser::parse_process_line(line);
+    if (pending) {
+      if (validator) {
+        validator(*pending);
+      }
+      return;
+    }
+  }
+}
+
+bool ProcessStream::read_line(std::string_view &line) {
+  while (true) {
+    const char *start = buffer.data() + begin;
+    const void *newline = std::memchr(start, '\n', end - begin);
+    if (newline) {
+      size_t length = static_cast<const char *>(newline) - start;
+      line = std::string_view(start, length);
+      begin += length + 1;
+      return true;
+    }
+
+    if (eof) {
+      if (begin == end) {
+        return false;
+      }
+      line = std::string_view(start, end - begin);
+      begin = end;
+      return true;
+    }
+
+    // Conserva la línea incompleta al inicio del bloque y completa el resto;
+    // una línea más larga que el bloque lo agranda.
+    std::memmove(buffer.data(), start, end - begin);
+    end -= begin;
+    begin = 0;
+    if (end == buffer.size()) {
+      buffer.resize(buffer.size() * 2);
+    }
+    file.read(buffer.data() + end,
+              static_cast<std::streamsize>(buffer.size() - end));
+    end += static_cast<size_t>(file.gcount());
+    if (!file) {
+      eof = true;
+    }
+  }
+}
+
+} // namespace OSSimulator
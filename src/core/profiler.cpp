@@ -0,0 +1,279 @@
+#include "core/profiler.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <map>
+#include <stdexcept>
+#include <utility>
+
+namespace OSSimulator {
+
+/**
+ * Tabla de un hilo: las fases y contadores se buscan por la dirección del
+ * literal, que es la misma en cada llamada desde el mismo punto. El mutex
+ * solo compite con el informe.
+ */
+struct Profiler::ThreadLog {
+  struct Slot {
+    const char *name;
+    uint64_t calls;
+    uint64_t total_ns;
+    uint64_t max_ns;
+  };
+
+  struct Event {
+    const char *name;
+    uint64_t start_ns;
+    uint64_t duration_ns;
+  };
+
+  std::mutex mutex;
+  int thread_index = 0;
+  std::vector<Slot> phases;
+  std::vector<std::pair<const char *, uint64_t>> counters;
+  std::vector<Event> events;
+};
+
+namespace {
+
+std::atomic<uint64_t> next_profiler_id{1};
+
+} // namespace
+
+Profiler &Profiler::instance() {
+  static Profiler profiler;
+  return profiler;
+}
+
+uint64_t Profiler::now_ns() {
+  return static_cast<uint64_t>(
+      std::chrono::duration_cast<std::chrono::nanoseconds>(
+          std::chrono::steady_clock::now().time_since_epoch())
+          .count());
+}
+
+Profiler::Profiler() : id(next_profiler_id++), start_ns(now_ns()) {}
+
+Profiler::ThreadLog &Profiler::local_log() {
+  thread_local std::vector<std::pair<uint64_t, std::shared_ptr<ThreadLog>>>
+      logs;
+  for (const auto &[owner, log] : logs) {
+    if (owner == id)
+      return *log;
+  }
+
+  auto log = std::make_shared<ThreadLog>();
+  {
+    std::lock_guard<std::mutex> lock(registry_mutex);
+    log->thread_index = static_cast<int>(thread_logs.size());
+    thread_logs.push_back(log);
+  }
+  logs.emplace_back(id, log);
+  return *log;
+}
+
+void Profiler::record(const char *phase, uint64_t start, uint64_t end) {
+  uint64_t duration = end > start ? end - start : 0;
+  ThreadLog &log = local_log();
+  std::lock_guard<std::mutex> lock(log.mutex);
+
+  auto it = std::find_if(
+      log.phases.begin(), log.phases.end(),
+      [phase](const auto &slot) { return slot.name == phase; });
+  if (it == log.phases.end()) {
+    log.phases.push_back({phase, 1, duration, duration});
+  } else {
+    it->calls++;
+    it->total_ns += duration;
+    it->max_ns = std::max(it->max_ns, duration);
+  }
+
+  size_t capacity = trace_capacity.load(std::memory_order_relaxed);
+  if (capacity > 0) {
+    if (trace_size.fetch_add(1, std::memory_order_relaxed) < capacity) {
+      log.events.push_back({phase, start, duration});
+    } else {
+      dropped_events.fetch_add(1, std::memory_order_relaxed);
+    }
+  }
+}
+
+void Profiler::count(const char *counter, uint64_t amount) {
+  ThreadLog &log = local_log();
+  std::lock_guard<std::mutex> lock(log.mutex);
+
+  auto it = std::find_if(log.counters.begin(), log.counters.end(),
+                         [counter](const auto &entry) {
+                           return entry.first == counter;
+                         });
+  if (it == log.counters.end()) {
+    log.counters.emplace_back(counter, amount);
+  } else {
+    it->second += amount;
+  }
+}
+
+void Profiler::enable_trace(size_t max_events) {
+  trace_capacity.store(max_events, std::memory_order_relaxed);
+}
+
+std::vector<Profiler::PhaseStats> Profiler::phases() const {
+  // El mismo literal puede tener direcciones distintas en cada unidad de
+  // compilación: se agrupa por nombre.
+  std::map<std::string, PhaseStats> merged;
+  std::lock_guard<std::mutex> registry_lock(registry_mutex);
+  for (const auto &log : thread_logs) {
+    std::lock_guard<std::mutex> lock(log->mutex);
+    for (const auto &slot : log->phases) {
+      PhaseStats &stats = merged[slot.name];
+      stats.calls += slot.calls;
+      stats.total_ns += slot.total_ns;
+      stats.max_ns = std::max(stats.max_ns, slot.max_ns);
+    }
+  }
+
+  std::vector<PhaseStats> result;
+  result.reserve(merged.size());
+  for (auto &[name, stats] : merged) {
+    stats.name = name;
+    result.push_back(std::move(stats));
+  }
+  std::stable_sort(result.begin(), result.end(),
+                   [](const PhaseStats &a, const PhaseStats &b) {
+                     return a.total_ns > b.total_ns;
+                   });
+  return result;
+}
+
+std::vector<Profiler::CounterStats> Profiler::counters() const {
+  std::map<std::string, uint64_t> merged;
+  std::lock_guard<std::mutex> registry_lock(registry_mutex);
+  for (const auto &log : thread_logs) {
+    std::lock_guard<std::mutex> lock(log->mutex);
+    for (const auto &[name, value] : log->counters) {
+      merged[name] += value;
+    }
+  }
+
+  std::vector<CounterStats> result;
+  result.reserve(merged.size());
+  for (const auto &[name, value] : merged) {
+    result.push_back({name, value});
+  }
+  return result;
+}
+
+uint64_t Profiler::elapsed_ns() const {
+  uint64_t start = start_ns.load(std::memory_order_relaxed);
+  uint64_t now = now_ns();
+  return now > start ? now - start : 0;
+}
+
+uint64_t Profiler::get_dropped_events() const {
+  return dropped_events.load(std::memory_order_relaxed);
+}
+
+void Profiler::print_report(std::ostream &out) const {
+  uint64_t elapsed = elapsed_ns();
+  auto phase_list = phases();
+  auto counter_list = counters();
+
+  char line[160];
+  std::snprintf(line, sizeof(line),
+                "\n[PERFIL] Desglose por fase (%.3f ms transcurridos)\n",
+                elapsed / 1e6);
+  out << line;
+  if (phase_list.empty()) {
+    out << "  Sin mediciones.\n";
+  } else {
+    std::snprintf(line, sizeof(line), "  %-24s %12s %12s %12s %12s %7s\n",
+                  "Fase", "Llamadas", "Total (ms)", "Media (us)", "Max (us)",
+                  "%");
+    out << line;
+    for (const auto &stats : phase_list) {
+      double share = elapsed > 0 ? 100.0 * stats.total_ns / elapsed : 0.0;
+      std::snprintf(line, sizeof(line),
+                    "  %-24s %12llu %12.3f %12.3f %12.3f %7.1f\n",
+                    stats.name.c_str(),
+                    static_cast<unsigned long long>(stats.calls),
+                    stats.total_ns / 1e6,
+                    stats.total_ns / 1e3 / static_cast<double>(stats.calls),
+                    stats.max_ns / 1e3, share);
+      out << line;
+    }
+  }
+
+  if (!counter_list.empty()) {
+    out << "  Contadores:\n";
+    for (const auto &counter : counter_list) {
+      std::snprintf(line, sizeof(line), "  %-24s %12llu\n",
+                    counter.name.c_str(),
+                    static_cast<unsigned long long>(counter.value));
+      out << line;
+    }
+  }
+
+  if (get_dropped_events() > 0) {
+    out << "  Eventos de traza descartados: " << get_dropped_events() << "\n";
+  }
+}
+
+void Profiler::write_chrome_trace(const std::string &filename) const {
+  std::ofstream out(filename);
+  if (!out.is_open()) {
+    throw std::runtime_error("No se pudo escribir la traza de perfilado: " +
+                             filename);
+  }
+
+  uint64_t origin = start_ns.load(std::memory_order_relaxed);
+  bool first = true;
+  auto separator = [&]() {
+    out << (first ? "\n" : ",\n");
+    first = false;
+  };
+
+  out << "{\"traceEvents\":[";
+  std::lock_guard<std::mutex> registry_lock(registry_mutex);
+  for (const auto &log : thread_logs) {
+    std::lock_guard<std::mutex> lock(log->mutex);
+    separator();
+    out << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":"
+        << log->thread_index << ",\"args\":{\"name\":\"hilo "
+        << log->thread_index << "\"}}";
+
+    // Los nombres de fase son identificadores sin caracteres a escapar.
+    for (const auto &event : log->events) {
+      uint64_t start = event.start_ns > origin ? event.start_ns - origin : 0;
+      char line[96];
+      std::snprintf(line, sizeof(line),
+                    "\",\"ph\":\"X\",\"ts\":%.3f,\"dur\":%.3f,\"pid\":1,"
+                    "\"tid\":%d}",
+                    start / 1e3, event.duration_ns / 1e3, log->thread_index);
+      separator();
+      out << "{\"name\":\"" << event.name << line;
+    }
+  }
+  out << "\n],\"displayTimeUnit\":\"ns\",\"otherData\":{\"dropped_events\":"
+      << get_dropped_events() << "}}\n";
+
+  if (!out) {
+    throw std::runtime_error("No se pudo escribir la traza de perfilado: " +
+                             filename);
+  }
+}
+
+void Profiler::reset() {
+  std::lock_guard<std::mutex> registry_lock(registry_mutex);
+  for (const auto &log : thread_logs) {
+    std::lock_guard<std::mutex> lock(log->mutex);
+    log->phases.clear();
+    log->counters.clear();
+    log->events.clear();
+  }
+  trace_size.store(0, std::memory_order_relaxed);
+  dropped_events.store(0, std::memory_order_relaxed);
+  start_ns.store(now_ns(), std::memory_order_relaxed);
+}
+
+} // namespace OSSimulator
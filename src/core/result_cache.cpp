@@ -0,0 +1,337 @@
+#include "core/result_cache.hpp"
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <iterator>
+#include <limits>
+#include <map>
+#include <sstream>
+#include <thread>
+
+namespace OSSimulator {
+
+namespace fs = std::filesystem;
+
+namespace {
+
+constexpr uint64_t FNV_PRIME = 0x100000001b3ULL;
+
+std::string hex(uint64_t value) {
+  std::ostringstream out;
+  out << std::hex << std::setw(16) << std::setfill('0') << value;
+  return out.str();
+}
+
+template <typename T>
+std::string join(const std::vector<T> &values, char separator) {
+  std::string text;
+  for (size_t i = 0; i < values.size(); ++i) {
+    if (i > 0)
+      text += separator;
+    text += std::to_string(values[i]);
+  }
+  return text;
+}
+
+} // namespace
+
+void CacheKey::add(std::string_view text) {
+  for (unsigned char c : text) {
+    hash = (hash ^ c) * FNV_PRIME;
+    check = (check ^ c) * FNV_PRIME;
+  }
+  // El largo separa las partes: ("ab", "c") y ("a", "bc") no coinciden.
+  for (uint64_t length = text.size(), i = 0; i < 8; ++i, length >>= 8) {
+    hash = (hash ^ (length & 0xFF)) * FNV_PRIME;
+    check = (check ^ (length & 0xFF)) * FNV_PRIME;
+  }
+}
+
+std::string CacheKey::name() const { return hex(hash); }
+
+ResultCache::ResultCache(std::string directory, uint64_t max_bytes)
+    : directory(std::move(directory)), max_bytes(max_bytes) {}
+
+bool ResultCache::cacheable(const SimulatorConfig &config, bool with_trace) {
+  if (config.process_loading == "stream" || !config.checkpoint_file.empty() ||
+      !config.restore_file.empty()) {
+    return false;
+  }
+  if (with_trace && (!config.metrics_aggregate_windows.empty() ||
+                     (config.metrics_writer == "async" &&
+                      config.metrics_backpressure == "drop"))) {
+    return false;
+  }
+  return true;
+}
+
+std::string ResultCache::describe(const SimulatorConfig &config) {
+  // Los modos de ejecución y de bloqueo y el escritor de métricas no
+  // cambian el resultado ni la traza: threaded e inline escriben lo mismo.
+  std::ostringstream out;
+  out << std::setprecision(std::numeric_limits<double>::max_digits10);
+  out << "total_memory_frames=" << config.total_memory_frames << '\n'
+      << "frame_size=" << config.frame_size << '\n'
+      << "huge_page_size=" << config.huge_page_size << '\n'
+      << "huge_page_frames=" << config.huge_page_frames << '\n'
+      << "scheduling_algorithm=" << config.scheduling_algorithm << '\n'
+      << "page_replacement_algorithm=" << config.page_replacement_algorithm
+      << '\n'
+      << "io_scheduling_algorithm=" << config.io_scheduling_algorithm << '\n'
+      << "quantum=" << config.quantum << '\n'
+      << "priority_aging_interval=" << config.priority_aging_interval << '\n'
+      << "mlfq_quanta=" << join(config.mlfq_quanta, ':') << '\n'
+      << "mlfq_boost_interval=" << config.mlfq_boost_interval << '\n'
+      << "cfs_target_latency=" << config.cfs_target_latency << '\n'
+      << "cfs_min_granularity=" << config.cfs_min_granularity << '\n'
+      << "sjf_prediction=" << config.sjf_prediction << '\n'
+      << "sjf_alpha=" << config.sjf_alpha << '\n'
+      << "sjf_initial_estimate=" << config.sjf_initial_estimate << '\n'
+      << "io_quantum=" << config.io_quantum << '\n'
+      << "io_seek_speed=" << config.io_seek_speed << '\n'
+      << "io_cylinders=" << config.io_cylinders << '\n'
+      << "io_merge_limit=" << config.io_merge_limit << '\n'
+      << "simulation_engine=" << config.simulation_engine << '\n'
+      << "process_loading=" << config.process_loading << '\n'
+      << "replacement_seed=" << config.replacement_seed << '\n'
+      << "working_set_window=" << config.working_set_window << '\n'
+      << "page_fault_channels=" << config.page_fault_channels << '\n'
+      << "page_prefetch=" << config.page_prefetch << '\n'
+      << "paging_mode=" << config.paging_mode << '\n'
+      << "locality_window=" << config.locality_window << '\n'
+      << "locality_shift=" << config.locality_shift << '\n'
+      << "load_control=" << config.load_control << '\n'
+      << "tlb_entries=" << config.tlb_entries << '\n'
+      << "tlb_ways=" << config.tlb_ways << '\n'
+      << "tlb_mode=" << config.tlb_mode << '\n'
+      << "numa_nodes=" << config.numa_nodes << '\n'
+      << "numa_policy=" << config.numa_policy << '\n'
+      << "numa_remote_latency=" << config.numa_remote_latency << '\n'
+      << "metrics_keyframe_interval=" << config.metrics_keyframe_interval
+      << '\n'
+      << "metrics_categories=" << config.metrics_categories << '\n'
+      << "metrics_sample_rate=" << config.metrics_sample_rate << '\n'
+      << "metrics_aggregate_windows="
+      << join(config.metrics_aggregate_windows, ':') << '\n'
+      << "metrics_aggregate_file=" << config.metrics_aggregate_file << '\n'
+      << "cpu_cores=" << config.cpu_cores << '\n'
+      << "core_migration_cost=" << config.core_migration_cost << '\n'
+      << "checkpoint_tick=" << config.checkpoint_tick << '\n'
+      << "checkpoint_file=" << config.checkpoint_file << '\n'
+      << "restore_file=" << config.restore_file << '\n';
+  for (const auto &device : config.io_devices) {
+    out << "io_device=" << device.name << ':' << device.scheduling_algorithm
+        << ':' << device.quantum << ':' << device.service_rate << ':'
+        << device.seek_speed << ':' << device.cylinders << '\n';
+  }
+  return out.str();
+}
+
+std::string
+ResultCache::describe(const std::vector<std::shared_ptr<Process>> &processes) {
+  std::ostringstream out;
+  for (const auto &process : processes) {
+    out << process->pid << ' ' << process->name << ' '
+        << process->arrival_time << ' ' << process->priority << ' '
+        << process->memory_required << ' ';
+    for (const auto &burst : process->burst_sequence) {
+      if (burst.type == BurstType::CPU) {
+        out << 'C' << burst.duration;
+      } else {
+        out << 'I' << burst.duration << '[' << burst.io_device << '@'
+            << burst.cylinder << ']';
+      }
+      out << ',';
+    }
+    out << ' ';
+    for (size_t i = 0; i < process->memory_access_trace.size(); ++i) {
+      out << process->memory_access_trace[i];
+      if (i < process->memory_write_trace.size() &&
+          process->memory_write_trace[i])
+        out << 'w';
+      out << ',';
+    }
+    for (const auto &mapping : process->shared_mappings) {
+      out << ' ' << mapping.region << '@' << mapping.first_page << ':'
+          << mapping.pages;
+    }
+    out << '\n';
+  }
+  return out.str();
+}
+
+CacheKey ResultCache::make_key(std::string_view config,
+                               std::string_view processes,
+                               std::string_view variant) {
+  CacheKey key;
+  key.add(SIMULATOR_VERSION);
+  key.add(config);
+  key.add(processes);
+  key.add(variant);
+  return key;
+}
+
+fs::path ResultCache::entry_path(const CacheKey &key,
+                                 const char *extension) const {
+  return directory / (key.name() + extension);
+}
+
+bool ResultCache::load(const CacheKey &key, std::string &summary,
+                       bool with_trace) {
+  fs::path result = entry_path(key, ".result");
+  std::ifstream in(result, std::ios::binary);
+  if (!in.is_open())
+    return false;
+  std::string check;
+  if (!std::getline(in, check) || check != hex(key.check))
+    return false;
+  std::error_code ec;
+  fs::path trace = entry_path(key, ".trace");
+  if (with_trace && !fs::exists(trace, ec))
+    return false;
+  summary.assign(std::istreambuf_iterator<char>(in),
+                 std::istreambuf_iterator<char>());
+
+  // La fecha de modificación ordena el desalojo: la entrada pasa a ser la
+  // más reciente.
+  auto now = fs::file_time_type::clock::now();
+  fs::last_write_time(result, now, ec);
+  if (with_trace)
+    fs::last_write_time(trace, now, ec);
+  return true;
+}
+
+bool ResultCache::copy_trace(const CacheKey &key,
+                             const std::string &destination) const {
+  std::error_code ec;
+  fs::copy_file(entry_path(key, ".trace"), destination,
+                fs::copy_options::overwrite_existing, ec);
+  return !ec;
+}
+
+bool ResultCache::store(const CacheKey &key, const std::string &summary,
+                        const std::string &trace_file) {
+  std::error_code ec;
+  fs::create_directories(directory, ec);
+  if (ec)
+    return false;
+
+  std::string suffix;
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    auto stamp =
+        std::chrono::steady_clock::now().time_since_epoch().count() ^
+        std::hash<std::thread::id>{}(std::this_thread::get_id());
+    suffix = ".tmp" + hex(static_cast<uint64_t>(stamp)) +
+             std::to_string(temp_counter++);
+  }
+
+  // La traza va primero: una entrada existe cuando existe su .result.
+  uint64_t added = 0;
+  if (!trace_file.empty()) {
+    fs::path trace = entry_path(key, ".trace");
+    fs::path temp = trace.string() + suffix;
+    fs::copy_file(trace_file, temp, fs::copy_options::overwrite_existing, ec);
+    if (!ec)
+      fs::rename(temp, trace, ec);
+    if (ec) {
+      fs::remove(temp, ec);
+      return false;
+    }
+    added += fs::file_size(trace, ec);
+  }
+
+  fs::path result = entry_path(key, ".result");
+  fs::path temp = result.string() + suffix;
+  {
+    std::ofstream out(temp, std::ios::binary | std::ios::trunc);
+    out << hex(key.check) << '\n' << summary;
+    if (!out.good()) {
+      out.close();
+      fs::remove(temp, ec);
+      return false;
+    }
+  }
+  fs::rename(temp, result, ec);
+  if (ec) {
+    fs::remove(temp, ec);
+    return false;
+  }
+  added += fs::file_size(result, ec);
+
+  std::lock_guard<std::mutex> lock(mutex);
+  if (!scanned) {
+    used_bytes = size_bytes();
+    scanned = true;
+  } else {
+    used_bytes += added;
+  }
+  if (used_bytes > max_bytes)
+    evict();
+  return true;
+}
+
+uint64_t ResultCache::size_bytes() const {
+  uint64_t total = 0;
+  std::error_code ec;
+  for (fs::directory_iterator it(directory, ec), end; !ec && it != end;
+       it.increment(ec)) {
+    auto extension = it->path().extension();
+    if (extension != ".result" && extension != ".trace")
+      continue;
+    std::error_code size_ec;
+    uint64_t size = it->file_size(size_ec);
+    if (!size_ec)
+      total += size;
+  }
+  return total;
+}
+
+void ResultCache::evict() {
+  struct Entry {
+    fs::file_time_type last_use = fs::file_time_type::min();
+    uint64_t bytes = 0;
+    std::vector<fs::path> files;
+  };
+  std::map<std::string, Entry> entries;
+  std::error_code ec;
+  for (fs::directory_iterator it(directory, ec), end; !ec && it != end;
+       it.increment(ec)) {
+    auto extension = it->path().extension();
+    if (extension != ".result" && extension != ".trace")
+      continue;
+    std::error_code file_ec;
+    uint64_t size = it->file_size(file_ec);
+    auto time = it->last_write_time(file_ec);
+    if (file_ec)
+      continue;
+    auto &entry = entries[it->path().stem().string()];
+    entry.last_use = std::max(entry.last_use, time);
+    entry.bytes += size;
+    entry.files.push_back(it->path());
+  }
+
+  std::vector<const Entry *> by_age;
+  uint64_t total = 0;
+  for (const auto &[name, entry] : entries) {
+    by_age.push_back(&entry);
+    total += entry.bytes;
+  }
+  std::sort(by_age.begin(), by_age.end(),
+            [](const Entry *a, const Entry *b) {
+              return a->last_use < b->last_use;
+            });
+  for (const Entry *entry : by_age) {
+    if (total <= max_bytes)
+      break;
+    // Si otro proceso ya la eliminó, el error se ignora.
+    for (const auto &file : entry->files)
+      fs::remove(file, ec);
+    total -= entry->bytes;
+  }
+  used_bytes = total;
+}
+
+} // namespace OSSimulator
@@ -0,0 +1,240 @@
+#include "core/snapshot.hpp"
+#include "core/process.hpp"
+#include "io/io_request.hpp"
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <stdexcept>
+
+namespace OSSimulator {
+
+/*
+ * Formato de la instantánea.
+ *
+ * Cabecera: "OSSK", versión (1 byte) y 3 bytes reservados. A continuación el
+ * estado de cada componente, en el orden en que lo escribe
+ * CPUScheduler::save_state. No hay registros ni longitudes por sección: el
+ * lector debe leer exactamente lo que escribió el escritor, y cada
+ * componente verifica sus dimensiones (marcos, núcleos, dispositivos,
+ * políticas) contra la configuración actual antes de restaurarse.
+ */
+
+namespace {
+
+constexpr char MAGIC[4] = {'O', 'S', 'S', 'K'};
+constexpr uint8_t VERSION = 4;
+constexpr size_t HEADER_SIZE = 8;
+
+} // namespace
+
+void SnapshotWriter::put_uint(uint64_t value) {
+  while (value >= 0x80) {
+    data += static_cast<char>((value & 0x7F) | 0x80);
+    value >>= 7;
+  }
+  data += static_cast<char>(value);
+}
+
+void SnapshotWriter::put_int(int64_t value) {
+  put_uint((static_cast<uint64_t>(value) << 1) ^
+           static_cast<uint64_t>(value >> 63));
+}
+
+void SnapshotWriter::put_bool(bool value) { data += value ? '\1' : '\0'; }
+
+void SnapshotWriter::put_double(double value) {
+  uint64_t bits;
+  std::memcpy(&bits, &value, sizeof(bits));
+  for (int i = 0; i < 8; ++i)
+    data += static_cast<char>((bits >> (8 * i)) & 0xFF);
+}
+
+void SnapshotWriter::put_string(const std::string &value) {
+  put_uint(value.size());
+  data += value;
+}
+
+void SnapshotWriter::put_process(const Process *process) {
+  put_int(process ? process->pid : -1);
+}
+
+void SnapshotWriter::put_request(const std::shared_ptr<IORequest> &request) {
+  if (!request) {
+    put_int(-1);
+    return;
+  }
+
+  auto [it, inserted] =
+      request_ids.try_emplace(request.get(), request_ids.size());
+  put_int(static_cast<int64_t>(it->second));
+  if (!inserted)
+    return;
+
+  put_process(request->process);
+  put_uint(static_cast<uint64_t>(request->burst.type));
+  put_int(request->burst.duration);
+  put_int(request->burst.remaining_time);
+  put_string(request->burst.io_device);
+  put_int(request->burst.cylinder);
+  put_int(request->arrival_time);
+  put_int(request->completion_time);
+  put_int(request->start_time);
+  put_int(request->priority);
+  put_int(request->cylinder);
+  put_uint(request->merged.size());
+  for (const auto &merged : request->merged)
+    put_request(merged);
+}
+
+void SnapshotWriter::save(const std::string &filename) const {
+  std::ofstream out(filename, std::ios::binary);
+  if (!out.is_open())
+    throw std::runtime_error("No se pudo crear la instantánea: " + filename);
+
+  char header[HEADER_SIZE] = {MAGIC[0], MAGIC[1], MAGIC[2], MAGIC[3],
+                              static_cast<char>(VERSION), 0, 0, 0};
+  out.write(header, sizeof(header));
+  out.write(data.data(), static_cast<std::streamsize>(data.size()));
+  if (!out)
+    throw std::runtime_error("No se pudo escribir la instantánea: " + filename);
+}
+
+SnapshotReader::SnapshotReader(const std::string &filename) {
+  std::ifstream in(filename, std::ios::binary);
+  if (!in.is_open())
+    throw std::runtime_error("No se pudo abrir la instantánea: " + filename);
+
+  std::string content((std::istreambuf_iterator<char>(in)),
+                      std::istreambuf_iterator<char>());
+  if (content.size() < HEADER_SIZE ||
+      std::memcmp(content.data(), MAGIC, sizeof(MAGIC)) != 0) {
+    throw std::runtime_error("El archivo no es una instantánea: " + filename);
+  }
+  if (static_cast<uint8_t>(content[4]) != VERSION) {
+    throw std::runtime_error("Versión de instantánea no soportada: " +
+                             filename);
+  }
+  data = content.substr(HEADER_SIZE);
+}
+
+uint64_t SnapshotReader::get_uint() {
+  uint64_t value = 0;
+  for (int shift = 0; shift < 64; shift += 7) {
+    if (offset >= data.size())
+      throw std::runtime_error("Instantánea truncada");
+    uint8_t byte = static_cast<uint8_t>(data[offset++]);
+    value |= static_cast<uint64_t>(byte & 0x7F) << shift;
+    if (!(byte & 0x80))
+      return value;
+  }
+  throw std::runtime_error("Instantánea corrupta");
+}
+
+int64_t SnapshotReader::get_int64() {
+  uint64_t raw = get_uint();
+  return static_cast<int64_t>(raw >> 1) ^ -static_cast<int64_t>(raw & 1);
+}
+
+int SnapshotReader::get_int() { return static_cast<int>(get_int64()); }
+
+bool SnapshotReader::get_bool() {
+  if (offset >= data.size())
+    throw std::runtime_error("Instantánea truncada");
+  return data[offset++] != 0;
+}
+
+double SnapshotReader::get_double() {
+  if (data.size() - offset < 8)
+    throw std::runtime_error("Instantánea truncada");
+  uint64_t bits = 0;
+  for (int i = 0; i < 8; ++i)
+    bits |= static_cast<uint64_t>(static_cast<uint8_t>(data[offset++]))
+            << (8 * i);
+  double value;
+  std::memcpy(&value, &bits, sizeof(value));
+  return value;
+}
+
+std::string SnapshotReader::get_string() {
+  size_t length = get_count();
+  std::string value = data.substr(offset, length);
+  offset += length;
+  return value;
+}
+
+size_t SnapshotReader::get_count() {
+  uint64_t count = get_uint();
+  if (count > data.size() - offset)
+    throw std::runtime_error("Instantánea corrupta");
+  return static_cast<size_t>(count);
+}
+
+void SnapshotReader::expect(int64_t expected, const std::string &what) {
+  int64_t value = get_int64();
+  if (value != expected) {
+    throw std::runtime_error("La instantánea no coincide con la "
+                             "configuración (" +
+                             what + ": " + std::to_string(value) + " en la "
+                             "instantánea, " + std::to_string(expected) +
+                             " configurado)");
+  }
+}
+
+void SnapshotReader::expect(const std::string &expected,
+                            const std::string &what) {
+  std::string value = get_string();
+  if (value != expected) {
+    throw std::runtime_error("La instantánea no coincide con la "
+                             "configuración (" +
+                             what + ": " + value + " en la instantánea, " +
+                             expected + " configurado)");
+  }
+}
+
+void SnapshotReader::set_processes(
+    const std::vector<std::shared_ptr<Process>> &processes) {
+  processes_by_pid.clear();
+  for (const auto &process : processes)
+    processes_by_pid[process->pid] = process;
+}
+
+std::shared_ptr<Process> SnapshotReader::get_process() {
+  int pid = get_int();
+  if (pid < 0)
+    return nullptr;
+  auto it = processes_by_pid.find(pid);
+  if (it == processes_by_pid.end())
+    throw std::runtime_error("La instantánea referencia un proceso "
+                             "desconocido: " +
+                             std::to_string(pid));
+  return it->second;
+}
+
+std::shared_ptr<IORequest> SnapshotReader::get_request() {
+  int64_t id = get_int64();
+  if (id < 0)
+    return nullptr;
+  if (static_cast<uint64_t>(id) < requests.size())
+    return requests[static_cast<size_t>(id)];
+  if (static_cast<uint64_t>(id) != requests.size())
+    throw std::runtime_error("Instantánea corrupta");
+
+  auto request = std::make_shared<IORequest>();
+  requests.push_back(request);
+  request->process = get_process();
+  request->burst.type = static_cast<BurstType>(get_uint());
+  request->burst.duration = get_int64();
+  request->burst.remaining_time = get_int64();
+  request->burst.io_device = get_string();
+  request->burst.cylinder = get_int();
+  request->arrival_time = get_int64();
+  request->completion_time = get_int64();
+  request->start_time = get_int64();
+  request->priority = get_int();
+  request->cylinder = get_int();
+  for (size_t i = get_count(); i > 0; --i)
+    request->merged.push_back(get_request());
+  return request;
+}
+
+} // namespace OSSimulator
@@ -0,0 +1,176 @@
+#include "core/workload_generator.hpp"
+#include <algorithm>
+#include <charconv>
+#include <climits>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+
+namespace OSSimulator {
+
+namespace {
+
+void check_distribution(const Distribution &distribution,
+                        const std::string &what) {
+  bool valid = std::isfinite(distribution.a) && std::isfinite(distribution.b);
+  if (distribution.kind == Distribution::Kind::UNIFORM) {
+    valid = valid && distribution.a <= distribution.b;
+  } else if (distribution.kind == Distribution::Kind::EXPONENTIAL) {
+    valid = valid && distribution.a > 0;
+  }
+  if (!valid || distribution.a < 0 || distribution.a > INT_MAX ||
+      distribution.b > INT_MAX) {
+    throw std::invalid_argument("Distribución no válida para " + what);
+  }
+}
+
+void append_int(std::string &out, long long value) {
+  char digits[24];
+  auto result = std::to_chars(digits, digits + sizeof(digits), value);
+  out.append(digits, result.ptr);
+}
+
+const char *kind_name(Distribution::Kind kind) {
+  switch (kind) {
+  case Distribution::Kind::UNIFORM:
+    return "uniform";
+  case Distribution::Kind::EXPONENTIAL:
+    return "exponential";
+  default:
+    return "constant";
+  }
+}
+
+void describe(std::ostream &out, const char *name,
+              const Distribution &distribution) {
+  out << "#   " << name << '=' << kind_name(distribution.kind) << ':'
+      << distribution.a;
+  if (distribution.kind == Distribution::Kind::UNIFORM)
+    out << ':' << distribution.b;
+  out << '\n';
+}
+
+} // namespace
+
+WorkloadGenerator::WorkloadGenerator(const WorkloadSpec &spec)
+    : spec(spec), engine(spec.seed) {
+  if (spec.processes == 0) {
+    throw std::invalid_argument("La carga sintética no tiene procesos");
+  }
+  if (spec.arrival != "poisson" && spec.arrival != "bursty") {
+    throw std::invalid_argument("Modelo de llegadas no reconocido: " +
+                                spec.arrival);
+  }
+  if (!(spec.arrival_rate > 0) || !std::isfinite(spec.arrival_rate)) {
+    throw std::invalid_argument("Tasa de llegadas no válida");
+  }
+  if (spec.burst_size < 1) {
+    throw std::invalid_argument("Tamaño de ráfaga de llegadas no válido");
+  }
+  check_distribution(spec.cpu_bursts, "cpu_bursts");
+  check_distribution(spec.cpu_burst, "cpu_burst");
+  check_distribution(spec.io_burst, "io_burst");
+  check_distribution(spec.priority, "priority");
+  check_distribution(spec.pages, "pages");
+}
+
+/**
+ * Obtiene un número uniforme en [0, 1) con los 53 bits altos del generador.
+ */
+double WorkloadGenerator::uniform() {
+  return static_cast<double>(engine() >> 11) * 0x1.0p-53;
+}
+
+double WorkloadGenerator::exponential(double mean) {
+  return -mean * std::log1p(-uniform());
+}
+
+int WorkloadGenerator::sample(const Distribution &distribution, int minimum) {
+  double value = distribution.a;
+  if (distribution.kind == Distribution::Kind::UNIFORM) {
+    double span = std::floor(distribution.b) - std::ceil(distribution.a) + 1;
+    value = std::ceil(distribution.a) + std::floor(uniform() * span);
+  } else if (distribution.kind == Distribution::Kind::EXPONENTIAL) {
+    value = std::round(exponential(distribution.a));
+  }
+  value = std::min(value, static_cast<double>(INT_MAX));
+  return std::max(minimum, static_cast<int>(value));
+}
+
+/**
+ * Avanza el reloj de llegadas. En ráfagas los intervalos entre grupos tienen
+ * media burst_size / arrival_rate y cada grupo entre 1 y 2 * burst_size - 1
+ * llegadas en el mismo tick, con lo que la tasa promedio se mantiene.
+ */
+Tick WorkloadGenerator::next_arrival() {
+  if (spec.arrival == "poisson") {
+    clock += exponential(1.0 / spec.arrival_rate);
+  } else if (group_left == 0) {
+    if (generated > 0)
+      clock += exponential(spec.burst_size / spec.arrival_rate);
+    group_left = 1 + static_cast<int>(uniform() * (2 * spec.burst_size - 1));
+  }
+  if (spec.arrival == "bursty")
+    group_left--;
+  if (clock >= static_cast<double>(std::numeric_limits<Tick>::max())) {
+    throw std::runtime_error(
+        "La carga sintética supera el tiempo máximo de llegada");
+  }
+  return static_cast<Tick>(clock);
+}
+
+bool WorkloadGenerator::next_line(std::string_view &text) {
+  if (done()) {
+    return false;
+  }
+  Tick arrival = next_arrival();
+  generated++;
+
+  line.clear();
+  line += 'P';
+  append_int(line, static_cast<long long>(generated));
+  line += ' ';
+  append_int(line, arrival);
+  line += ' ';
+  int cpu_bursts = sample(spec.cpu_bursts, 1);
+  for (int i = 0; i < cpu_bursts; ++i) {
+    if (i > 0) {
+      line += ",E/S(";
+      append_int(line, sample(spec.io_burst, 1));
+      line += "),";
+    }
+    line += "CPU(";
+    append_int(line, sample(spec.cpu_burst, 1));
+    line += ')';
+  }
+  line += ' ';
+  append_int(line, sample(spec.priority, 0));
+  line += ' ';
+  append_int(line, sample(spec.pages, 1));
+
+  text = line;
+  return true;
+}
+
+void WorkloadGenerator::write(std::ostream &out) {
+  out << "# Carga sintética generada con --generate\n";
+  out << "#   seed=" << spec.seed << "\n";
+  out << "#   processes=" << spec.processes << "\n";
+  out << "#   arrival=" << spec.arrival << "\n";
+  out << "#   arrival_rate=" << spec.arrival_rate << "\n";
+  if (spec.arrival == "bursty")
+    out << "#   burst_size=" << spec.burst_size << "\n";
+  describe(out, "cpu_bursts", spec.cpu_bursts);
+  describe(out, "cpu_burst", spec.cpu_burst);
+  describe(out, "io_burst", spec.io_burst);
+  describe(out, "priority", spec.priority);
+  describe(out, "pages", spec.pages);
+
+  std::string_view text;
+  while (next_line(text)) {
+    out.write(text.data(), static_cast<std::streamsize>(text.size()));
+    out.put('\n');
+  }
+}
+
+} // namespace OSSimulator
@@ -0,0 +1,219 @@
+#include "cpu/cfs_scheduler.hpp"
+#include "core/snapshot.hpp"
+#include <algorithm>
+#include <iterator>
+#include <stdexcept>
+
+namespace OSSimulator {
+
+namespace {
+
+// Pesos de nice -20 a 19: cada nivel cambia el reparto de CPU en ~10 %.
+constexpr int NICE_TO_WEIGHT[40] = {
+    88761, 71755, 56483, 46273, 36291, 29154, 23254, 18705, 14949, 11916,
+    9548,  7620,  6100,  4904,  3906,  3121,  2501,  1991,  1586,  1277,
+    1024,  820,   655,   526,   423,   335,   272,   215,   172,   137,
+    110,   87,    70,    56,    45,    36,    29,    23,    18,    15};
+
+} // namespace
+
+bool CFSScheduler::Node::operator<(const Node &other) const {
+  if (vruntime != other.vruntime)
+    return vruntime < other.vruntime;
+  return sequence < other.sequence;
+}
+
+CFSScheduler::CFSScheduler(int target_latency, int min_granularity)
+    : target_latency(std::max(1, target_latency)),
+      min_granularity(std::max(1, min_granularity)) {}
+
+int CFSScheduler::weight_for(int priority) {
+  return NICE_TO_WEIGHT[std::clamp(priority, -20, 19) + 20];
+}
+
+void CFSScheduler::insert(const std::shared_ptr<Process> &process,
+                          Entry &entry) {
+  entry.sequence = next_sequence++;
+  Node node{entry.vruntime, entry.sequence, process->pid, process};
+  if (spare_nodes.empty()) {
+    timeline.insert(node);
+  } else {
+    spare_nodes.back().value() = node;
+    timeline.insert(std::move(spare_nodes.back()));
+    spare_nodes.pop_back();
+  }
+  total_weight += entry.weight;
+  entry.queued = true;
+}
+
+std::shared_ptr<Process> CFSScheduler::unlink(int pid, Entry &entry) {
+  if (!entry.queued)
+    return nullptr;
+  std::shared_ptr<Process> process;
+  auto it = timeline.find({entry.vruntime, entry.sequence, pid, nullptr});
+  if (it != timeline.end()) {
+    spare_nodes.push_back(timeline.extract(it));
+    process = std::move(spare_nodes.back().value().process);
+  }
+  total_weight -= entry.weight;
+  entry.queued = false;
+  return process;
+}
+
+void CFSScheduler::update_min_vruntime() {
+  if (!timeline.empty())
+    min_vruntime = std::max(min_vruntime, timeline.begin()->vruntime);
+}
+
+void CFSScheduler::add_process(const std::shared_ptr<Process> &process) {
+  auto [it, inserted] = entries.try_emplace(process->pid);
+  Entry &entry = it->second;
+  unlink(process->pid, entry);
+  entry.weight = weight_for(process->priority);
+
+  // Un proceso nuevo empieza en el mínimo; uno que vuelve de un bloqueo
+  // conserva a lo sumo media latencia de ventaja, para no acaparar la CPU.
+  uint64_t credit = static_cast<uint64_t>(target_latency) * SCALE / 2;
+  uint64_t floor = min_vruntime > credit ? min_vruntime - credit : 0;
+  entry.vruntime =
+      inserted ? min_vruntime : std::max(entry.vruntime, floor);
+
+  insert(process, entry);
+  update_min_vruntime();
+}
+
+std::shared_ptr<Process> CFSScheduler::get_next_process() {
+  if (timeline.empty())
+    return nullptr;
+  return timeline.begin()->process;
+}
+
+std::shared_ptr<Process> CFSScheduler::get_last_process() {
+  if (timeline.empty())
+    return nullptr;
+  return std::prev(timeline.end())->process;
+}
+
+bool CFSScheduler::has_processes() const { return !timeline.empty(); }
+
+void CFSScheduler::remove_process(int pid) {
+  auto it = entries.find(pid);
+  if (it == entries.end())
+    return;
+  unlink(pid, it->second);
+  update_min_vruntime();
+}
+
+size_t CFSScheduler::size() const { return timeline.size(); }
+
+void CFSScheduler::clear() {
+  timeline.clear();
+  entries.clear();
+  min_vruntime = 0;
+  next_sequence = 0;
+  total_weight = 0;
+}
+
+SchedulingAlgorithm CFSScheduler::get_algorithm() const {
+  return SchedulingAlgorithm::CFS;
+}
+
+std::unique_ptr<Scheduler> CFSScheduler::create_empty() const {
+  return std::make_unique<CFSScheduler>(target_latency, min_granularity);
+}
+
+void CFSScheduler::save_state(SnapshotWriter &out) const {
+  out.put_uint(entries.size());
+  for (const auto &[pid, entry] : entries) {
+    out.put_int(pid);
+    out.put_uint(entry.vruntime);
+    out.put_uint(entry.sequence);
+    out.put_int(entry.weight);
+    out.put_bool(entry.queued);
+  }
+  out.put_uint(timeline.size());
+  for (const Node &node : timeline)
+    out.put_process(node.process);
+  out.put_uint(min_vruntime);
+  out.put_uint(next_sequence);
+}
+
+void CFSScheduler::load_state(SnapshotReader &in) {
+  clear();
+  for (size_t i = in.get_count(); i > 0; --i) {
+    Entry &entry = entries[in.get_int()];
+    entry.vruntime = in.get_uint();
+    entry.sequence = in.get_uint();
+    entry.weight = in.get_int();
+    entry.queued = in.get_bool();
+  }
+  for (size_t i = in.get_count(); i > 0; --i) {
+    auto process = in.get_process();
+    auto it = process ? entries.find(process->pid) : entries.end();
+    if (it == entries.end() || !it->second.queued)
+      throw std::runtime_error("Instantánea corrupta");
+    const Entry &entry = it->second;
+    timeline.insert({entry.vruntime, entry.sequence, process->pid, process});
+    total_weight += entry.weight;
+  }
+  min_vruntime = in.get_uint();
+  next_sequence = in.get_uint();
+}
+
+int CFSScheduler::get_quantum(const Process &process) const {
+  auto it = entries.find(process.pid);
+  int weight = weight_for(process.priority);
+  long long runnable = static_cast<long long>(timeline.size());
+  long long weights = total_weight;
+  if (it == entries.end() || !it->second.queued) {
+    ++runnable;
+    weights += weight;
+  }
+
+  long long period = std::max<long long>(target_latency,
+                                         runnable * min_granularity);
+  long long slice = period * weight / weights;
+  return static_cast<int>(std::max<long long>(min_granularity, slice));
+}
+
+bool CFSScheduler::should_preempt(const Process &candidate,
+                                  const Process &running) const {
+  auto cand = entries.find(candidate.pid);
+  auto run = entries.find(running.pid);
+  if (cand == entries.end() || run == entries.end())
+    return false;
+  uint64_t granularity = static_cast<uint64_t>(min_granularity) * SCALE;
+  return cand->second.vruntime + granularity < run->second.vruntime;
+}
+
+void CFSScheduler::on_cpu_time(const Process &process, Tick ticks) {
+  auto it = entries.find(process.pid);
+  if (it == entries.end() || ticks <= 0)
+    return;
+
+  Entry &entry = it->second;
+  auto queued = unlink(process.pid, entry);
+  entry.vruntime += static_cast<uint64_t>(ticks) * SCALE * NICE_0_WEIGHT /
+                    static_cast<uint64_t>(entry.weight);
+  if (queued)
+    insert(queued, entry);
+  update_min_vruntime();
+}
+
+void CFSScheduler::on_process_exit(int pid) {
+  auto it = entries.find(pid);
+  if (it == entries.end())
+    return;
+  unlink(pid, it->second);
+  entries.erase(it);
+  update_min_vruntime();
+}
+
+double CFSScheduler::get_vruntime(int pid) const {
+  auto it = entries.find(pid);
+  if (it == entries.end())
+    return 0.0;
+  return static_cast<double>(it->second.vruntime) / SCALE;
+}
+
+} // namespace OSSimulator
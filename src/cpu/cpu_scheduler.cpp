@@ -1,10 +1,13 @@
 #include "cpu/cpu_scheduler.hpp"
 #include "core/process.hpp"
-#include "cpu/round_robin_scheduler.hpp"
+#include "core/process_stream.hpp"
+#include "core/profiler.hpp"
+#include "core/snapshot.hpp"
 #include "io/io_manager.hpp"
-#include "io/io_request.hpp"
+#include <algorithm>
 #include <chrono>
 #include <iostream>
+#include <stdexcept>
 
 namespace OSSimulator {
 
@@ -18,15 +21,40 @@ CPUScheduler::~CPUScheduler() { terminate_all_threads(); }
 
 void CPUScheduler::set_scheduler(std::unique_ptr<Scheduler> sched) {
   scheduler = std::move(sched);
+  for (auto &core : cores) {
+    core.queue = scheduler ? scheduler->create_empty() : nullptr;
+  }
+}
+
+void CPUScheduler::set_core_count(int count) {
+  std::lock_guard<SimMutex> lock(scheduler_mutex);
+  cores.clear();
+  if (count <= 1)
+    return;
+
+  cores.resize(static_cast<size_t>(count));
+  for (auto &core : cores) {
+    core.queue = scheduler ? scheduler->create_empty() : nullptr;
+  }
+}
+
+int CPUScheduler::get_core_count() const {
+  return cores.empty() ? 1 : static_cast<int>(cores.size());
+}
+
+void CPUScheduler::set_migration_cost(int ticks) {
+  migration_cost = std::max(0, ticks);
 }
 
 void CPUScheduler::set_memory_manager(std::shared_ptr<MemoryManager> mm) {
-  std::lock_guard<std::mutex> lock(scheduler_mutex);
+  std::lock_guard<SimMutex> lock(scheduler_mutex);
   memory_manager = mm;
   if (memory_manager) {
-    memory_manager->set_ready_callback([this](std::shared_ptr<Process> proc) {
-      this->handle_memory_ready(proc);
-    });
+    memory_manager->set_locking(core_locking == CoreLocking::COARSE);
+    memory_manager->set_ready_callback(
+        [this](const std::shared_ptr<Process> &proc, Tick ready_time) {
+          this->handle_memory_ready(proc, ready_time);
+        });
 
     if (metrics_collector) {
       memory_manager->set_metrics_collector(metrics_collector);
@@ -38,20 +66,59 @@ void CPUScheduler::set_memory_callback(MemoryCheckCallback callback) {
   memory_check_callback = callback;
 }
 
+void CPUScheduler::set_execution_mode(ExecutionMode mode) {
+  if (mode == execution_mode)
+    return;
+
+  execution_mode = mode;
+  for (auto &proc : all_processes) {
+    if (execution_mode == ExecutionMode::INLINE) {
+      proc->stop_thread();
+    } else if (proc->state != ProcessState::TERMINATED) {
+      spawn_process_thread(proc);
+    }
+  }
+}
+
+ExecutionMode CPUScheduler::get_execution_mode() const {
+  return execution_mode;
+}
+
+void CPUScheduler::set_core_locking(CoreLocking mode) {
+  if (mode == CoreLocking::COARSE && !CORE_LOCKING_AVAILABLE) {
+    throw std::runtime_error("El simulador se compiló con SINGLE_THREADED_CORE "
+                             "y no admite core_locking=coarse");
+  }
+  core_locking = mode;
+  bool enabled = mode == CoreLocking::COARSE;
+  scheduler_mutex.set_enabled(enabled);
+  if (memory_manager)
+    memory_manager->set_locking(enabled);
+  if (io_manager)
+    io_manager->set_locking(enabled);
+}
+
+CoreLocking CPUScheduler::get_core_locking() const { return core_locking; }
+
+void CPUScheduler::set_event_driven(bool enabled) { event_driven = enabled; }
+
+bool CPUScheduler::is_event_driven() const { return event_driven; }
+
 void CPUScheduler::set_io_manager(std::shared_ptr<IOManager> manager) {
-  std::lock_guard<std::mutex> lock(scheduler_mutex);
+  std::lock_guard<SimMutex> lock(scheduler_mutex);
   io_manager = manager;
   if (io_manager) {
-    io_manager->set_completion_callback(
-        [this](std::shared_ptr<Process> proc, int completion_time) {
-          handle_io_completion(proc, completion_time);
+    io_manager->set_locking(core_locking == CoreLocking::COARSE);
+    io_manager->set_batch_completion_callback(
+        [this](const std::vector<IOCompletion> &completions) {
+          handle_io_completions(completions);
         });
   }
 }
 
 void CPUScheduler::set_metrics_collector(
     std::shared_ptr<MetricsCollector> collector) {
-  std::lock_guard<std::mutex> lock(scheduler_mutex);
+  std::lock_guard<SimMutex> lock(scheduler_mutex);
   metrics_collector = collector;
 
   if (memory_manager && metrics_collector) {
@@ -63,26 +130,57 @@ void CPUScheduler::set_metrics_collector(
   }
 }
 
-void CPUScheduler::add_process(std::shared_ptr<Process> process) {
+void CPUScheduler::set_live_stats(std::shared_ptr<LiveStats> stats) {
+  std::lock_guard<SimMutex> lock(scheduler_mutex);
+  live_stats = std::move(stats);
+  live_devices.clear();
+  if (!live_stats)
+    return;
+
+  live_stats->cores.store(get_core_count(), std::memory_order_relaxed);
+  if (io_manager) {
+    for (const auto &[name, device] : io_manager->get_all_devices())
+      live_devices.emplace_back(device, live_stats->add_device(name));
+  }
+  publish_live_stats();
+}
+
+void CPUScheduler::add_process(const std::shared_ptr<Process> &process) {
   all_processes.push_back(process);
+  track_new_process(process);
   spawn_process_thread(process);
 }
 
 void CPUScheduler::load_processes(
     const std::vector<std::shared_ptr<Process>> &processes) {
   all_processes = processes;
+  rebuild_state_tracking();
   for (auto &proc : all_processes) {
     spawn_process_thread(proc);
   }
 
   completed_processes.clear();
+  completed_processes.reserve(all_processes.size());
+  latency_stats.clear();
+  completed_count = 0;
   current_time = 0;
   context_switches = 0;
   running_process = nullptr;
 
   if (scheduler)
     scheduler->clear();
+  reset_cores();
+  process_stream = nullptr;
+  release_completed = false;
+}
+
+void CPUScheduler::stream_processes(std::unique_ptr<ProcessStream> stream) {
+  load_processes({});
+  process_stream = std::move(stream);
+  last_streamed_arrival = 0;
+  release_completed = true;
 }
+
 bool CPUScheduler::check_and_allocate_memory(Process &process) {
   if (memory_check_callback)
     return memory_check_callback(process);
@@ -91,45 +189,106 @@ bool CPUScheduler::check_and_allocate_memory(Process &process) {
 }
 
 void CPUScheduler::add_arrived_processes() {
-  for (auto &proc : all_processes) {
-    if (proc->state == ProcessState::NEW && proc->has_arrived(current_time)) {
-      bool allocated = false;
-      if (memory_manager) {
-        if (memory_manager->allocate_initial_memory(*proc)) {
-          memory_manager->register_process(proc);
-          allocated = true;
-          proc->memory_allocated = true;
+  OSSIM_PROFILE_SCOPE("cpu.arrivals");
+  if (release_completed)
+    release_terminated();
+
+  while (process_stream && !process_stream->done() &&
+         process_stream->peek_arrival() <= current_time) {
+    auto proc = process_stream->next();
+    if (proc->arrival_time < last_streamed_arrival) {
+      throw std::runtime_error("La carga incremental requiere los procesos "
+                               "ordenados por tiempo de llegada: " +
+                               proc->name);
+    }
+    last_streamed_arrival = proc->arrival_time;
+    add_process(proc);
+  }
+
+  while (arrival_cursor < arrival_order.size() &&
+         process_table.arrival_times[arrival_order[arrival_cursor]] <=
+             current_time) {
+    size_t index = arrival_order[arrival_cursor++];
+    if (process_table.states[index] == ProcessState::NEW) {
+      arrived_new.insert(index);
+    }
+  }
+
+  admission_deferred = false;
+  for (auto it = arrived_new.begin(); it != arrived_new.end();) {
+    size_t index = *it++;
+    const auto &proc = all_processes[index];
+    bool allocated = false;
+    if (memory_manager) {
+      if (memory_manager->allocate_initial_memory(*proc)) {
+        if (!memory_manager->admit_process(*proc, current_time)) {
+          admission_deferred = true;
+          break;
         }
-      } else {
-        allocated = check_and_allocate_memory(*proc);
+        memory_manager->register_process(proc);
+        allocated = true;
+        proc->memory_allocated = true;
       }
+    } else {
+      allocated = check_and_allocate_memory(*proc);
+    }
 
-      if (allocated) {
-        ProcessState old_state = proc->state.load();
-        proc->state = ProcessState::READY;
+    if (allocated) {
+      ProcessState old_state = proc->state.load();
+      set_process_state(proc, ProcessState::READY);
+      if (cores.empty()) {
         scheduler->add_process(proc);
+      } else {
+        enqueue_on_core(proc);
+      }
 
-        if (metrics_collector && metrics_collector->is_enabled()) {
-          metrics_collector->log_state_transition(
-              current_time, proc->pid, proc->name, old_state,
-              ProcessState::READY, "process_arrival");
-        }
+      if (metrics_collector && metrics_collector->is_enabled()) {
+        metrics_collector->log_state_transition(
+            current_time, proc->pid, proc->name_id, old_state,
+            ProcessState::READY, "process_arrival");
       }
     }
   }
 }
 
 void CPUScheduler::execute_step(int quantum) {
-  std::unique_lock<std::mutex> scheduler_lock(scheduler_mutex);
+  OSSIM_PROFILE_SCOPE("cpu.step");
+  std::lock_guard<SimMutex> lock(scheduler_mutex);
+
+  if (!cores.empty()) {
+    execute_multicore_step(quantum);
+    return;
+  }
 
+  scheduler->advance_time(current_time);
   add_arrived_processes();
 
   if (!scheduler->has_processes()) {
     if (has_pending_processes()) {
-      int idle_start = current_time;
-      advance_memory_manager(1, idle_start, scheduler_lock);
-      advance_io_devices(1, idle_start, scheduler_lock);
+      Tick idle_start = current_time;
+      Tick idle_ticks = 1;
+      if (event_driven) {
+        Tick next_event = get_next_event_time();
+        if (next_event > idle_start) {
+          idle_ticks = next_event - idle_start;
+        }
+      }
+
+      advance_memory_manager(idle_ticks, idle_start);
+      advance_io_devices(idle_ticks, idle_start);
+
+      if (metrics_collector &&
+          metrics_collector->logs_category(MetricsCollector::CATEGORY_CPU)) {
+        // Dentro del salto no hay eventos: la cola de listos está vacía
+        // hasta el último tick.
+        for (Tick tick = idle_start; tick < idle_start + idle_ticks - 1;
+             ++tick) {
+          metrics_collector->log_cpu(tick, "IDLE", -1, NameTable::EMPTY, 0, 0,
+                                     false);
+        }
+      }
 
+      current_time = idle_start + idle_ticks - 1;
       send_cpu_metrics("IDLE", nullptr, false);
       last_tick_was_idle = true;
 
@@ -138,18 +297,23 @@ void CPUScheduler::execute_step(int quantum) {
     return;
   }
 
-  auto next = scheduler->get_next_process();
-  while (next && (next->state == ProcessState::WAITING ||
-                  next->state == ProcessState::MEMORY_WAITING ||
-                  next->state == ProcessState::TERMINATED)) {
-    scheduler->remove_process(next->pid);
-    next = scheduler->has_processes() ? scheduler->get_next_process() : nullptr;
+  std::shared_ptr<Process> next;
+  {
+    OSSIM_PROFILE_SCOPE("cpu.dispatch");
+    next = scheduler->get_next_process();
+    while (next && (next->state == ProcessState::WAITING ||
+                    next->state == ProcessState::MEMORY_WAITING ||
+                    next->state == ProcessState::TERMINATED)) {
+      scheduler->remove_process(next->pid);
+      next =
+          scheduler->has_processes() ? scheduler->get_next_process() : nullptr;
+    }
   }
 
   if (!next) {
     if (has_pending_processes()) {
-      int idle_start = current_time;
-      advance_io_devices(1, idle_start, scheduler_lock);
+      Tick idle_start = current_time;
+      advance_io_devices(1, idle_start);
       current_time++;
     }
     return;
@@ -159,9 +323,12 @@ void CPUScheduler::execute_step(int quantum) {
   if (!running_process || running_process->pid != next->pid) {
     context_switches++;
     context_switch_occurred = true;
+    if (memory_manager)
+      memory_manager->switch_context(0);
   }
 
   running_process = next;
+  quantum = quantum_for(*scheduler, *running_process, quantum);
 
   if (memory_manager) {
     if (!memory_manager->prepare_process_for_cpu(running_process,
@@ -169,12 +336,12 @@ void CPUScheduler::execute_step(int quantum) {
       memory_manager->mark_process_inactive(*running_process);
 
       ProcessState old_state = running_process->state.load();
-      running_process->state = ProcessState::MEMORY_WAITING;
+      set_process_state(running_process, ProcessState::MEMORY_WAITING);
       scheduler->remove_process(running_process->pid);
 
       if (metrics_collector && metrics_collector->is_enabled()) {
         metrics_collector->log_state_transition(
-            current_time, running_process->pid, running_process->name,
+            current_time, running_process->pid, running_process->name_id,
             old_state, ProcessState::MEMORY_WAITING, "page_fault");
         send_queue_snapshot();
       }
@@ -190,39 +357,57 @@ void CPUScheduler::execute_step(int quantum) {
       memory_manager->mark_process_inactive(*running_process);
     }
     ProcessState old_state = running_process->state.load();
-    running_process->state = ProcessState::WAITING;
+    set_process_state(running_process, ProcessState::WAITING);
     scheduler->remove_process(running_process->pid);
 
     if (metrics_collector && metrics_collector->is_enabled()) {
       metrics_collector->log_state_transition(
-          current_time, running_process->pid, running_process->name, old_state,
-          ProcessState::WAITING, "io_request");
+          current_time, running_process->pid, running_process->name_id,
+          old_state, ProcessState::WAITING, "io_request");
       send_queue_snapshot();
     }
 
-    auto request = std::make_shared<IORequest>(running_process, *current_burst,
-                                               current_time);
-    io_manager->submit_io_request(request);
+    io_manager->submit_io_request(
+        io_requests.acquire(running_process, *current_burst, current_time));
 
     running_process = nullptr;
     return;
   }
 
+  // Con paginación por demanda la ejecución se corta antes del primer
+  // acceso a una página no residente; el proceso falla en el siguiente paso
+  // sin perder su turno.
+  Tick slice = quantum;
+  bool page_fault_cut = false;
+  if (memory_manager && current_burst &&
+      current_burst->type == BurstType::CPU) {
+    Tick limit = quantum > 0 ? std::min<Tick>(quantum,
+                                              current_burst->remaining_time)
+                             : current_burst->remaining_time;
+    Tick resident = memory_manager->access_pages(*running_process, limit,
+                                                 current_time);
+    if (resident < limit) {
+      slice = std::max<Tick>(1, resident);
+      page_fault_cut = true;
+    }
+  }
+
   notify_process_running(running_process);
   wait_for_process_step(running_process);
 
-  int step_start_time = current_time;
-  int time_executed = running_process->execute(quantum, current_time);
+  Tick step_start_time = current_time;
+  Tick time_executed = running_process->execute(slice, current_time);
 
   total_cpu_time += time_executed;
+  scheduler->on_cpu_time(*running_process, time_executed);
 
   bool will_complete = running_process->is_completed();
 
   bool will_preempt = false;
   if (!will_complete) {
-    if (scheduler->get_algorithm() == SchedulingAlgorithm::ROUND_ROBIN) {
-      will_preempt = true;
-    } else if (scheduler->get_algorithm() == SchedulingAlgorithm::PRIORITY) {
+    if (is_time_sliced()) {
+      will_preempt = !page_fault_cut;
+    } else if (is_preemptive()) {
       will_preempt = pending_preemption;
     }
   }
@@ -238,17 +423,17 @@ void CPUScheduler::execute_step(int quantum) {
 
   current_time += time_executed;
 
-  advance_memory_manager(time_executed, step_start_time, scheduler_lock);
-  advance_io_devices(time_executed, step_start_time, scheduler_lock);
+  advance_memory_manager(time_executed, step_start_time);
+  advance_io_devices(time_executed, step_start_time);
 
   if (will_complete) {
     running_process->calculate_metrics();
     running_process->stop_thread();
 
-    completed_processes.push_back(running_process);
+    record_completion(running_process);
 
     ProcessState old_state = running_process->state.load();
-    running_process->state = ProcessState::TERMINATED;
+    set_process_state(running_process, ProcessState::TERMINATED);
 
     scheduler->remove_process(running_process->pid);
 
@@ -259,8 +444,8 @@ void CPUScheduler::execute_step(int quantum) {
 
     if (metrics_collector && metrics_collector->is_enabled()) {
       metrics_collector->log_state_transition(
-          current_time, running_process->pid, running_process->name, old_state,
-          ProcessState::TERMINATED, "burst_completed");
+          current_time, running_process->pid, running_process->name_id,
+          old_state, ProcessState::TERMINATED, "burst_completed");
       send_queue_snapshot();
     }
 
@@ -268,8 +453,7 @@ void CPUScheduler::execute_step(int quantum) {
     running_process = nullptr;
   } else {
     if (pending_preemption &&
-        (scheduler->get_algorithm() == SchedulingAlgorithm::ROUND_ROBIN ||
-         scheduler->get_algorithm() == SchedulingAlgorithm::PRIORITY)) {
+        (is_time_sliced() || is_preemptive())) {
       pending_preemption = false;
       if (memory_manager) {
         memory_manager->mark_process_inactive(*running_process);
@@ -281,10 +465,11 @@ void CPUScheduler::execute_step(int quantum) {
         running_process->state = ProcessState::READY;
         running_process->state_cv.notify_all();
       }
+      sync_process_state(*running_process);
 
       if (metrics_collector && metrics_collector->is_enabled()) {
         metrics_collector->log_state_transition(
-            current_time, running_process->pid, running_process->name,
+            current_time, running_process->pid, running_process->name_id,
             old_state, ProcessState::READY, "preempted");
       }
 
@@ -299,7 +484,7 @@ void CPUScheduler::execute_step(int quantum) {
       pending_preemption = false;
     }
 
-    if (scheduler->get_algorithm() == SchedulingAlgorithm::ROUND_ROBIN) {
+    if (is_time_sliced() && !page_fault_cut) {
       if (memory_manager) {
         memory_manager->mark_process_inactive(*running_process);
       }
@@ -311,91 +496,694 @@ void CPUScheduler::execute_step(int quantum) {
         running_process->step_complete = false;
         running_process->state_cv.notify_all();
       }
+      sync_process_state(*running_process);
 
       if (metrics_collector && metrics_collector->is_enabled()) {
         metrics_collector->log_state_transition(
-            current_time, running_process->pid, running_process->name,
+            current_time, running_process->pid, running_process->name_id,
             old_state, ProcessState::READY, "quantum_expired");
       }
 
       scheduler->remove_process(running_process->pid);
       scheduler->add_process(running_process);
     } else {
-      std::lock_guard<std::mutex> lock(running_process->process_mutex);
-      running_process->state = ProcessState::READY;
-      running_process->step_complete = false;
-      running_process->state_cv.notify_all();
+      {
+        std::lock_guard<std::mutex> lock(running_process->process_mutex);
+        running_process->state = ProcessState::READY;
+        running_process->step_complete = false;
+        running_process->state_cv.notify_all();
+      }
+      sync_process_state(*running_process);
     }
   }
 }
 
 void CPUScheduler::run_until_completion() {
   simulation_running = true;
+  start_aggregate_samples();
   while (simulation_running &&
          (has_pending_processes() || scheduler->has_processes())) {
-    int quantum = 0;
-    if (scheduler->get_algorithm() == SchedulingAlgorithm::ROUND_ROBIN) {
-      if (auto *rr = dynamic_cast<RoundRobinScheduler *>(scheduler.get()))
-        quantum = rr->get_quantum();
-    } else if (scheduler->get_algorithm() == SchedulingAlgorithm::PRIORITY) {
-      quantum = 1;
+    execute_step(0);
+    publish_live_stats();
+    collect_aggregate_sample();
+  }
+}
+
+void CPUScheduler::run_until(Tick tick) {
+  simulation_running = true;
+  start_aggregate_samples();
+  while (simulation_running && current_time < tick &&
+         (has_pending_processes() || scheduler->has_processes())) {
+    execute_step(0);
+    publish_live_stats();
+    collect_aggregate_sample();
+  }
+}
+
+void CPUScheduler::save_checkpoint(const std::string &filename) {
+  std::lock_guard<SimMutex> lock(scheduler_mutex);
+  if (process_stream) {
+    throw std::runtime_error("Los puntos de control no admiten la carga "
+                             "incremental de procesos");
+  }
+  SnapshotWriter out;
+  out.put_string(get_algorithm_name());
+  out.put_int(get_core_count());
+  out.put_int(static_cast<int64_t>(all_processes.size()));
+  for (const auto &proc : all_processes) {
+    out.put_int(proc->pid);
+    proc->save_state(out);
+  }
+
+  out.put_int(current_time);
+  out.put_int(context_switches);
+  out.put_int(total_cpu_time);
+  out.put_bool(last_tick_was_idle);
+  out.put_bool(pending_preemption);
+  out.put_process(running_process);
+  out.put_processes(completed_processes);
+  out.put_vector(process_table.cores);
+
+  scheduler->save_state(out);
+  for (const auto &core : cores) {
+    core.queue->save_state(out);
+    out.put_process(core.running);
+    out.put_int(core.last_pid);
+    out.put_int(core.slice_used);
+    out.put_int(core.quantum);
+    out.put_int(core.migration_left);
+    out.put_int(core.remote_left);
+    out.put_bool(core.preempt);
+    out.put_int(core.busy_ticks);
+    out.put_int(core.context_switches);
+    out.put_int(core.migrations);
+    out.put_int(core.steals);
+  }
+
+  out.put_int(memory_manager != nullptr);
+  if (memory_manager)
+    memory_manager->save_state(out);
+  out.put_int(io_manager != nullptr);
+  if (io_manager)
+    io_manager->save_state(out);
+
+  out.save(filename);
+}
+
+void CPUScheduler::restore_checkpoint(const std::string &filename) {
+  std::lock_guard<SimMutex> lock(scheduler_mutex);
+  if (process_stream) {
+    throw std::runtime_error("Los puntos de control no admiten la carga "
+                             "incremental de procesos");
+  }
+  SnapshotReader in(filename);
+  in.set_processes(all_processes);
+  in.expect(get_algorithm_name(), "algoritmo de planificación");
+  in.expect(get_core_count(), "núcleos");
+  in.expect(static_cast<int64_t>(all_processes.size()), "procesos");
+  for (const auto &proc : all_processes) {
+    in.expect(proc->pid, "PID");
+    proc->load_state(in);
+  }
+
+  current_time = in.get_int64();
+  context_switches = in.get_int64();
+  total_cpu_time = in.get_int64();
+  last_tick_was_idle = in.get_bool();
+  pending_preemption = in.get_bool();
+  running_process = in.get_process();
+  in.get_processes(completed_processes);
+  completed_count = completed_processes.size();
+  latency_stats.clear();
+  for (const auto &proc : completed_processes)
+    latency_stats.record(proc->priority, proc->waiting_time,
+                         proc->turnaround_time, proc->response_time);
+
+  rebuild_state_tracking();
+  std::vector<int> process_cores;
+  in.get_vector(process_cores);
+  if (process_cores.size() != process_table.size())
+    throw std::runtime_error("Instantánea corrupta");
+  process_table.cores = process_cores;
+
+  scheduler->load_state(in);
+  for (auto &core : cores) {
+    core.queue->load_state(in);
+    core.running = in.get_process();
+    core.last_pid = in.get_int();
+    core.slice_used = in.get_int64();
+    core.quantum = in.get_int();
+    core.migration_left = in.get_int();
+    core.remote_left = in.get_int64();
+    core.preempt = in.get_bool();
+    core.busy_ticks = in.get_int64();
+    core.context_switches = in.get_int64();
+    core.migrations = in.get_int64();
+    core.steals = in.get_int64();
+  }
+
+  in.expect(memory_manager != nullptr, "gestor de memoria");
+  if (memory_manager)
+    memory_manager->load_state(in);
+  in.expect(io_manager != nullptr, "gestor de E/S");
+  if (io_manager)
+    io_manager->load_state(in);
+  if (!in.at_end())
+    throw std::runtime_error("Instantánea corrupta");
+
+  for (const auto &proc : all_processes) {
+    if (proc->state == ProcessState::TERMINATED)
+      proc->stop_thread();
+  }
+}
+
+void CPUScheduler::execute_multicore_step(int quantum) {
+  for (auto &core : cores) {
+    core.queue->advance_time(current_time);
+  }
+  add_arrived_processes();
+
+  if (!cores_have_work()) {
+    if (has_pending_processes()) {
+      Tick idle_start = current_time;
+      Tick idle_ticks = 1;
+      if (event_driven) {
+        Tick next_event = get_next_event_time();
+        if (next_event > idle_start) {
+          idle_ticks = next_event - idle_start;
+        }
+      }
+
+      advance_memory_manager(idle_ticks, idle_start);
+      advance_io_devices(idle_ticks, idle_start);
+
+      if (metrics_collector &&
+          metrics_collector->logs_category(MetricsCollector::CATEGORY_CPU)) {
+        for (Tick tick = idle_start; tick < idle_start + idle_ticks; ++tick) {
+          for (size_t i = 0; i < cores.size(); ++i) {
+            metrics_collector->log_core(tick, static_cast<int>(i), "IDLE", -1,
+                                        NameTable::EMPTY, 0, 0, false);
+          }
+        }
+      }
+      current_time = idle_start + idle_ticks;
+    }
+    return;
+  }
+
+  for (size_t i = 0; i < cores.size(); ++i) {
+    if (!cores[i].running && !cores[i].queue->has_processes()) {
+      steal_work(i);
     }
-    execute_step(quantum);
+  }
+
+  Tick step_start_time = current_time;
+  for (size_t i = 0; i < cores.size(); ++i) {
+    run_core_tick(i, quantum);
+  }
+
+  current_time++;
+  advance_memory_manager(1, step_start_time);
+  advance_io_devices(1, step_start_time);
+
+  for (size_t i = 0; i < cores.size(); ++i) {
+    finish_core_tick(i);
   }
 }
 
-bool CPUScheduler::has_pending_processes() const {
-  for (const auto &proc : all_processes)
-    if (proc->state != ProcessState::TERMINATED)
+void CPUScheduler::run_core_tick(size_t index, int quantum) {
+  Core &core = cores[index];
+  int core_id = static_cast<int>(index);
+  bool context_switch = false;
+
+  while (!core.running && core.queue->has_processes()) {
+    auto next = core.queue->get_next_process();
+    core.queue->remove_process(next->pid);
+    if (next->state != ProcessState::READY) {
+      continue;
+    }
+
+    if (core.last_pid != next->pid) {
+      core.context_switches++;
+      context_switches++;
+      context_switch = true;
+      if (memory_manager)
+        memory_manager->switch_context(core_id);
+    }
+    core.last_pid = next->pid;
+    core.slice_used = 0;
+    core.quantum = quantum_for(*core.queue, *next, quantum);
+    core.preempt = false;
+    core.remote_left = 0;
+
+    auto it = process_index.find(next.get());
+    if (it != process_index.end()) {
+      int &last_core = process_table.cores[it->second];
+      if (last_core >= 0 && last_core != core_id) {
+        core.migrations++;
+        core.migration_left = migration_cost;
+      }
+      last_core = core_id;
+    }
+    core.running = next;
+  }
+
+  if (!core.running) {
+    if (metrics_collector) {
+      metrics_collector->log_core(current_time, core_id, "IDLE", -1,
+                                  NameTable::EMPTY, 0, 0, false);
+    }
+    return;
+  }
+
+  auto proc = core.running;
+  Tick stall = 0;
+  if (memory_manager && !memory_manager->prepare_process_for_cpu(
+                            proc, current_time, core_id, &stall)) {
+    memory_manager->mark_process_inactive(*proc);
+
+    ProcessState old_state = proc->state.load();
+    set_process_state(proc, ProcessState::MEMORY_WAITING);
+    core.running = nullptr;
+
+    if (metrics_collector && metrics_collector->is_enabled()) {
+      metrics_collector->log_state_transition(
+          current_time, proc->pid, proc->name_id, old_state,
+          ProcessState::MEMORY_WAITING, "page_fault");
+      metrics_collector->log_core(current_time, core_id, "IDLE", -1,
+                                  NameTable::EMPTY, 0, core.queue->size(),
+                                  context_switch);
+      send_queue_snapshot();
+    }
+    return;
+  }
+  core.remote_left += stall;
+
+  if (start_core_io(index)) {
+    if (metrics_collector) {
+      metrics_collector->log_core(current_time, core_id, "IDLE", -1,
+                                  NameTable::EMPTY, 0, core.queue->size(),
+                                  context_switch);
+    }
+    return;
+  }
+
+  if (core.migration_left > 0) {
+    core.migration_left--;
+    if (metrics_collector) {
+      metrics_collector->log_core(current_time, core_id, "MIGRATE", proc->pid,
+                                  proc->name_id, 0, core.queue->size(),
+                                  context_switch);
+    }
+    return;
+  }
+
+  // El próximo acceso cae en la memoria de otro nodo NUMA: el núcleo espera
+  // la latencia remota antes de ejecutarlo.
+  if (core.remote_left > 0) {
+    core.remote_left--;
+    if (metrics_collector) {
+      metrics_collector->log_core(current_time, core_id, "REMOTE_STALL",
+                                  proc->pid, proc->name_id, 0,
+                                  core.queue->size(), context_switch);
+    }
+    return;
+  }
+
+  notify_process_running(proc);
+  wait_for_process_step(proc);
+
+  if (memory_manager) {
+    memory_manager->access_pages(*proc, 1, current_time, core_id);
+  }
+  Tick time_executed = proc->execute(1, current_time);
+  core.queue->on_cpu_time(*proc, time_executed);
+  total_cpu_time += time_executed;
+  core.busy_ticks += time_executed;
+  core.slice_used += time_executed;
+
+  if (metrics_collector &&
+      metrics_collector->should_log(MetricsCollector::CATEGORY_CPU,
+                                    current_time)) {
+    const char *event = "EXEC";
+    if (proc->is_completed()) {
+      event = "COMPLETE";
+    } else if (core.preempt || core_quantum_expired(core)) {
+      event = "PREEMPT";
+    }
+
+    Tick remaining = 0;
+    auto *burst = proc->get_current_burst_mutable();
+    if (burst && burst->type == BurstType::CPU) {
+      remaining = burst->remaining_time;
+    }
+    metrics_collector->log_core(current_time, core_id, event, proc->pid,
+                                proc->name_id, remaining, core.queue->size(),
+                                context_switch);
+  }
+}
+
+bool CPUScheduler::start_core_io(size_t index) {
+  Core &core = cores[index];
+  auto proc = core.running;
+  auto *burst = proc->get_current_burst_mutable();
+  if (!burst || burst->type != BurstType::IO || !io_manager) {
+    return false;
+  }
+
+  if (memory_manager) {
+    memory_manager->mark_process_inactive(*proc);
+  }
+  ProcessState old_state = proc->state.load();
+  set_process_state(proc, ProcessState::WAITING);
+  core.running = nullptr;
+
+  if (metrics_collector && metrics_collector->is_enabled()) {
+    metrics_collector->log_state_transition(current_time, proc->pid,
+                                            proc->name_id, old_state,
+                                            ProcessState::WAITING,
+                                            "io_request");
+    send_queue_snapshot();
+  }
+
+  io_manager->submit_io_request(
+      io_requests.acquire(proc, *burst, current_time));
+  return true;
+}
+
+void CPUScheduler::finish_core_tick(size_t index) {
+  Core &core = cores[index];
+  if (!core.running) {
+    return;
+  }
+  auto proc = core.running;
+
+  if (proc->is_completed()) {
+    proc->calculate_metrics();
+    proc->stop_thread();
+    record_completion(proc);
+
+    ProcessState old_state = proc->state.load();
+    set_process_state(proc, ProcessState::TERMINATED);
+    core.running = nullptr;
+
+    if (memory_manager) {
+      memory_manager->mark_process_inactive(*proc);
+      memory_manager->release_process_memory(proc->pid);
+    }
+
+    if (metrics_collector && metrics_collector->is_enabled()) {
+      metrics_collector->log_state_transition(
+          current_time, proc->pid, proc->name_id, old_state,
+          ProcessState::TERMINATED, "burst_completed");
+      send_queue_snapshot();
+    }
+    return;
+  }
+
+  if (start_core_io(index)) {
+    return;
+  }
+
+  bool quantum_expired = core_quantum_expired(core);
+  if (!core.preempt && !quantum_expired) {
+    return;
+  }
+
+  core.preempt = false;
+  if (memory_manager) {
+    memory_manager->mark_process_inactive(*proc);
+  }
+
+  ProcessState old_state = proc->state.load();
+  {
+    std::lock_guard<std::mutex> lock(proc->process_mutex);
+    proc->state = ProcessState::READY;
+    proc->step_complete = false;
+    proc->state_cv.notify_all();
+  }
+  sync_process_state(*proc);
+  core.running = nullptr;
+
+  if (metrics_collector && metrics_collector->is_enabled()) {
+    metrics_collector->log_state_transition(
+        current_time, proc->pid, proc->name_id, old_state, ProcessState::READY,
+        quantum_expired ? "quantum_expired" : "preempted");
+  }
+  core.queue->add_process(proc);
+}
+
+void CPUScheduler::steal_work(size_t index) {
+  size_t victim = index;
+  size_t best_surplus = 0;
+  for (size_t i = 0; i < cores.size(); ++i) {
+    if (i == index) {
+      continue;
+    }
+    // Un núcleo ocioso conserva el primer proceso de su cola para sí.
+    size_t queued = cores[i].queue->size();
+    size_t surplus = cores[i].running ? queued : (queued > 0 ? queued - 1 : 0);
+    if (surplus > best_surplus) {
+      best_surplus = surplus;
+      victim = i;
+    }
+  }
+  if (victim == index) {
+    return;
+  }
+
+  // Se roba el último de la cola: el primero es el que la víctima ejecutaría
+  // a continuación.
+  auto proc = cores[victim].queue->get_last_process();
+  if (!proc) {
+    return;
+  }
+  cores[victim].queue->remove_process(proc->pid);
+  cores[index].queue->add_process(proc);
+  cores[index].steals++;
+}
+
+void CPUScheduler::enqueue_on_core(const std::shared_ptr<Process> &proc) {
+  size_t target = 0;
+  auto it = process_index.find(proc.get());
+  int last_core =
+      it != process_index.end() ? process_table.cores[it->second] : -1;
+
+  if (last_core >= 0 && static_cast<size_t>(last_core) < cores.size()) {
+    target = static_cast<size_t>(last_core);
+  } else {
+    size_t best_load = 0;
+    for (size_t i = 0; i < cores.size(); ++i) {
+      size_t load = cores[i].queue->size() + (cores[i].running ? 1 : 0);
+      if (i == 0 || load < best_load) {
+        best_load = load;
+        target = i;
+      }
+    }
+  }
+
+  Core &core = cores[target];
+  core.queue->add_process(proc);
+  if (core.running && core.queue->should_preempt(*proc, *core.running)) {
+    core.preempt = true;
+  }
+}
+
+bool CPUScheduler::cores_have_work() const {
+  for (const auto &core : cores) {
+    if (core.running || core.queue->has_processes()) {
       return true;
+    }
+  }
   return false;
 }
 
-int CPUScheduler::get_current_time() const { return current_time; }
-int CPUScheduler::get_context_switches() const { return context_switches; }
+void CPUScheduler::reset_cores() {
+  for (auto &core : cores) {
+    if (core.queue) {
+      core.queue->clear();
+    }
+    core.running = nullptr;
+    core.last_pid = -1;
+    core.slice_used = 0;
+    core.quantum = 0;
+    core.migration_left = 0;
+    core.remote_left = 0;
+    core.preempt = false;
+    core.busy_ticks = 0;
+    core.context_switches = 0;
+    core.migrations = 0;
+    core.steals = 0;
+  }
+}
+
+std::vector<CPUScheduler::CoreStats> CPUScheduler::get_core_stats() const {
+  std::vector<CoreStats> stats;
+  stats.reserve(cores.size());
+  for (const auto &core : cores) {
+    stats.push_back(
+        {core.busy_ticks, core.context_switches, core.migrations, core.steals});
+  }
+  return stats;
+}
+
+void CPUScheduler::log_core_summaries() {
+  if (!metrics_collector || !metrics_collector->is_enabled()) {
+    return;
+  }
+  if (cores.empty()) {
+    return;
+  }
+  // Los ticks siguen en el búfer circular: se vuelcan antes del resumen.
+  metrics_collector->flush_all();
+  for (size_t i = 0; i < cores.size(); ++i) {
+    const Core &core = cores[i];
+    metrics_collector->log_core_summary(static_cast<int>(i), current_time,
+                                        core.busy_ticks,
+                                        core.context_switches,
+                                        core.migrations, core.steals);
+  }
+}
+
+bool CPUScheduler::has_pending_processes() const {
+  return active_process_count > 0 ||
+         (process_stream && !process_stream->done());
+}
+
+Tick CPUScheduler::get_current_time() const { return current_time; }
+int64_t CPUScheduler::get_context_switches() const {
+  return context_switches;
+}
 
 const std::vector<std::shared_ptr<Process>> &
 CPUScheduler::get_completed_processes() const {
   return completed_processes;
 }
 
+size_t CPUScheduler::get_completed_count() const { return completed_count; }
+
 const std::vector<std::shared_ptr<Process>> &
 CPUScheduler::get_all_processes() const {
   return all_processes;
 }
 
 double CPUScheduler::get_average_waiting_time() const {
-  if (completed_processes.empty())
-    return 0.0;
-  int total = 0;
-  for (const auto &proc : completed_processes)
-    total += proc->waiting_time;
-  return static_cast<double>(total) / completed_processes.size();
+  return latency_stats.waiting().mean();
 }
 
 double CPUScheduler::get_average_turnaround_time() const {
-  if (completed_processes.empty())
-    return 0.0;
-  int total = 0;
-  for (const auto &proc : completed_processes)
-    total += proc->turnaround_time;
-  return static_cast<double>(total) / completed_processes.size();
+  return latency_stats.turnaround().mean();
 }
 
 double CPUScheduler::get_average_response_time() const {
-  if (completed_processes.empty())
-    return 0.0;
-  int total = 0;
-  for (const auto &proc : completed_processes)
-    total += proc->response_time;
-  return static_cast<double>(total) / completed_processes.size();
+  return latency_stats.response().mean();
+}
+
+std::vector<LatencySummary> CPUScheduler::get_latency_summaries() const {
+  auto rows = latency_stats.summarize();
+  if (io_manager) {
+    for (const auto &[name, device] : io_manager->get_all_devices()) {
+      auto delay = device->get_queue_delay();
+      if (delay.count() > 0)
+        rows.push_back(LatencySummary::from(LatencySummary::Scope::DEVICE,
+                                            name, "queue_delay", delay));
+    }
+  }
+  return rows;
+}
+
+void CPUScheduler::record_completion(const std::shared_ptr<Process> &proc) {
+  if (!release_completed)
+    completed_processes.push_back(proc);
+  completed_count++;
+  latency_stats.record(proc->priority, proc->waiting_time,
+                       proc->turnaround_time, proc->response_time);
+
+  // Un proceso migrado puede tener datos en la cola de varios núcleos.
+  if (cores.empty()) {
+    scheduler->on_process_exit(proc->pid);
+  } else {
+    for (auto &core : cores)
+      core.queue->on_process_exit(proc->pid);
+  }
+}
+
+void CPUScheduler::publish_live_stats() {
+  if (!live_stats)
+    return;
+
+  // Solo escrituras relajadas: el exportador lee sin sincronizarse con el
+  // paso y tolera valores de pasos distintos en una misma muestra.
+  constexpr auto relaxed = std::memory_order_relaxed;
+  auto in_state = [this](ProcessState state) {
+    return static_cast<int64_t>(
+        state_members[static_cast<size_t>(state)].size());
+  };
+  LiveStats &stats = *live_stats;
+  stats.tick.store(current_time, relaxed);
+  stats.cpu_busy_ticks.store(total_cpu_time, relaxed);
+  stats.ready.store(static_cast<int64_t>(get_ready_queue_size()), relaxed);
+  stats.memory_waiting.store(in_state(ProcessState::MEMORY_WAITING), relaxed);
+  stats.io_waiting.store(in_state(ProcessState::WAITING), relaxed);
+  // Los terminados ya liberados no están en la tabla pero sí en la cuenta.
+  auto seen = static_cast<int64_t>(completed_count + all_processes.size());
+  stats.arrived.store(seen - in_state(ProcessState::NEW) -
+                          in_state(ProcessState::TERMINATED),
+                      relaxed);
+  stats.completed.store(static_cast<int64_t>(completed_count), relaxed);
+  stats.context_switches.store(context_switches, relaxed);
+  if (memory_manager)
+    stats.page_faults.store(memory_manager->get_total_page_faults(), relaxed);
+  for (const auto &[device, counters] : live_devices) {
+    counters->busy_ticks.store(device->get_total_io_time(), relaxed);
+    counters->queue.store(static_cast<int64_t>(device->get_queue_size()),
+                          relaxed);
+  }
+}
+
+void CPUScheduler::start_aggregate_samples() {
+  aggregate_devices.clear();
+  if (!metrics_collector || !metrics_collector->aggregates_enabled())
+    return;
+  if (io_manager) {
+    for (const auto &[name, device] : io_manager->get_all_devices())
+      aggregate_devices.push_back(device);
+  }
+  collect_aggregate_sample();
+}
+
+void CPUScheduler::collect_aggregate_sample() {
+  if (!metrics_collector || !metrics_collector->aggregates_enabled())
+    return;
+
+  auto in_state = [this](ProcessState state) {
+    return static_cast<int>(state_members[static_cast<size_t>(state)].size());
+  };
+  AggregateSample sample;
+  sample.tick = current_time;
+  sample.cores = get_core_count();
+  sample.busy_ticks = total_cpu_time;
+  sample.context_switches = context_switches;
+  if (memory_manager)
+    sample.page_faults = memory_manager->get_total_page_faults();
+  for (const auto &device : aggregate_devices)
+    sample.io_completions += device->get_total_requests_completed();
+  sample.completed = static_cast<int64_t>(completed_count);
+  sample.ready = static_cast<int>(get_ready_queue_size());
+  sample.blocked_memory = in_state(ProcessState::MEMORY_WAITING);
+  sample.blocked_io = in_state(ProcessState::WAITING);
+  metrics_collector->log_aggregate_sample(sample);
 }
 
 void CPUScheduler::reset() {
   terminate_all_threads();
   for (auto &proc : all_processes)
     proc->reset();
+  rebuild_state_tracking();
   completed_processes.clear();
+  completed_processes.reserve(all_processes.size());
+  latency_stats.clear();
+  completed_count = 0;
   current_time = 0;
   context_switches = 0;
   running_process = nullptr;
@@ -403,34 +1191,45 @@ void CPUScheduler::reset() {
   last_tick_was_idle = false;
   if (scheduler)
     scheduler->clear();
+  reset_cores();
 }
 
-void CPUScheduler::spawn_process_thread(std::shared_ptr<Process> proc) {
+void CPUScheduler::spawn_process_thread(const std::shared_ptr<Process> &proc) {
+  if (execution_mode == ExecutionMode::INLINE)
+    return;
   if (!proc->is_thread_running())
     proc->start_thread();
 }
 
-void CPUScheduler::notify_process_running(std::shared_ptr<Process> proc) {
+void CPUScheduler::notify_process_running(
+    const std::shared_ptr<Process> &proc) {
   if (!proc)
     return;
+  OSSIM_PROFILE_SCOPE("cpu.handshake");
   std::lock_guard<std::mutex> lock(proc->process_mutex);
 
   ProcessState old_state = proc->state.load();
   proc->state = ProcessState::RUNNING;
   proc->step_complete = false;
   proc->state_cv.notify_all();
+  sync_process_state(*proc);
 
   if (metrics_collector && metrics_collector->is_enabled() &&
       old_state != ProcessState::RUNNING) {
-    metrics_collector->log_state_transition(current_time, proc->pid, proc->name,
-                                            old_state, ProcessState::RUNNING,
-                                            "scheduled");
+    metrics_collector->log_state_transition(
+        current_time, proc->pid, proc->name_id, old_state,
+        ProcessState::RUNNING, "scheduled");
   }
 }
 
-void CPUScheduler::wait_for_process_step(std::shared_ptr<Process> proc) {
+void CPUScheduler::wait_for_process_step(const std::shared_ptr<Process> &proc) {
   if (!proc)
     return;
+  OSSIM_PROFILE_SCOPE("cpu.handshake");
+  if (execution_mode == ExecutionMode::INLINE) {
+    proc->step_complete = false;
+    return;
+  }
   std::unique_lock<std::mutex> lock(proc->process_mutex);
   bool step_done =
       proc->state_cv.wait_for(lock, std::chrono::milliseconds(1000),
@@ -448,13 +1247,19 @@ void CPUScheduler::wait_for_process_step(std::shared_ptr<Process> proc) {
   proc->step_complete = false;
 }
 
-void CPUScheduler::handle_io_completion(std::shared_ptr<Process> proc,
-                                        int completion_time) {
+void CPUScheduler::handle_io_completions(
+    const std::vector<IOCompletion> &completions) {
+  OSSIM_PROFILE_SCOPE("cpu.io_completions");
+  for (const auto &completion : completions) {
+    handle_io_completion(completion.process, completion.completion_time);
+  }
+}
+
+void CPUScheduler::handle_io_completion(const std::shared_ptr<Process> &proc,
+                                        Tick completion_time) {
   if (!proc)
     return;
 
-  std::lock_guard<std::mutex> lock(scheduler_mutex);
-
   auto *burst = proc->get_current_burst_mutable();
   if (burst && burst->type == BurstType::IO) {
     burst->remaining_time = 0;
@@ -467,97 +1272,289 @@ void CPUScheduler::handle_io_completion(std::shared_ptr<Process> proc,
     proc->calculate_metrics();
     proc->stop_thread();
     ProcessState old_state = proc->state.load();
-    proc->state = ProcessState::TERMINATED;
-    completed_processes.push_back(proc);
+    set_process_state(proc, ProcessState::TERMINATED);
+    record_completion(proc);
 
     if (metrics_collector && metrics_collector->is_enabled()) {
       metrics_collector->log_state_transition(
-          completion_time, proc->pid, proc->name, old_state,
+          completion_time, proc->pid, proc->name_id, old_state,
           ProcessState::TERMINATED, "io_completed");
       send_queue_snapshot(completion_time);
     }
   } else {
     ProcessState old_state = proc->state.load();
-    proc->state = ProcessState::READY;
-    if (scheduler) {
+    set_process_state(proc, ProcessState::READY);
+    if (!cores.empty()) {
+      enqueue_on_core(proc);
+    } else if (scheduler) {
       scheduler->add_process(proc);
       request_preemption_if_needed(proc);
     }
 
     if (metrics_collector && metrics_collector->is_enabled()) {
       metrics_collector->log_state_transition(
-          completion_time, proc->pid, proc->name, old_state,
+          completion_time, proc->pid, proc->name_id, old_state,
           ProcessState::READY, "io_completed");
       send_queue_snapshot(completion_time);
     }
   }
 }
 
-void CPUScheduler::handle_memory_ready(std::shared_ptr<Process> proc) {
+void CPUScheduler::handle_memory_ready(const std::shared_ptr<Process> &proc,
+                                       Tick ready_time) {
   if (!proc)
     return;
 
-  std::lock_guard<std::mutex> lock(scheduler_mutex);
   if (!scheduler || proc->state == ProcessState::TERMINATED)
     return;
 
   ProcessState old_state = proc->state.load();
-  proc->state = ProcessState::READY;
-  scheduler->remove_process(proc->pid);
-  scheduler->add_process(proc);
-  request_preemption_if_needed(proc);
+  set_process_state(proc, ProcessState::READY);
+  if (!cores.empty()) {
+    enqueue_on_core(proc);
+  } else {
+    scheduler->remove_process(proc->pid);
+    scheduler->add_process(proc);
+    request_preemption_if_needed(proc);
+  }
 
   if (metrics_collector && metrics_collector->is_enabled()) {
-    metrics_collector->log_state_transition(current_time, proc->pid, proc->name,
+    // Tras un paso con CPU el reloj ya avanzó hasta su final; en un salto
+    // del motor por eventos aún marca su inicio, antes de la carga.
+    Tick time = std::max(current_time, ready_time);
+    metrics_collector->log_state_transition(time, proc->pid, proc->name_id,
                                             old_state, ProcessState::READY,
                                             "memory_loaded");
-    send_queue_snapshot();
+    send_queue_snapshot(time);
   }
 }
 
-void CPUScheduler::advance_memory_manager(int time_slice, int step_start_time,
-                                          std::unique_lock<std::mutex> &lock) {
+void CPUScheduler::advance_memory_manager(Tick time_slice,
+                                          Tick step_start_time) {
   if (!memory_manager || time_slice <= 0)
     return;
 
-  lock.unlock();
   memory_manager->advance_fault_queue(time_slice, step_start_time);
-  lock.lock();
 }
 
-void CPUScheduler::advance_io_devices(int time_slice, int step_start_time,
-                                      std::unique_lock<std::mutex> &lock) {
+void CPUScheduler::advance_io_devices(Tick time_slice, Tick step_start_time) {
   if (!io_manager || time_slice <= 0)
     return;
 
-  lock.unlock();
   io_manager->execute_all_devices(time_slice, step_start_time);
-  lock.lock();
 }
 
-void CPUScheduler::request_preemption_if_needed(std::shared_ptr<Process> proc) {
+void CPUScheduler::request_preemption_if_needed(
+    const std::shared_ptr<Process> &proc) {
   if (!scheduler || !proc || !running_process)
     return;
 
-  switch (scheduler->get_algorithm()) {
-  case SchedulingAlgorithm::ROUND_ROBIN:
+  if (scheduler->yields_on_ready() ||
+      scheduler->should_preempt(*proc, *running_process)) {
     pending_preemption = true;
-    break;
-  case SchedulingAlgorithm::PRIORITY:
-    if (should_preempt_priority(proc)) {
-      pending_preemption = true;
+  }
+}
+
+bool CPUScheduler::is_time_sliced() const {
+  return scheduler && scheduler->is_time_sliced();
+}
+
+bool CPUScheduler::is_preemptive() const {
+  return scheduler && scheduler->is_preemptive();
+}
+
+int CPUScheduler::quantum_for(const Scheduler &queue, const Process &proc,
+                              int quantum) const {
+  int own = queue.get_quantum(proc);
+  if (quantum <= 0)
+    return own;
+  return own > 0 ? std::min(quantum, own) : quantum;
+}
+
+bool CPUScheduler::core_quantum_expired(const Core &core) const {
+  return is_time_sliced() && core.quantum > 0 &&
+         core.slice_used >= core.quantum;
+}
+
+Tick CPUScheduler::get_next_event_time() const {
+  Tick next = -1;
+  auto consider = [&next](Tick time) {
+    if (time >= 0 && (next < 0 || time < next)) {
+      next = time;
     }
-    break;
-  default:
-    break;
+  };
+
+  // Una admisión diferida solo cambia al terminar un proceso o al ejecutar,
+  // que ya son eventos.
+  if (!arrived_new.empty() && !admission_deferred) {
+    consider(current_time);
+  }
+  if (arrival_cursor < arrival_order.size()) {
+    size_t next_arrival = arrival_order[arrival_cursor];
+    consider(std::max(process_table.arrival_times[next_arrival], current_time));
+  }
+  if (process_stream && !process_stream->done()) {
+    consider(std::max(process_stream->peek_arrival(), current_time));
+  }
+
+  if (memory_manager) {
+    Tick load_completion = memory_manager->get_next_event_time(current_time);
+    if (load_completion >= 0) {
+      consider(load_completion + 1);
+    }
+  }
+
+  if (io_manager) {
+    consider(io_manager->get_next_event_time(current_time));
   }
+
+  return next;
 }
 
-bool CPUScheduler::should_preempt_priority(
-    std::shared_ptr<Process> candidate) const {
-  if (!candidate || !running_process)
-    return false;
-  return candidate->priority < running_process->priority;
+void CPUScheduler::rebuild_state_tracking() {
+  process_table.clear();
+  process_index.clear();
+  for (auto &members : state_members) {
+    members.clear();
+  }
+  active_process_count = 0;
+  arrival_order.clear();
+  arrival_cursor = 0;
+  arrived_new.clear();
+  admission_deferred = false;
+  // Los conjuntos se dimensionan para toda la carga: los cambios de estado
+  // de los ticks siguientes no reservan memoria.
+  for (auto &members : state_members) {
+    members.reserve(all_processes.size());
+  }
+  arrived_new.reserve(all_processes.size());
+  for (const auto &proc : all_processes) {
+    track_new_process(proc);
+  }
+}
+
+void CPUScheduler::release_terminated() {
+  const auto &terminated =
+      state_members[static_cast<size_t>(ProcessState::TERMINATED)];
+  if (terminated.size() * 2 <= process_table.size())
+    return;
+
+  // Compactación estable: los procesos conservados mantienen su orden, así
+  // los recorridos por posición (instantáneas de colas, llegadas) no cambian.
+  std::vector<size_t> moved(process_table.size(), IndexSet::npos);
+  size_t kept = 0;
+  for (size_t index = 0; index < process_table.size(); ++index) {
+    if (process_table.states[index] == ProcessState::TERMINATED)
+      continue;
+    moved[index] = kept;
+    all_processes[kept] = std::move(all_processes[index]);
+    process_table.pids[kept] = process_table.pids[index];
+    process_table.arrival_times[kept] = process_table.arrival_times[index];
+    process_table.states[kept] = process_table.states[index];
+    process_table.cores[kept] = process_table.cores[index];
+    kept++;
+  }
+  all_processes.resize(kept);
+  process_table.pids.resize(kept);
+  process_table.arrival_times.resize(kept);
+  process_table.states.resize(kept);
+  process_table.cores.resize(kept);
+
+  process_index.clear();
+  for (auto &members : state_members)
+    members.clear();
+  for (size_t index = 0; index < kept; ++index) {
+    process_index[all_processes[index].get()] = index;
+    state_members[static_cast<size_t>(process_table.states[index])].insert(
+        index);
+  }
+
+  // Las llegadas ya alcanzadas no se vuelven a leer: se descartan.
+  size_t pending = 0;
+  for (size_t i = arrival_cursor; i < arrival_order.size(); ++i) {
+    if (moved[arrival_order[i]] != IndexSet::npos)
+      arrival_order[pending++] = moved[arrival_order[i]];
+  }
+  arrival_order.resize(pending);
+  arrival_cursor = 0;
+
+  IndexSet waiting;
+  for (size_t index : arrived_new)
+    waiting.insert(moved[index]);
+  arrived_new = std::move(waiting);
+}
+
+void CPUScheduler::track_new_process(const std::shared_ptr<Process> &proc) {
+  size_t index = process_table.size();
+  ProcessState state = proc->state.load();
+  process_table.pids.push_back(proc->pid);
+  process_table.arrival_times.push_back(proc->arrival_time);
+  process_table.states.push_back(state);
+  process_table.cores.push_back(-1);
+  process_index[proc.get()] = index;
+  state_members[static_cast<size_t>(state)].insert(index);
+  if (state != ProcessState::TERMINATED) {
+    active_process_count++;
+  }
+  if (state == ProcessState::NEW) {
+    index_arrival(index);
+  }
+}
+
+void CPUScheduler::index_arrival(size_t index) {
+  Tick arrival = process_table.arrival_times[index];
+  auto position = std::upper_bound(
+      arrival_order.begin() + arrival_cursor, arrival_order.end(), arrival,
+      [this](Tick time, size_t other) {
+        return time < process_table.arrival_times[other];
+      });
+  arrival_order.insert(position, index);
+}
+
+void CPUScheduler::sync_process_state(const Process &proc) {
+  auto it = process_index.find(&proc);
+  if (it == process_index.end()) {
+    return;
+  }
+
+  size_t index = it->second;
+  ProcessState old_state = process_table.states[index];
+  ProcessState new_state = proc.state.load();
+  if (old_state == new_state) {
+    return;
+  }
+
+  state_members[static_cast<size_t>(old_state)].erase(index);
+  state_members[static_cast<size_t>(new_state)].insert(index);
+  process_table.states[index] = new_state;
+
+  if (old_state == ProcessState::NEW) {
+    arrived_new.erase(index);
+  } else if (new_state == ProcessState::NEW) {
+    index_arrival(index);
+  }
+
+  if (old_state == ProcessState::TERMINATED) {
+    active_process_count++;
+  } else if (new_state == ProcessState::TERMINATED) {
+    active_process_count--;
+  }
+}
+
+void CPUScheduler::set_process_state(const std::shared_ptr<Process> &proc,
+                                     ProcessState new_state) {
+  proc->state = new_state;
+  sync_process_state(*proc);
+}
+
+void CPUScheduler::get_pids_in_state(ProcessState state,
+                                     std::vector<int> &pids) const {
+  const auto &members = state_members[static_cast<size_t>(state)];
+  pids.clear();
+  pids.reserve(members.size());
+  for (size_t index : members) {
+    pids.push_back(process_table.pids[index]);
+  }
 }
 
 void CPUScheduler::terminate_all_threads() {
@@ -574,7 +1571,9 @@ double CPUScheduler::get_cpu_utilization() const {
   if (current_time == 0) {
     return 0.0;
   }
-  return (static_cast<double>(total_cpu_time) / current_time) * 100.0;
+  return (static_cast<double>(total_cpu_time) /
+          (static_cast<double>(current_time) * get_core_count())) *
+         100.0;
 }
 
 std::string CPUScheduler::get_algorithm_name() const {
@@ -587,16 +1586,29 @@ std::string CPUScheduler::get_algorithm_name() const {
     return "FCFS";
   case SchedulingAlgorithm::SJF:
     return "SJF";
+  case SchedulingAlgorithm::SRTF:
+    return "SRTF";
   case SchedulingAlgorithm::ROUND_ROBIN:
     return "ROUND_ROBIN";
   case SchedulingAlgorithm::PRIORITY:
     return "PRIORITY";
+  case SchedulingAlgorithm::MLFQ:
+    return "MLFQ";
+  case SchedulingAlgorithm::CFS:
+    return "CFS";
   default:
     return "UNKNOWN";
   }
 }
 
 size_t CPUScheduler::get_ready_queue_size() const {
+  if (!cores.empty()) {
+    size_t total = 0;
+    for (const auto &core : cores) {
+      total += core.queue->size();
+    }
+    return total;
+  }
   if (!scheduler) {
     return 0;
   }
@@ -605,35 +1617,28 @@ size_t CPUScheduler::get_ready_queue_size() const {
 
 std::vector<int> CPUScheduler::get_ready_queue_pids() const {
   std::vector<int> pids;
-  for (const auto &proc : all_processes) {
-    if (proc->state == ProcessState::READY) {
-      pids.push_back(proc->pid);
-    }
-  }
+  get_pids_in_state(ProcessState::READY, pids);
   return pids;
 }
 
 std::vector<int> CPUScheduler::get_memory_waiting_pids() const {
   std::vector<int> pids;
-  for (const auto &proc : all_processes) {
-    if (proc->state == ProcessState::MEMORY_WAITING) {
-      pids.push_back(proc->pid);
-    }
-  }
+  get_pids_in_state(ProcessState::MEMORY_WAITING, pids);
   return pids;
 }
 
 std::vector<int> CPUScheduler::get_io_waiting_pids() const {
   std::vector<int> pids;
-  for (const auto &proc : all_processes) {
-    if (proc->state == ProcessState::WAITING) {
-      pids.push_back(proc->pid);
-    }
-  }
+  get_pids_in_state(ProcessState::WAITING, pids);
   return pids;
 }
 
 int CPUScheduler::get_running_pid() const {
+  for (const auto &core : cores) {
+    if (core.running && core.running->state == ProcessState::RUNNING) {
+      return core.running->pid;
+    }
+  }
   if (running_process && running_process->state == ProcessState::RUNNING) {
     return running_process->pid;
   }
@@ -641,19 +1646,22 @@ int CPUScheduler::get_running_pid() const {
 }
 
 void CPUScheduler::send_cpu_metrics(const std::string &event,
-                                    std::shared_ptr<Process> proc,
+                                    const std::shared_ptr<Process> &proc,
                                     bool context_switch) {
-  if (!metrics_collector || !metrics_collector->is_enabled()) {
+  if (!metrics_collector ||
+      !metrics_collector->should_log(MetricsCollector::CATEGORY_CPU,
+                                     current_time)) {
     return;
   }
+  OSSIM_PROFILE_SCOPE("cpu.metrics");
 
   int pid = -1;
-  std::string name;
-  int remaining = 0;
+  NameId name = NameTable::EMPTY;
+  Tick remaining = 0;
 
   if (proc) {
     pid = proc->pid;
-    name = proc->name;
+    name = proc->name_id;
 
     auto *current_burst = proc->get_current_burst_mutable();
     if (current_burst && current_burst->type == BurstType::CPU) {
@@ -668,31 +1676,32 @@ void CPUScheduler::send_cpu_metrics(const std::string &event,
 }
 
 void CPUScheduler::send_queue_snapshot() {
-  if (!metrics_collector || !metrics_collector->is_enabled()) {
+  if (!metrics_collector ||
+      !metrics_collector->should_log(MetricsCollector::CATEGORY_QUEUES,
+                                     current_time)) {
     return;
   }
 
-  auto ready_pids = get_ready_queue_pids();
-  auto memory_pids = get_memory_waiting_pids();
-  auto io_pids = get_io_waiting_pids();
-  int running_pid = get_running_pid();
-
-  metrics_collector->log_queue_snapshot(current_time, ready_pids, memory_pids,
-                                        io_pids, running_pid);
+  write_queue_snapshot(current_time);
 }
 
-void CPUScheduler::send_queue_snapshot(int tick) {
-  if (!metrics_collector || !metrics_collector->is_enabled()) {
+void CPUScheduler::send_queue_snapshot(Tick tick) {
+  if (!metrics_collector ||
+      !metrics_collector->should_log(MetricsCollector::CATEGORY_QUEUES, tick)) {
     return;
   }
+  OSSIM_PROFILE_SCOPE("cpu.metrics");
 
-  auto ready_pids = get_ready_queue_pids();
-  auto memory_pids = get_memory_waiting_pids();
-  auto io_pids = get_io_waiting_pids();
-  int running_pid = get_running_pid();
+  write_queue_snapshot(tick);
+}
 
+void CPUScheduler::write_queue_snapshot(Tick tick) {
+  auto &[ready_pids, memory_pids, io_pids] = queue_pids;
+  get_pids_in_state(ProcessState::READY, ready_pids);
+  get_pids_in_state(ProcessState::MEMORY_WAITING, memory_pids);
+  get_pids_in_state(ProcessState::WAITING, io_pids);
   metrics_collector->log_queue_snapshot(tick, ready_pids, memory_pids, io_pids,
-                                        running_pid);
+                                        get_running_pid());
 }
 
 } // namespace OSSimulator
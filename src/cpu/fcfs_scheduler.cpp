@@ -1,8 +1,9 @@
 #include "cpu/fcfs_scheduler.hpp"
+#include "core/snapshot.hpp"
 
 namespace OSSimulator {
 
-void FCFSScheduler::add_process(std::shared_ptr<Process> process) {
+void FCFSScheduler::add_process(const std::shared_ptr<Process> &process) {
   ready_queue.push_back(process);
 }
 
@@ -13,6 +14,13 @@ std::shared_ptr<Process> FCFSScheduler::get_next_process() {
   return ready_queue.front();
 }
 
+std::shared_ptr<Process> FCFSScheduler::get_last_process() {
+  if (ready_queue.empty()) {
+    return nullptr;
+  }
+  return ready_queue.back();
+}
+
 bool FCFSScheduler::has_processes() const { return !ready_queue.empty(); }
 
 void FCFSScheduler::remove_process(int pid) {
@@ -32,4 +40,16 @@ SchedulingAlgorithm FCFSScheduler::get_algorithm() const {
   return SchedulingAlgorithm::FCFS;
 }
 
+std::unique_ptr<Scheduler> FCFSScheduler::create_empty() const {
+  return std::make_unique<FCFSScheduler>();
+}
+
+void FCFSScheduler::save_state(SnapshotWriter &out) const {
+  out.put_processes(ready_queue);
+}
+
+void FCFSScheduler::load_state(SnapshotReader &in) {
+  in.get_processes(ready_queue);
+}
+
 } // namespace OSSimulator
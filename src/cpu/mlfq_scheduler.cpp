@@ -0,0 +1,229 @@
+#include "cpu/mlfq_scheduler.hpp"
+#include "core/snapshot.hpp"
+#include <algorithm>
+
+namespace OSSimulator {
+
+namespace {
+
+int lowest_bit(uint64_t word) {
+#if defined(__GNUC__) || defined(__clang__)
+  return __builtin_ctzll(word);
+#else
+  int bit = 0;
+  while ((word & 1ULL) == 0) {
+    word >>= 1;
+    ++bit;
+  }
+  return bit;
+#endif
+}
+
+int highest_bit(uint64_t word) {
+#if defined(__GNUC__) || defined(__clang__)
+  return 63 - __builtin_clzll(word);
+#else
+  int bit = 63;
+  while ((word & (1ULL << bit)) == 0)
+    --bit;
+  return bit;
+#endif
+}
+
+} // namespace
+
+MLFQScheduler::MLFQScheduler(std::vector<int> quanta, int boost_interval)
+    : quanta(std::move(quanta)), boost_interval(std::max(0, boost_interval)),
+      next_boost(this->boost_interval) {
+  if (this->quanta.empty())
+    this->quanta.push_back(1);
+  if (this->quanta.size() > static_cast<size_t>(MAX_LEVELS))
+    this->quanta.resize(MAX_LEVELS);
+  for (int &quantum : this->quanta)
+    quantum = std::max(1, quantum);
+  levels.resize(this->quanta.size());
+}
+
+void MLFQScheduler::push(const std::shared_ptr<Process> &process,
+                         Entry &entry) {
+  levels[entry.level].push_back(process);
+  non_empty |= 1ULL << entry.level;
+  entry.queued = true;
+  ++count;
+}
+
+std::shared_ptr<Process> MLFQScheduler::unlink(int pid, Entry &entry) {
+  if (!entry.queued)
+    return nullptr;
+  auto &queue = levels[entry.level];
+  auto it = std::find_if(queue.begin(), queue.end(),
+                         [pid](const auto &process) {
+                           return process->pid == pid;
+                         });
+  if (it == queue.end())
+    return nullptr;
+  std::shared_ptr<Process> process = *it;
+  queue.erase(it);
+  if (queue.empty())
+    non_empty &= ~(1ULL << entry.level);
+  entry.queued = false;
+  --count;
+  return process;
+}
+
+void MLFQScheduler::add_process(const std::shared_ptr<Process> &process) {
+  Entry &entry = entries[process->pid];
+  unlink(process->pid, entry);
+  push(process, entry);
+}
+
+std::shared_ptr<Process> MLFQScheduler::get_next_process() {
+  if (non_empty == 0)
+    return nullptr;
+  return levels[lowest_bit(non_empty)].front();
+}
+
+std::shared_ptr<Process> MLFQScheduler::get_last_process() {
+  if (non_empty == 0)
+    return nullptr;
+  return levels[highest_bit(non_empty)].back();
+}
+
+bool MLFQScheduler::has_processes() const { return count > 0; }
+
+void MLFQScheduler::remove_process(int pid) {
+  auto it = entries.find(pid);
+  if (it != entries.end())
+    unlink(pid, it->second);
+}
+
+size_t MLFQScheduler::size() const { return count; }
+
+void MLFQScheduler::clear() {
+  for (auto &queue : levels)
+    queue.clear();
+  entries.clear();
+  non_empty = 0;
+  count = 0;
+  next_boost = boost_interval;
+}
+
+SchedulingAlgorithm MLFQScheduler::get_algorithm() const {
+  return SchedulingAlgorithm::MLFQ;
+}
+
+std::unique_ptr<Scheduler> MLFQScheduler::create_empty() const {
+  return std::make_unique<MLFQScheduler>(quanta, boost_interval);
+}
+
+void MLFQScheduler::save_state(SnapshotWriter &out) const {
+  out.put_int(static_cast<int64_t>(levels.size()));
+  for (const auto &queue : levels)
+    out.put_processes(queue);
+  out.put_uint(entries.size());
+  for (const auto &[pid, entry] : entries) {
+    out.put_int(pid);
+    out.put_int(entry.level);
+    out.put_int(entry.used);
+    out.put_bool(entry.queued);
+  }
+  out.put_int(next_boost);
+}
+
+void MLFQScheduler::load_state(SnapshotReader &in) {
+  clear();
+  in.expect(static_cast<int64_t>(levels.size()), "niveles MLFQ");
+  for (size_t level = 0; level < levels.size(); ++level) {
+    in.get_processes(levels[level]);
+    if (!levels[level].empty())
+      non_empty |= 1ULL << level;
+    count += levels[level].size();
+  }
+  for (size_t i = in.get_count(); i > 0; --i) {
+    Entry &entry = entries[in.get_int()];
+    entry.level = in.get_int();
+    entry.used = in.get_int();
+    entry.queued = in.get_bool();
+  }
+  next_boost = in.get_int64();
+}
+
+int MLFQScheduler::get_quantum(const Process &process) const {
+  auto it = entries.find(process.pid);
+  if (it == entries.end())
+    return quanta.front();
+  return quanta[it->second.level] - it->second.used;
+}
+
+bool MLFQScheduler::should_preempt(const Process &candidate,
+                                   const Process &running) const {
+  return get_level(candidate.pid) < get_level(running.pid);
+}
+
+void MLFQScheduler::on_cpu_time(const Process &process, Tick ticks) {
+  auto it = entries.find(process.pid);
+  if (it == entries.end() || ticks <= 0)
+    return;
+
+  // Basta con sumar hasta el quantum: al alcanzarlo el consumo se reinicia.
+  Entry &entry = it->second;
+  entry.used += static_cast<int>(std::min<Tick>(ticks, quanta[entry.level]));
+  if (entry.used < quanta[entry.level])
+    return;
+
+  // El último nivel solo reinicia el consumo: es un Round Robin.
+  entry.used = 0;
+  if (entry.level + 1 >= static_cast<int>(levels.size()))
+    return;
+
+  // Un proceso en cola pasa al final de la cola del nivel inferior.
+  auto queued = unlink(process.pid, entry);
+  ++entry.level;
+  if (queued)
+    push(queued, entry);
+}
+
+void MLFQScheduler::on_process_exit(int pid) {
+  auto it = entries.find(pid);
+  if (it == entries.end())
+    return;
+  unlink(pid, it->second);
+  entries.erase(it);
+}
+
+void MLFQScheduler::advance_time(Tick current_time) {
+  if (boost_interval == 0 || current_time < next_boost)
+    return;
+  // Un salto largo del reloj puede cruzar muchas elevaciones: se avanza
+  // directamente a la primera posterior a current_time.
+  next_boost += ((current_time - next_boost) / boost_interval + 1) *
+                boost_interval;
+
+  // Se conserva el orden: primero los procesos de los niveles superiores.
+  for (size_t level = 1; level < levels.size(); ++level) {
+    auto &queue = levels[level];
+    for (auto &process : queue)
+      levels[0].push_back(std::move(process));
+    queue.clear();
+  }
+  non_empty = levels[0].empty() ? 0 : 1;
+  // Los procesos terminados ya se descartaron: el recorrido solo visita los
+  // que siguen en el sistema.
+  for (auto &entry : entries) {
+    entry.second.level = 0;
+    entry.second.used = 0;
+  }
+}
+
+int MLFQScheduler::get_level(int pid) const {
+  auto it = entries.find(pid);
+  return it == entries.end() ? 0 : it->second.level;
+}
+
+int MLFQScheduler::get_level_count() const {
+  return static_cast<int>(levels.size());
+}
+
+size_t MLFQScheduler::get_tracked_count() const { return entries.size(); }
+
+} // namespace OSSimulator
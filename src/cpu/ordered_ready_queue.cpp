@@ -0,0 +1,126 @@
+#include "cpu/ordered_ready_queue.hpp"
+#include "core/snapshot.hpp"
+#include <iterator>
+#include <stdexcept>
+#include <utility>
+
+namespace OSSimulator {
+
+bool OrderedReadyQueue::Entry::operator<(const Entry &other) const {
+  if (key != other.key) {
+    return key < other.key;
+  }
+  if (arrival_time != other.arrival_time) {
+    return arrival_time < other.arrival_time;
+  }
+  return sequence < other.sequence;
+}
+
+OrderedReadyQueue::OrderedReadyQueue(KeyFunction key)
+    : key_of(std::move(key)) {}
+
+void OrderedReadyQueue::refresh_last_front() {
+  if (last_front_pid < 0) {
+    return;
+  }
+  auto it = index.find(last_front_pid);
+  if (it == index.end() || it->second == entries.end()) {
+    return;
+  }
+  const Entry &entry = *it->second;
+  Tick key = key_of(*entry.proc);
+  if (entry.key == key) {
+    return;
+  }
+  auto node = entries.extract(it->second);
+  node.value().key = key;
+  it->second = entries.insert(std::move(node)).position;
+}
+
+void OrderedReadyQueue::push(const std::shared_ptr<Process> &process) {
+  if (!process) {
+    return;
+  }
+  refresh_last_front();
+  erase(process->pid);
+
+  Entry entry{key_of(*process), process->arrival_time, next_sequence++,
+              process};
+  auto &position = index[process->pid];
+  if (spare_entries.empty()) {
+    position = entries.insert(std::move(entry)).first;
+  } else {
+    spare_entries.back().value() = std::move(entry);
+    position = entries.insert(std::move(spare_entries.back())).position;
+    spare_entries.pop_back();
+  }
+}
+
+std::shared_ptr<Process> OrderedReadyQueue::front() {
+  if (entries.empty()) {
+    return nullptr;
+  }
+  refresh_last_front();
+  const auto &proc = entries.begin()->proc;
+  last_front_pid = proc->pid;
+  return proc;
+}
+
+std::shared_ptr<Process> OrderedReadyQueue::back() {
+  if (entries.empty()) {
+    return nullptr;
+  }
+  refresh_last_front();
+  return std::prev(entries.end())->proc;
+}
+
+void OrderedReadyQueue::erase(int pid) {
+  auto it = index.find(pid);
+  if (it == index.end() || it->second == entries.end()) {
+    return;
+  }
+  spare_entries.push_back(entries.extract(it->second));
+  spare_entries.back().value().proc.reset();
+  it->second = entries.end();
+}
+
+bool OrderedReadyQueue::empty() const { return entries.empty(); }
+
+size_t OrderedReadyQueue::size() const { return entries.size(); }
+
+void OrderedReadyQueue::clear() {
+  entries.clear();
+  index.clear();
+  last_front_pid = -1;
+}
+
+void OrderedReadyQueue::save_state(SnapshotWriter &out) const {
+  out.put_uint(entries.size());
+  for (const Entry &entry : entries) {
+    out.put_process(entry.proc);
+    out.put_int(entry.key);
+    out.put_int(entry.arrival_time);
+    out.put_uint(entry.sequence);
+  }
+  out.put_uint(next_sequence);
+  out.put_int(last_front_pid);
+}
+
+void OrderedReadyQueue::load_state(SnapshotReader &in) {
+  clear();
+  for (size_t i = in.get_count(); i > 0; --i) {
+    Entry entry;
+    entry.proc = in.get_process();
+    entry.key = in.get_int64();
+    entry.arrival_time = in.get_int64();
+    entry.sequence = in.get_uint();
+    if (!entry.proc)
+      throw std::runtime_error("Instantánea corrupta");
+    int pid = entry.proc->pid;
+    index[pid] = entries.insert(std::move(entry)).first;
+  }
+  next_sequence = in.get_uint();
+  last_front_pid = in.get_int();
+}
+
+} // namespace OSSimulator
@@ -1,44 +1,106 @@
 #include "cpu/priority_scheduler.hpp"
+#include "core/snapshot.hpp"
 #include <algorithm>
 
 namespace OSSimulator {
 
-void PriorityScheduler::add_process(std::shared_ptr<Process> process) {
-  ready_queue.push_back(process);
-  std::sort(
-      ready_queue.begin(), ready_queue.end(),
-      [](const std::shared_ptr<Process> &a, const std::shared_ptr<Process> &b) {
-        if (a->priority == b->priority) {
-          return a->arrival_time < b->arrival_time;
-        }
-        return a->priority < b->priority;
-      });
+PriorityScheduler::PriorityScheduler(int aging_interval)
+    : aging_interval(std::max(0, aging_interval)),
+      ready_queue([this](const Process &p) { return key_for(p); }) {}
+
+Tick PriorityScheduler::key_for(const Process &process) const {
+  if (aging_interval == 0) {
+    return process.priority;
+  }
+  auto it = ready_since.find(process.pid);
+  Tick since = it != ready_since.end() ? it->second : now;
+  return process.priority * aging_interval + since;
 }
 
-std::shared_ptr<Process> PriorityScheduler::get_next_process() {
-  if (ready_queue.empty()) {
-    return nullptr;
+void PriorityScheduler::add_process(const std::shared_ptr<Process> &process) {
+  if (aging_interval > 0) {
+    ready_since[process->pid] = now;
   }
+  ready_queue.push(process);
+}
+
+std::shared_ptr<Process> PriorityScheduler::get_next_process() {
   return ready_queue.front();
 }
 
+std::shared_ptr<Process> PriorityScheduler::get_last_process() {
+  return ready_queue.back();
+}
+
 bool PriorityScheduler::has_processes() const { return !ready_queue.empty(); }
 
-void PriorityScheduler::remove_process(int pid) {
-  for (auto it = ready_queue.begin(); it != ready_queue.end(); ++it) {
-    if ((*it)->pid == pid) {
-      ready_queue.erase(it);
-      return;
-    }
-  }
-}
+void PriorityScheduler::remove_process(int pid) { ready_queue.erase(pid); }
 
 size_t PriorityScheduler::size() const { return ready_queue.size(); }
 
-void PriorityScheduler::clear() { ready_queue.clear(); }
+void PriorityScheduler::clear() {
+  ready_queue.clear();
+  ready_since.clear();
+  now = 0;
+}
 
 SchedulingAlgorithm PriorityScheduler::get_algorithm() const {
   return SchedulingAlgorithm::PRIORITY;
 }
 
+std::unique_ptr<Scheduler> PriorityScheduler::create_empty() const {
+  return std::make_unique<PriorityScheduler>(aging_interval);
+}
+
+void PriorityScheduler::save_state(SnapshotWriter &out) const {
+  out.put_int(now);
+  out.put_uint(ready_since.size());
+  for (const auto &[pid, since] : ready_since) {
+    out.put_int(pid);
+    out.put_int(since);
+  }
+  ready_queue.save_state(out);
+}
+
+void PriorityScheduler::load_state(SnapshotReader &in) {
+  now = in.get_int64();
+  ready_since.clear();
+  for (size_t i = in.get_count(); i > 0; --i) {
+    int pid = in.get_int();
+    ready_since[pid] = in.get_int64();
+  }
+  ready_queue.load_state(in);
+}
+
+int PriorityScheduler::get_quantum(const Process & /*process*/) const {
+  return 1;
+}
+
+bool PriorityScheduler::should_preempt(const Process &candidate,
+                                       const Process &running) const {
+  return key_for(candidate) < key_for(running);
+}
+
+void PriorityScheduler::on_cpu_time(const Process &process, Tick ticks) {
+  // Ejecutar descuenta la espera acumulada tick a tick: el proceso conserva
+  // su prioridad efectiva mientras se ejecuta. La clave nueva se aplica
+  // cuando la cola vuelve a consultar el frente.
+  if (aging_interval > 0 && ticks > 0) {
+    auto it = ready_since.try_emplace(process.pid, now).first;
+    it->second += ticks;
+  }
+}
+
+void PriorityScheduler::advance_time(Tick current_time) { now = current_time; }
+
+int PriorityScheduler::get_effective_priority(const Process &process) const {
+  if (aging_interval == 0) {
+    return process.priority;
+  }
+  auto it = ready_since.find(process.pid);
+  Tick waited =
+      it != ready_since.end() ? std::max<Tick>(0, now - it->second) : 0;
+  return process.priority - static_cast<int>(waited / aging_interval);
+}
+
 } // namespace OSSimulator
@@ -1,10 +1,11 @@
 #include "cpu/round_robin_scheduler.hpp"
+#include "core/snapshot.hpp"
 
 namespace OSSimulator {
 
 RoundRobinScheduler::RoundRobinScheduler(int q) : quantum(q) {}
 
-void RoundRobinScheduler::add_process(std::shared_ptr<Process> process) {
+void RoundRobinScheduler::add_process(const std::shared_ptr<Process> &process) {
   ready_queue.push_back(process);
 }
 
@@ -15,6 +16,13 @@ std::shared_ptr<Process> RoundRobinScheduler::get_next_process() {
   return ready_queue.front();
 }
 
+std::shared_ptr<Process> RoundRobinScheduler::get_last_process() {
+  if (ready_queue.empty()) {
+    return nullptr;
+  }
+  return ready_queue.back();
+}
+
 bool RoundRobinScheduler::has_processes() const { return !ready_queue.empty(); }
 
 void RoundRobinScheduler::remove_process(int pid) {
@@ -39,10 +47,26 @@ void RoundRobinScheduler::clear() { ready_queue.clear(); }
 
 int RoundRobinScheduler::get_quantum() const { return quantum; }
 
+int RoundRobinScheduler::get_quantum(const Process & /*process*/) const {
+  return quantum;
+}
+
 void RoundRobinScheduler::set_quantum(int q) { quantum = q; }
 
 SchedulingAlgorithm RoundRobinScheduler::get_algorithm() const {
   return SchedulingAlgorithm::ROUND_ROBIN;
 }
 
+std::unique_ptr<Scheduler> RoundRobinScheduler::create_empty() const {
+  return std::make_unique<RoundRobinScheduler>(quantum);
+}
+
+void RoundRobinScheduler::save_state(SnapshotWriter &out) const {
+  out.put_processes(ready_queue);
+}
+
+void RoundRobinScheduler::load_state(SnapshotReader &in) {
+  in.get_processes(ready_queue);
+}
+
 } // namespace OSSimulator
@@ -1,44 +1,101 @@
 #include "cpu/sjf_scheduler.hpp"
+#include "core/snapshot.hpp"
 #include <algorithm>
+#include <cmath>
 
 namespace OSSimulator {
 
-void SJFScheduler::add_process(std::shared_ptr<Process> process) {
-  ready_queue.push_back(process);
-  std::sort(
-      ready_queue.begin(), ready_queue.end(),
-      [](const std::shared_ptr<Process> &a, const std::shared_ptr<Process> &b) {
-        if (a->remaining_time == b->remaining_time) {
-          return a->arrival_time < b->arrival_time;
-        }
-        return a->remaining_time < b->remaining_time;
-      });
+SJFScheduler::SJFScheduler(bool preemptive, BurstPrediction prediction,
+                           double alpha, int initial_estimate)
+    : preemptive(preemptive), prediction(prediction),
+      alpha(std::clamp(alpha, 0.0, 1.0)),
+      initial_estimate(std::max(1, initial_estimate)),
+      ready_queue([this](const Process &p) { return key_for(p); }) {}
+
+double SJFScheduler::predict_burst(const Process &process) const {
+  auto [it, inserted] = estimates.try_emplace(process.pid);
+  Estimate &estimate = it->second;
+  size_t done = std::min(process.current_burst_index,
+                         process.burst_sequence.size());
+  if (inserted || done < estimate.next_burst) {
+    estimate = Estimate{0, static_cast<double>(initial_estimate)};
+  }
+
+  // Se incorporan solo las ráfagas completadas desde la última consulta.
+  for (; estimate.next_burst < done; ++estimate.next_burst) {
+    const Burst &burst = process.burst_sequence[estimate.next_burst];
+    if (burst.type == BurstType::CPU) {
+      estimate.tau = alpha * burst.duration + (1.0 - alpha) * estimate.tau;
+    }
+  }
+  return estimate.tau;
 }
 
-std::shared_ptr<Process> SJFScheduler::get_next_process() {
-  if (ready_queue.empty()) {
-    return nullptr;
+Tick SJFScheduler::key_for(const Process &process) const {
+  if (prediction == BurstPrediction::ORACLE) {
+    return process.remaining_time;
+  }
+
+  Tick executed = process.burst_time - process.remaining_time;
+  if (!process.burst_sequence.empty()) {
+    const Burst *burst = process.get_current_burst();
+    executed = burst && burst->type == BurstType::CPU
+                   ? burst->duration - burst->remaining_time
+                   : 0;
   }
+  Tick predicted = std::llround(predict_burst(process));
+  return std::max<Tick>(0, predicted - executed);
+}
+
+void SJFScheduler::add_process(const std::shared_ptr<Process> &process) {
+  ready_queue.push(process);
+}
+
+std::shared_ptr<Process> SJFScheduler::get_next_process() {
   return ready_queue.front();
 }
 
+std::shared_ptr<Process> SJFScheduler::get_last_process() {
+  return ready_queue.back();
+}
+
 bool SJFScheduler::has_processes() const { return !ready_queue.empty(); }
 
-void SJFScheduler::remove_process(int pid) {
-  for (auto it = ready_queue.begin(); it != ready_queue.end(); ++it) {
-    if ((*it)->pid == pid) {
-      ready_queue.erase(it);
-      return;
-    }
-  }
-}
+void SJFScheduler::remove_process(int pid) { ready_queue.erase(pid); }
 
 size_t SJFScheduler::size() const { return ready_queue.size(); }
 
-void SJFScheduler::clear() { ready_queue.clear(); }
+void SJFScheduler::clear() {
+  ready_queue.clear();
+  estimates.clear();
+}
 
 SchedulingAlgorithm SJFScheduler::get_algorithm() const {
-  return SchedulingAlgorithm::SJF;
+  return preemptive ? SchedulingAlgorithm::SRTF : SchedulingAlgorithm::SJF;
+}
+
+std::unique_ptr<Scheduler> SJFScheduler::create_empty() const {
+  return std::make_unique<SJFScheduler>(preemptive, prediction, alpha,
+                                        initial_estimate);
+}
+
+void SJFScheduler::save_state(SnapshotWriter &out) const {
+  ready_queue.save_state(out);
+}
+
+void SJFScheduler::load_state(SnapshotReader &in) {
+  // Las estimaciones se recalculan con el historial de ráfagas restaurado.
+  estimates.clear();
+  ready_queue.load_state(in);
+}
+
+int SJFScheduler::get_quantum(const Process & /*process*/) const {
+  return preemptive ? 1 : 0;
+}
+
+bool SJFScheduler::should_preempt(const Process &candidate,
+                                  const Process &running) const {
+  return preemptive && key_for(candidate) < key_for(running);
 }
 
 } // namespace OSSimulator
@@ -0,0 +1,17 @@
+#include "io/io_clook_scheduler.hpp"
+
+namespace OSSimulator {
+
+IOCLOOKScheduler::RequestMap::iterator IOCLOOKScheduler::select_next() {
+  auto it = pending.lower_bound(head_position);
+  if (it != pending.end()) {
+    return it;
+  }
+  return pending.begin();
+}
+
+IOSchedulingAlgorithm IOCLOOKScheduler::get_algorithm() const {
+  return IOSchedulingAlgorithm::C_LOOK;
+}
+
+} // namespace OSSimulator
@@ -0,0 +1,20 @@
+#include "io/io_cscan_scheduler.hpp"
+#include <algorithm>
+
+namespace OSSimulator {
+
+IOCSCANScheduler::RequestMap::iterator IOCSCANScheduler::select_next() {
+  auto it = pending.lower_bound(head_position);
+  if (it != pending.end()) {
+    return it;
+  }
+  move_head(std::max(cylinders - 1, head_position));
+  move_head(0);
+  return pending.begin();
+}
+
+IOSchedulingAlgorithm IOCSCANScheduler::get_algorithm() const {
+  return IOSchedulingAlgorithm::C_SCAN;
+}
+
+} // namespace OSSimulator
@@ -1,19 +1,24 @@
 #include "io/io_device.hpp"
-#include "io/io_round_robin_scheduler.hpp"
+#include "core/snapshot.hpp"
 #include "metrics/metrics_collector.hpp"
+#include <algorithm>
 
 namespace OSSimulator {
 
 IODevice::IODevice(const std::string &name)
-    : device_name(name), scheduler(nullptr), current_request(nullptr),
-      total_io_time(0), device_switches(0), total_requests_completed(0),
+    : device_name(name), device_name_id(name_table().intern(name)),
+      scheduler(nullptr), current_request(nullptr), total_io_time(0),
+      device_switches(0), total_requests_completed(0),
       completion_callback(nullptr), metrics_collector(nullptr),
       last_event_was_completed(false), last_event_was_step(false),
-      last_completed_pid(-1), last_completed_name(""), last_step_pid(-1),
-      last_step_name(""), last_step_remaining(0), current_quantum_used(0) {}
+      last_completed_pid(-1), last_completed_name(NameTable::EMPTY),
+      last_step_pid(-1), last_step_name(NameTable::EMPTY),
+      last_step_remaining(0), current_quantum_used(0),
+      service_rate(1), seek_speed(0), seek_remaining(0), total_seek_time(0),
+      last_event_was_seek(false), merge_limit(0), total_merges(0) {}
 
 void IODevice::set_scheduler(std::unique_ptr<IOScheduler> sched) {
-  std::lock_guard<std::mutex> lock(device_mutex);
+  std::lock_guard<SimMutex> lock(device_mutex);
   scheduler = std::move(sched);
 }
 
@@ -23,20 +28,132 @@ void IODevice::set_completion_callback(CompletionCallback callback) {
 
 void IODevice::set_metrics_collector(
     std::shared_ptr<MetricsCollector> collector) {
-  std::lock_guard<std::mutex> lock(device_mutex);
+  std::lock_guard<SimMutex> lock(device_mutex);
   metrics_collector = collector;
 }
 
-void IODevice::add_io_request(std::shared_ptr<IORequest> request) {
-  std::lock_guard<std::mutex> lock(device_mutex);
-  if (scheduler) {
-    scheduler->add_request(request);
+void IODevice::set_locking(bool enabled) { device_mutex.set_enabled(enabled); }
+
+void IODevice::set_service_rate(int rate) {
+  std::lock_guard<SimMutex> lock(device_mutex);
+  service_rate = std::max(1, rate);
+}
+
+int IODevice::get_service_rate() const {
+  std::lock_guard<SimMutex> lock(device_mutex);
+  return service_rate;
+}
+
+void IODevice::set_seek_speed(int speed) {
+  std::lock_guard<SimMutex> lock(device_mutex);
+  seek_speed = std::max(0, speed);
+}
+
+int IODevice::get_seek_speed() const {
+  std::lock_guard<SimMutex> lock(device_mutex);
+  return seek_speed;
+}
+
+void IODevice::set_merge_limit(int limit) {
+  std::lock_guard<SimMutex> lock(device_mutex);
+  merge_limit = std::max(0, limit);
+}
+
+int IODevice::get_merge_limit() const {
+  std::lock_guard<SimMutex> lock(device_mutex);
+  return merge_limit;
+}
+
+void IODevice::add_io_request(const std::shared_ptr<IORequest> &request) {
+  std::lock_guard<SimMutex> lock(device_mutex);
+  if (!scheduler) {
+    return;
   }
+  if (merge_limit > 0) {
+    if (try_merge_locked(request)) {
+      return;
+    }
+    merge_candidates.emplace(request->cylinder, request);
+  }
+  scheduler->add_request(request);
 }
 
-void IODevice::execute_step(int quantum, int current_time) {
-  std::lock_guard<std::mutex> lock(device_mutex);
+bool IODevice::try_merge_locked(const std::shared_ptr<IORequest> &request) {
+  Tick start = request->cylinder;
+  Tick end = start + request->burst.remaining_time;
+
+  // Solo pueden tocar [start, end) las solicitudes que empiezan en o antes de
+  // end; las que empiezan antes de end - merge_limit no caben en la unión.
+  auto it = merge_candidates.upper_bound(end);
+  while (it != merge_candidates.begin()) {
+    --it;
+    if (it->first < end - merge_limit) {
+      break;
+    }
+
+    auto host = it->second;
+    Tick host_end = host->cylinder + host->burst.remaining_time;
+    Tick merged_start = std::min<Tick>(start, host->cylinder);
+    Tick merged_end = std::max(end, host_end);
+    if (host_end < start || merged_end - merged_start > merge_limit) {
+      continue;
+    }
+
+    int old_cylinder = host->cylinder;
+    host->cylinder = static_cast<int>(merged_start);
+    host->burst.remaining_time = merged_end - merged_start;
+    host->merged.push_back(request);
+    merge_candidates.erase(it);
+    merge_candidates.emplace(host->cylinder, host);
+    scheduler->update_request(host, old_cylinder);
+    total_merges++;
+    return true;
+  }
+  return false;
+}
+
+void IODevice::execute_step(Tick quantum, Tick current_time) {
+  std::vector<IOCompletion> completions;
+  {
+    std::lock_guard<SimMutex> lock(device_mutex);
+    step_locked(quantum, current_time, completions);
+  }
+
+  if (completion_callback) {
+    for (const auto &completion : completions) {
+      completion_callback(completion.process, completion.completion_time);
+    }
+  }
+}
+
+void IODevice::advance(Tick ticks, Tick start_time,
+                       std::vector<IOCompletion> &completions) {
+  std::lock_guard<SimMutex> lock(device_mutex);
+
+  Tick elapsed = 0;
+  while (elapsed < ticks) {
+    Tick chunk = ticks_until_next_event_locked();
+    if (chunk <= 0) {
+      break;
+    }
+    chunk = std::min(chunk, ticks - elapsed);
+    step_locked(chunk, start_time + elapsed, completions);
+    elapsed += chunk;
+  }
+}
+
+void IODevice::step_and_log(Tick quantum, Tick current_time,
+                            std::vector<IOCompletion> &completions) {
+  std::lock_guard<SimMutex> lock(device_mutex);
+
+  if (has_pending_requests_locked()) {
+    step_locked(quantum, current_time, completions);
+  }
+  send_log_metrics_locked(current_time);
+}
 
+void IODevice::step_locked(Tick quantum, Tick current_time,
+                           std::vector<IOCompletion> &completions) {
   if (!scheduler) {
     return;
   }
@@ -52,39 +169,81 @@ void IODevice::execute_step(int quantum, int current_time) {
     }
     device_switches++;
     current_quantum_used = 0;
+    if (merge_limit > 0) {
+      auto range = merge_candidates.equal_range(current_request->cylinder);
+      for (auto it = range.first; it != range.second; ++it) {
+        if (it->second == current_request) {
+          merge_candidates.erase(it);
+          break;
+        }
+      }
+    }
+    int distance = scheduler->take_seek_distance();
+    seek_remaining =
+        seek_speed > 0 ? (distance + seek_speed - 1) / seek_speed : 0;
+  }
+
+  // La búsqueda ocupa el dispositivo antes de atender la solicitud. Si
+  // consume todo el quantum, no se ejecuta nada (quantum 0 sería "hasta
+  // completar").
+  Tick seek_time = 0;
+  if (seek_remaining > 0) {
+    seek_time = quantum > 0 ? std::min<Tick>(quantum, seek_remaining)
+                            : seek_remaining;
+    seek_remaining -= static_cast<int>(seek_time);
+    total_seek_time += seek_time;
+    if (quantum > 0 && seek_time >= quantum) {
+      last_event_was_completed = false;
+      last_event_was_step = false;
+      last_event_was_seek = true;
+      return;
+    }
   }
 
-  int time_executed = current_request->execute(quantum, current_time);
+  Tick time_executed = current_request->execute(
+      quantum > 0 ? quantum - seek_time : 0, current_time + seek_time,
+      service_rate);
   total_io_time += time_executed;
   current_quantum_used += time_executed;
 
   last_event_was_completed = current_request->is_completed();
   last_event_was_step = false;
+  last_event_was_seek = false;
 
   if (last_event_was_completed) {
     total_requests_completed++;
 
     if (current_request->process) {
       last_completed_pid = current_request->process->pid;
-      last_completed_name = current_request->process->name;
+      last_completed_name = current_request->process->name_id;
     }
 
-    if (completion_callback && current_request->process) {
-      completion_callback(current_request->process,
-                          current_time + time_executed);
+    Tick completion_time = current_time + seek_time + time_executed;
+    if (current_request->process) {
+      completions.push_back({current_request->process, completion_time});
+    }
+    queue_delay.record(current_request->start_time -
+                       current_request->arrival_time);
+    for (const auto &merged : current_request->merged) {
+      merged->burst.remaining_time = 0;
+      merged->start_time = current_request->start_time;
+      merged->completion_time = completion_time;
+      queue_delay.record(merged->start_time - merged->arrival_time);
+      total_requests_completed++;
+      if (merged->process) {
+        completions.push_back({merged->process, completion_time});
+      }
     }
+    current_request->merged.clear();
 
     current_request = nullptr;
     current_quantum_used = 0;
-  } else if (scheduler->get_algorithm() == IOSchedulingAlgorithm::ROUND_ROBIN) {
-    auto rr_scheduler = dynamic_cast<IORoundRobinScheduler *>(scheduler.get());
-    int io_quantum = rr_scheduler ? rr_scheduler->get_quantum() : 1;
-
+  } else if (int io_quantum = scheduler->get_quantum(); io_quantum > 0) {
     if (current_quantum_used >= io_quantum && scheduler->has_requests()) {
       if (current_request->process) {
         last_event_was_step = true;
         last_step_pid = current_request->process->pid;
-        last_step_name = current_request->process->name;
+        last_step_name = current_request->process->name_id;
         last_step_remaining = current_request->burst.remaining_time;
       }
       scheduler->add_request(current_request);
@@ -94,7 +253,7 @@ void IODevice::execute_step(int quantum, int current_time) {
       if (current_request->process) {
         last_event_was_step = true;
         last_step_pid = current_request->process->pid;
-        last_step_name = current_request->process->name;
+        last_step_name = current_request->process->name_id;
         last_step_remaining = current_request->burst.remaining_time;
       }
     }
@@ -102,23 +261,54 @@ void IODevice::execute_step(int quantum, int current_time) {
 }
 
 bool IODevice::has_pending_requests() const {
-  std::lock_guard<std::mutex> lock(device_mutex);
+  std::lock_guard<SimMutex> lock(device_mutex);
+  return has_pending_requests_locked();
+}
+
+bool IODevice::has_pending_requests_locked() const {
   return (scheduler && scheduler->has_requests()) ||
          (current_request != nullptr);
 }
 
+Tick IODevice::get_ticks_until_next_event() const {
+  std::lock_guard<SimMutex> lock(device_mutex);
+  return ticks_until_next_event_locked();
+}
+
+Tick IODevice::ticks_until_next_event_locked() const {
+  if (!current_request) {
+    return (scheduler && scheduler->has_requests()) ? 1 : -1;
+  }
+
+  Tick remaining =
+      seek_remaining +
+      std::max<Tick>(1, current_request->remaining_ticks(service_rate));
+  int io_quantum = scheduler ? scheduler->get_quantum() : 0;
+  if (io_quantum > 0 && scheduler->has_requests()) {
+    Tick slice = std::max<Tick>(1, io_quantum - current_quantum_used);
+    return std::min(remaining, seek_remaining + slice);
+  }
+  return remaining;
+}
+
+bool IODevice::is_logging_metrics() const {
+  std::lock_guard<SimMutex> lock(device_mutex);
+  return metrics_collector &&
+         metrics_collector->logs_category(MetricsCollector::CATEGORY_IO);
+}
+
 bool IODevice::is_busy() const {
-  std::lock_guard<std::mutex> lock(device_mutex);
+  std::lock_guard<SimMutex> lock(device_mutex);
   return current_request != nullptr;
 }
 
 size_t IODevice::get_queue_size() const {
-  std::lock_guard<std::mutex> lock(device_mutex);
+  std::lock_guard<SimMutex> lock(device_mutex);
   return scheduler ? scheduler->size() : 0;
 }
 
 void IODevice::reset() {
-  std::lock_guard<std::mutex> lock(device_mutex);
+  std::lock_guard<SimMutex> lock(device_mutex);
   if (scheduler) {
     scheduler->clear();
   }
@@ -129,57 +319,141 @@ void IODevice::reset() {
   last_event_was_completed = false;
   last_event_was_step = false;
   last_completed_pid = -1;
-  last_completed_name = "";
+  last_completed_name = NameTable::EMPTY;
   last_step_pid = -1;
-  last_step_name = "";
+  last_step_name = NameTable::EMPTY;
   last_step_remaining = 0;
   current_quantum_used = 0;
+  seek_remaining = 0;
+  total_seek_time = 0;
+  last_event_was_seek = false;
+  merge_candidates.clear();
+  total_merges = 0;
+  queue_delay.clear();
+}
+
+LatencyHistogram IODevice::get_queue_delay() const {
+  std::lock_guard<SimMutex> lock(device_mutex);
+  return queue_delay;
 }
 
-void IODevice::send_log_metrics(int current_time) {
-  std::lock_guard<std::mutex> lock(device_mutex);
+void IODevice::send_log_metrics(Tick current_time) {
+  std::lock_guard<SimMutex> lock(device_mutex);
+  send_log_metrics_locked(current_time);
+}
 
+void IODevice::send_log_metrics_locked(Tick current_time) {
   if (!metrics_collector) {
     return;
   }
 
-  std::string event;
-  int pid = -1;
-  std::string name;
-  int remaining = 0;
-  size_t queue_size = scheduler ? scheduler->size() : 0;
+  if (metrics_collector->should_log(MetricsCollector::CATEGORY_IO,
+                                    current_time)) {
+    std::string event;
+    int pid = -1;
+    NameId name = NameTable::EMPTY;
+    Tick remaining = 0;
+    size_t queue_size = scheduler ? scheduler->size() : 0;
 
-  if (last_event_was_completed) {
-    event = "COMPLETED";
-    pid = last_completed_pid;
-    name = last_completed_name;
+    if (last_event_was_completed) {
+      event = "COMPLETED";
+      pid = last_completed_pid;
+      name = last_completed_name;
 
-  } else if (last_event_was_step) {
-    event = "STEP";
-    pid = last_step_pid;
-    name = last_step_name;
-    remaining = last_step_remaining;
+    } else if (last_event_was_seek && current_request &&
+               current_request->process) {
+      event = "SEEK";
+      pid = current_request->process->pid;
+      name = current_request->process->name_id;
+      remaining = current_request->burst.remaining_time;
 
-  } else if (current_request && current_request->process) {
-    event = "STEP";
-    pid = current_request->process->pid;
-    name = current_request->process->name;
-    remaining = current_request->burst.remaining_time;
+    } else if (last_event_was_step) {
+      event = "STEP";
+      pid = last_step_pid;
+      name = last_step_name;
+      remaining = last_step_remaining;
 
-  } else {
-    event = "IDLE";
-  }
+    } else if (current_request && current_request->process) {
+      event = "STEP";
+      pid = current_request->process->pid;
+      name = current_request->process->name_id;
+      remaining = current_request->burst.remaining_time;
 
-  metrics_collector->log_io(current_time, device_name, event, pid, name,
-                            remaining, queue_size);
+    } else {
+      event = "IDLE";
+    }
+
+    metrics_collector->log_io(current_time, device_name_id, event, pid, name,
+                              remaining, queue_size);
+  }
 
   last_event_was_completed = false;
   last_event_was_step = false;
+  last_event_was_seek = false;
   last_completed_pid = -1;
-  last_completed_name = "";
+  last_completed_name = NameTable::EMPTY;
   last_step_pid = -1;
-  last_step_name = "";
+  last_step_name = NameTable::EMPTY;
   last_step_remaining = 0;
 }
 
+void IODevice::save_state(SnapshotWriter &out) const {
+  std::lock_guard<SimMutex> lock(device_mutex);
+  out.put_int(scheduler ? static_cast<int>(scheduler->get_algorithm()) : -1);
+  if (scheduler)
+    scheduler->save_state(out);
+  out.put_request(current_request);
+  out.put_int(total_io_time);
+  out.put_int(device_switches);
+  out.put_int(total_requests_completed);
+  out.put_bool(last_event_was_completed);
+  out.put_bool(last_event_was_step);
+  out.put_int(last_completed_pid);
+  out.put_string(name_table().name(last_completed_name));
+  out.put_int(last_step_pid);
+  out.put_string(name_table().name(last_step_name));
+  out.put_int(last_step_remaining);
+  out.put_int(current_quantum_used);
+  out.put_int(seek_remaining);
+  out.put_int(total_seek_time);
+  out.put_bool(last_event_was_seek);
+  out.put_int(total_merges);
+  out.put_uint(merge_candidates.size());
+  for (const auto &entry : merge_candidates) {
+    out.put_int(entry.first);
+    out.put_request(entry.second);
+  }
+  queue_delay.save_state(out);
+}
+
+void IODevice::load_state(SnapshotReader &in) {
+  std::lock_guard<SimMutex> lock(device_mutex);
+  in.expect(scheduler ? static_cast<int>(scheduler->get_algorithm()) : -1,
+            "algoritmo de E/S de " + device_name);
+  if (scheduler)
+    scheduler->load_state(in);
+  current_request = in.get_request();
+  total_io_time = in.get_int64();
+  device_switches = in.get_int64();
+  total_requests_completed = in.get_int64();
+  last_event_was_completed = in.get_bool();
+  last_event_was_step = in.get_bool();
+  last_completed_pid = in.get_int();
+  last_completed_name = name_table().intern(in.get_string());
+  last_step_pid = in.get_int();
+  last_step_name = name_table().intern(in.get_string());
+  last_step_remaining = in.get_int64();
+  current_quantum_used = in.get_int64();
+  seek_remaining = in.get_int();
+  total_seek_time = in.get_int64();
+  last_event_was_seek = in.get_bool();
+  total_merges = in.get_int64();
+  merge_candidates.clear();
+  for (size_t i = in.get_count(); i > 0; --i) {
+    int cylinder = in.get_int();
+    merge_candidates.emplace(cylinder, in.get_request());
+  }
+  queue_delay.load_state(in);
+}
+
 } // namespace OSSimulator
@@ -0,0 +1,84 @@
+#include "io/io_elevator_scheduler.hpp"
+#include "core/snapshot.hpp"
+#include <algorithm>
+
+namespace OSSimulator {
+
+IOElevatorScheduler::IOElevatorScheduler(int cyl)
+    : cylinders(std::max(1, cyl)) {}
+
+void IOElevatorScheduler::add_request(
+    const std::shared_ptr<IORequest> &request) {
+  pending.emplace(request->cylinder, request);
+}
+
+std::shared_ptr<IORequest> IOElevatorScheduler::get_next_request() {
+  if (pending.empty())
+    return nullptr;
+  auto it = select_next();
+  auto request = it->second;
+  pending.erase(it);
+  move_head(request->cylinder);
+  return request;
+}
+
+bool IOElevatorScheduler::has_requests() const { return !pending.empty(); }
+
+void IOElevatorScheduler::remove_request(
+    const std::shared_ptr<IORequest> &request) {
+  auto range = pending.equal_range(request->cylinder);
+  for (auto it = range.first; it != range.second; ++it) {
+    if (it->second == request) {
+      pending.erase(it);
+      return;
+    }
+  }
+}
+
+void IOElevatorScheduler::update_request(
+    const std::shared_ptr<IORequest> &request, int old_cylinder) {
+  auto range = pending.equal_range(old_cylinder);
+  for (auto it = range.first; it != range.second; ++it) {
+    if (it->second == request) {
+      pending.erase(it);
+      pending.emplace(request->cylinder, request);
+      return;
+    }
+  }
+}
+
+size_t IOElevatorScheduler::size() const { return pending.size(); }
+
+void IOElevatorScheduler::clear() {
+  pending.clear();
+  reset_head();
+}
+
+int IOElevatorScheduler::get_cylinders() const { return cylinders; }
+
+IOElevatorScheduler::RequestMap::iterator
+IOElevatorScheduler::oldest_at(RequestMap::iterator it) {
+  return pending.lower_bound(it->first);
+}
+
+void IOElevatorScheduler::save_state(SnapshotWriter &out) const {
+  out.put_int(head_position);
+  out.put_int(seek_distance);
+  out.put_uint(pending.size());
+  for (const auto &entry : pending)
+    out.put_request(entry.second);
+}
+
+void IOElevatorScheduler::load_state(SnapshotReader &in) {
+  head_position = in.get_int();
+  seek_distance = in.get_int();
+  pending.clear();
+  for (size_t i = in.get_count(); i > 0; --i) {
+    auto request = in.get_request();
+    if (!request)
+      throw std::runtime_error("Instantánea corrupta");
+    pending.emplace(request->cylinder, request);
+  }
+}
+
+} // namespace OSSimulator
@@ -1,9 +1,10 @@
 #include "io/io_fcfs_scheduler.hpp"
+#include "core/snapshot.hpp"
 #include <algorithm>
 
 namespace OSSimulator {
 
-void IOFCFSScheduler::add_request(std::shared_ptr<IORequest> request) {
+void IOFCFSScheduler::add_request(const std::shared_ptr<IORequest> &request) {
   queue.push_back(request);
 }
 
@@ -12,12 +13,14 @@ std::shared_ptr<IORequest> IOFCFSScheduler::get_next_request() {
     return nullptr;
   auto request = queue.front();
   queue.pop_front();
+  move_head(request->cylinder);
   return request;
 }
 
 bool IOFCFSScheduler::has_requests() const { return !queue.empty(); }
 
-void IOFCFSScheduler::remove_request(std::shared_ptr<IORequest> request) {
+void IOFCFSScheduler::remove_request(
+    const std::shared_ptr<IORequest> &request) {
   auto it = std::find(queue.begin(), queue.end(), request);
   if (it != queue.end()) {
     queue.erase(it);
@@ -26,10 +29,29 @@ void IOFCFSScheduler::remove_request(std::shared_ptr<IORequest> request) {
 
 size_t IOFCFSScheduler::size() const { return queue.size(); }
 
-void IOFCFSScheduler::clear() { queue.clear(); }
+void IOFCFSScheduler::clear() {
+  queue.clear();
+  reset_head();
+}
 
 IOSchedulingAlgorithm IOFCFSScheduler::get_algorithm() const {
   return IOSchedulingAlgorithm::FCFS;
 }
 
+void IOFCFSScheduler::save_state(SnapshotWriter &out) const {
+  out.put_int(head_position);
+  out.put_int(seek_distance);
+  out.put_uint(queue.size());
+  for (const auto &request : queue)
+    out.put_request(request);
+}
+
+void IOFCFSScheduler::load_state(SnapshotReader &in) {
+  head_position = in.get_int();
+  seek_distance = in.get_int();
+  queue.clear();
+  for (size_t i = in.get_count(); i > 0; --i)
+    queue.push_back(in.get_request());
+}
+
 } // namespace OSSimulator
@@ -1,12 +1,16 @@
 #include "io/io_manager.hpp"
+#include "core/profiler.hpp"
+#include "core/snapshot.hpp"
+#include <algorithm>
 #include <iostream>
 
 namespace OSSimulator {
 
 void IOManager::add_device(const std::string &name,
                            std::shared_ptr<IODevice> device) {
-  std::lock_guard<std::mutex> lock(manager_mutex);
+  std::lock_guard<SimMutex> lock(manager_mutex);
   devices[name] = device;
+  device->set_locking(manager_mutex.enabled());
 
   if (completion_callback) {
     device->set_completion_callback(completion_callback);
@@ -17,7 +21,7 @@ void IOManager::add_device(const std::string &name,
 }
 
 std::shared_ptr<IODevice> IOManager::get_device(const std::string &name) {
-  std::lock_guard<std::mutex> lock(manager_mutex);
+  std::lock_guard<SimMutex> lock(manager_mutex);
   auto it = devices.find(name);
   if (it != devices.end()) {
     return it->second;
@@ -26,12 +30,12 @@ std::shared_ptr<IODevice> IOManager::get_device(const std::string &name) {
 }
 
 bool IOManager::has_device(const std::string &name) const {
-  std::lock_guard<std::mutex> lock(manager_mutex);
+  std::lock_guard<SimMutex> lock(manager_mutex);
   return devices.find(name) != devices.end();
 }
 
 void IOManager::set_completion_callback(CompletionCallback callback) {
-  std::lock_guard<std::mutex> lock(manager_mutex);
+  std::lock_guard<SimMutex> lock(manager_mutex);
   completion_callback = callback;
 
   for (auto &[name, device] : devices) {
@@ -39,9 +43,15 @@ void IOManager::set_completion_callback(CompletionCallback callback) {
   }
 }
 
+void IOManager::set_batch_completion_callback(
+    BatchCompletionCallback callback) {
+  std::lock_guard<SimMutex> lock(manager_mutex);
+  batch_completion_callback = std::move(callback);
+}
+
 void IOManager::set_metrics_collector(
     std::shared_ptr<MetricsCollector> collector) {
-  std::lock_guard<std::mutex> lock(manager_mutex);
+  std::lock_guard<SimMutex> lock(manager_mutex);
   metrics_collector = collector;
 
   for (auto &[name, device] : devices) {
@@ -49,7 +59,14 @@ void IOManager::set_metrics_collector(
   }
 }
 
-void IOManager::submit_io_request(std::shared_ptr<IORequest> request) {
+void IOManager::set_locking(bool enabled) {
+  manager_mutex.set_enabled(enabled);
+  for (auto &[name, device] : devices) {
+    device->set_locking(enabled);
+  }
+}
+
+void IOManager::submit_io_request(const std::shared_ptr<IORequest> &request) {
   if (!request || !request->process) {
     return;
   }
@@ -68,31 +85,78 @@ void IOManager::submit_io_request(std::shared_ptr<IORequest> request) {
   }
 }
 
-void IOManager::execute_all_devices(int quantum, int current_time) {
-  std::lock_guard<std::mutex> lock(manager_mutex);
+void IOManager::execute_all_devices(Tick quantum, Tick current_time) {
+  OSSIM_PROFILE_SCOPE("io.devices");
+  std::lock_guard<SimMutex> lock(manager_mutex);
 
   if (quantum <= 0) {
     for (auto &[name, device] : devices) {
-      if (device->has_pending_requests()) {
-        device->execute_step(0, current_time);
-      }
-      device->send_log_metrics(current_time);
+      device->step_and_log(0, current_time, completion_batch);
+    }
+    deliver_completions();
+  } else if (std::none_of(devices.begin(), devices.end(), [](const auto &entry) {
+               return entry.second->is_logging_metrics();
+             })) {
+    // Sin métricas por tick, los dispositivos no dependen entre sí: cada uno
+    // avanza el quantum completo hasta sus propios eventos. Ordenar por
+    // tiempo, de forma estable, reproduce el orden de las finalizaciones
+    // entre dispositivos.
+    for (auto &[name, device] : devices) {
+      device->advance(quantum, current_time, completion_batch);
+    }
+    // Inserción estable en lugar de std::stable_sort: el lote es corto y
+    // casi ordenado, y así no se reserva el búfer temporal en cada paso.
+    auto by_time = [](const IOCompletion &a, const IOCompletion &b) {
+      return a.completion_time < b.completion_time;
+    };
+    for (auto it = completion_batch.begin(); it != completion_batch.end();
+         ++it) {
+      auto pos = std::upper_bound(completion_batch.begin(), it, *it, by_time);
+      std::rotate(pos, it, it + 1);
     }
+    deliver_completions();
   } else {
-    for (int tick = 0; tick < quantum; ++tick) {
-      int tick_time = current_time + tick;
+    for (Tick tick = 0; tick < quantum; ++tick) {
+      Tick tick_time = current_time + tick;
       for (auto &[name, device] : devices) {
-        if (device->has_pending_requests()) {
-          device->execute_step(1, tick_time);
-        }
-        device->send_log_metrics(tick_time);
+        device->step_and_log(1, tick_time, completion_batch);
       }
+      deliver_completions();
     }
   }
 }
 
+void IOManager::deliver_completions() {
+  if (completion_batch.empty()) {
+    return;
+  }
+  OSSIM_PROFILE_COUNT("io.completions", completion_batch.size());
+
+  if (batch_completion_callback) {
+    batch_completion_callback(completion_batch);
+  } else if (completion_callback) {
+    for (const auto &completion : completion_batch) {
+      completion_callback(completion.process, completion.completion_time);
+    }
+  }
+  completion_batch.clear();
+}
+
+Tick IOManager::get_next_event_time(Tick current_time) const {
+  std::lock_guard<SimMutex> lock(manager_mutex);
+
+  Tick next = -1;
+  for (const auto &[name, device] : devices) {
+    Tick ticks = device->get_ticks_until_next_event();
+    if (ticks > 0 && (next < 0 || current_time + ticks < next)) {
+      next = current_time + ticks;
+    }
+  }
+  return next;
+}
+
 bool IOManager::has_pending_io() const {
-  std::lock_guard<std::mutex> lock(manager_mutex);
+  std::lock_guard<SimMutex> lock(manager_mutex);
 
   for (const auto &[name, device] : devices) {
     if (device->has_pending_requests()) {
@@ -104,11 +168,30 @@ bool IOManager::has_pending_io() const {
 }
 
 void IOManager::reset_all_devices() {
-  std::lock_guard<std::mutex> lock(manager_mutex);
+  std::lock_guard<SimMutex> lock(manager_mutex);
 
   for (auto &[name, device] : devices) {
     device->reset();
   }
 }
 
+void IOManager::save_state(SnapshotWriter &out) const {
+  std::lock_guard<SimMutex> lock(manager_mutex);
+  out.put_int(static_cast<int64_t>(devices.size()));
+  for (const auto &[name, device] : devices) {
+    out.put_string(name);
+    device->save_state(out);
+  }
+}
+
+void IOManager::load_state(SnapshotReader &in) {
+  std::lock_guard<SimMutex> lock(manager_mutex);
+  in.expect(static_cast<int64_t>(devices.size()), "dispositivos de E/S");
+  for (const auto &[name, device] : devices) {
+    in.expect(name, "dispositivo de E/S");
+    device->load_state(in);
+  }
+  completion_batch.clear();
+}
+
 } // namespace OSSimulator
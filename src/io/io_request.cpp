@@ -1,26 +1,28 @@
 #include "io/io_request.hpp"
+#include <algorithm>
 
 namespace OSSimulator {
 
 IORequest::IORequest()
     : process(nullptr), burst(), arrival_time(0), completion_time(0),
-      start_time(-1), priority(0) {}
+      start_time(-1), priority(0), cylinder(0) {}
 
-IORequest::IORequest(std::shared_ptr<Process> proc, const Burst &b,
-                     int arrival, int prio)
+IORequest::IORequest(const std::shared_ptr<Process> &proc, const Burst &b,
+                     Tick arrival, int prio)
     : process(proc), burst(b), arrival_time(arrival), completion_time(0),
-      start_time(-1), priority(prio) {}
+      start_time(-1), priority(prio), cylinder(b.cylinder) {}
 
 bool IORequest::is_completed() const { return burst.is_completed(); }
 
-int IORequest::execute(int quantum, int current_time) {
+Tick IORequest::execute(Tick quantum, Tick current_time, int service_rate) {
   if (start_time < 0) {
     start_time = current_time;
   }
 
-  int time_executed = (quantum > 0) ? std::min(quantum, burst.remaining_time)
-                                    : burst.remaining_time;
-  burst.remaining_time -= time_executed;
+  Tick needed = remaining_ticks(service_rate);
+  Tick time_executed = (quantum > 0) ? std::min(quantum, needed) : needed;
+  burst.remaining_time =
+      std::max<Tick>(0, burst.remaining_time - time_executed * service_rate);
 
   if (is_completed()) {
     completion_time = current_time + time_executed;
@@ -29,4 +31,8 @@ int IORequest::execute(int quantum, int current_time) {
   return time_executed;
 }
 
+Tick IORequest::remaining_ticks(int service_rate) const {
+  return (burst.remaining_time + service_rate - 1) / service_rate;
+}
+
 } // namespace OSSimulator
@@ -0,0 +1,57 @@
+#include "io/io_request_pool.hpp"
+#include <new>
+
+namespace OSSimulator {
+
+IORequestPool::Storage::~Storage() {
+  for (void *block : free_blocks) {
+    ::operator delete(block);
+  }
+}
+
+void *IORequestPool::Storage::allocate(size_t bytes) {
+  std::lock_guard<std::mutex> lock(mutex);
+  if (block_size == 0) {
+    block_size = bytes;
+  }
+  if (bytes != block_size) {
+    return ::operator new(bytes);
+  }
+  if (!free_blocks.empty()) {
+    void *block = free_blocks.back();
+    free_blocks.pop_back();
+    return block;
+  }
+  allocated_blocks++;
+  return ::operator new(bytes);
+}
+
+void IORequestPool::Storage::deallocate(void *block, size_t bytes) {
+  std::lock_guard<std::mutex> lock(mutex);
+  if (bytes != block_size) {
+    ::operator delete(block);
+    return;
+  }
+  free_blocks.push_back(block);
+}
+
+IORequestPool::IORequestPool() : storage(std::make_shared<Storage>()) {}
+
+std::shared_ptr<IORequest>
+IORequestPool::acquire(const std::shared_ptr<Process> &proc,
+                       const Burst &burst, Tick arrival, int priority) {
+  return std::allocate_shared<IORequest>(Allocator<IORequest>(storage), proc,
+                                         burst, arrival, priority);
+}
+
+size_t IORequestPool::available() const {
+  std::lock_guard<std::mutex> lock(storage->mutex);
+  return storage->free_blocks.size();
+}
+
+size_t IORequestPool::allocated() const {
+  std::lock_guard<std::mutex> lock(storage->mutex);
+  return storage->allocated_blocks;
+}
+
+} // namespace OSSimulator
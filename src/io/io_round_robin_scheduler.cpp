@@ -1,11 +1,14 @@
 #include "io/io_round_robin_scheduler.hpp"
+#include "core/snapshot.hpp"
 #include <algorithm>
 
 namespace OSSimulator {
 
-IORoundRobinScheduler::IORoundRobinScheduler(int q) : quantum(q) {}
+IORoundRobinScheduler::IORoundRobinScheduler(int q)
+    : quantum(std::max(1, q)) {}
 
-void IORoundRobinScheduler::add_request(std::shared_ptr<IORequest> request) {
+void IORoundRobinScheduler::add_request(
+    const std::shared_ptr<IORequest> &request) {
   queue.push_back(request);
 }
 
@@ -14,12 +17,14 @@ std::shared_ptr<IORequest> IORoundRobinScheduler::get_next_request() {
     return nullptr;
   auto request = queue.front();
   queue.pop_front();
+  move_head(request->cylinder);
   return request;
 }
 
 bool IORoundRobinScheduler::has_requests() const { return !queue.empty(); }
 
-void IORoundRobinScheduler::remove_request(std::shared_ptr<IORequest> request) {
+void IORoundRobinScheduler::remove_request(
+    const std::shared_ptr<IORequest> &request) {
   auto it = std::find(queue.begin(), queue.end(), request);
   if (it != queue.end()) {
     queue.erase(it);
@@ -28,7 +33,10 @@ void IORoundRobinScheduler::remove_request(std::shared_ptr<IORequest> request) {
 
 size_t IORoundRobinScheduler::size() const { return queue.size(); }
 
-void IORoundRobinScheduler::clear() { queue.clear(); }
+void IORoundRobinScheduler::clear() {
+  queue.clear();
+  reset_head();
+}
 
 IOSchedulingAlgorithm IORoundRobinScheduler::get_algorithm() const {
   return IOSchedulingAlgorithm::ROUND_ROBIN;
@@ -36,6 +44,22 @@ IOSchedulingAlgorithm IORoundRobinScheduler::get_algorithm() const {
 
 int IORoundRobinScheduler::get_quantum() const { return quantum; }
 
-void IORoundRobinScheduler::set_quantum(int q) { quantum = q; }
+void IORoundRobinScheduler::set_quantum(int q) { quantum = std::max(1, q); }
+
+void IORoundRobinScheduler::save_state(SnapshotWriter &out) const {
+  out.put_int(head_position);
+  out.put_int(seek_distance);
+  out.put_uint(queue.size());
+  for (const auto &request : queue)
+    out.put_request(request);
+}
+
+void IORoundRobinScheduler::load_state(SnapshotReader &in) {
+  head_position = in.get_int();
+  seek_distance = in.get_int();
+  queue.clear();
+  for (size_t i = in.get_count(); i > 0; --i)
+    queue.push_back(in.get_request());
+}
 
 } // namespace OSSimulator
@@ -0,0 +1,46 @@
+#include "io/io_scan_scheduler.hpp"
+#include "core/snapshot.hpp"
+#include <algorithm>
+#include <iterator>
+
+namespace OSSimulator {
+
+IOSCANScheduler::RequestMap::iterator IOSCANScheduler::select_next() {
+  if (moving_up) {
+    auto it = pending.lower_bound(head_position);
+    if (it != pending.end()) {
+      return it;
+    }
+    move_head(std::max(cylinders - 1, head_position));
+    moving_up = false;
+  }
+
+  auto it = pending.upper_bound(head_position);
+  if (it != pending.begin()) {
+    return oldest_at(std::prev(it));
+  }
+  move_head(0);
+  moving_up = true;
+  return pending.begin();
+}
+
+void IOSCANScheduler::clear() {
+  IOElevatorScheduler::clear();
+  moving_up = true;
+}
+
+IOSchedulingAlgorithm IOSCANScheduler::get_algorithm() const {
+  return IOSchedulingAlgorithm::SCAN;
+}
+
+void IOSCANScheduler::save_state(SnapshotWriter &out) const {
+  IOElevatorScheduler::save_state(out);
+  out.put_bool(moving_up);
+}
+
+void IOSCANScheduler::load_state(SnapshotReader &in) {
+  IOElevatorScheduler::load_state(in);
+  moving_up = in.get_bool();
+}
+
+} // namespace OSSimulator
@@ -0,0 +1,23 @@
+#include "io/io_sstf_scheduler.hpp"
+#include <iterator>
+
+namespace OSSimulator {
+
+IOSSTFScheduler::RequestMap::iterator IOSSTFScheduler::select_next() {
+  auto above = pending.lower_bound(head_position);
+  if (above == pending.begin()) {
+    return above;
+  }
+  auto below = oldest_at(std::prev(above));
+  if (above == pending.end() ||
+      head_position - below->first < above->first - head_position) {
+    return below;
+  }
+  return above;
+}
+
+IOSchedulingAlgorithm IOSSTFScheduler::get_algorithm() const {
+  return IOSchedulingAlgorithm::SSTF;
+}
+
+} // namespace OSSimulator
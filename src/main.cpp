@@ -1,121 +1,960 @@
 #include "core/config_parser.hpp"
+#include "core/policy_registry.hpp"
+#include "core/process_stream.hpp"
+#include "core/profiler.hpp"
+#include "core/result_cache.hpp"
+#include "core/workload_generator.hpp"
 #include "cpu/cpu_scheduler.hpp"
-#include "cpu/fcfs_scheduler.hpp"
-#include "cpu/priority_scheduler.hpp"
-#include "cpu/round_robin_scheduler.hpp"
-#include "cpu/sjf_scheduler.hpp"
 #include "io/io_device.hpp"
-#include "io/io_fcfs_scheduler.hpp"
 #include "io/io_manager.hpp"
-#include "io/io_round_robin_scheduler.hpp"
-#include "memory/fifo_replacement.hpp"
-#include "memory/lru_replacement.hpp"
 #include "memory/memory_manager.hpp"
-#include "memory/nru_replacement.hpp"
-#include "memory/optimal_replacement.hpp"
+#include "metrics/live_exporter.hpp"
 #include "metrics/metrics_collector.hpp"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
 #include <cstring>
 #include <filesystem>
+#include <fstream>
 #include <iostream>
 #include <memory>
+#include <optional>
+#include <stdexcept>
+#include <thread>
 #include <vector>
 
+#include <nlohmann/json.hpp>
+
 using namespace OSSimulator;
+using json = nlohmann::json;
+
+/// Eventos máximos de la traza de perfilado (unos 24 bytes cada uno).
+constexpr size_t PROFILE_TRACE_EVENTS = 1 << 22;
+
+/**
+ * Resultados agregados de una simulación.
+ */
+struct SimulationResult {
+  Tick total_time = 0;
+  double cpu_utilization = 0.0;
+  double avg_waiting_time = 0.0;
+  double avg_turnaround_time = 0.0;
+  double avg_response_time = 0.0;
+  int64_t context_switches = 0;
+  int64_t page_faults = 0;
+  int64_t replacements = 0;
+  size_t completed_processes = 0;
+};
+
+/**
+ * Origen de los procesos a simular: un archivo o una carga sintética.
+ */
+struct ProcessInput {
+  std::string file;                     //!< Archivo de procesos.
+  std::optional<WorkloadSpec> workload; //!< Carga sintética que reemplaza al archivo.
+
+  /**
+   * Carga todos los procesos (process_loading=eager).
+   * @return Procesos del archivo o de la carga generada.
+   */
+  std::vector<std::shared_ptr<Process>> load_all() const {
+    if (!workload)
+      return ConfigParser::load_processes_from_file(file);
+    std::vector<std::shared_ptr<Process>> processes;
+    WorkloadGenerator generator(*workload);
+    std::string_view line;
+    while (generator.next_line(line))
+      processes.push_back(ConfigParser::parse_process_line(line));
+    return processes;
+  }
+
+  /**
+   * Abre los procesos para leerlos durante la simulación
+   * (process_loading=stream).
+   * @param validator Validación de cada proceso leído.
+   * @return Lector del archivo o del generador.
+   */
+  std::unique_ptr<ProcessStream>
+  open_stream(ProcessStream::Validator validator) const {
+    if (!workload)
+      return std::make_unique<ProcessStream>(file, std::move(validator));
+    auto generator = std::make_shared<WorkloadGenerator>(*workload);
+    return std::make_unique<ProcessStream>(
+        [generator](std::string_view &line) {
+          return generator->next_line(line);
+        },
+        std::move(validator));
+  }
+};
+
+/**
+ * Configura los componentes del simulador según la configuración y ejecuta
+ * la simulación hasta completar todos los procesos. Cada llamada usa sus
+ * propias instancias de planificador, memoria y E/S.
+ * @param config Configuración del simulador.
+ * @param input Origen de los procesos, leído durante la simulación con
+ * process_loading=stream.
+ * @param processes Procesos a simular (se modifican durante la ejecución);
+ * vacío con process_loading=stream.
+ * @param metrics Colector de métricas opcional para registrar la ejecución.
+ * @param result Resultados de la simulación.
+ * @return false si la configuración no es válida.
+ */
+bool simulate(const SimulatorConfig &config, const ProcessInput &input,
+              const std::vector<std::shared_ptr<Process>> &processes,
+              std::shared_ptr<MetricsCollector> metrics,
+              SimulationResult &result) {
+  CPUScheduler scheduler;
+
+  if (config.execution_mode == "inline") {
+    scheduler.set_execution_mode(ExecutionMode::INLINE);
+  } else if (config.execution_mode != "threaded") {
+    std::cerr << "[ERROR] Modo de ejecución no reconocido: "
+              << config.execution_mode << std::endl;
+    return false;
+  }
+
+  if (config.simulation_engine == "event") {
+    scheduler.set_event_driven(true);
+  } else if (config.simulation_engine != "tick") {
+    std::cerr << "[ERROR] Motor de simulación no reconocido: "
+              << config.simulation_engine << std::endl;
+    return false;
+  }
+
+  if (config.core_locking == "coarse") {
+    if (!CORE_LOCKING_AVAILABLE) {
+      std::cerr << "[ERROR] core_locking=coarse no disponible: compilado con "
+                   "SINGLE_THREADED_CORE"
+                << std::endl;
+      return false;
+    }
+    scheduler.set_core_locking(CoreLocking::COARSE);
+  } else if (config.core_locking != "none") {
+    std::cerr << "[ERROR] Bloqueo del núcleo no reconocido: "
+              << config.core_locking << std::endl;
+    return false;
+  }
+
+  auto cpu_policy =
+      cpu_scheduler_registry().create(config.scheduling_algorithm, config);
+  if (!cpu_policy) {
+    std::cerr << "[ERROR] Algoritmo de planificación no reconocido: "
+              << config.scheduling_algorithm << std::endl;
+    return false;
+  }
+  scheduler.set_scheduler(std::move(cpu_policy));
+
+  if (config.cpu_cores < 1) {
+    std::cerr << "[ERROR] Número de núcleos no válido: " << config.cpu_cores
+              << std::endl;
+    return false;
+  }
+  scheduler.set_core_count(config.cpu_cores);
+  scheduler.set_migration_cost(config.core_migration_cost);
+
+  // Un algoritmo de reemplazo no registrado usa FIFO.
+  auto make_replacement = [&config]() {
+    auto algorithm = replacement_registry().create(
+        config.page_replacement_algorithm, config);
+    return algorithm ? std::move(algorithm)
+                     : replacement_registry().create("FIFO", config);
+  };
+
+  auto memory_manager = std::make_shared<MemoryManager>(
+      config.total_memory_frames, make_replacement(), 1);
+  if (config.huge_page_size > 0) {
+    if (config.frame_size <= 0 ||
+        config.huge_page_size % config.frame_size != 0 ||
+        config.huge_page_size / config.frame_size < 2) {
+      std::cerr << "[ERROR] Tamaño de página grande no válido: "
+                << config.huge_page_size << std::endl;
+      return false;
+    }
+    memory_manager->set_huge_pages(config.huge_page_size / config.frame_size,
+                                   config.huge_page_frames, make_replacement());
+  }
+  memory_manager->set_fault_channels(config.page_fault_channels);
+  memory_manager->set_prefetch_pages(config.page_prefetch);
+  if (config.paging_mode != "full" && config.paging_mode != "demand") {
+    std::cerr << "[ERROR] Modo de paginación no reconocido: "
+              << config.paging_mode << std::endl;
+    return false;
+  }
+  memory_manager->set_demand_paging(config.paging_mode == "demand");
+  memory_manager->set_locality(config.locality_window, config.locality_shift);
+  if (config.load_control != "none" && config.load_control != "working_set") {
+    std::cerr << "[ERROR] Control de carga no reconocido: "
+              << config.load_control << std::endl;
+    return false;
+  }
+  memory_manager->set_load_control(config.load_control == "working_set",
+                                   config.working_set_window);
+  if (config.tlb_mode != "flush" && config.tlb_mode != "asid") {
+    std::cerr << "[ERROR] Modo de TLB no reconocido: " << config.tlb_mode
+              << std::endl;
+    return false;
+  }
+  memory_manager->set_tlb(config.tlb_entries, config.tlb_ways,
+                          config.tlb_mode == "asid");
+  if (config.numa_nodes > 1) {
+    NumaPolicy numa_policy = NumaPolicy::FIRST_TOUCH;
+    if (config.numa_policy == "interleave") {
+      numa_policy = NumaPolicy::INTERLEAVE;
+    } else if (config.numa_policy == "bind") {
+      numa_policy = NumaPolicy::BIND;
+    } else if (config.numa_policy != "first_touch") {
+      std::cerr << "[ERROR] Política NUMA no reconocida: "
+                << config.numa_policy << std::endl;
+      return false;
+    }
+    memory_manager->set_numa(config.numa_nodes, numa_policy,
+                             config.numa_remote_latency, config.cpu_cores);
+  }
+
+  // "disk" atiende las ráfagas E/S(n) sin dispositivo; una declaración
+  // io_device=disk:... posterior la reemplaza.
+  std::vector<IODeviceConfig> device_configs;
+  device_configs.push_back(
+      {"disk", config.io_scheduling_algorithm, config.io_quantum, 1,
+       config.io_seek_speed, config.io_cylinders});
+  device_configs.insert(device_configs.end(), config.io_devices.begin(),
+                        config.io_devices.end());
+
+  auto io_manager = std::make_shared<IOManager>();
+  for (const auto &device_config : device_configs) {
+    auto device = std::make_shared<IODevice>(device_config.name);
+    // Un algoritmo de E/S no registrado usa FCFS.
+    auto io_policy = io_scheduler_registry().create(
+        device_config.scheduling_algorithm, device_config);
+    device->set_scheduler(io_policy ? std::move(io_policy)
+                                    : io_scheduler_registry().create(
+                                          "FCFS", device_config));
+    device->set_service_rate(device_config.service_rate);
+    device->set_seek_speed(device_config.seek_speed);
+    device->set_merge_limit(config.io_merge_limit);
+    io_manager->add_device(device_config.name, device);
+  }
+
+  auto undeclared_device = [io_manager](const Process &proc) -> const Burst * {
+    for (const auto &burst : proc.burst_sequence) {
+      if (burst.type == BurstType::IO &&
+          !io_manager->has_device(burst.io_device)) {
+        return &burst;
+      }
+    }
+    return nullptr;
+  };
+  for (const auto &proc : processes) {
+    if (const Burst *burst = undeclared_device(*proc)) {
+      std::cerr << "[ERROR] Dispositivo de E/S no declarado: "
+                << burst->io_device << " (proceso " << proc->name << ")"
+                << std::endl;
+      return false;
+    }
+  }
+
+  std::unique_ptr<ProcessStream> stream;
+  if (config.process_loading == "stream") {
+    // Cada proceso se valida al leerse, ya en plena simulación.
+    stream = input.open_stream([undeclared_device](const Process &proc) {
+      if (const Burst *burst = undeclared_device(proc)) {
+        throw std::runtime_error("Dispositivo de E/S no declarado: " +
+                                 burst->io_device + " (proceso " + proc.name +
+                                 ")");
+      }
+    });
+    if (stream->done()) {
+      std::cerr << "[ERROR] No se cargaron procesos." << std::endl;
+      return false;
+    }
+  } else if (config.process_loading != "eager") {
+    std::cerr << "[ERROR] Modo de carga de procesos no reconocido: "
+              << config.process_loading << std::endl;
+    return false;
+  }
+
+  scheduler.set_memory_manager(memory_manager);
+  scheduler.set_io_manager(io_manager);
+
+  if (metrics) {
+    metrics->set_buffer_size(config.metrics_buffer_size);
+    metrics->set_keyframe_interval(config.metrics_keyframe_interval);
+    uint32_t categories = 0;
+    if (!MetricsCollector::parse_categories(config.metrics_categories,
+                                            categories)) {
+      std::cerr << "[ERROR] Categorías de métricas no reconocidas: "
+                << config.metrics_categories << std::endl;
+      return false;
+    }
+    metrics->set_categories(categories);
+    metrics->set_sample_rate(config.metrics_sample_rate);
+    if (config.metrics_backpressure != "block" &&
+        config.metrics_backpressure != "drop") {
+      std::cerr << "[ERROR] Política de contrapresión no reconocida: "
+                << config.metrics_backpressure << std::endl;
+      return false;
+    }
+    if (config.metrics_writer == "async") {
+      auto policy = config.metrics_backpressure == "drop"
+                        ? MetricsCollector::BackpressurePolicy::DROP
+                        : MetricsCollector::BackpressurePolicy::BLOCK;
+      metrics->enable_async(config.metrics_queue_capacity, policy);
+    } else if (config.metrics_writer != "sync") {
+      std::cerr << "[ERROR] Escritor de métricas no reconocido: "
+                << config.metrics_writer << std::endl;
+      return false;
+    }
+    if (!config.metrics_aggregate_windows.empty() &&
+        !metrics->enable_aggregates(config.metrics_aggregate_windows,
+                                    config.metrics_aggregate_file)) {
+      std::cerr << "[ERROR] No se pudo abrir el archivo de series agregadas"
+                << std::endl;
+      return false;
+    }
+    scheduler.set_metrics_collector(metrics);
+    memory_manager->set_metrics_collector(metrics);
+    io_manager->set_metrics_collector(metrics);
+  }
+
+  if (stream) {
+    scheduler.stream_processes(std::move(stream));
+  } else {
+    scheduler.load_processes(processes);
+  }
+  // El monitor en vivo lee contadores atómicos desde su propio hilo.
+  std::unique_ptr<LiveExporter> live_exporter;
+  if (config.live_metrics_interval > 0) {
+    auto live_stats = std::make_shared<LiveStats>();
+    scheduler.set_live_stats(live_stats);
+    live_exporter = std::make_unique<LiveExporter>(
+        live_stats, std::chrono::milliseconds(config.live_metrics_interval),
+        config.live_metrics_file, std::cerr);
+    live_exporter->start();
+  }
+  try {
+    if (!config.restore_file.empty()) {
+      scheduler.restore_checkpoint(config.restore_file);
+    }
+    if (!config.checkpoint_file.empty()) {
+      scheduler.run_until(config.checkpoint_tick);
+      scheduler.save_checkpoint(config.checkpoint_file);
+      std::cout << "[INFO] Punto de control guardado en: "
+                << config.checkpoint_file << " (tick "
+                << scheduler.get_current_time() << ")\n";
+    }
+  } catch (const std::runtime_error &e) {
+    std::cerr << "[ERROR] " << e.what() << std::endl;
+    return false;
+  }
+  scheduler.run_until_completion();
+  if (live_exporter)
+    live_exporter->stop();
+  scheduler.log_core_summaries();
+  if (metrics && metrics->is_enabled()) {
+    metrics->flush_all();
+    metrics->log_cpu_summary(
+        scheduler.get_current_time(), scheduler.get_cpu_utilization(),
+        scheduler.get_average_waiting_time(),
+        scheduler.get_average_turnaround_time(),
+        scheduler.get_average_response_time(), scheduler.get_context_switches(),
+        config.scheduling_algorithm, scheduler.get_latency_summaries());
+    metrics->log_memory_summary(
+        memory_manager->get_total_page_faults(),
+        memory_manager->get_total_replacements(), config.total_memory_frames,
+        memory_manager->get_peak_used_frames(),
+        config.page_replacement_algorithm,
+        static_cast<int64_t>(scheduler.get_completed_count()),
+        scheduler.get_current_time(),
+        memory_manager->get_deferred_admissions(),
+        memory_manager->get_deferral_ticks(), memory_manager->get_tlb_hits(),
+        memory_manager->get_tlb_misses());
+    const auto &numa_stats = memory_manager->get_numa_stats();
+    if (numa_stats.size() > 1) {
+      for (size_t node = 0; node < numa_stats.size(); ++node) {
+        const auto &stats = numa_stats[node];
+        metrics->log_numa_summary(static_cast<int>(node), stats.frames,
+                                  stats.page_faults, stats.local_accesses,
+                                  stats.remote_accesses, stats.remote_loads,
+                                  stats.remote_stall_ticks);
+      }
+    }
+  }
+
+  result.total_time = scheduler.get_current_time();
+  result.cpu_utilization = scheduler.get_cpu_utilization();
+  result.avg_waiting_time = scheduler.get_average_waiting_time();
+  result.avg_turnaround_time = scheduler.get_average_turnaround_time();
+  result.avg_response_time = scheduler.get_average_response_time();
+  result.context_switches = scheduler.get_context_switches();
+  result.page_faults = memory_manager->get_total_page_faults();
+  result.replacements = memory_manager->get_total_replacements();
+  result.completed_processes = scheduler.get_completed_count();
+  return true;
+}
+
+/**
+ * Convierte el resultado de una simulación a JSON, para las filas del
+ * barrido y la caché de resultados.
+ * @param r Resultado.
+ * @param ok true si la simulación se completó.
+ * @return Objeto con las métricas.
+ */
+json sweep_row(const SimulationResult &r, bool ok) {
+  json row;
+  row["ok"] = ok;
+  row["total_time"] = r.total_time;
+  row["cpu_utilization"] = r.cpu_utilization;
+  row["avg_waiting_time"] = r.avg_waiting_time;
+  row["avg_turnaround_time"] = r.avg_turnaround_time;
+  row["avg_response_time"] = r.avg_response_time;
+  row["context_switches"] = r.context_switches;
+  row["page_faults"] = r.page_faults;
+  row["replacements"] = r.replacements;
+  row["completed_processes"] = r.completed_processes;
+  return row;
+}
+
+/**
+ * Lee el resultado de una simulación desde JSON.
+ * @param row Objeto escrito con sweep_row().
+ * @return Resultado.
+ */
+SimulationResult sweep_result(const json &row) {
+  SimulationResult r;
+  r.total_time = row.at("total_time").get<Tick>();
+  r.cpu_utilization = row.at("cpu_utilization").get<double>();
+  r.avg_waiting_time = row.at("avg_waiting_time").get<double>();
+  r.avg_turnaround_time = row.at("avg_turnaround_time").get<double>();
+  r.avg_response_time = row.at("avg_response_time").get<double>();
+  r.context_switches = row.at("context_switches").get<int64_t>();
+  r.page_faults = row.at("page_faults").get<int64_t>();
+  r.replacements = row.at("replacements").get<int64_t>();
+  r.completed_processes = row.at("completed_processes").get<size_t>();
+  return r;
+}
 
 /**
  * Ejecuta la simulación con los archivos de configuración y procesos especificados.
- * @param process_file Ruta al archivo de definición de procesos.
+ * @param input Archivo de procesos o carga sintética.
  * @param config_file Ruta al archivo de configuración del simulador.
  * @param metrics Colector de métricas opcional para registrar la ejecución.
+ * @param execution_mode Modo de ejecución que reemplaza al de la configuración
+ * (vacío para usar el de la configuración).
  */
-void run_simulation(const std::string &process_file,
-                    const std::string &config_file,
-                    std::shared_ptr<MetricsCollector> metrics = nullptr) {
+void run_simulation(const ProcessInput &input, const std::string &config_file,
+                    std::shared_ptr<MetricsCollector> metrics = nullptr,
+                    const std::string &execution_mode = "") {
   try {
     auto config = ConfigParser::load_simulator_config(config_file);
-    auto processes = ConfigParser::load_processes_from_file(process_file);
+    if (!execution_mode.empty()) {
+      config.execution_mode = execution_mode;
+    }
+    bool streaming = config.process_loading == "stream";
+    std::vector<std::shared_ptr<Process>> processes;
+    if (!streaming) {
+      processes = input.load_all();
+    }
 
-    if (processes.empty()) {
+    if (!streaming && processes.empty()) {
       std::cerr << "[ERROR] No se cargaron procesos." << std::endl;
       return;
     }
 
     std::cout << "\n[CONFIGURACIÓN]\n";
-    std::cout << "  Archivo de procesos:      " << process_file << "\n";
+    if (input.workload) {
+      const auto &workload = *input.workload;
+      std::cout << "  Carga sintética:          " << workload.processes
+                << " procesos, llegadas " << workload.arrival << " (tasa "
+                << workload.arrival_rate << ", semilla " << workload.seed
+                << ")\n";
+    } else {
+      std::cout << "  Archivo de procesos:      " << input.file << "\n";
+    }
     std::cout << "  Archivo de configuración: " << config_file << "\n";
     std::cout << "  Marcos de memoria:        " << config.total_memory_frames
               << "\n";
     std::cout << "  Tamaño de marco:          " << config.frame_size
               << " bytes\n";
+    if (config.huge_page_size > 0) {
+      std::cout << "  Páginas grandes:          " << config.huge_page_frames
+                << " x " << config.huge_page_size << " bytes\n";
+    }
+    if (config.tlb_entries > 0) {
+      std::cout << "  TLB:                      " << config.tlb_entries
+                << " entradas, " << config.tlb_ways << " vías, "
+                << config.tlb_mode << "\n";
+    }
+    if (config.numa_nodes > 1) {
+      std::cout << "  Nodos NUMA:               " << config.numa_nodes << " ("
+                << config.numa_policy << ", latencia remota "
+                << config.numa_remote_latency << ")\n";
+    }
     std::cout << "  Algoritmo de CPU:         " << config.scheduling_algorithm
               << "\n";
+    if (config.scheduling_algorithm == "MLFQ") {
+      std::cout << "  Niveles MLFQ:             " << config.mlfq_quanta.size()
+                << " (elevación cada " << config.mlfq_boost_interval
+                << " ticks)\n";
+    }
+    if (config.scheduling_algorithm == "SJF" ||
+        config.scheduling_algorithm == "SRTF") {
+      std::cout << "  Predicción de ráfagas:    " << config.sjf_prediction;
+      if (config.sjf_prediction == "exponential") {
+        std::cout << " (alpha " << config.sjf_alpha << ", inicial "
+                  << config.sjf_initial_estimate << ")";
+      }
+      std::cout << "\n";
+    }
+    if (config.scheduling_algorithm == "Priority" &&
+        config.priority_aging_interval > 0) {
+      std::cout << "  Envejecimiento:           un nivel cada "
+                << config.priority_aging_interval << " ticks de espera\n";
+    }
+    if (config.scheduling_algorithm == "CFS") {
+      std::cout << "  Latencia CFS:             " << config.cfs_target_latency
+                << " ticks (turno mínimo " << config.cfs_min_granularity
+                << ")\n";
+    }
     std::cout << "  Algoritmo de reemplazo:   "
               << config.page_replacement_algorithm << "\n";
     std::cout << "  Algoritmo de E/S:         "
               << config.io_scheduling_algorithm << "\n";
     std::cout << "  Quantum:                  " << config.quantum << "\n";
     std::cout << "  Quantum E/S:              " << config.io_quantum << "\n";
-    std::cout << "  Procesos cargados:        " << processes.size() << "\n";
-
-    CPUScheduler scheduler;
-
-    if (config.scheduling_algorithm == "FCFS") {
-      scheduler.set_scheduler(std::make_unique<FCFSScheduler>());
-    } else if (config.scheduling_algorithm == "SJF") {
-      scheduler.set_scheduler(std::make_unique<SJFScheduler>());
-    } else if (config.scheduling_algorithm == "RoundRobin") {
-      scheduler.set_scheduler(
-          std::make_unique<RoundRobinScheduler>(config.quantum));
-    } else if (config.scheduling_algorithm == "Priority") {
-      scheduler.set_scheduler(std::make_unique<PriorityScheduler>());
+    if (!config.io_devices.empty()) {
+      std::cout << "  Dispositivos de E/S:     ";
+      for (const auto &device : config.io_devices) {
+        std::cout << " " << device.name << "(" << device.scheduling_algorithm
+                  << ", x" << device.service_rate << ")";
+      }
+      std::cout << "\n";
+    }
+    std::cout << "  Modo de ejecución:        " << config.execution_mode
+              << "\n";
+    std::cout << "  Motor de simulación:      " << config.simulation_engine
+              << "\n";
+    std::cout << "  Bloqueo del núcleo:       " << config.core_locking << "\n";
+    std::cout << "  Núcleos de CPU:           " << config.cpu_cores << "\n";
+    if (streaming) {
+      std::cout << "  Procesos cargados:        al llegar (stream)\n";
     } else {
-      std::cerr << "[ERROR] Algoritmo de planificación no reconocido: "
-                << config.scheduling_algorithm << std::endl;
-      return;
+      std::cout << "  Procesos cargados:        " << processes.size() << "\n";
     }
 
-    std::unique_ptr<ReplacementAlgorithm> replacement_algo;
-    if (config.page_replacement_algorithm == "FIFO") {
-      replacement_algo = std::make_unique<FIFOReplacement>();
-    } else if (config.page_replacement_algorithm == "LRU") {
-      replacement_algo = std::make_unique<LRUReplacement>();
-    } else if (config.page_replacement_algorithm == "Optimal") {
-      replacement_algo = std::make_unique<OptimalReplacement>();
-    } else if (config.page_replacement_algorithm == "NRU") {
-      replacement_algo = std::make_unique<NRUReplacement>();
-    } else {
-      replacement_algo = std::make_unique<FIFOReplacement>();
+    // Con métricas la entrada incluye la traza, que se reutiliza copiándola
+    // al archivo de métricas; cada formato tiene su propia entrada.
+    bool tracing = metrics && metrics->is_enabled();
+    std::string trace_file = tracing ? metrics->get_output_path() : "";
+    std::unique_ptr<ResultCache> cache;
+    CacheKey key;
+    if (!config.result_cache_dir.empty() && (!tracing || !trace_file.empty()) &&
+        ResultCache::cacheable(config, tracing)) {
+      cache = std::make_unique<ResultCache>(config.result_cache_dir,
+                                            config.result_cache_max_bytes);
+      std::string variant = "trace=none";
+      if (tracing) {
+        variant = metrics->get_trace_format() ==
+                          MetricsCollector::TraceFormat::BINARY
+                      ? "trace=binary"
+                      : "trace=jsonl";
+      }
+      key = ResultCache::make_key(ResultCache::describe(config),
+                                  ResultCache::describe(processes), variant);
+      std::string summary;
+      if (cache->load(key, summary, tracing)) {
+        if (tracing) {
+          metrics->disable_output();
+          if (!cache->copy_trace(key, trace_file)) {
+            std::cerr << "[ERROR] No se pudo copiar la traza de la caché: "
+                      << key.name() << std::endl;
+            return;
+          }
+        }
+        std::cout << "\n[INFO] Resultado reutilizado de la caché: "
+                  << key.name() << "\n";
+        return;
+      }
     }
 
-    auto memory_manager = std::make_shared<MemoryManager>(
-        config.total_memory_frames, std::move(replacement_algo), 1);
+    if (PROFILING_ENABLED) {
+      Profiler::instance().reset();
+      if (!config.profile_trace_file.empty())
+        Profiler::instance().enable_trace(PROFILE_TRACE_EVENTS);
+    } else if (!config.profile_trace_file.empty()) {
+      std::cout << "[INFO] profile_trace_file no tiene efecto: el simulador "
+                   "se compiló sin ENABLE_PROFILING\n";
+    }
 
-    auto io_manager = std::make_shared<IOManager>();
-    auto disk_device = std::make_shared<IODevice>("disk");
+    SimulationResult result;
+    bool ok = simulate(config, input, processes, metrics, result);
 
-    if (config.io_scheduling_algorithm == "RoundRobin") {
-      disk_device->set_scheduler(
-          std::make_unique<IORoundRobinScheduler>(config.io_quantum));
-    } else {
-      disk_device->set_scheduler(std::make_unique<IOFCFSScheduler>());
+    if (cache && ok) {
+      if (tracing)
+        metrics->disable_output();
+      if (cache->store(key, sweep_row(result, true).dump(), trace_file)) {
+        std::cout << "\n[INFO] Resultado guardado en la caché: " << key.name()
+                  << "\n";
+      } else {
+        std::cerr << "[ERROR] No se pudo guardar el resultado en la caché: "
+                  << config.result_cache_dir << std::endl;
+      }
+    }
+
+    if (PROFILING_ENABLED) {
+      Profiler::instance().print_report(std::cout);
+      if (!config.profile_trace_file.empty()) {
+        Profiler::instance().write_chrome_trace(config.profile_trace_file);
+        std::cout << "[INFO] Traza de perfilado guardada en: "
+                  << config.profile_trace_file << "\n";
+      }
     }
-    io_manager->add_device("disk", disk_device);
 
-    scheduler.set_memory_manager(memory_manager);
-    scheduler.set_io_manager(io_manager);
+  } catch (const std::exception &e) {
+    std::cerr << "[ERROR] " << e.what() << std::endl;
+  }
+}
+
+/**
+ * Escapa un campo para el formato CSV.
+ * @param value Valor del campo.
+ * @return Campo entre comillas si contiene separadores o comillas.
+ */
+std::string csv_field(const std::string &value) {
+  if (value.find_first_of(",\"\n") == std::string::npos)
+    return value;
+  std::string quoted = "\"";
+  for (char c : value) {
+    if (c == '"')
+      quoted += '"';
+    quoted += c;
+  }
+  return quoted + "\"";
+}
+
+/// Rejilla de parámetros de un barrido, en el orden del archivo.
+using ParameterGrid =
+    std::vector<std::pair<std::string, std::vector<std::string>>>;
+
+/**
+ * Obtiene los valores de una combinación de la rejilla. Cada combinación se
+ * identifica por su índice en orden lexicográfico.
+ * @param grid Rejilla del barrido.
+ * @param index Índice de la combinación.
+ * @return Valor de cada parámetro.
+ */
+std::vector<std::string> sweep_combination(const ParameterGrid &grid,
+                                           size_t index) {
+  std::vector<std::string> values(grid.size());
+  for (size_t k = grid.size(); k-- > 0;) {
+    const auto &options = grid[k].second;
+    values[k] = options[index % options.size()];
+    index /= options.size();
+  }
+  return values;
+}
+
+/**
+ * Abre un archivo de resultados del barrido, creando su directorio.
+ * @param output_file Ruta del archivo.
+ * @param out Flujo a abrir.
+ * @return false si no se pudo abrir.
+ */
+bool open_sweep_output(const std::string &output_file, std::ofstream &out) {
+  std::filesystem::path output_path(output_file);
+  if (!output_path.parent_path().empty())
+    std::filesystem::create_directories(output_path.parent_path());
+  out.open(output_file, std::ios::trunc);
+  if (!out.is_open()) {
+    std::cerr << "[ERROR] No se pudo abrir el archivo de resultados: "
+              << output_file << std::endl;
+    return false;
+  }
+  return true;
+}
+
+/**
+ * Escribe la tabla de resultados de un barrido completo, con una fila por
+ * combinación en orden.
+ * @param output_file Tabla de resultados (.csv, o JSON en otro caso).
+ * @param grid Rejilla del barrido.
+ * @param results Resultado de cada combinación.
+ * @param succeeded Combinaciones completadas.
+ * @return Número de combinaciones fallidas, o -1 si no se pudo escribir.
+ */
+int64_t write_sweep_table(const std::string &output_file,
+                          const ParameterGrid &grid,
+                          const std::vector<SimulationResult> &results,
+                          const std::vector<char> &succeeded) {
+  std::ofstream out;
+  if (!open_sweep_output(output_file, out))
+    return -1;
+
+  bool csv = std::filesystem::path(output_file).extension() == ".csv";
+  if (csv) {
+    for (const auto &[key, values] : grid)
+      out << csv_field(key) << ',';
+    out << "ok,total_time,cpu_utilization,avg_waiting_time,"
+           "avg_turnaround_time,avg_response_time,context_switches,"
+           "page_faults,replacements,completed_processes\n";
+  }
+
+  json table = json::array();
+  int64_t failures = 0;
+  for (size_t run = 0; run < results.size(); ++run) {
+    auto values = sweep_combination(grid, run);
+    const auto &r = results[run];
+    if (!succeeded[run])
+      failures++;
 
-    if (metrics) {
-      scheduler.set_metrics_collector(metrics);
-      memory_manager->set_metrics_collector(metrics);
-      io_manager->set_metrics_collector(metrics);
+    if (csv) {
+      for (const auto &value : values)
+        out << csv_field(value) << ',';
+      out << (succeeded[run] ? "true" : "false") << ',' << r.total_time << ','
+          << r.cpu_utilization << ',' << r.avg_waiting_time << ','
+          << r.avg_turnaround_time << ',' << r.avg_response_time << ','
+          << r.context_switches << ',' << r.page_faults << ','
+          << r.replacements << ',' << r.completed_processes << '\n';
+      continue;
     }
 
-    scheduler.load_processes(processes);
-    scheduler.run_until_completion();
+    json row = sweep_row(r, succeeded[run]);
+    for (size_t k = 0; k < grid.size(); ++k)
+      row["parameters"][grid[k].first] = values[k];
+    table.push_back(row);
+  }
+  if (!csv)
+    out << table.dump(2) << '\n';
+  return failures;
+}
 
+/**
+ * Ejecuta un barrido de simulaciones: una por cada combinación de la rejilla
+ * de parámetros, repartidas entre tantos hilos como núcleos. Los procesos se
+ * ejecutan en modo inline y sin métricas por tick; el resultado es una única
+ * tabla con una fila por combinación. Con result_cache_dir, las
+ * combinaciones ya simuladas se toman de la caché de resultados.
+ *
+ * Con varias partes (shard_count > 1) solo se ejecutan las combinaciones
+ * cuyo índice módulo shard_count es shard_index, y el resultado es un
+ * archivo parcial en JSON con la rejilla y el índice de cada combinación,
+ * que merge_sweep() une con las demás partes.
+ * @param input Archivo de procesos o carga sintética.
+ * @param config_file Configuración base; la rejilla reemplaza sus parámetros.
+ * @param grid_file Ruta a la rejilla de parámetros.
+ * @param output_file Tabla de resultados (.csv, o JSON en otro caso) o
+ * archivo parcial.
+ * @param jobs Número de hilos (0 = número de núcleos).
+ * @param shard_index Parte a ejecutar.
+ * @param shard_count Número de partes (1 = barrido completo).
+ * @return true si todas las simulaciones se completaron.
+ */
+bool run_sweep(const ProcessInput &input, const std::string &config_file,
+               const std::string &grid_file, const std::string &output_file,
+               unsigned jobs, int shard_index = 0, int shard_count = 1) {
+  SimulatorConfig base;
+  ParameterGrid grid;
+  try {
+    base = ConfigParser::load_simulator_config(config_file);
+    grid = ConfigParser::load_parameter_grid(grid_file);
   } catch (const std::exception &e) {
     std::cerr << "[ERROR] " << e.what() << std::endl;
+    return false;
+  }
+  base.execution_mode = "inline";
+  base.live_metrics_interval = 0;
+  // La caché es la de la configuración base: la rejilla no la cambia.
+  std::unique_ptr<ResultCache> cache;
+  if (!base.result_cache_dir.empty()) {
+    cache = std::make_unique<ResultCache>(base.result_cache_dir,
+                                          base.result_cache_max_bytes);
+  }
+
+  size_t total_runs = 1;
+  for (const auto &[key, values] : grid)
+    total_runs *= values.size();
+
+  // Las partes toman combinaciones alternas: las que comparten los primeros
+  // parámetros, de costo parecido, quedan repartidas entre las máquinas.
+  std::vector<size_t> runs;
+  for (size_t run = shard_index; run < total_runs; run += shard_count)
+    runs.push_back(run);
+
+  if (jobs == 0)
+    jobs = std::max(1u, std::thread::hardware_concurrency());
+  jobs = static_cast<unsigned>(
+      std::max<size_t>(1, std::min<size_t>(jobs, runs.size())));
+
+  std::cout << "\n[BARRIDO]\n";
+  std::cout << "  Combinaciones: " << total_runs << "\n";
+  if (shard_count > 1) {
+    std::cout << "  Parte:         " << shard_index << "/" << shard_count
+              << " (" << runs.size() << " combinaciones)\n";
   }
+  std::cout << "  Hilos:         " << jobs << "\n";
+
+  std::vector<SimulationResult> results(total_runs);
+  std::vector<char> succeeded(total_runs, false);
+  std::atomic<size_t> next_run{0};
+  std::atomic<size_t> reused{0};
+
+  auto worker = [&]() {
+    for (size_t i = next_run++; i < runs.size(); i = next_run++) {
+      size_t run = runs[i];
+      SimulatorConfig config = base;
+      auto values = sweep_combination(grid, run);
+      try {
+        for (size_t k = 0; k < grid.size(); ++k)
+          ConfigParser::apply_config_value(config, grid[k].first, values[k]);
+        std::vector<std::shared_ptr<Process>> processes;
+        if (config.process_loading != "stream") {
+          processes = input.load_all();
+          if (processes.empty())
+            continue;
+        }
+        bool cached = cache && ResultCache::cacheable(config, false);
+        CacheKey key;
+        if (cached) {
+          key = ResultCache::make_key(ResultCache::describe(config),
+                                      ResultCache::describe(processes),
+                                      "trace=none");
+          std::string summary;
+          if (cache->load(key, summary)) {
+            // Una entrada ilegible se descarta y la combinación se simula.
+            try {
+              results[run] = sweep_result(json::parse(summary));
+              succeeded[run] = true;
+              reused++;
+              continue;
+            } catch (const json::exception &) {
+            }
+          }
+        }
+        succeeded[run] =
+            simulate(config, input, processes, nullptr, results[run]);
+        if (cached && succeeded[run])
+          cache->store(key, sweep_row(results[run], true).dump());
+      } catch (const std::exception &e) {
+        std::cerr << "[ERROR] " << e.what() << std::endl;
+      }
+    }
+  };
+
+  std::vector<std::thread> workers;
+  for (unsigned i = 0; i < jobs; ++i)
+    workers.emplace_back(worker);
+  for (auto &t : workers)
+    t.join();
+
+  int64_t failures = 0;
+  if (shard_count > 1) {
+    std::ofstream out;
+    if (!open_sweep_output(output_file, out))
+      return false;
+    json partial;
+    partial["grid"] = json::array();
+    for (const auto &[key, values] : grid)
+      partial["grid"].push_back({{"key", key}, {"values", values}});
+    partial["shard"] = shard_index;
+    partial["shards"] = shard_count;
+    partial["results"] = json::array();
+    for (size_t run : runs) {
+      json row = sweep_row(results[run], succeeded[run]);
+      row["run"] = run;
+      partial["results"].push_back(std::move(row));
+      if (!succeeded[run])
+        failures++;
+    }
+    out << partial.dump(2) << '\n';
+  } else {
+    failures = write_sweep_table(output_file, grid, results, succeeded);
+    if (failures < 0)
+      return false;
+  }
+
+  std::cout << "  Fallidas:      " << failures << "\n";
+  if (cache)
+    std::cout << "  Reutilizadas:  " << reused << "\n";
+  std::cout << "\n[INFO] Resultados del barrido en: " << output_file << "\n";
+  return failures == 0;
+}
+
+/**
+ * Une los archivos parciales de un barrido por partes en la misma tabla que
+ * habría escrito el barrido completo. Todas las partes deben tener la misma
+ * rejilla y, juntas, cubrir cada combinación exactamente una vez.
+ * @param output_file Tabla de resultados (.csv, o JSON en otro caso).
+ * @param partial_files Archivos parciales, en cualquier orden.
+ * @return true si la tabla se escribió y todas las combinaciones se
+ * completaron.
+ */
+bool merge_sweep(const std::string &output_file,
+                 const std::vector<std::string> &partial_files) {
+  ParameterGrid grid;
+  std::vector<SimulationResult> results;
+  std::vector<char> succeeded;
+  std::vector<char> seen;
+  try {
+    for (size_t i = 0; i < partial_files.size(); ++i) {
+      std::ifstream in(partial_files[i]);
+      if (!in.is_open()) {
+        throw std::runtime_error("No se pudo abrir el resultado parcial: " +
+                                 partial_files[i]);
+      }
+      json partial = json::parse(in);
+      ParameterGrid partial_grid;
+      for (const auto &param : partial.at("grid")) {
+        partial_grid.emplace_back(
+            param.at("key").get<std::string>(),
+            param.at("values").get<std::vector<std::string>>());
+      }
+      if (i == 0) {
+        grid = std::move(partial_grid);
+        size_t total_runs = 1;
+        for (const auto &[key, values] : grid)
+          total_runs *= values.size();
+        results.assign(total_runs, SimulationResult());
+        succeeded.assign(total_runs, false);
+        seen.assign(total_runs, false);
+      } else if (partial_grid != grid) {
+        throw std::runtime_error("La rejilla de " + partial_files[i] +
+                                 " no coincide con la de " + partial_files[0]);
+      }
+      for (const auto &row : partial.at("results")) {
+        size_t run = row.at("run").get<size_t>();
+        if (run >= results.size() || seen[run]) {
+          throw std::runtime_error("Combinación " + std::to_string(run) +
+                                   " repetida o fuera de la rejilla en " +
+                                   partial_files[i]);
+        }
+        seen[run] = true;
+        succeeded[run] = row.at("ok").get<bool>();
+        results[run] = sweep_result(row);
+      }
+    }
+  } catch (const std::exception &e) {
+    std::cerr << "[ERROR] " << e.what() << std::endl;
+    return false;
+  }
+
+  size_t missing = std::count(seen.begin(), seen.end(), false);
+  if (missing > 0) {
+    std::cerr << "[ERROR] Faltan " << missing
+              << " combinaciones del barrido; ¿falta alguna parte?"
+              << std::endl;
+    return false;
+  }
+
+  int64_t failures = write_sweep_table(output_file, grid, results, succeeded);
+  if (failures < 0)
+    return false;
+
+  std::cout << "\n[BARRIDO]\n";
+  std::cout << "  Partes:        " << partial_files.size() << "\n";
+  std::cout << "  Combinaciones: " << results.size() << "\n";
+  std::cout << "  Fallidas:      " << failures << "\n";
+  std::cout << "\n[INFO] Resultados del barrido en: " << output_file << "\n";
+  return failures == 0;
 }
 
 /**
@@ -145,6 +984,49 @@ void print_usage(const char *program_name) {
   std::cout
       << "        Especifica el archivo donde se guardarán las métricas.\n";
   std::cout << "        Por defecto: data/resultados/metrics.jsonl\n\n";
+  std::cout << "    -e <modo>\n";
+  std::cout << "        Modo de ejecución de los procesos: threaded (un hilo "
+               "por proceso)\n";
+  std::cout << "        o inline (sin hilos ni esperas, mismas métricas).\n";
+  std::cout << "        Por defecto: el indicado en la configuración.\n\n";
+  std::cout << "    -t <formato>\n";
+  std::cout << "        Formato del archivo de métricas: jsonl o binary (traza "
+               "compacta).\n";
+  std::cout << "        Con binary el archivo por defecto es "
+               "data/resultados/metrics.bin.\n";
+  std::cout << "        Por defecto: jsonl\n\n";
+  std::cout << "    --sweep <rejilla>\n";
+  std::cout << "        Ejecuta en paralelo una simulación por cada combinación "
+               "de la rejilla\n";
+  std::cout << "        de parámetros (líneas clave=valor1,valor2,...) y guarda "
+               "una tabla\n";
+  std::cout << "        de resultados en lugar de archivos de métricas.\n\n";
+  std::cout << "    -o <archivo>\n";
+  std::cout << "        Tabla de resultados del barrido (.csv, o JSON con otra "
+               "extensión).\n";
+  std::cout << "        Por defecto: data/resultados/sweep.csv\n\n";
+  std::cout << "    -j <hilos>\n";
+  std::cout << "        Hilos del barrido. Por defecto: número de núcleos.\n\n";
+  std::cout << "    --shard <i/N>\n";
+  std::cout << "        Ejecuta solo la parte i (desde 0) de N del barrido y "
+               "guarda un\n";
+  std::cout << "        resultado parcial en JSON. Por defecto: "
+               "data/resultados/sweep_<i>_<N>.json\n\n";
+  std::cout << "    --merge <salida> <parcial>...\n";
+  std::cout << "        Une los resultados parciales de todas las partes en la "
+               "tabla del\n";
+  std::cout << "        barrido completo y termina.\n\n";
+  std::cout << "    -g <carga>\n";
+  std::cout << "        Simula una carga sintética generada a partir de sus "
+               "parámetros (líneas\n";
+  std::cout << "        clave=valor) en lugar del archivo de procesos. Con "
+               "process_loading=stream\n";
+  std::cout << "        cada proceso se genera al llegar.\n\n";
+  std::cout << "    --generate <carga> <salida>\n";
+  std::cout << "        Escribe la carga sintética como archivo de procesos y "
+               "termina.\n\n";
+  std::cout << "    --to-jsonl <entrada> <salida>\n";
+  std::cout << "        Convierte una traza binaria a JSONL y termina.\n\n";
   std::cout << "    -h, --help\n";
   std::cout << "        Muestra esta ayuda.\n\n";
   std::cout << "EJEMPLOS\n";
@@ -154,7 +1036,21 @@ void print_usage(const char *program_name) {
   std::cout << "    " << program_name
             << " -f mis_procesos.txt -c mi_config.txt\n\n";
   std::cout << "    # Especificar archivo de métricas personalizado\n";
-  std::cout << "    " << program_name << " -m resultados/test.jsonl\n";
+  std::cout << "    " << program_name << " -m resultados/test.jsonl\n\n";
+  std::cout << "    # Barrido de algoritmos y marcos en paralelo\n";
+  std::cout << "    " << program_name
+            << " --sweep data/procesos/sweep.txt -o resultados/sweep.csv\n\n";
+  std::cout << "    # El mismo barrido en dos máquinas, unido después\n";
+  std::cout << "    " << program_name
+            << " --sweep data/procesos/sweep.txt --shard 0/2 -o parte0.json\n";
+  std::cout << "    " << program_name
+            << " --sweep data/procesos/sweep.txt --shard 1/2 -o parte1.json\n";
+  std::cout << "    " << program_name
+            << " --merge resultados/sweep.csv parte0.json parte1.json\n\n";
+  std::cout << "    # Carga sintética reproducible, a archivo o directa\n";
+  std::cout << "    " << program_name
+            << " --generate data/procesos/workload.txt procesos_gen.txt\n";
+  std::cout << "    " << program_name << " -g data/procesos/workload.txt\n";
 }
 
 /**
@@ -175,21 +1071,81 @@ void print_visualization_instructions(const std::string &metrics_file) {
  * @return Código de salida (0 = éxito, 1 = error).
  */
 int main(int argc, char *argv[]) {
-  std::string process_file = "data/procesos/procesos.txt";
+  ProcessInput input{"data/procesos/procesos.txt", std::nullopt};
+  std::string workload_file;
   std::string config_file = "data/procesos/config.txt";
   std::string metrics_file = "data/resultados/metrics.jsonl";
+  std::string execution_mode;
+  std::string trace_format = "jsonl";
+  std::string sweep_grid;
+  std::string sweep_output;
+  unsigned sweep_jobs = 0;
+  int shard_index = 0;
+  int shard_count = 1;
+  bool custom_metrics_file = false;
   bool enable_metrics = true;
 
   for (int i = 1; i < argc; i++) {
     if (std::strcmp(argv[i], "-f") == 0 && i + 1 < argc) {
-      process_file = argv[++i];
+      input.file = argv[++i];
+    } else if (std::strcmp(argv[i], "-g") == 0 && i + 1 < argc) {
+      workload_file = argv[++i];
     } else if (std::strcmp(argv[i], "-c") == 0 && i + 1 < argc) {
       config_file = argv[++i];
+    } else if (std::strcmp(argv[i], "-e") == 0 && i + 1 < argc) {
+      execution_mode = argv[++i];
     } else if (std::strcmp(argv[i], "-m") == 0) {
       enable_metrics = true;
       if (i + 1 < argc && argv[i + 1][0] != '-') {
         metrics_file = argv[++i];
+        custom_metrics_file = true;
+      }
+    } else if (std::strcmp(argv[i], "-t") == 0 && i + 1 < argc) {
+      trace_format = argv[++i];
+    } else if (std::strcmp(argv[i], "--sweep") == 0 && i + 1 < argc) {
+      sweep_grid = argv[++i];
+    } else if (std::strcmp(argv[i], "-o") == 0 && i + 1 < argc) {
+      sweep_output = argv[++i];
+    } else if (std::strcmp(argv[i], "-j") == 0 && i + 1 < argc) {
+      sweep_jobs = static_cast<unsigned>(std::max(0, std::atoi(argv[++i])));
+    } else if (std::strcmp(argv[i], "--shard") == 0 && i + 1 < argc) {
+      if (!ConfigParser::parse_shard(argv[++i], shard_index, shard_count)) {
+        std::cerr << "[ERROR] Parte de barrido no válida (se espera i/N): "
+                  << argv[i] << "\n";
+        return 1;
+      }
+    } else if (std::strcmp(argv[i], "--merge") == 0 && i + 2 < argc) {
+      std::vector<std::string> partials(argv + i + 2, argv + argc);
+      return merge_sweep(argv[i + 1], partials) ? 0 : 1;
+    } else if (std::strcmp(argv[i], "--to-jsonl") == 0 && i + 2 < argc) {
+      const char *input = argv[i + 1];
+      const char *output = argv[i + 2];
+      if (!MetricsCollector::convert_binary_to_jsonl(input, output)) {
+        std::cerr << "[ERROR] No se pudo convertir la traza binaria: " << input
+                  << "\n";
+        return 1;
       }
+      std::cout << "[INFO] Traza convertida en: " << output << "\n";
+      return 0;
+    } else if (std::strcmp(argv[i], "--generate") == 0 && i + 2 < argc) {
+      const char *spec_file = argv[i + 1];
+      const char *output = argv[i + 2];
+      try {
+        WorkloadGenerator generator(
+            ConfigParser::load_workload_spec(spec_file));
+        std::ofstream out(output, std::ios::trunc);
+        if (!out.is_open()) {
+          std::cerr << "[ERROR] No se pudo abrir el archivo de procesos: "
+                    << output << "\n";
+          return 1;
+        }
+        generator.write(out);
+      } catch (const std::exception &e) {
+        std::cerr << "[ERROR] " << e.what() << "\n";
+        return 1;
+      }
+      std::cout << "[INFO] Carga sintética generada en: " << output << "\n";
+      return 0;
     } else if (std::strcmp(argv[i], "-h") == 0 ||
                std::strcmp(argv[i], "--help") == 0) {
       print_usage(argv[0]);
@@ -197,6 +1153,39 @@ int main(int argc, char *argv[]) {
     }
   }
 
+  if (!workload_file.empty()) {
+    try {
+      input.workload = ConfigParser::load_workload_spec(workload_file);
+    } catch (const std::exception &e) {
+      std::cerr << "[ERROR] " << e.what() << "\n";
+      return 1;
+    }
+  }
+
+  if (!sweep_grid.empty()) {
+    if (sweep_output.empty()) {
+      sweep_output = shard_count > 1
+                         ? "data/resultados/sweep_" +
+                               std::to_string(shard_index) + "_" +
+                               std::to_string(shard_count) + ".json"
+                         : "data/resultados/sweep.csv";
+    }
+    bool ok = run_sweep(input, config_file, sweep_grid, sweep_output,
+                        sweep_jobs, shard_index, shard_count);
+    return ok ? 0 : 1;
+  }
+
+  MetricsCollector::TraceFormat format = MetricsCollector::TraceFormat::JSONL;
+  if (trace_format == "binary") {
+    format = MetricsCollector::TraceFormat::BINARY;
+    if (!custom_metrics_file)
+      metrics_file = "data/resultados/metrics.bin";
+  } else if (trace_format != "jsonl") {
+    std::cerr << "[ERROR] Formato de métricas desconocido: " << trace_format
+              << "\n";
+    return 1;
+  }
+
   std::shared_ptr<MetricsCollector> metrics;
   if (enable_metrics) {
     std::string final_metrics_path;
@@ -217,7 +1206,7 @@ int main(int argc, char *argv[]) {
     }
 
     metrics = std::make_shared<MetricsCollector>();
-    if (!metrics->enable_file_output(final_metrics_path)) {
+    if (!metrics->enable_file_output(final_metrics_path, format)) {
       std::cerr << "[ERROR] No se pudo abrir el archivo de métricas: "
                 << final_metrics_path << "\n";
       return 1;
@@ -225,10 +1214,14 @@ int main(int argc, char *argv[]) {
     metrics_file = final_metrics_path;
   }
 
-  run_simulation(process_file, config_file, metrics);
+  run_simulation(input, config_file, metrics, execution_mode);
 
   if (metrics) {
     metrics->flush_all();
+    if (metrics->get_dropped_events() > 0) {
+      std::cout << "\n[INFO] Eventos de métricas descartados: "
+                << metrics->get_dropped_events() << "\n";
+    }
     metrics->disable_output();
     std::cout << "\n[INFO] Métricas guardadas en: " << metrics_file << "\n";
     print_visualization_instructions(metrics_file);
@@ -0,0 +1,92 @@
+#include "memory/clock_replacement.hpp"
+#include "core/process.hpp"
+#include "core/snapshot.hpp"
+
+namespace OSSimulator {
+
+int ClockReplacement::select_victim(
+    const std::vector<Frame> &frames,
+    const std::unordered_map<int, std::shared_ptr<Process>> & /*process_map*/,
+    Tick /*current_time*/) {
+  std::size_t first = static_cast<std::size_t>(first_frame);
+  std::size_t end = frame_end(frames);
+  if (end <= first)
+    return -1;
+  std::size_t count = end - first;
+  ensure_frame(static_cast<int>(end) - 1);
+
+  // Dos vueltas bastan: la primera limpia los bits de uso.
+  for (std::size_t step = 0; step < 2 * count; ++step) {
+    std::size_t frame_id = first + hand % count;
+    hand = (frame_id - first + 1) % count;
+
+    if (is_skipped(frames, frame_id))
+      continue;
+    if (use_bit[frame_id]) {
+      use_bit[frame_id] = false;
+      continue;
+    }
+    return static_cast<int>(frame_id);
+  }
+  return -1;
+}
+
+void ClockReplacement::on_page_access(int frame_id) {
+  if (frame_id < 0)
+    return;
+  ensure_frame(frame_id);
+  use_bit[frame_id] = true;
+  pinned[frame_id] = true;
+}
+
+void ClockReplacement::on_frame_release(int frame_id) {
+  if (frame_id < 0 || frame_id >= static_cast<int>(use_bit.size()))
+    return;
+  use_bit[frame_id] = false;
+  pinned[frame_id] = false;
+}
+
+void ClockReplacement::on_process_referenced(const Process &process,
+                                             bool referenced) {
+  for (const auto &page : process.page_table) {
+    if (!page.is_valid() || !owns_frame(page.get_frame_number()))
+      continue;
+    ensure_frame(page.get_frame_number());
+    pinned[page.get_frame_number()] = referenced;
+    if (referenced)
+      use_bit[page.get_frame_number()] = true;
+  }
+}
+
+void ClockReplacement::on_frame_referenced(int frame_id) {
+  if (frame_id < 0 || !owns_frame(frame_id))
+    return;
+  ensure_frame(frame_id);
+  pinned[frame_id] = true;
+}
+
+void ClockReplacement::ensure_frame(int frame_id) {
+  if (frame_id >= static_cast<int>(use_bit.size())) {
+    use_bit.resize(frame_id + 1, false);
+    pinned.resize(frame_id + 1, false);
+  }
+}
+
+bool ClockReplacement::is_skipped(const std::vector<Frame> &frames,
+                                  std::size_t frame_id) const {
+  return !frames[frame_id].occupied || pinned[frame_id];
+}
+
+void ClockReplacement::save_state(SnapshotWriter &out) const {
+  out.put_vector(use_bit);
+  out.put_vector(pinned);
+  out.put_uint(hand);
+}
+
+void ClockReplacement::load_state(SnapshotReader &in) {
+  in.get_vector(use_bit);
+  in.get_vector(pinned);
+  hand = static_cast<std::size_t>(in.get_uint());
+}
+
+} // namespace OSSimulator
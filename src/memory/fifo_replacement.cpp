@@ -1,5 +1,6 @@
 #include "memory/fifo_replacement.hpp"
 #include "core/process.hpp"
+#include "core/snapshot.hpp"
 #include <algorithm>
 
 namespace OSSimulator {
@@ -7,11 +8,11 @@ namespace OSSimulator {
 int FIFOReplacement::select_victim(
     const std::vector<Frame> &frames,
     const std::unordered_map<int, std::shared_ptr<Process>> & /*process_map*/,
-    int /*current_time*/) {
-  if (fifo_queue.empty())
+    Tick /*current_time*/) {
+  if (live == 0)
     return -1;
 
-  int candidate = fifo_queue.front();
+  int candidate = ring[head];
 
   if (candidate >= 0 && candidate < static_cast<int>(frames.size())) {
     const Frame &frame = frames[candidate];
@@ -24,15 +25,80 @@ int FIFOReplacement::select_victim(
 }
 
 void FIFOReplacement::on_page_access(int frame_id) {
-  bool found = (std::find(fifo_queue.begin(), fifo_queue.end(), frame_id) !=
-                fifo_queue.end());
-  if (!found) {
-    fifo_queue.push_back(frame_id);
-  }
+  if (frame_id < 0)
+    return;
+
+  if (frame_id >= static_cast<int>(position.size()))
+    position.resize(frame_id + 1, -1);
+  if (position[frame_id] != -1)
+    return;
+
+  if (used == ring.size())
+    compact();
+
+  std::size_t slot = (head + used) % ring.size();
+  ring[slot] = frame_id;
+  position[frame_id] = static_cast<int>(slot);
+  ++used;
+  ++live;
 }
 
 void FIFOReplacement::on_frame_release(int frame_id) {
-  fifo_queue.remove(frame_id);
+  if (frame_id < 0 || frame_id >= static_cast<int>(position.size()) ||
+      position[frame_id] == -1)
+    return;
+
+  ring[position[frame_id]] = -1;
+  position[frame_id] = -1;
+  --live;
+  skip_holes();
+}
+
+void FIFOReplacement::skip_holes() {
+  while (used > 0 && ring[head] == -1) {
+    head = (head + 1) % ring.size();
+    --used;
+  }
+  if (used == 0)
+    head = 0;
+}
+
+void FIFOReplacement::compact() {
+  std::size_t capacity = ring.size();
+  if (live * 2 > capacity)
+    capacity *= 2;
+  capacity = std::max<std::size_t>(capacity, 8);
+
+  std::vector<int> compacted(capacity, -1);
+  std::size_t count = 0;
+  for (std::size_t i = 0; i < used; ++i) {
+    int frame_id = ring[(head + i) % ring.size()];
+    if (frame_id == -1)
+      continue;
+    compacted[count] = frame_id;
+    position[frame_id] = static_cast<int>(count);
+    ++count;
+  }
+
+  ring = std::move(compacted);
+  head = 0;
+  used = count;
+}
+
+void FIFOReplacement::save_state(SnapshotWriter &out) const {
+  out.put_vector(ring);
+  out.put_vector(position);
+  out.put_uint(head);
+  out.put_uint(used);
+  out.put_uint(live);
+}
+
+void FIFOReplacement::load_state(SnapshotReader &in) {
+  in.get_vector(ring);
+  in.get_vector(position);
+  head = static_cast<std::size_t>(in.get_uint());
+  used = static_cast<std::size_t>(in.get_uint());
+  live = static_cast<std::size_t>(in.get_uint());
 }
 
 } // namespace OSSimulator
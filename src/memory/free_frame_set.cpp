@@ -0,0 +1,101 @@
+#include "memory/free_frame_set.hpp"
+
+namespace OSSimulator {
+
+namespace {
+
+int lowest_bit(uint64_t word) {
+#if defined(__GNUC__) || defined(__clang__)
+  return __builtin_ctzll(word);
+#else
+  int bit = 0;
+  while ((word & 1ULL) == 0) {
+    word >>= 1;
+    ++bit;
+  }
+  return bit;
+#endif
+}
+
+} // namespace
+
+FreeFrameSet::FreeFrameSet(int total_frames)
+    : total_frames(total_frames > 0 ? total_frames : 0), free_frames(0) {
+  size_t count = static_cast<size_t>(this->total_frames);
+  do {
+    size_t words = (count + 63) / 64;
+    levels.emplace_back(words == 0 ? 1 : words, 0);
+    count = words;
+  } while (count > 1);
+
+  for (int i = 0; i < this->total_frames; ++i) {
+    set_bit(i);
+  }
+  free_frames = this->total_frames;
+}
+
+void FreeFrameSet::set_bit(int frame_id) {
+  size_t index = static_cast<size_t>(frame_id);
+  for (auto &level : levels) {
+    uint64_t &word = level[index / 64];
+    bool was_empty = word == 0;
+    word |= 1ULL << (index % 64);
+    if (!was_empty) {
+      break;
+    }
+    index /= 64;
+  }
+}
+
+void FreeFrameSet::clear_bit(int frame_id) {
+  size_t index = static_cast<size_t>(frame_id);
+  for (auto &level : levels) {
+    uint64_t &word = level[index / 64];
+    word &= ~(1ULL << (index % 64));
+    if (word != 0) {
+      break;
+    }
+    index /= 64;
+  }
+}
+
+int FreeFrameSet::first_free() const {
+  if (free_frames == 0) {
+    return -1;
+  }
+
+  size_t index = 0;
+  for (size_t level = levels.size(); level-- > 0;) {
+    uint64_t word = levels[level][index];
+    index = index * 64 + static_cast<size_t>(lowest_bit(word));
+  }
+  return static_cast<int>(index);
+}
+
+void FreeFrameSet::mark_used(int frame_id) {
+  if (!is_free(frame_id)) {
+    return;
+  }
+  clear_bit(frame_id);
+  free_frames--;
+}
+
+void FreeFrameSet::mark_free(int frame_id) {
+  if (frame_id < 0 || frame_id >= total_frames || is_free(frame_id)) {
+    return;
+  }
+  set_bit(frame_id);
+  free_frames++;
+}
+
+bool FreeFrameSet::is_free(int frame_id) const {
+  if (frame_id < 0 || frame_id >= total_frames) {
+    return false;
+  }
+  size_t index = static_cast<size_t>(frame_id);
+  return (levels[0][index / 64] >> (index % 64)) & 1ULL;
+}
+
+int FreeFrameSet::free_count() const { return free_frames; }
+
+} // namespace OSSimulator
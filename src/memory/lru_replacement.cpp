@@ -1,32 +1,102 @@
 #include "memory/lru_replacement.hpp"
 #include "core/process.hpp"
-#include <limits>
+#include "core/snapshot.hpp"
 
 namespace OSSimulator {
 
 int LRUReplacement::select_victim(
     const std::vector<Frame> &frames,
     const std::unordered_map<int, std::shared_ptr<Process>> &process_map,
-    int /*current_time*/) {
-  int victim = -1;
-  int min_time = std::numeric_limits<int>::max();
+    Tick /*current_time*/) {
+  for (int frame_id = head; frame_id != -1; frame_id = next[frame_id]) {
+    if (frame_id >= static_cast<int>(frames.size()))
+      continue;
 
-  for (const auto &frame : frames) {
+    const Frame &frame = frames[frame_id];
     if (!frame.occupied)
       continue;
 
     auto it = process_map.find(frame.process_id);
-    if (it != process_map.end()) {
-      const Page &page = it->second->page_table[frame.page_id];
-      if (page.referenced)
-        continue;
-      if (page.last_access_time < min_time) {
-        min_time = page.last_access_time;
-        victim = frame.frame_id;
-      }
-    }
+    if (it == process_map.end())
+      continue;
+
+    const auto &page_table = it->second->page_table;
+    if (frame.page_id < 0 ||
+        frame.page_id >= static_cast<int>(page_table.size()))
+      continue;
+    if (page_table[frame.page_id].is_referenced())
+      continue;
+    return frame_id;
+  }
+  return -1;
+}
+
+void LRUReplacement::on_page_access(int frame_id) {
+  if (frame_id < 0)
+    return;
+
+  if (frame_id >= static_cast<int>(linked.size())) {
+    prev.resize(frame_id + 1, -1);
+    next.resize(frame_id + 1, -1);
+    linked.resize(frame_id + 1, false);
   }
-  return victim;
+
+  if (linked[frame_id]) {
+    if (frame_id == tail)
+      return;
+    unlink(frame_id);
+  }
+
+  prev[frame_id] = tail;
+  next[frame_id] = -1;
+  if (tail != -1)
+    next[tail] = frame_id;
+  else
+    head = frame_id;
+  tail = frame_id;
+  linked[frame_id] = true;
+}
+
+void LRUReplacement::on_frame_release(int frame_id) {
+  if (frame_id < 0 || frame_id >= static_cast<int>(linked.size()) ||
+      !linked[frame_id])
+    return;
+  unlink(frame_id);
+}
+
+void LRUReplacement::unlink(int frame_id) {
+  int before = prev[frame_id];
+  int after = next[frame_id];
+
+  if (before != -1)
+    next[before] = after;
+  else
+    head = after;
+
+  if (after != -1)
+    prev[after] = before;
+  else
+    tail = before;
+
+  prev[frame_id] = -1;
+  next[frame_id] = -1;
+  linked[frame_id] = false;
+}
+
+void LRUReplacement::save_state(SnapshotWriter &out) const {
+  out.put_vector(prev);
+  out.put_vector(next);
+  out.put_vector(linked);
+  out.put_int(head);
+  out.put_int(tail);
+}
+
+void LRUReplacement::load_state(SnapshotReader &in) {
+  in.get_vector(prev);
+  in.get_vector(next);
+  in.get_vector(linked);
+  head = in.get_int();
+  tail = in.get_int();
 }
 
 } // namespace OSSimulator
@@ -1,34 +1,181 @@
 #include "memory/memory_manager.hpp"
 #include "core/process.hpp"
+#include "core/profiler.hpp"
+#include "core/snapshot.hpp"
 #include "metrics/metrics_collector.hpp"
 #include <algorithm>
+#include <cstdlib>
+#include <stdexcept>
 
 namespace OSSimulator {
 
 MemoryManager::MemoryManager(int total_frames,
                              std::unique_ptr<ReplacementAlgorithm> algo,
                              int page_fault_latency)
-    : total_frames(total_frames), algorithm(std::move(algo)),
+    : total_frames(total_frames), memory_pages(total_frames),
+      base_frames(total_frames), algorithm(std::move(algo)),
       page_fault_latency(std::max(1, page_fault_latency)) {
+  reset_frames();
+}
+
+void MemoryManager::reset_frames() {
+  node_first.resize(numa_nodes + 1);
+  for (int node = 0; node <= numa_nodes; ++node) {
+    node_first[node] = static_cast<int>(static_cast<int64_t>(base_frames) *
+                                        node / numa_nodes);
+  }
+  free_frames.clear();
+  for (int node = 0; node < numa_nodes; ++node)
+    free_frames.emplace_back(node_first[node + 1] - node_first[node]);
+  free_huge_frames = FreeFrameSet(huge_frame_count);
   frames.resize(total_frames);
+  frame_node.resize(total_frames);
+  numa_stats.assign(numa_nodes, NumaStats());
+  frame_slot.assign(total_frames, -1);
+  frame_dirty.assign(total_frames, false);
+  frame_loading.assign(total_frames, false);
+  dirty_frames.clear();
+  int node = 0;
   for (int i = 0; i < total_frames; ++i) {
     frames[i] = {i, -1, -1, false};
+    if (i < base_frames) {
+      while (i >= node_first[node + 1])
+        ++node;
+      frame_node[i] = node;
+      numa_stats[node].frames++;
+    } else {
+      frame_node[i] = static_cast<int>(static_cast<int64_t>(i - base_frames) *
+                                       numa_nodes / huge_frame_count);
+      numa_stats[frame_node[i]].frames += huge_page_size;
+    }
+    mark_frame_dirty(i);
   }
 }
 
-void MemoryManager::register_process(std::shared_ptr<Process> process) {
+void MemoryManager::set_huge_pages(int page_size, int count,
+                                   std::unique_ptr<ReplacementAlgorithm> algo) {
+  std::lock_guard<SimMutex> lock(mutex_);
+  if (page_size < 2 || !algo)
+    return;
+  // Quedan al menos page_size marcos base: la parte de un proceso que no
+  // llena una región siempre cabe.
+  count = std::min(std::max(0, count), memory_pages / page_size - 1);
+  if (count == 0)
+    return;
+
+  huge_page_size = page_size;
+  huge_frame_count = count;
+  base_frames = memory_pages - count * page_size;
+  total_frames = base_frames + count;
+  huge_algorithm = std::move(algo);
+  if (algorithm)
+    algorithm->set_frame_range(0, base_frames);
+  huge_algorithm->set_frame_range(base_frames, count);
+  reset_frames();
+}
+
+void MemoryManager::set_tlb(int entries, int ways, bool tagged) {
+  std::lock_guard<SimMutex> lock(mutex_);
+  tlb_entries = std::max(0, entries);
+  tlb_ways = std::max(1, ways);
+  tlb_tagged = tagged;
+  tlbs.clear();
+}
+
+void MemoryManager::set_numa(int nodes, NumaPolicy policy,
+                             int remote_latency, int cores) {
+  std::lock_guard<SimMutex> lock(mutex_);
+  numa_nodes = std::clamp(nodes, 1, std::max(1, base_frames));
+  numa_policy = policy;
+  this->remote_latency = std::max(0, remote_latency);
+  cpu_cores = std::max(1, cores);
+  reset_frames();
+}
+
+void MemoryManager::switch_context(int core) {
+  std::lock_guard<SimMutex> lock(mutex_);
+  if (TLB *tlb = tlb_for(core))
+    tlb->switch_context();
+}
+
+TLB *MemoryManager::tlb_for(int core) {
+  if (tlb_entries == 0 || core < 0)
+    return nullptr;
+  while (static_cast<int>(tlbs.size()) <= core)
+    tlbs.emplace_back(tlb_entries, tlb_ways, tlb_tagged);
+  return &tlbs[core];
+}
+
+void MemoryManager::set_fault_channels(int channels) {
+  std::lock_guard<SimMutex> lock(mutex_);
+  fault_channels = std::max(1, channels);
+}
+
+void MemoryManager::set_prefetch_pages(int pages) {
+  std::lock_guard<SimMutex> lock(mutex_);
+  prefetch_pages = std::max(0, pages);
+}
+
+void MemoryManager::set_demand_paging(bool enabled) {
+  std::lock_guard<SimMutex> lock(mutex_);
+  demand_paging = enabled;
+}
+
+void MemoryManager::set_locality(int window, int shift) {
+  std::lock_guard<SimMutex> lock(mutex_);
+  locality_window = std::max(1, window);
+  locality_shift = std::max(1, shift);
+}
+
+void MemoryManager::set_load_control(bool enabled, int window) {
+  std::lock_guard<SimMutex> lock(mutex_);
+  load_control = enabled;
+  working_set_window = std::max(1, window);
+}
+
+void MemoryManager::register_process(const std::shared_ptr<Process> &process) {
   if (!process)
     return;
-  std::lock_guard<std::mutex> lock(mutex_);
+  std::lock_guard<SimMutex> lock(mutex_);
   process_map[process->pid] = process;
+  wait_entry(*process);
+  attach_shared_mappings(*process);
 }
 
 void MemoryManager::unregister_process(int pid) {
-  std::lock_guard<std::mutex> lock(mutex_);
+  std::lock_guard<SimMutex> lock(mutex_);
+
+  auto mappings = region_mappings.find(pid);
+  if (mappings != region_mappings.end()) {
+    // Las páginas compartidas que otros siguen mapeando no se liberan: el
+    // marco pasa a otro mapeador si el proceso era su dueño.
+    auto proc = process_map.find(pid);
+    for (const auto &mapping : mappings->second) {
+      auto &mappers = shared_regions[mapping.region].mappers;
+      mappers.erase(std::remove(mappers.begin(), mappers.end(), pid),
+                    mappers.end());
+      if (proc == process_map.end())
+        continue;
+      const auto &table = proc->second->page_table;
+      for (size_t page = 0; page < mapping.copied.size(); ++page) {
+        const Page &entry = table[mapping.first_entry + page];
+        if (!mapping.copied[page] && entry.is_valid() &&
+            frames[entry.get_frame_number()].region == mapping.region)
+          drop_mapping(entry.get_frame_number(), pid);
+      }
+    }
+    region_mappings.erase(mappings);
+  }
 
   process_map.erase(pid);
-  pending_pages_by_process.erase(pid);
-  processes_waiting_on_memory.erase(pid);
+  auto admitted = admitted_demand.find(pid);
+  if (admitted != admitted_demand.end()) {
+    admitted_frames -= admitted->second;
+    admitted_demand.erase(admitted);
+  }
+  memory_waits.erase(pid);
+  for (auto &tlb : tlbs)
+    tlb.invalidate_process(pid);
 
   fault_queue.erase(std::remove_if(fault_queue.begin(), fault_queue.end(),
                                    [pid](const PageLoadTask &task) {
@@ -37,198 +184,887 @@ void MemoryManager::unregister_process(int pid) {
                                    }),
                     fault_queue.end());
 
-  if (active_task && active_task->process && active_task->process->pid == pid) {
-    active_task.reset();
+  for (auto it = active_tasks.begin(); it != active_tasks.end();) {
+    if (it->process && it->process->pid == pid) {
+      frame_loading[it->frame_id] = false;
+      for (const auto &prefetched : it->prefetched) {
+        frame_loading[prefetched.second] = false;
+      }
+      it = active_tasks.erase(it);
+    } else {
+      ++it;
+    }
   }
 
-  for (auto &frame : frames) {
-    if (frame.process_id == pid) {
-      frame.process_id = -1;
-      frame.page_id = -1;
-      frame.occupied = false;
-      if (algorithm)
-        algorithm->on_frame_release(frame.frame_id);
-    }
+  auto owned = frames_by_process.find(pid);
+  if (owned == frames_by_process.end())
+    return;
+
+  // Se liberan en orden ascendente, como el recorrido completo anterior.
+  std::vector<int> owned_frames = std::move(owned->second);
+  frames_by_process.erase(owned);
+  std::sort(owned_frames.begin(), owned_frames.end());
+
+  for (int frame_idx : owned_frames) {
+    Frame &frame = frames[frame_idx];
+    frame_slot[frame_idx] = -1;
+    mark_frame_free(frame_idx);
+    if (frame.region >= 0)
+      shared_regions[frame.region].frames[frame.region_page] = -1;
+    frame = {frame_idx, -1, -1, false};
+    mark_frame_dirty(frame_idx);
+    if (auto *algo = algorithm_for(frame_idx))
+      algo->on_frame_release(frame.frame_id);
   }
 }
 
 void MemoryManager::set_ready_callback(ProcessReadyCallback callback) {
-  std::lock_guard<std::mutex> lock(mutex_);
+  std::lock_guard<SimMutex> lock(mutex_);
   ready_callback = std::move(callback);
 }
 
 void MemoryManager::set_metrics_collector(
     std::shared_ptr<MetricsCollector> collector) {
-  std::lock_guard<std::mutex> lock(mutex_);
+  std::lock_guard<SimMutex> lock(mutex_);
   metrics_collector = collector;
+  // El nuevo recolector no conoce el estado de los marcos: se reenvían todos.
+  for (int i = 0; i < total_frames; ++i)
+    mark_frame_dirty(i);
 }
 
+void MemoryManager::set_locking(bool enabled) { mutex_.set_enabled(enabled); }
+
 bool MemoryManager::allocate_initial_memory(Process &process) {
   int num_pages = static_cast<int>(process.memory_required);
-  process.page_table.resize(num_pages);
-  for (int i = 0; i < num_pages; ++i) {
-    process.page_table[i] = Page(i);
-    process.page_table[i].process_id = process.pid;
+  // Las regiones alineadas se mapean con una entrada de página grande,
+  // tantas como marcos grandes haya; el resto usa páginas base.
+  int regions = 0;
+  if (huge_frame_count > 0) {
+    // Las páginas compartidas usan entradas base: las regiones grandes
+    // terminan antes de la primera.
+    int huge_pages = num_pages;
+    for (const auto &mapping : process.shared_mappings)
+      huge_pages = std::min(huge_pages, mapping.first_page);
+    regions = std::min(huge_pages / huge_page_size, huge_frame_count);
   }
+  // Los tiempos de acceso solo se guardan si alguna política los usa.
+  bool access_times = (algorithm && algorithm->uses_access_times()) ||
+                      (huge_algorithm && huge_algorithm->uses_access_times());
+  process.page_table.reset(num_pages, regions, huge_page_size, access_times);
   return true;
 }
 
-bool MemoryManager::prepare_process_for_cpu(std::shared_ptr<Process> process,
-                                            int current_time) {
+bool MemoryManager::admit_process(const Process &process, Tick current_time) {
+  std::lock_guard<SimMutex> lock(mutex_);
+  if (!load_control || admitted_demand.count(process.pid)) {
+    return true;
+  }
+
+  int demand = working_set_size(process);
+  if (!admitted_demand.empty() && admitted_frames + demand > memory_pages) {
+    if (deferred_since.emplace(process.pid, current_time).second) {
+      deferred_admissions++;
+    }
+    return false;
+  }
+
+  auto deferred = deferred_since.find(process.pid);
+  if (deferred != deferred_since.end()) {
+    deferral_ticks += current_time - deferred->second;
+    deferred_since.erase(deferred);
+  }
+  admitted_demand[process.pid] = demand;
+  admitted_frames += demand;
+  return true;
+}
+
+bool MemoryManager::prepare_process_for_cpu(
+    const std::shared_ptr<Process> &process, Tick current_time, int core,
+    Tick *stall) {
+  if (stall)
+    *stall = 0;
   if (!process)
     return false;
-  std::lock_guard<std::mutex> lock(mutex_);
+  OSSIM_PROFILE_SCOPE("memory.prepare");
+  std::lock_guard<SimMutex> lock(mutex_);
 
   if (process->page_table.empty()) {
     allocate_initial_memory(*process);
   }
+  if (numa_nodes > 1)
+    wait_entry(*process).node = node_of_core(core);
+
+  if (demand_paging) {
+    // Solo la página del próximo acceso debe estar residente; una ráfaga de
+    // E/S no accede a memoria.
+    const Burst *burst = process->get_current_burst();
+    Tick access = process->burst_time - process->remaining_time;
+    int page_id = -1;
+    if (!burst || burst->type == BurstType::CPU) {
+      page_id = page_for_access(*process, access);
+    }
+    // Una escritura en una página que otro proceso sigue compartiendo
+    // necesita su propia copia antes de ejecutar.
+    bool resident = false;
+    if (page_id >= 0) {
+      resident = process->page_table[page_id].is_valid() ||
+                 map_shared_page(process, page_id, current_time);
+    }
+    if (page_id < 0 ||
+        (resident && (!is_write_access(*process, access) ||
+                      claim_for_write(*process, page_id)))) {
+      set_process_pages_referenced(*process, true);
+      if (auto wait = memory_waits.find(process->pid);
+          wait != memory_waits.end())
+        wait->second.waiting = false;
+      if (stall)
+        *stall = remote_stall(*process);
+      return true;
+    }
+    auto &wait = wait_entry(*process);
+    if (!std::binary_search(wait.pending.begin(), wait.pending.end(),
+                            page_id)) {
+      enqueue_missing_page(process, wait, page_id, current_time, resident);
+    }
+    wait.waiting = true;
+    return false;
+  }
 
   if (are_all_pages_resident(*process)) {
     set_process_pages_referenced(*process, true);
-    processes_waiting_on_memory.erase(process->pid);
+    if (auto wait = memory_waits.find(process->pid);
+        wait != memory_waits.end())
+      wait->second.waiting = false;
+    if (stall)
+      *stall = remote_stall(*process);
     return true;
   }
 
-  std::vector<int> missing_pages;
-  auto &pending = pending_pages_by_process[process->pid];
-  for (const auto &page : process->page_table) {
-    if (!page.valid && pending.find(page.page_id) == pending.end()) {
-      missing_pages.push_back(page.page_id);
+  auto &wait = wait_entry(*process);
+  const auto &table = process->page_table;
+  bool missing = false;
+  for (int page_id = 0; page_id < static_cast<int>(table.size()); ++page_id) {
+    if (table[page_id].is_valid())
+      continue;
+    if (!std::binary_search(wait.pending.begin(), wait.pending.end(),
+                            page_id)) {
+      if (map_shared_page(process, page_id, current_time))
+        continue;
+      enqueue_missing_page(process, wait, page_id, current_time);
     }
+    missing = true;
   }
-
-  if (!missing_pages.empty()) {
-    enqueue_missing_pages(process, missing_pages, current_time);
+  if (!missing) {
+    // Las páginas que faltaban eran compartidas y ya estaban cargadas.
+    set_process_pages_referenced(*process, true);
+    wait.waiting = false;
+    if (stall)
+      *stall = remote_stall(*process);
+    return true;
   }
 
-  processes_waiting_on_memory.insert(process->pid);
+  wait.waiting = true;
   return false;
 }
 
-void MemoryManager::advance_fault_queue(int duration, int start_time) {
+Tick MemoryManager::access_pages(Process &process, Tick max_ticks,
+                                 Tick current_time, int core) {
+  std::lock_guard<SimMutex> lock(mutex_);
+  TLB *tlb = tlb_for(core);
+  if (!demand_paging && !tlb && numa_nodes == 1) {
+    return max_ticks;
+  }
+  OSSIM_PROFILE_SCOPE("memory.access");
+  int node = node_of_core(core);
+
+  Tick first = process.burst_time - process.remaining_time;
+  for (Tick tick = 0; tick < max_ticks; ++tick) {
+    int page_id = page_for_access(process, first + tick);
+    if (page_id < 0) {
+      return max_ticks;
+    }
+    Page &page = process.page_table[page_id];
+    if (!page.is_valid()) {
+      if (!demand_paging)
+        continue;
+      update_admitted_demand(process);
+      return tick;
+    }
+    if (tlb)
+      tlb->translate(process.pid, page_id);
+    if (numa_nodes > 1) {
+      if (frame_node[page.get_frame_number()] == node)
+        numa_stats[node].local_accesses++;
+      else
+        numa_stats[node].remote_accesses++;
+    }
+    if (!demand_paging)
+      continue;
+    if (is_write_access(process, first + tick)) {
+      if (!claim_for_write(process, page_id)) {
+        update_admitted_demand(process);
+        return tick;
+      }
+      page.set_modified(true);
+    }
+    page.set_referenced(true);
+    process.page_table.touch(page_id, current_time + tick);
+    if (auto *algo = algorithm_for(page.get_frame_number())) {
+      algo->on_page_access(page.get_frame_number());
+    }
+  }
+  if (demand_paging)
+    update_admitted_demand(process);
+  return max_ticks;
+}
+
+void MemoryManager::advance_fault_queue(Tick duration, Tick start_time) {
   if (duration <= 0)
     return;
+  OSSIM_PROFILE_SCOPE("memory.fault_queue");
 
-  for (int step = 0; step < duration; ++step) {
-    int tick_time = start_time + step;
-    std::vector<std::shared_ptr<Process>> ready_processes;
+  auto notify_ready = [this](Tick ready_time) {
+    for (auto &proc : ready_scratch) {
+      if (ready_callback) {
+        ready_callback(proc, ready_time);
+      }
+    }
+    ready_scratch.clear();
+  };
+
+  Tick last_time = start_time;
+  for (Tick step = 0; step < duration; ++step) {
+    Tick tick_time = start_time + step;
+    last_time = tick_time;
+    ready_scratch.clear();
 
     {
-      std::lock_guard<std::mutex> lock(mutex_);
+      std::lock_guard<SimMutex> lock(mutex_);
       memory_time = tick_time;
 
-      if (!active_task) {
-        start_next_task_if_possible(tick_time);
+      start_next_tasks(tick_time);
+
+      if (active_tasks.empty()) {
+        // Sin carga activa nada cambia hasta que el planificador intervenga.
+        memory_time = start_time + duration - 1;
+        break;
+      }
+
+      int next_done = active_tasks.front().remaining_time;
+      for (const auto &task : active_tasks) {
+        next_done = std::min(next_done, task.remaining_time);
+      }
+      if (next_done > 1) {
+        // Los ticks hasta la próxima finalización solo descuentan tiempo.
+        int skipped = static_cast<int>(
+            std::min<Tick>(next_done - 1, duration - step) - 1);
+        for (auto &task : active_tasks) {
+          task.remaining_time -= skipped;
+        }
+        step += skipped;
+        tick_time += skipped;
+        memory_time = tick_time;
       }
 
-      if (active_task) {
-        active_task->remaining_time--;
-        if (active_task->remaining_time <= 0) {
-          auto newly_ready = complete_active_task(tick_time);
+      // Las cargas que terminan en el mismo tick se completan en orden de
+      // canal.
+      size_t kept = 0;
+      for (size_t i = 0; i < active_tasks.size(); ++i) {
+        auto &task = active_tasks[i];
+        task.remaining_time--;
+        if (task.remaining_time <= 0) {
+          auto newly_ready = complete_task(task, tick_time);
           if (newly_ready) {
-            ready_processes.push_back(newly_ready);
+            ready_scratch.push_back(newly_ready);
           }
-          active_task.reset();
+        } else {
+          if (kept != i) {
+            active_tasks[kept] = std::move(task);
+          }
+          ++kept;
         }
       }
+      active_tasks.resize(kept);
 
-      if (!active_task) {
-        start_next_task_if_possible(tick_time);
-      }
+      start_next_tasks(tick_time);
     }
 
-    for (auto &proc : ready_processes) {
-      if (ready_callback) {
-        ready_callback(proc);
-      }
-    }
+    notify_ready(tick_time);
   }
+  // Un mapeo compartido puede dejar listo un proceso sin carga activa.
+  notify_ready(last_time);
+}
+
+Tick MemoryManager::get_next_event_time(Tick current_time) const {
+  std::lock_guard<SimMutex> lock(mutex_);
+  if (!fault_queue.empty() &&
+      static_cast<int>(active_tasks.size()) < fault_channels) {
+    return current_time;
+  }
+  if (active_tasks.empty()) {
+    return -1;
+  }
+  int next_done = active_tasks.front().remaining_time;
+  for (const auto &task : active_tasks) {
+    next_done = std::min(next_done, task.remaining_time);
+  }
+  return current_time + std::max(0, next_done - 1);
 }
 
 void MemoryManager::mark_process_inactive(const Process &process) {
-  std::lock_guard<std::mutex> lock(mutex_);
+  std::lock_guard<SimMutex> lock(mutex_);
   set_process_pages_referenced(process, false);
 }
 
 void MemoryManager::release_process_memory(int pid) { unregister_process(pid); }
 
-int MemoryManager::get_total_page_faults() const { return total_page_faults; }
-int MemoryManager::get_total_replacements() const { return total_replacements; }
+int64_t MemoryManager::get_total_page_faults() const {
+  return total_page_faults;
+}
+int64_t MemoryManager::get_total_replacements() const {
+  return total_replacements;
+}
+int64_t MemoryManager::get_cow_faults() const { return total_cow_faults; }
+int64_t MemoryManager::get_deferred_admissions() const {
+  return deferred_admissions;
+}
+Tick MemoryManager::get_deferral_ticks() const { return deferral_ticks; }
+int MemoryManager::get_peak_used_frames() const { return peak_used_frames; }
+
+int64_t MemoryManager::get_tlb_hits() const {
+  int64_t hits = 0;
+  for (const auto &tlb : tlbs)
+    hits += tlb.get_hits();
+  return hits;
+}
 
-int MemoryManager::find_free_frame() {
-  for (int i = 0; i < total_frames; ++i) {
-    if (!frames[i].occupied)
-      return i;
+int64_t MemoryManager::get_tlb_misses() const {
+  int64_t misses = 0;
+  for (const auto &tlb : tlbs)
+    misses += tlb.get_misses();
+  return misses;
+}
+
+const std::vector<MemoryManager::NumaStats> &
+MemoryManager::get_numa_stats() const {
+  return numa_stats;
+}
+
+int MemoryManager::find_free_frame(int page_size, int node) {
+  if (page_size > 1) {
+    int huge = free_huge_frames.first_free();
+    return huge == -1 ? -1 : base_frames + huge;
+  }
+  for (int i = 0; i < numa_nodes; ++i) {
+    int candidate = (node + i) % numa_nodes;
+    int frame_idx = free_frames[candidate].first_free();
+    if (frame_idx != -1)
+      return node_first[candidate] + frame_idx;
   }
   return -1;
 }
 
+int MemoryManager::node_of_core(int core) const {
+  if (numa_nodes == 1)
+    return 0;
+  core = std::clamp(core, 0, cpu_cores - 1);
+  return static_cast<int>(static_cast<int64_t>(core) * numa_nodes /
+                          cpu_cores);
+}
+
+int MemoryManager::placement_node(const Process &process, int page_id,
+                                  int node) {
+  if (numa_nodes == 1)
+    return 0;
+  switch (numa_policy) {
+  case NumaPolicy::INTERLEAVE: {
+    // Las páginas compartidas alternan por su posición en la región, igual
+    // para todos los procesos que la mapean.
+    int region_page = -1;
+    if (mapping_for(process.pid, page_id, region_page))
+      return region_page % numa_nodes;
+    return page_id % numa_nodes;
+  }
+  case NumaPolicy::BIND:
+    return std::abs(process.pid) % numa_nodes;
+  case NumaPolicy::FIRST_TOUCH:
+    break;
+  }
+  return node;
+}
+
+Tick MemoryManager::remote_stall(const Process &process) {
+  if (numa_nodes == 1 || remote_latency == 0)
+    return 0;
+  const Burst *burst = process.get_current_burst();
+  if (burst && burst->type != BurstType::CPU)
+    return 0;
+  Tick access = process.burst_time - process.remaining_time;
+  int page_id = page_for_access(process, access);
+  if (page_id < 0 || !process.page_table[page_id].is_valid())
+    return 0;
+  auto &wait = wait_entry(process);
+  int frame_idx = process.page_table[page_id].get_frame_number();
+  if (frame_node[frame_idx] == wait.node || wait.stalled_access == access)
+    return 0;
+  wait.stalled_access = access;
+  numa_stats[wait.node].remote_stall_ticks += remote_latency;
+  return remote_latency;
+}
+
+int MemoryManager::free_base_frames() const {
+  int free = 0;
+  for (const auto &set : free_frames)
+    free += set.free_count();
+  return free;
+}
+
+ReplacementAlgorithm *MemoryManager::algorithm_for(int frame_idx) const {
+  return frame_idx >= base_frames ? huge_algorithm.get() : algorithm.get();
+}
+
+void MemoryManager::mark_frame_used(int frame_idx) {
+  if (frame_idx >= base_frames) {
+    free_huge_frames.mark_used(frame_idx - base_frames);
+  } else {
+    int node = frame_node[frame_idx];
+    free_frames[node].mark_used(frame_idx - node_first[node]);
+  }
+}
+
+void MemoryManager::mark_frame_free(int frame_idx) {
+  if (frame_idx >= base_frames) {
+    free_huge_frames.mark_free(frame_idx - base_frames);
+  } else {
+    int node = frame_node[frame_idx];
+    free_frames[node].mark_free(frame_idx - node_first[node]);
+  }
+}
+
+void MemoryManager::mark_frame_dirty(int frame_idx) {
+  if (frame_dirty[frame_idx])
+    return;
+  frame_dirty[frame_idx] = true;
+  dirty_frames.push_back(frame_idx);
+}
+
+void MemoryManager::assign_frame(int frame_idx, int pid) {
+  mark_frame_used(frame_idx);
+  int used_pages = base_frames - free_base_frames() +
+                   (huge_frame_count - free_huge_frames.free_count()) *
+                       huge_page_size;
+  peak_used_frames = std::max(peak_used_frames, used_pages);
+  mark_frame_dirty(frame_idx);
+  link_frame(frame_idx, pid);
+}
+
+void MemoryManager::link_frame(int frame_idx, int pid) {
+  if (pid < 0)
+    return;
+  auto &owned = frames_by_process[pid];
+  frame_slot[frame_idx] = static_cast<int>(owned.size());
+  owned.push_back(frame_idx);
+}
+
+void MemoryManager::release_frame(int frame_idx) {
+  mark_frame_free(frame_idx);
+  mark_frame_dirty(frame_idx);
+  unlink_frame(frame_idx);
+}
+
+void MemoryManager::unlink_frame(int frame_idx) {
+  int slot = frame_slot[frame_idx];
+  frame_slot[frame_idx] = -1;
+  if (slot < 0)
+    return;
+
+  auto owned = frames_by_process.find(frames[frame_idx].process_id);
+  if (owned == frames_by_process.end())
+    return;
+
+  auto &list = owned->second;
+  int last = list.back();
+  list[slot] = last;
+  frame_slot[last] = slot;
+  list.pop_back();
+  if (last == frame_idx)
+    frame_slot[frame_idx] = -1;
+  // La lista vacía se conserva con su capacidad hasta liberar el proceso.
+}
+
+void MemoryManager::free_frame(int frame_idx) {
+  Frame &frame = frames[frame_idx];
+  if (frame.region >= 0)
+    shared_regions[frame.region].frames[frame.region_page] = -1;
+  if (auto *algo = algorithm_for(frame_idx))
+    algo->on_frame_release(frame_idx);
+  release_frame(frame_idx);
+  frame = {frame_idx, -1, -1, false};
+}
+
+void MemoryManager::attach_shared_mappings(const Process &process) {
+  if (process.shared_mappings.empty() || region_mappings.count(process.pid))
+    return;
+  const auto &table = process.page_table;
+  auto &mappings = region_mappings[process.pid];
+  for (const auto &shared : process.shared_mappings) {
+    int first_entry = table.entry_for_page(shared.first_page);
+    int pages = std::min(shared.pages, table.base_pages() - shared.first_page);
+    if (first_entry < 0 || pages <= 0 || table.entry_size(first_entry) > 1)
+      continue;
+    auto [id, inserted] = region_ids.try_emplace(
+        shared.region, static_cast<int>(shared_regions.size()));
+    if (inserted)
+      shared_regions.push_back({shared.region, {}, {}});
+    SharedRegion &region = shared_regions[id->second];
+    if (static_cast<int>(region.frames.size()) < pages)
+      region.frames.resize(pages, -1);
+    region.mappers.push_back(process.pid);
+    mappings.push_back({id->second, first_entry, std::vector<bool>(pages)});
+  }
+}
+
+MemoryManager::RegionMapping *
+MemoryManager::mapping_for(int pid, int entry, int &region_page) {
+  auto it = region_mappings.find(pid);
+  if (it == region_mappings.end())
+    return nullptr;
+  for (auto &mapping : it->second) {
+    int page = entry - mapping.first_entry;
+    if (page >= 0 && page < static_cast<int>(mapping.copied.size())) {
+      region_page = page;
+      return &mapping;
+    }
+  }
+  return nullptr;
+}
+
+template <typename Visit>
+void MemoryManager::for_each_mapper(int frame_idx, Visit visit) {
+  const Frame &frame = frames[frame_idx];
+  if (frame.region < 0) {
+    auto owner = process_map.find(frame.process_id);
+    if (owner != process_map.end() && frame.page_id >= 0 &&
+        frame.page_id < static_cast<int>(owner->second->page_table.size()))
+      visit(*owner->second, frame.page_id);
+    return;
+  }
+
+  int region = frame.region;
+  int page = frame.region_page;
+  for (int pid : shared_regions[region].mappers) {
+    auto proc = process_map.find(pid);
+    auto mappings = region_mappings.find(pid);
+    if (proc == process_map.end() || mappings == region_mappings.end())
+      continue;
+    for (const auto &mapping : mappings->second) {
+      if (mapping.region != region)
+        continue;
+      if (page < static_cast<int>(mapping.copied.size()) &&
+          !mapping.copied[page]) {
+        int entry = mapping.first_entry + page;
+        const Page &mapped = proc->second->page_table[entry];
+        if (mapped.is_valid() && mapped.get_frame_number() == frame_idx)
+          visit(*proc->second, entry);
+      }
+      break;
+    }
+  }
+}
+
+bool MemoryManager::frame_referenced(int frame_idx) {
+  bool referenced = false;
+  for_each_mapper(frame_idx, [&referenced](Process &mapper, int page_id) {
+    referenced = referenced || mapper.page_table[page_id].is_referenced();
+  });
+  return referenced;
+}
+
+bool MemoryManager::map_shared_page(const std::shared_ptr<Process> &process,
+                                    int page_id, Tick current_time) {
+  int region_page = -1;
+  RegionMapping *mapping = mapping_for(process->pid, page_id, region_page);
+  if (!mapping || mapping->copied[region_page])
+    return false;
+  int frame_idx = shared_regions[mapping->region].frames[region_page];
+  if (frame_idx == -1 || frame_loading[frame_idx])
+    return false;
+
+  Page &page = process->page_table[page_id];
+  page.set_valid(true);
+  page.set_frame_number(frame_idx);
+  page.set_referenced(true);
+  process->page_table.touch(page_id, current_time);
+  process->active_pages_count++;
+  frames[frame_idx].ref_count++;
+  if (auto *algo = algorithm_for(frame_idx))
+    algo->on_page_access(frame_idx);
+
+  if (metrics_collector && metrics_collector->is_enabled()) {
+    metrics_collector->log_memory(current_time, "PAGE_SHARED", process->pid,
+                                  process->name_id, page_id, frame_idx,
+                                  total_page_faults, total_replacements);
+    log_process_page_table(current_time, process->pid);
+  }
+  return true;
+}
+
+bool MemoryManager::claim_for_write(Process &process, int page_id) {
+  int region_page = -1;
+  RegionMapping *mapping = mapping_for(process.pid, page_id, region_page);
+  if (!mapping || mapping->copied[region_page])
+    return true;
+  int frame_idx = process.page_table[page_id].get_frame_number();
+  Frame &frame = frames[frame_idx];
+  if (frame.ref_count > 1)
+    return false;
+
+  // Sin otros mapeadores el marco pasa a ser privado sin copiarlo.
+  shared_regions[mapping->region].frames[region_page] = -1;
+  mapping->copied[region_page] = true;
+  frame.region = -1;
+  frame.region_page = -1;
+  if (frame.process_id != process.pid) {
+    unlink_frame(frame_idx);
+    frame.process_id = process.pid;
+    frame.page_id = page_id;
+    link_frame(frame_idx, process.pid);
+    mark_frame_dirty(frame_idx);
+  }
+  return true;
+}
+
+void MemoryManager::drop_mapping(int frame_idx, int pid) {
+  Frame &frame = frames[frame_idx];
+  frame.ref_count = std::max(0, frame.ref_count - 1);
+  if (frame.process_id != pid || frame.ref_count == 0)
+    return;
+
+  Process *heir = nullptr;
+  int heir_page = -1;
+  for_each_mapper(frame_idx, [&](Process &mapper, int page_id) {
+    if (!heir && mapper.pid != pid) {
+      heir = &mapper;
+      heir_page = page_id;
+    }
+  });
+  if (!heir)
+    return;
+  unlink_frame(frame_idx);
+  frame.process_id = heir->pid;
+  frame.page_id = heir_page;
+  link_frame(frame_idx, heir->pid);
+  mark_frame_dirty(frame_idx);
+}
+
+bool MemoryManager::is_write_access(const Process &process,
+                                    Tick access) const {
+  const auto &writes = process.memory_write_trace;
+  return !writes.empty() &&
+         writes[static_cast<size_t>(access) % writes.size()];
+}
+
+int MemoryManager::page_for_access(const Process &process, Tick access) const {
+  const auto &table = process.page_table;
+  if (table.empty()) {
+    return -1;
+  }
+  int pages = table.base_pages();
+  int base_page;
+  const auto &trace = process.memory_access_trace;
+  if (!trace.empty()) {
+    base_page = trace[static_cast<size_t>(access) % trace.size()];
+  } else {
+    base_page = static_cast<int>(
+        (access / locality_shift + access % locality_window) % pages);
+  }
+  return table.entry_for_page(base_page);
+}
+
+int MemoryManager::working_set_size(const Process &process) const {
+  const auto &table = process.page_table;
+  if (table.empty()) {
+    return 0;
+  }
+  if (!demand_paging) {
+    return table.base_pages();
+  }
+
+  Tick end = std::max<Tick>(process.burst_time - process.remaining_time,
+                            working_set_window);
+  std::vector<bool> seen(table.size(), false);
+  int distinct = 0;
+  for (Tick access = end - working_set_window; access < end; ++access) {
+    int page_id = page_for_access(process, access);
+    if (page_id >= 0 && !seen[page_id]) {
+      seen[page_id] = true;
+      distinct += table.entry_size(page_id);
+    }
+  }
+  return distinct;
+}
+
+void MemoryManager::update_admitted_demand(const Process &process) {
+  if (!load_control) {
+    return;
+  }
+  auto admitted = admitted_demand.find(process.pid);
+  if (admitted == admitted_demand.end()) {
+    return;
+  }
+  int demand = working_set_size(process);
+  admitted_frames += demand - admitted->second;
+  admitted->second = demand;
+}
+
 bool MemoryManager::are_all_pages_resident(const Process &process) const {
   if (process.page_table.empty()) {
     return true;
   }
 
   for (const auto &page : process.page_table) {
-    if (!page.valid)
+    if (!page.is_valid())
       return false;
   }
   return true;
 }
 
-void MemoryManager::enqueue_missing_pages(std::shared_ptr<Process> process,
-                                          const std::vector<int> &missing_pages,
-                                          int current_time) {
-  auto &pending = pending_pages_by_process[process->pid];
-  for (int page_id : missing_pages) {
-    pending.insert(page_id);
-    PageLoadTask task{process, page_id, page_fault_latency, -1, current_time};
-    fault_queue.push_back(task);
-    process->page_faults++;
-    total_page_faults++;
+MemoryManager::MemoryWait &MemoryManager::wait_entry(const Process &process) {
+  auto [entry, inserted] = memory_waits.try_emplace(process.pid);
+  if (inserted) {
+    // Se crea al registrar el proceso: sus listas se reservan de una vez y
+    // no crecen en los ticks siguientes.
+    size_t pages = process.page_table.size();
+    entry->second.pending.reserve(pages);
+    frames_by_process[process.pid].reserve(pages);
+  }
+  return entry->second;
+}
 
-    if (metrics_collector && metrics_collector->is_enabled()) {
-      metrics_collector->log_memory(current_time, "PAGE_FAULT", process->pid,
-                                    process->name, page_id, -1,
-                                    total_page_faults, total_replacements);
-    }
+void MemoryManager::enqueue_missing_page(
+    const std::shared_ptr<Process> &process, MemoryWait &wait, int page_id,
+    Tick current_time, bool copy) {
+  wait.pending.insert(
+      std::lower_bound(wait.pending.begin(), wait.pending.end(), page_id),
+      page_id);
+  fault_queue.push_back(PageLoadTask{
+      process, current_time, page_id, page_fault_latency, -1, {}, copy,
+      placement_node(*process, page_id, wait.node)});
+  process->page_faults++;
+  total_page_faults++;
+  numa_stats[wait.node].page_faults++;
+  if (copy)
+    total_cow_faults++;
+
+  if (metrics_collector && metrics_collector->is_enabled()) {
+    metrics_collector->log_memory(current_time,
+                                  copy ? "COW_FAULT" : "PAGE_FAULT",
+                                  process->pid,
+                                  process->name_id, page_id, -1,
+                                  total_page_faults, total_replacements);
   }
 }
 
-void MemoryManager::start_next_task_if_possible(int current_time) {
-  if (active_task || fault_queue.empty())
-    return;
+void MemoryManager::start_next_tasks(Tick current_time) {
+  while (static_cast<int>(active_tasks.size()) < fault_channels &&
+         !fault_queue.empty()) {
+    int region_page = -1;
+    RegionMapping *mapping = nullptr;
+    if (!fault_queue.front().copy && fault_queue.front().process) {
+      mapping = mapping_for(fault_queue.front().process->pid,
+                            fault_queue.front().page_id, region_page);
+      if (mapping && mapping->copied[region_page])
+        mapping = nullptr;
+    }
+    if (mapping && shared_regions[mapping->region].frames[region_page] != -1) {
+      // Otro proceso cargó la página compartida o la está cargando; la cola
+      // espera a que termine, como cuando no hay marcos.
+      if (frame_loading[shared_regions[mapping->region].frames[region_page]])
+        return;
+      auto task = std::move(fault_queue.front());
+      fault_queue.pop_front();
+      if (!task.process->page_table[task.page_id].is_valid())
+        map_shared_page(task.process, task.page_id, current_time);
+      if (auto ready = settle_page(task.process, task.page_id, current_time))
+        ready_scratch.push_back(std::move(ready));
+      continue;
+    }
 
-  auto task = fault_queue.front();
-  if (!reserve_frame_for_task(task)) {
-    return;
+    auto task = std::move(fault_queue.front());
+    task.frame_id = reserve_frame(task.process, task.page_id, task.node);
+    if (task.frame_id == -1) {
+      fault_queue.front() = std::move(task);
+      return;
+    }
+    fault_queue.pop_front();
+    if (mapping) {
+      shared_regions[mapping->region].frames[region_page] = task.frame_id;
+      frames[task.frame_id].region = mapping->region;
+      frames[task.frame_id].region_page = region_page;
+    }
+    task.remaining_time = page_fault_latency;
+    if (numa_nodes > 1 && task.process) {
+      // Cargar en la memoria de otro nodo cruza la interconexión.
+      auto wait = memory_waits.find(task.process->pid);
+      int node = wait != memory_waits.end() ? wait->second.node : 0;
+      if (frame_node[task.frame_id] != node) {
+        task.remaining_time += remote_latency;
+        numa_stats[node].remote_loads++;
+      }
+    }
+    task.enqueue_time = current_time;
+    if (prefetch_pages > 1) {
+      prefetch_into_task(task);
+    }
+    active_tasks.push_back(std::move(task));
   }
-  task.remaining_time = page_fault_latency;
-  task.enqueue_time = current_time;
-  active_task = task;
-  fault_queue.pop_front();
 }
 
-bool MemoryManager::reserve_frame_for_task(PageLoadTask &task) {
-  int frame_idx = find_free_frame();
+void MemoryManager::prefetch_into_task(PageLoadTask &task) {
+  for (auto it = fault_queue.begin();
+       it != fault_queue.end() &&
+       static_cast<int>(task.prefetched.size()) + 1 < prefetch_pages;) {
+    // Solo se precargan páginas privadas: las compartidas y las copias
+    // actualizan otras tablas al cargarse.
+    int region_page = -1;
+    if (it->process != task.process || it->copy ||
+        mapping_for(it->process->pid, it->page_id, region_page)) {
+      ++it;
+      continue;
+    }
+    int frame_idx = reserve_frame(it->process, it->page_id, it->node);
+    if (frame_idx == -1) {
+      return;
+    }
+    task.prefetched.emplace_back(it->page_id, frame_idx);
+    it = fault_queue.erase(it);
+  }
+}
 
-  if (frame_idx == -1 && algorithm) {
-    frame_idx = algorithm->select_victim(frames, process_map, memory_time);
+int MemoryManager::reserve_frame(const std::shared_ptr<Process> &process,
+                                 int page_id, int node) {
+  int page_size = 1;
+  if (process && page_id >= 0 &&
+      page_id < static_cast<int>(process->page_table.size())) {
+    page_size = process->page_table.entry_size(page_id);
+  }
+  bool huge = page_size > 1;
+  int frame_idx = find_free_frame(page_size, node);
+  ReplacementAlgorithm *algo = huge ? huge_algorithm.get() : algorithm.get();
+
+  if (frame_idx == -1 && algo) {
+    {
+      OSSIM_PROFILE_SCOPE("memory.select_victim");
+      frame_idx = algo->select_victim(frames, process_map, memory_time);
+    }
     if (frame_idx != -1) {
-      if (frame_idx < 0 || frame_idx >= total_frames)
-        return false;
-
-      auto &frame = frames[frame_idx];
-      if (frame.occupied) {
-        auto it = process_map.find(frame.process_id);
-        if (it != process_map.end()) {
-          Process &victim_proc = *it->second;
-          if (frame.page_id >= 0 &&
-              frame.page_id < static_cast<int>(victim_proc.page_table.size())) {
-            Page &victim_page = victim_proc.page_table[frame.page_id];
-            if (victim_page.referenced) {
-              return false;
-            }
-          }
+      if (frame_idx < 0 || frame_idx >= total_frames ||
+          frame_loading[frame_idx] || (frame_idx >= base_frames) != huge)
+        return -1;
+
+      if (frames[frame_idx].occupied) {
+        if (frame_referenced(frame_idx)) {
+          return -1;
         }
         evict_frame(frame_idx);
       }
@@ -236,23 +1072,26 @@ bool MemoryManager::reserve_frame_for_task(PageLoadTask &task) {
   }
 
   if (frame_idx == -1)
-    return false;
+    return -1;
 
   Frame &frame = frames[frame_idx];
   frame.occupied = true;
-  frame.process_id = task.process ? task.process->pid : -1;
-  frame.page_id = task.page_id;
-  task.frame_id = frame_idx;
-  return true;
+  frame.process_id = process ? process->pid : -1;
+  frame.page_id = page_id;
+  frame.ref_count = 0;
+  assign_frame(frame_idx, frame.process_id);
+  frame_loading[frame_idx] = true;
+  return frame_idx;
 }
 
 void MemoryManager::evict_frame(int frame_idx) {
   if (frame_idx < 0 || frame_idx >= total_frames)
     return;
+  OSSIM_PROFILE_COUNT("memory.evictions", 1);
   Frame &frame = frames[frame_idx];
 
   int evicted_pid = -1;
-  std::string evicted_name;
+  NameId evicted_name = NameTable::EMPTY;
   int evicted_page_id = frame.page_id;
 
   if (frame.process_id != -1) {
@@ -260,18 +1099,23 @@ void MemoryManager::evict_frame(int frame_idx) {
     if (it != process_map.end()) {
       Process &victim_proc = *it->second;
       evicted_pid = victim_proc.pid;
-      evicted_name = victim_proc.name;
-
-      if (frame.page_id >= 0 &&
-          frame.page_id < static_cast<int>(victim_proc.page_table.size())) {
-        Page &victim_page = victim_proc.page_table[frame.page_id];
-        if (victim_page.valid) {
-          victim_page.valid = false;
-          victim_page.frame_number = -1;
-          victim_proc.active_pages_count =
-              std::max(0, victim_proc.active_pages_count - 1);
+      evicted_name = victim_proc.name_id;
+
+      // Una página compartida se invalida en todos los procesos que la
+      // mapean; el reemplazo se cuenta una vez, al dueño.
+      mapper_scratch.clear();
+      for_each_mapper(frame_idx, [this](Process &mapper, int page_id) {
+        Page &page = mapper.page_table[page_id];
+        for (auto &tlb : tlbs)
+          tlb.invalidate(mapper.pid, page_id);
+        if (page.is_valid()) {
+          page.set_valid(false);
+          page.set_frame_number(-1);
+          mapper.active_pages_count =
+              std::max(0, mapper.active_pages_count - 1);
         }
-      }
+        mapper_scratch.push_back(mapper.pid);
+      });
       victim_proc.replacements++;
       total_replacements++;
 
@@ -279,37 +1123,58 @@ void MemoryManager::evict_frame(int frame_idx) {
         metrics_collector->log_memory(memory_time, "PAGE_REPLACED", evicted_pid,
                                       evicted_name, evicted_page_id, frame_idx,
                                       total_page_faults, total_replacements);
-        log_process_page_table(memory_time, evicted_pid);
+        for (int pid : mapper_scratch)
+          log_process_page_table(memory_time, pid);
         log_all_frames_status(memory_time);
       }
     }
   }
 
-  if (algorithm) {
-    algorithm->on_frame_release(frame_idx);
+  if (auto *algo = algorithm_for(frame_idx)) {
+    algo->on_frame_release(frame_idx);
   }
 
-  frame.process_id = -1;
-  frame.page_id = -1;
-  frame.occupied = false;
+  if (frame.region >= 0)
+    shared_regions[frame.region].frames[frame.region_page] = -1;
+  release_frame(frame_idx);
+  frame = {frame_idx, -1, -1, false};
 }
 
-std::shared_ptr<Process>
-MemoryManager::complete_active_task(int completion_time) {
-  if (!active_task || !active_task->process)
-    return nullptr;
-
-  auto process = active_task->process;
+void MemoryManager::load_page(const std::shared_ptr<Process> &process,
+                              int page_id, int frame_id, Tick completion_time,
+                              bool copy) {
   int pid = process->pid;
-  int page_id = active_task->page_id;
-  int frame_id = active_task->frame_id;
+  if (frame_id >= 0 && frame_id < total_frames) {
+    frame_loading[frame_id] = false;
+  }
 
-  auto pending_it = pending_pages_by_process.find(pid);
-  if (pending_it != pending_pages_by_process.end()) {
-    pending_it->second.erase(page_id);
-    if (pending_it->second.empty()) {
-      pending_pages_by_process.erase(pending_it);
+  auto wait = memory_waits.find(pid);
+  if (wait != memory_waits.end()) {
+    auto &pending = wait->second.pending;
+    auto it = std::lower_bound(pending.begin(), pending.end(), page_id);
+    if (it != pending.end() && *it == page_id)
+      pending.erase(it);
+  }
+
+  bool in_table =
+      page_id >= 0 && page_id < static_cast<int>(process->page_table.size());
+  int region_page = -1;
+  RegionMapping *mapping =
+      copy && in_table ? mapping_for(pid, page_id, region_page) : nullptr;
+  if (mapping && !mapping->copied[region_page]) {
+    // La copia privada sustituye al marco compartido, si aún lo mapeaba.
+    Page &page = process->page_table[page_id];
+    if (page.is_valid()) {
+      int shared = page.get_frame_number();
+      for (auto &tlb : tlbs)
+        tlb.invalidate(pid, page_id);
+      drop_mapping(shared, pid);
+      if (frames[shared].ref_count == 0)
+        free_frame(shared);
+      page.set_valid(false);
+      process->active_pages_count--;
     }
+    mapping->copied[region_page] = true;
   }
 
   if (frame_id >= 0 && frame_id < total_frames) {
@@ -317,44 +1182,69 @@ MemoryManager::complete_active_task(int completion_time) {
     frame.process_id = pid;
     frame.page_id = page_id;
     frame.occupied = true;
+    frame.ref_count = 1;
+    mark_frame_dirty(frame_id);
   }
 
-  if (page_id >= 0 && page_id < static_cast<int>(process->page_table.size())) {
+  if (in_table) {
     Page &page = process->page_table[page_id];
-    page.valid = true;
-    page.frame_number = frame_id;
-    page.referenced = true;
-    page.last_access_time = completion_time;
+    page.set_valid(true);
+    page.set_frame_number(frame_id);
+    page.set_referenced(true);
+    if (copy)
+      page.set_modified(true);
+    process->page_table.touch(page_id, completion_time);
     process->active_pages_count++;
   }
 
-  if (algorithm && frame_id >= 0) {
-    algorithm->on_page_access(frame_id);
+  if (frame_id >= 0) {
+    if (auto *algo = algorithm_for(frame_id))
+      algo->on_page_access(frame_id);
   }
 
   if (metrics_collector && metrics_collector->is_enabled()) {
     metrics_collector->log_memory(completion_time, "PAGE_LOADED", pid,
-                                  process->name, page_id, frame_id,
+                                  process->name_id, page_id, frame_id,
                                   total_page_faults, total_replacements);
     log_process_page_table(completion_time, pid);
     log_all_frames_status(completion_time);
   }
+}
 
-  auto pending_it_check = pending_pages_by_process.find(pid);
-  bool no_pending_pages = (pending_it_check == pending_pages_by_process.end() ||
-                           pending_it_check->second.empty());
+std::shared_ptr<Process>
+MemoryManager::complete_task(const PageLoadTask &task, Tick completion_time) {
+  if (!task.process)
+    return nullptr;
 
-  if (no_pending_pages && processes_waiting_on_memory.count(pid) > 0) {
-    processes_waiting_on_memory.erase(pid);
-    set_process_pages_referenced(*process, true);
-    if (metrics_collector && metrics_collector->is_enabled()) {
-      log_process_page_table(completion_time, pid);
-      log_all_frames_status(completion_time);
-    }
-    return process;
+  auto process = task.process;
+  load_page(process, task.page_id, task.frame_id, completion_time, task.copy);
+  for (const auto &[page_id, frame_id] : task.prefetched) {
+    load_page(process, page_id, frame_id, completion_time);
   }
+  return settle_page(process, task.page_id, completion_time);
+}
 
-  return nullptr;
+std::shared_ptr<Process>
+MemoryManager::settle_page(const std::shared_ptr<Process> &process,
+                           int page_id, Tick time) {
+  int pid = process->pid;
+  auto wait = memory_waits.find(pid);
+  if (wait == memory_waits.end())
+    return nullptr;
+  auto &pending = wait->second.pending;
+  auto it = std::lower_bound(pending.begin(), pending.end(), page_id);
+  if (it != pending.end() && *it == page_id)
+    pending.erase(it);
+
+  if (!wait->second.waiting || !pending.empty())
+    return nullptr;
+  wait->second.waiting = false;
+  set_process_pages_referenced(*process, true);
+  if (metrics_collector && metrics_collector->is_enabled()) {
+    log_process_page_table(time, pid);
+    log_all_frames_status(time);
+  }
+  return process;
 }
 
 void MemoryManager::set_process_pages_referenced(const Process &process,
@@ -364,14 +1254,40 @@ void MemoryManager::set_process_pages_referenced(const Process &process,
     return;
 
   for (auto &page : it->second->page_table) {
-    if (page.valid) {
-      page.referenced = referenced;
+    if (page.is_valid()) {
+      page.set_referenced(referenced);
+    }
+  }
+
+  if (algorithm)
+    algorithm->on_process_referenced(*it->second, referenced);
+  if (huge_algorithm)
+    huge_algorithm->on_process_referenced(*it->second, referenced);
+
+  // Un marco compartido sigue referenciado mientras lo esté la página de
+  // otro proceso que lo mapea.
+  auto mappings = region_mappings.find(process.pid);
+  if (referenced || mappings == region_mappings.end())
+    return;
+  const auto &table = it->second->page_table;
+  for (const auto &mapping : mappings->second) {
+    for (size_t page = 0; page < mapping.copied.size(); ++page) {
+      const Page &entry = table[mapping.first_entry + page];
+      if (mapping.copied[page] || !entry.is_valid())
+        continue;
+      int frame_idx = entry.get_frame_number();
+      if (frames[frame_idx].ref_count > 1 && frame_referenced(frame_idx)) {
+        if (auto *algo = algorithm_for(frame_idx))
+          algo->on_frame_referenced(frame_idx);
+      }
     }
   }
 }
 
-void MemoryManager::log_process_page_table(int tick, int pid) {
-  if (!metrics_collector || !metrics_collector->is_enabled())
+void MemoryManager::log_process_page_table(Tick tick, int pid) {
+  if (!metrics_collector ||
+      !metrics_collector->should_log(MetricsCollector::CATEGORY_PAGE_TABLE,
+                                     tick))
     return;
 
   auto it = process_map.find(pid);
@@ -379,37 +1295,333 @@ void MemoryManager::log_process_page_table(int tick, int pid) {
     return;
 
   auto &process = it->second;
-  std::vector<MetricsCollector::PageTableEntry> entries;
+  auto &entries = page_table_scratch;
+  entries.clear();
 
-  for (const auto &page : process->page_table) {
+  const auto &table = process->page_table;
+  for (int page_id = 0; page_id < static_cast<int>(table.size()); ++page_id) {
+    const Page &page = table[page_id];
     MetricsCollector::PageTableEntry entry;
-    entry.page_id = page.page_id;
-    entry.frame_id = page.frame_number;
-    entry.valid = page.valid;
-    entry.referenced = page.referenced;
-    entry.modified = page.modified;
+    entry.page_id = page_id;
+    entry.frame_id = page.get_frame_number();
+    entry.valid = page.is_valid();
+    entry.referenced = page.is_referenced();
+    entry.modified = page.is_modified();
     entries.push_back(entry);
   }
 
-  metrics_collector->log_page_table(tick, pid, process->name, entries);
+  metrics_collector->log_page_table(tick, pid, process->name_id, entries);
 }
 
-void MemoryManager::log_all_frames_status(int tick) {
-  if (!metrics_collector || !metrics_collector->is_enabled())
+void MemoryManager::log_all_frames_status(Tick tick) {
+  // Si el tick no se registra, los marcos siguen pendientes para el próximo.
+  if (!metrics_collector ||
+      !metrics_collector->should_log(MetricsCollector::CATEGORY_FRAME_STATUS,
+                                     tick))
     return;
 
-  std::vector<MetricsCollector::FrameStatusEntry> entries;
+  // Solo se envían los marcos modificados; el recolector conserva el resto.
+  auto &entries = frame_status_scratch;
+  entries.clear();
 
-  for (int i = 0; i < total_frames; ++i) {
+  for (int i : dirty_frames) {
     MetricsCollector::FrameStatusEntry entry;
     entry.frame_id = i;
     entry.occupied = frames[i].occupied;
     entry.pid = frames[i].process_id;
     entry.page_id = frames[i].page_id;
     entries.push_back(entry);
+    frame_dirty[i] = false;
+  }
+  dirty_frames.clear();
+
+  metrics_collector->log_frame_changes(tick, entries, total_frames);
+}
+
+void MemoryManager::save_state(SnapshotWriter &out) const {
+  std::lock_guard<SimMutex> lock(mutex_);
+  out.put_int(base_frames);
+  out.put_int(huge_frame_count);
+  out.put_int(numa_nodes);
+  for (const Frame &frame : frames) {
+    out.put_int(frame.process_id);
+    out.put_int(frame.page_id);
+    out.put_bool(frame.occupied);
+    out.put_int(frame.ref_count);
+    out.put_int(frame.region);
+    out.put_int(frame.region_page);
+  }
+  for (int i = 0; i < base_frames; ++i) {
+    int node = frame_node[i];
+    out.put_bool(free_frames[node].is_free(i - node_first[node]));
+  }
+  for (int i = 0; i < huge_frame_count; ++i)
+    out.put_bool(free_huge_frames.is_free(i));
+  out.put_uint(std::count_if(
+      frames_by_process.begin(), frames_by_process.end(),
+      [](const auto &entry) { return !entry.second.empty(); }));
+  for (const auto &[pid, owned] : frames_by_process) {
+    if (owned.empty())
+      continue;
+    out.put_int(pid);
+    out.put_vector(owned);
+  }
+  out.put_vector(frame_slot);
+  out.put_vector(frame_loading);
+
+  out.put_uint(shared_regions.size());
+  for (const auto &region : shared_regions) {
+    out.put_string(region.name);
+    out.put_vector(region.frames);
+    out.put_vector(region.mappers);
+  }
+  out.put_uint(region_mappings.size());
+  for (const auto &[pid, mappings] : region_mappings) {
+    out.put_int(pid);
+    out.put_uint(mappings.size());
+    for (const auto &mapping : mappings) {
+      out.put_int(mapping.region);
+      out.put_int(mapping.first_entry);
+      out.put_vector(mapping.copied);
+    }
+  }
+
+  out.put_uint(process_map.size());
+  for (const auto &entry : process_map)
+    out.put_process(entry.second);
+
+  auto put_task = [&out](const PageLoadTask &task) {
+    out.put_process(task.process);
+    out.put_int(task.page_id);
+    out.put_int(task.remaining_time);
+    out.put_int(task.frame_id);
+    out.put_int(task.enqueue_time);
+    out.put_uint(task.prefetched.size());
+    for (const auto &[page_id, frame_id] : task.prefetched) {
+      out.put_int(page_id);
+      out.put_int(frame_id);
+    }
+    out.put_bool(task.copy);
+    out.put_int(task.node);
+  };
+  out.put_uint(fault_queue.size());
+  for (const auto &task : fault_queue)
+    put_task(task);
+  out.put_uint(active_tasks.size());
+  for (const auto &task : active_tasks)
+    put_task(task);
+
+  out.put_uint(admitted_demand.size());
+  for (const auto &[pid, demand] : admitted_demand) {
+    out.put_int(pid);
+    out.put_int(demand);
+  }
+  out.put_int(admitted_frames);
+  out.put_uint(deferred_since.size());
+  for (const auto &[pid, since] : deferred_since) {
+    out.put_int(pid);
+    out.put_int(since);
+  }
+  out.put_int(deferred_admissions);
+  out.put_int(deferral_ticks);
+  out.put_int(peak_used_frames);
+
+  out.put_uint(tlbs.size());
+  for (const auto &tlb : tlbs)
+    tlb.save_state(out);
+
+  std::vector<int> waiting;
+  out.put_uint(std::count_if(
+      memory_waits.begin(), memory_waits.end(),
+      [](const auto &entry) { return !entry.second.pending.empty(); }));
+  for (const auto &[pid, wait] : memory_waits) {
+    if (wait.waiting)
+      waiting.push_back(pid);
+    if (wait.pending.empty())
+      continue;
+    out.put_int(pid);
+    out.put_vector(wait.pending);
+  }
+  out.put_vector(waiting);
+  if (numa_nodes > 1) {
+    out.put_uint(memory_waits.size());
+    for (const auto &[pid, wait] : memory_waits) {
+      out.put_int(pid);
+      out.put_int(wait.node);
+      out.put_int(wait.stalled_access);
+    }
+    for (const auto &stats : numa_stats) {
+      out.put_int(stats.page_faults);
+      out.put_int(stats.local_accesses);
+      out.put_int(stats.remote_accesses);
+      out.put_int(stats.remote_loads);
+      out.put_int(stats.remote_stall_ticks);
+    }
+  }
+
+  out.put_int(memory_time);
+  out.put_int(total_page_faults);
+  out.put_int(total_replacements);
+  out.put_int(total_cow_faults);
+
+  out.put_int(algorithm != nullptr);
+  if (algorithm)
+    algorithm->save_state(out);
+  out.put_int(huge_algorithm != nullptr);
+  if (huge_algorithm)
+    huge_algorithm->save_state(out);
+}
+
+void MemoryManager::load_state(SnapshotReader &in) {
+  std::lock_guard<SimMutex> lock(mutex_);
+  in.expect(base_frames, "marcos de memoria");
+  in.expect(huge_frame_count, "marcos de página grande");
+  in.expect(numa_nodes, "nodos NUMA");
+  for (Frame &frame : frames) {
+    frame.process_id = in.get_int();
+    frame.page_id = in.get_int();
+    frame.occupied = in.get_bool();
+    frame.ref_count = in.get_int();
+    frame.region = in.get_int();
+    frame.region_page = in.get_int();
+  }
+  for (int node = 0; node < numa_nodes; ++node)
+    free_frames[node] = FreeFrameSet(node_first[node + 1] - node_first[node]);
+  for (int i = 0; i < base_frames; ++i) {
+    if (!in.get_bool())
+      mark_frame_used(i);
+  }
+  free_huge_frames = FreeFrameSet(huge_frame_count);
+  for (int i = 0; i < huge_frame_count; ++i) {
+    if (!in.get_bool())
+      free_huge_frames.mark_used(i);
+  }
+  frames_by_process.clear();
+  for (size_t i = in.get_count(); i > 0; --i) {
+    int pid = in.get_int();
+    in.get_vector(frames_by_process[pid]);
+  }
+  in.get_vector(frame_slot);
+  in.get_vector(frame_loading);
+  if (frame_slot.size() != frames.size() ||
+      frame_loading.size() != frames.size())
+    throw std::runtime_error("Instantánea corrupta");
+  // El recolector de la ejecución restaurada no conoce los marcos: el
+  // próximo registro los envía todos.
+  frame_dirty.assign(total_frames, false);
+  dirty_frames.clear();
+  for (int i = 0; i < total_frames; ++i)
+    mark_frame_dirty(i);
+
+  shared_regions.assign(in.get_count(), SharedRegion());
+  region_ids.clear();
+  for (size_t i = 0; i < shared_regions.size(); ++i) {
+    SharedRegion &region = shared_regions[i];
+    region.name = in.get_string();
+    in.get_vector(region.frames);
+    in.get_vector(region.mappers);
+    region_ids[region.name] = static_cast<int>(i);
+  }
+  region_mappings.clear();
+  for (size_t i = in.get_count(); i > 0; --i) {
+    auto &mappings = region_mappings[in.get_int()];
+    mappings.resize(in.get_count());
+    for (auto &mapping : mappings) {
+      mapping.region = in.get_int();
+      mapping.first_entry = in.get_int();
+      in.get_vector(mapping.copied);
+      if (mapping.region < 0 ||
+          mapping.region >= static_cast<int>(shared_regions.size()))
+        throw std::runtime_error("Instantánea corrupta");
+    }
+  }
+
+  process_map.clear();
+  for (size_t i = in.get_count(); i > 0; --i) {
+    auto process = in.get_process();
+    if (process)
+      process_map[process->pid] = process;
+  }
+
+  auto get_task = [&in]() {
+    PageLoadTask task;
+    task.process = in.get_process();
+    task.page_id = in.get_int();
+    task.remaining_time = in.get_int();
+    task.frame_id = in.get_int();
+    task.enqueue_time = in.get_int64();
+    for (size_t i = in.get_count(); i > 0; --i) {
+      int page_id = in.get_int();
+      task.prefetched.emplace_back(page_id, in.get_int());
+    }
+    task.copy = in.get_bool();
+    task.node = in.get_int();
+    return task;
+  };
+  fault_queue.clear();
+  for (size_t i = in.get_count(); i > 0; --i)
+    fault_queue.push_back(get_task());
+  active_tasks.clear();
+  for (size_t i = in.get_count(); i > 0; --i)
+    active_tasks.push_back(get_task());
+
+  admitted_demand.clear();
+  for (size_t i = in.get_count(); i > 0; --i) {
+    int pid = in.get_int();
+    admitted_demand[pid] = in.get_int();
+  }
+  admitted_frames = in.get_int();
+  deferred_since.clear();
+  for (size_t i = in.get_count(); i > 0; --i) {
+    int pid = in.get_int();
+    deferred_since[pid] = in.get_int64();
+  }
+  deferred_admissions = in.get_int64();
+  deferral_ticks = in.get_int64();
+  peak_used_frames = in.get_int();
+
+  tlbs.clear();
+  for (size_t i = in.get_count(); i > 0; --i) {
+    tlbs.emplace_back(tlb_entries, tlb_ways, tlb_tagged);
+    tlbs.back().load_state(in);
+  }
+
+  memory_waits.clear();
+  for (size_t i = in.get_count(); i > 0; --i) {
+    auto &pending = memory_waits[in.get_int()].pending;
+    in.get_vector(pending);
+    std::sort(pending.begin(), pending.end());
+  }
+  std::vector<int> waiting;
+  in.get_vector(waiting);
+  for (int pid : waiting)
+    memory_waits[pid].waiting = true;
+  if (numa_nodes > 1) {
+    for (size_t i = in.get_count(); i > 0; --i) {
+      auto &wait = memory_waits[in.get_int()];
+      wait.node = in.get_int();
+      wait.stalled_access = in.get_int64();
+    }
+    for (auto &stats : numa_stats) {
+      stats.page_faults = in.get_int64();
+      stats.local_accesses = in.get_int64();
+      stats.remote_accesses = in.get_int64();
+      stats.remote_loads = in.get_int64();
+      stats.remote_stall_ticks = in.get_int64();
+    }
   }
 
-  metrics_collector->log_frame_status(tick, entries);
+  memory_time = in.get_int64();
+  total_page_faults = in.get_int64();
+  total_replacements = in.get_int64();
+  total_cow_faults = in.get_int64();
+
+  in.expect(algorithm != nullptr, "algoritmo de reemplazo");
+  if (algorithm)
+    algorithm->load_state(in);
+  in.expect(huge_algorithm != nullptr, "algoritmo de páginas grandes");
+  if (huge_algorithm)
+    huge_algorithm->load_state(in);
 }
 
 } // namespace OSSimulator
@@ -1,43 +1,136 @@
 #include "memory/nru_replacement.hpp"
 #include "core/process.hpp"
-#include <random>
-#include <vector>
+#include "core/snapshot.hpp"
+#include <sstream>
 
 namespace OSSimulator {
 
+namespace {
+
+int bit_count(uint64_t word) {
+#if defined(__GNUC__) || defined(__clang__)
+  return __builtin_popcountll(word);
+#else
+  int count = 0;
+  while (word != 0) {
+    word &= word - 1;
+    ++count;
+  }
+  return count;
+#endif
+}
+
+int lowest_bit(uint64_t word) {
+#if defined(__GNUC__) || defined(__clang__)
+  return __builtin_ctzll(word);
+#else
+  int bit = 0;
+  while ((word & 1ULL) == 0) {
+    word >>= 1;
+    ++bit;
+  }
+  return bit;
+#endif
+}
+
+} // namespace
+
+NRUReplacement::NRUReplacement(uint32_t seed) : generator(seed) {}
+
 int NRUReplacement::select_victim(
     const std::vector<Frame> &frames,
-    const std::unordered_map<int, std::shared_ptr<Process>> &process_map,
-    int /*current_time*/) {
-  std::vector<int> classes[4];
-
-  for (const auto &frame : frames) {
-    if (!frame.occupied)
+    const std::unordered_map<int, std::shared_ptr<Process>> & /*process_map*/,
+    Tick /*current_time*/) {
+  for (int class_idx = 0; class_idx < CLASS_COUNT; ++class_idx) {
+    if (class_size[class_idx] == 0)
       continue;
 
-    auto it = process_map.find(frame.process_id);
-    if (it != process_map.end()) {
-      const Page &page = it->second->page_table[frame.page_id];
-      if (page.referenced) {
+    std::uniform_int_distribution<int> dis(0, class_size[class_idx] - 1);
+    int rank = dis(generator);
+
+    for (size_t w = 0; w < classes[class_idx].size(); ++w) {
+      uint64_t word = classes[class_idx][w];
+      int count = bit_count(word);
+      if (rank >= count) {
+        rank -= count;
         continue;
       }
-      int class_idx = 0;
-      if (page.modified)
-        class_idx += 1;
-      classes[class_idx].push_back(frame.frame_id);
+      for (; rank > 0; --rank)
+        word &= word - 1;
+
+      int frame_id = static_cast<int>(w * 64) + lowest_bit(word);
+      if (frame_id < static_cast<int>(frames.size()) &&
+          frames[frame_id].occupied)
+        return frame_id;
+      return -1;
     }
   }
+  return -1;
+}
 
-  std::random_device rd;
-  std::mt19937 gen(rd());
+void NRUReplacement::on_frame_release(int frame_id) { set_class(frame_id, -1); }
 
-  for (int i = 0; i < 4; ++i) {
-    if (!classes[i].empty()) {
-      std::uniform_int_distribution<> dis(0, classes[i].size() - 1);
-      return classes[i][dis(gen)];
-    }
+void NRUReplacement::on_process_referenced(const Process &process,
+                                           bool referenced) {
+  for (const auto &page : process.page_table) {
+    if (!page.is_valid() || !owns_frame(page.get_frame_number()))
+      continue;
+    set_class(page.get_frame_number(), referenced ? -1 : (page.is_modified() ? 1 : 0));
   }
-  return -1;
+}
+
+void NRUReplacement::on_frame_referenced(int frame_id) {
+  set_class(frame_id, -1);
+}
+
+void NRUReplacement::set_class(int frame_id, int class_idx) {
+  if (frame_id < 0)
+    return;
+
+  if (frame_id >= static_cast<int>(frame_class.size())) {
+    if (class_idx == -1)
+      return;
+    frame_class.resize(frame_id + 1, -1);
+    size_t words = (frame_class.size() + 63) / 64;
+    for (auto &bits : classes)
+      bits.resize(words, 0);
+  }
+
+  int previous = frame_class[frame_id];
+  if (previous == class_idx)
+    return;
+
+  uint64_t mask = 1ULL << (frame_id % 64);
+  if (previous != -1) {
+    classes[previous][frame_id / 64] &= ~mask;
+    class_size[previous]--;
+  }
+  if (class_idx != -1) {
+    classes[class_idx][frame_id / 64] |= mask;
+    class_size[class_idx]++;
+  }
+  frame_class[frame_id] = static_cast<int8_t>(class_idx);
+}
+
+void NRUReplacement::save_state(SnapshotWriter &out) const {
+  for (int class_idx = 0; class_idx < CLASS_COUNT; ++class_idx) {
+    out.put_vector(classes[class_idx]);
+    out.put_int(class_size[class_idx]);
+  }
+  out.put_vector(frame_class);
+  std::ostringstream state;
+  state << generator;
+  out.put_string(state.str());
+}
+
+void NRUReplacement::load_state(SnapshotReader &in) {
+  for (int class_idx = 0; class_idx < CLASS_COUNT; ++class_idx) {
+    in.get_vector(classes[class_idx]);
+    class_size[class_idx] = in.get_int();
+  }
+  in.get_vector(frame_class);
+  std::istringstream state(in.get_string());
+  state >> generator;
 }
 
 } // namespace OSSimulator
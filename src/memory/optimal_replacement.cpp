@@ -1,72 +1,133 @@
 #include "memory/optimal_replacement.hpp"
 #include "core/process.hpp"
+#include "core/snapshot.hpp"
+#include <algorithm>
+#include <limits>
 
 namespace OSSimulator {
 
 int OptimalReplacement::select_victim(
     const std::vector<Frame> &frames,
     const std::unordered_map<int, std::shared_ptr<Process>> &process_map,
-    int /*current_time*/) {
-
-  int victim_terminated = -1;
-  int victim_io_waiting = -1;
-  int longest_io_time = -1;
-  int victim_unblocked = -1;
+    Tick /*current_time*/) {
+  for (const auto &entry : candidates) {
+    int frame_id = entry.second;
+    if (frame_id >= static_cast<int>(frames.size()))
+      continue;
 
-  for (const auto &frame : frames) {
+    const Frame &frame = frames[frame_id];
     if (!frame.occupied)
       continue;
 
     auto it = process_map.find(frame.process_id);
+    if (it == process_map.end())
+      return frame_id;
 
-    if (it == process_map.end()) {
-      return frame.frame_id;
-    }
+    const auto &page_table = it->second->page_table;
+    if (frame.page_id >= 0 &&
+        frame.page_id < static_cast<int>(page_table.size()) &&
+        page_table[frame.page_id].is_referenced())
+      continue;
+    return frame_id;
+  }
+  return -1;
+}
 
-    auto &proc = *it->second;
+void OptimalReplacement::on_frame_release(int frame_id) {
+  remove_candidate(frame_id);
+}
 
-    if (frame.page_id >= 0 &&
-        frame.page_id < static_cast<int>(proc.page_table.size())) {
-      if (proc.page_table[frame.page_id].referenced) {
-        continue;
-      }
-    }
-
-    ProcessState state = proc.state.load();
-
-    if (state == ProcessState::TERMINATED) {
-      if (victim_terminated == -1) {
-        victim_terminated = frame.frame_id;
-      }
+void OptimalReplacement::on_frame_referenced(int frame_id) {
+  remove_candidate(frame_id);
+}
+
+void OptimalReplacement::on_process_referenced(const Process &process,
+                                               bool referenced) {
+  const auto &table = process.page_table;
+  for (int entry = 0; entry < static_cast<int>(table.size()); ++entry) {
+    const Page &page = table[entry];
+    if (!page.is_valid() || !owns_frame(page.get_frame_number()))
       continue;
-    }
-
-    if (state == ProcessState::WAITING) {
-      int remaining_io = 0;
-      const Burst *current_burst = proc.get_current_burst();
-      if (current_burst && current_burst->type == BurstType::IO) {
-        remaining_io = current_burst->remaining_time;
-      }
-
-      if (remaining_io > longest_io_time) {
-        longest_io_time = remaining_io;
-        victim_io_waiting = frame.frame_id;
-      }
+
+    int frame_id = page.get_frame_number();
+    remove_candidate(frame_id);
+    if (referenced)
       continue;
-    }
 
-    if (victim_unblocked == -1) {
-      victim_unblocked = frame.frame_id;
-    }
+    if (frame_id >= static_cast<int>(distance_of.size()))
+      distance_of.resize(frame_id + 1, -1);
+    int distance = next_use_distance(process, entry);
+    distance_of[frame_id] = distance;
+    candidates.emplace(-distance, frame_id);
   }
+}
+
+const OptimalReplacement::TraceIndex &
+OptimalReplacement::trace_index(const Process &process) {
+  auto it = traces.find(process.pid);
+  if (it != traces.end())
+    return it->second;
 
-  if (victim_terminated != -1) {
-    return victim_terminated;
+  TraceIndex index;
+  const auto &trace = process.memory_access_trace;
+  for (int pos = 0; pos < static_cast<int>(trace.size()); ++pos) {
+    int page_id = trace[pos];
+    if (page_id < 0)
+      continue;
+    if (page_id >= static_cast<int>(index.positions.size()))
+      index.positions.resize(page_id + 1);
+    index.positions[page_id].push_back(pos);
+  }
+  return traces.emplace(process.pid, std::move(index)).first->second;
+}
+
+int OptimalReplacement::next_use_distance(const Process &process,
+                                          int entry) {
+  if (process.memory_access_trace.empty())
+    return 0;
+
+  // El rastro usa páginas base: una página grande se usa cuando se accede a
+  // cualquiera de las páginas que cubre.
+  const TraceIndex &index = trace_index(process);
+  int current = static_cast<int>(process.current_access_index);
+  int distance = std::numeric_limits<int>::max();
+  int first = process.page_table.first_page(entry);
+  int last = std::min(first + process.page_table.entry_size(entry),
+                      static_cast<int>(index.positions.size()));
+  for (int page_id = std::max(0, first); page_id < last; ++page_id) {
+    const auto &positions = index.positions[page_id];
+    auto next = std::lower_bound(positions.begin(), positions.end(), current);
+    if (next != positions.end())
+      distance = std::min(distance, *next - current);
+  }
+  return distance;
+}
+
+void OptimalReplacement::remove_candidate(int frame_id) {
+  if (frame_id < 0 || frame_id >= static_cast<int>(distance_of.size()) ||
+      distance_of[frame_id] == -1)
+    return;
+  candidates.erase({-distance_of[frame_id], frame_id});
+  distance_of[frame_id] = -1;
+}
+
+void OptimalReplacement::save_state(SnapshotWriter &out) const {
+  // Los índices de los rastros se reconstruyen al usarse.
+  out.put_uint(candidates.size());
+  for (const auto &[distance, frame_id] : candidates) {
+    out.put_int(distance);
+    out.put_int(frame_id);
   }
-  if (victim_io_waiting != -1) {
-    return victim_io_waiting;
+  out.put_vector(distance_of);
+}
+
+void OptimalReplacement::load_state(SnapshotReader &in) {
+  candidates.clear();
+  for (size_t i = in.get_count(); i > 0; --i) {
+    int distance = in.get_int();
+    candidates.emplace(distance, in.get_int());
   }
-  return victim_unblocked;
+  in.get_vector(distance_of);
 }
 
 } // namespace OSSimulator
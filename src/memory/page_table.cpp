@@ -0,0 +1,77 @@
+#include "memory/page_table.hpp"
+#include "core/snapshot.hpp"
+#include <algorithm>
+
+namespace OSSimulator {
+
+void PageTable::reset(int pages, int huge_regions, int huge_page_size,
+                      bool access_times) {
+  pages = std::max(0, pages);
+  this->huge_page_size = std::max(1, huge_page_size);
+  this->huge_regions =
+      std::clamp(huge_regions, 0, pages / this->huge_page_size);
+  base_page_count = pages;
+
+  int huge_span = this->huge_regions * this->huge_page_size;
+  entries.assign(static_cast<std::size_t>(this->huge_regions + pages -
+                                          huge_span),
+                 Page());
+  this->access_times.clear();
+  if (access_times)
+    this->access_times.assign(entries.size(), 0);
+}
+
+int PageTable::first_page(int entry) const {
+  if (entry < huge_regions)
+    return entry * huge_page_size;
+  return huge_regions * huge_page_size + entry - huge_regions;
+}
+
+int PageTable::entry_for_page(int page) const {
+  if (page < 0 || page >= base_page_count)
+    return -1;
+  int huge_span = huge_regions * huge_page_size;
+  if (page < huge_span)
+    return page / huge_page_size;
+  return huge_regions + page - huge_span;
+}
+
+std::size_t PageTable::memory_bytes() const {
+  return entries.capacity() * sizeof(Page) +
+         access_times.capacity() * sizeof(Tick);
+}
+
+void PageTable::save_state(SnapshotWriter &out) const {
+  out.put_int(huge_regions);
+  out.put_int(huge_page_size);
+  out.put_int(base_page_count);
+  out.put_uint(entries.size());
+  for (const Page &page : entries) {
+    out.put_int(page.get_frame_number());
+    out.put_uint((page.is_valid() ? 1u : 0u) |
+                 (page.is_referenced() ? 2u : 0u) |
+                 (page.is_modified() ? 4u : 0u));
+  }
+  out.put_uint(access_times.size());
+  for (Tick time : access_times)
+    out.put_int(time);
+}
+
+void PageTable::load_state(SnapshotReader &in) {
+  huge_regions = in.get_int();
+  huge_page_size = in.get_int();
+  base_page_count = in.get_int();
+  entries.assign(in.get_count(), Page());
+  for (Page &page : entries) {
+    page.set_frame_number(in.get_int());
+    uint64_t bits = in.get_uint();
+    page.set_valid(bits & 1u);
+    page.set_referenced(bits & 2u);
+    page.set_modified(bits & 4u);
+  }
+  access_times.assign(in.get_count(), 0);
+  for (Tick &time : access_times)
+    time = in.get_int64();
+}
+
+} // namespace OSSimulator
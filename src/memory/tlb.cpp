@@ -0,0 +1,88 @@
+#include "memory/tlb.hpp"
+#include "core/snapshot.hpp"
+#include <algorithm>
+
+namespace OSSimulator {
+
+TLB::TLB(int entries, int ways, bool tagged) : tagged(tagged) {
+  entries = std::max(0, entries);
+  ways = std::clamp(ways, 1, std::max(1, entries));
+  while (entries % ways != 0)
+    --ways;
+  this->ways = ways;
+  sets = entries / ways;
+  this->entries.resize(static_cast<size_t>(entries));
+}
+
+bool TLB::translate(int pid, int page) {
+  if (entries.empty())
+    return false;
+
+  ++clock;
+  auto set = entries.begin() + static_cast<long>(page % sets) * ways;
+  auto victim = set;
+  for (auto it = set; it != set + ways; ++it) {
+    if (it->pid == pid && it->page == page) {
+      it->last_use = clock;
+      ++hits;
+      return true;
+    }
+    if (it->last_use < victim->last_use)
+      victim = it;
+  }
+
+  ++misses;
+  *victim = {pid, page, clock};
+  return false;
+}
+
+void TLB::switch_context() {
+  if (tagged)
+    return;
+  std::fill(entries.begin(), entries.end(), Entry());
+}
+
+void TLB::invalidate(int pid, int page) {
+  if (entries.empty() || page < 0)
+    return;
+  auto set = entries.begin() + static_cast<long>(page % sets) * ways;
+  for (auto it = set; it != set + ways; ++it) {
+    if (it->pid == pid && it->page == page)
+      *it = Entry();
+  }
+}
+
+void TLB::invalidate_process(int pid) {
+  for (auto &entry : entries) {
+    if (entry.pid == pid)
+      entry = Entry();
+  }
+}
+
+void TLB::save_state(SnapshotWriter &out) const {
+  out.put_int(static_cast<int64_t>(entries.size()));
+  out.put_int(ways);
+  for (const Entry &entry : entries) {
+    out.put_int(entry.pid);
+    out.put_int(entry.page);
+    out.put_uint(entry.last_use);
+  }
+  out.put_uint(clock);
+  out.put_int(hits);
+  out.put_int(misses);
+}
+
+void TLB::load_state(SnapshotReader &in) {
+  in.expect(static_cast<int64_t>(entries.size()), "entradas de la TLB");
+  in.expect(ways, "vías de la TLB");
+  for (Entry &entry : entries) {
+    entry.pid = in.get_int();
+    entry.page = in.get_int();
+    entry.last_use = in.get_uint();
+  }
+  clock = in.get_uint();
+  hits = in.get_int64();
+  misses = in.get_int64();
+}
+
+} // namespace OSSimulator
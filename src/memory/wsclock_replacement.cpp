@@ -0,0 +1,74 @@
+#include "memory/wsclock_replacement.hpp"
+#include "core/process.hpp"
+#include "core/snapshot.hpp"
+#include <algorithm>
+
+namespace OSSimulator {
+
+WSClockReplacement::WSClockReplacement(int window)
+    : window(std::max(0, window)) {}
+
+int WSClockReplacement::select_victim(
+    const std::vector<Frame> &frames,
+    const std::unordered_map<int, std::shared_ptr<Process>> &process_map,
+    Tick current_time) {
+  std::size_t first = static_cast<std::size_t>(first_frame);
+  std::size_t end = frame_end(frames);
+  if (end <= first)
+    return -1;
+  std::size_t count = end - first;
+  ensure_frame(static_cast<int>(end) - 1);
+  if (last_use.size() < end)
+    last_use.resize(end, current_time);
+
+  int first_dirty = -1;
+  int first_candidate = -1;
+
+  for (std::size_t step = 0; step < count; ++step) {
+    std::size_t frame_id = first + hand % count;
+    hand = (frame_id - first + 1) % count;
+
+    if (is_skipped(frames, frame_id))
+      continue;
+    if (use_bit[frame_id]) {
+      use_bit[frame_id] = false;
+      last_use[frame_id] = current_time;
+      continue;
+    }
+    if (first_candidate == -1)
+      first_candidate = static_cast<int>(frame_id);
+    if (current_time - last_use[frame_id] <= window)
+      continue;
+
+    bool modified = false;
+    const Frame &frame = frames[frame_id];
+    auto it = process_map.find(frame.process_id);
+    if (it != process_map.end() && frame.page_id >= 0 &&
+        frame.page_id < static_cast<int>(it->second->page_table.size())) {
+      modified = it->second->page_table[frame.page_id].is_modified();
+    }
+    if (!modified)
+      return static_cast<int>(frame_id);
+    if (first_dirty == -1)
+      first_dirty = static_cast<int>(frame_id);
+  }
+
+  if (first_dirty != -1)
+    return first_dirty;
+  if (first_candidate != -1)
+    return first_candidate;
+  // Todos los bits de uso estaban activos y ya se limpiaron: Clock decide.
+  return ClockReplacement::select_victim(frames, process_map, current_time);
+}
+
+void WSClockReplacement::save_state(SnapshotWriter &out) const {
+  ClockReplacement::save_state(out);
+  out.put_vector(last_use);
+}
+
+void WSClockReplacement::load_state(SnapshotReader &in) {
+  ClockReplacement::load_state(in);
+  in.get_vector(last_use);
+}
+
+} // namespace OSSimulator
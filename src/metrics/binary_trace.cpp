@@ -0,0 +1,650 @@
+#include "metrics/metrics_collector.hpp"
+#include <cstring>
+#include <fstream>
+#include <iterator>
+
+namespace OSSimulator {
+
+/*
+ * Formato de la traza binaria.
+ *
+ * Cabecera: "OSST", versión (1 byte) y 3 bytes reservados. A continuación una
+ * secuencia de registros que comienzan con un byte de tipo:
+ *
+ *   STRING          longitud (varint) + bytes. Recibe implícitamente el
+ *                   siguiente identificador; se emite la primera vez que se
+ *                   usa una cadena.
+ *   TICK            delta del tick (zigzag), máscara de secciones (varint) y
+ *                   las secciones presentes en el orden de las claves JSON.
+ *                   Los deltas de tabla de páginas y de marcos usan su propio
+ *                   bit y la misma codificación que la instantánea completa.
+ *   CPU_SUMMARY     enteros en varint y promedios como double de 8 bytes,
+ *                   seguidos de las filas de percentiles de latencia (grupo,
+ *                   clave, métrica, cantidad, p50, p95, p99 y máximo).
+ *   CORE_SUMMARY    contadores de un núcleo en varint.
+ *   MEMORY_SUMMARY  contadores en varint; la utilización, el rendimiento y
+ *                   la tasa de aciertos de la TLB se recalculan.
+ *   NUMA_SUMMARY    contadores de un nodo NUMA en varint; la localidad se
+ *                   recalcula.
+ *
+ * Los enteros con signo se codifican en zigzag y las cadenas por su
+ * identificador, de modo que los nombres repetidos ocupan uno o dos bytes.
+ */
+
+namespace {
+
+constexpr char MAGIC[4] = {'O', 'S', 'S', 'T'};
+constexpr uint8_t VERSION = 4;
+
+enum RecordType : uint8_t {
+  RECORD_STRING = 0x01,
+  RECORD_TICK = 0x02,
+  RECORD_CPU_SUMMARY = 0x03,
+  RECORD_MEMORY_SUMMARY = 0x04,
+  RECORD_CORE_SUMMARY = 0x05,
+  RECORD_NUMA_SUMMARY = 0x06,
+};
+
+enum SectionMask : uint32_t {
+  SECTION_CPU = 1u << 0,
+  SECTION_IO = 1u << 1,
+  SECTION_MEMORY = 1u << 2,
+  SECTION_TRANSITIONS = 1u << 3,
+  SECTION_QUEUES = 1u << 4,
+  SECTION_PAGE_TABLE = 1u << 5,
+  SECTION_FRAME_STATUS = 1u << 6,
+  SECTION_PAGE_TABLE_DELTA = 1u << 7,
+  SECTION_FRAME_STATUS_DELTA = 1u << 8,
+  SECTION_CORES = 1u << 9,
+  SECTION_IO_DEVICES = 1u << 10,
+};
+
+constexpr uint32_t SECTION_ANY_PAGE_TABLE =
+    SECTION_PAGE_TABLE | SECTION_PAGE_TABLE_DELTA;
+constexpr uint32_t SECTION_ANY_FRAME_STATUS =
+    SECTION_FRAME_STATUS | SECTION_FRAME_STATUS_DELTA;
+
+void put_varint(std::string &out, uint64_t value) {
+  while (value >= 0x80) {
+    out += static_cast<char>((value & 0x7F) | 0x80);
+    value >>= 7;
+  }
+  out += static_cast<char>(value);
+}
+
+void put_int(std::string &out, int64_t value) {
+  put_varint(out, (static_cast<uint64_t>(value) << 1) ^
+                      static_cast<uint64_t>(value >> 63));
+}
+
+void put_double(std::string &out, double value) {
+  uint64_t bits;
+  std::memcpy(&bits, &value, sizeof(bits));
+  for (int i = 0; i < 8; ++i)
+    out += static_cast<char>((bits >> (8 * i)) & 0xFF);
+}
+
+void put_int_list(std::string &out, const std::vector<int> &values) {
+  put_varint(out, values.size());
+  for (int v : values)
+    put_int(out, v);
+}
+
+/**
+ * Lector secuencial sobre el contenido de una traza binaria. Cualquier lectura
+ * fuera de rango deja el lector en estado de error.
+ */
+class TraceReader {
+public:
+  TraceReader(const std::string &bytes) : data(bytes) {}
+
+  bool ok() const { return !failed; }
+  bool at_end() const { return pos >= data.size(); }
+
+  uint8_t byte() {
+    if (pos >= data.size()) {
+      failed = true;
+      return 0;
+    }
+    return static_cast<uint8_t>(data[pos++]);
+  }
+
+  uint64_t varint() {
+    uint64_t value = 0;
+    for (int shift = 0; shift < 64; shift += 7) {
+      uint8_t b = byte();
+      value |= static_cast<uint64_t>(b & 0x7F) << shift;
+      if (!(b & 0x80))
+        return value;
+    }
+    failed = true;
+    return 0;
+  }
+
+  int64_t integer64() {
+    uint64_t raw = varint();
+    return static_cast<int64_t>(raw >> 1) ^ -static_cast<int64_t>(raw & 1);
+  }
+
+  int integer() { return static_cast<int>(integer64()); }
+
+  size_t count() {
+    uint64_t n = varint();
+    // Cada elemento ocupa al menos un byte: evita reservas desmesuradas.
+    if (n > data.size() - pos) {
+      failed = true;
+      return 0;
+    }
+    return static_cast<size_t>(n);
+  }
+
+  double real() {
+    uint64_t bits = 0;
+    for (int i = 0; i < 8; ++i)
+      bits |= static_cast<uint64_t>(byte()) << (8 * i);
+    double value;
+    std::memcpy(&value, &bits, sizeof(value));
+    return value;
+  }
+
+  std::string raw(size_t length) {
+    if (length > data.size() - pos) {
+      failed = true;
+      return {};
+    }
+    std::string value = data.substr(pos, length);
+    pos += length;
+    return value;
+  }
+
+  const std::string &string(const std::vector<std::string> &table) {
+    static const std::string empty;
+    uint64_t id = varint();
+    if (id >= table.size()) {
+      failed = true;
+      return empty;
+    }
+    return table[id];
+  }
+
+  std::vector<int> int_list() {
+    std::vector<int> values(count());
+    for (int &v : values)
+      v = integer();
+    return values;
+  }
+
+private:
+  const std::string &data;
+  size_t pos = 0;
+  bool failed = false;
+};
+
+} // namespace
+
+void MetricsCollector::start_binary_trace() {
+  string_ids.clear();
+  name_string_ids.clear();
+  last_binary_tick = 0;
+
+  std::string header(MAGIC, sizeof(MAGIC));
+  header += static_cast<char>(VERSION);
+  header.append(3, '\0');
+  write_raw(header);
+}
+
+void MetricsCollector::encode_string(std::string &out,
+                                     const std::string &value) {
+  auto it = string_ids.find(value);
+  if (it == string_ids.end()) {
+    uint32_t id = static_cast<uint32_t>(string_ids.size());
+    it = string_ids.emplace(value, id).first;
+
+    // El registro de la cadena debe preceder al registro que la usa; como
+    // `out` ya contiene el comienzo de ese registro, se escribe aparte.
+    std::string record;
+    record += static_cast<char>(RECORD_STRING);
+    put_varint(record, value.size());
+    record += value;
+    write_raw(record);
+  }
+  put_varint(out, it->second);
+}
+
+void MetricsCollector::encode_name(std::string &out, NameId name) {
+  if (name < name_string_ids.size() && name_string_ids[name] != 0) {
+    put_varint(out, name_string_ids[name] - 1);
+    return;
+  }
+  const std::string &value = name_table().name(name);
+  encode_string(out, value);
+  if (name >= name_string_ids.size())
+    name_string_ids.resize(name + 1, 0);
+  name_string_ids[name] = string_ids.at(value) + 1;
+}
+
+void MetricsCollector::encode_tick(std::string &out, Tick tick,
+                                   const TickData &data) {
+  uint32_t mask = 0;
+  if (!data.cores.empty())
+    mask |= SECTION_CORES;
+  if (data.has_cpu)
+    mask |= SECTION_CPU;
+  if (data.has_io)
+    mask |= SECTION_IO;
+  if (!data.io_devices.empty())
+    mask |= SECTION_IO_DEVICES;
+  if (data.has_memory)
+    mask |= SECTION_MEMORY;
+  if (!data.state_transitions.empty())
+    mask |= SECTION_TRANSITIONS;
+  if (data.has_queue_snapshot)
+    mask |= SECTION_QUEUES;
+  if (data.has_page_table)
+    mask |= data.page_table.keyframe ? SECTION_PAGE_TABLE
+                                     : SECTION_PAGE_TABLE_DELTA;
+  if (data.has_frame_status)
+    mask |= data.frame_status.keyframe ? SECTION_FRAME_STATUS
+                                       : SECTION_FRAME_STATUS_DELTA;
+
+  // Las cadenas nuevas se emiten antes del registro del tick, así que el
+  // cuerpo se construye aparte y se antepone el encabezado al final.
+  std::string &body = tick_body;
+  body.clear();
+  if (mask & SECTION_CORES) {
+    put_varint(body, data.cores.size());
+    for (const auto &core : data.cores) {
+      body += static_cast<char>(core.context_switch);
+      put_int(body, core.core);
+      encode_string(body, core.event);
+      encode_name(body, core.name);
+      put_int(body, core.pid);
+      put_varint(body, core.ready_queue_size);
+      put_int(body, core.remaining);
+    }
+  }
+
+  if (mask & SECTION_CPU) {
+    body += static_cast<char>(data.cpu.context_switch);
+    encode_string(body, data.cpu.event);
+    encode_name(body, data.cpu.name);
+    put_int(body, data.cpu.pid);
+    put_varint(body, data.cpu.ready_queue_size);
+    put_int(body, data.cpu.remaining);
+  }
+
+  if (mask & SECTION_ANY_FRAME_STATUS) {
+    put_varint(body, data.frame_status.frames.size());
+    for (const auto &entry : data.frame_status.frames) {
+      put_int(body, entry.frame_id);
+      body += static_cast<char>(entry.occupied);
+      put_int(body, entry.page_id);
+      put_int(body, entry.pid);
+    }
+  }
+
+  if (mask & SECTION_IO) {
+    encode_name(body, data.io.device);
+    encode_string(body, data.io.event);
+    encode_name(body, data.io.name);
+    put_int(body, data.io.pid);
+    put_varint(body, data.io.queue_size);
+    put_int(body, data.io.remaining);
+  }
+
+  if (mask & SECTION_IO_DEVICES) {
+    put_varint(body, data.io_devices.size());
+    for (const auto &io : data.io_devices) {
+      encode_name(body, io.device);
+      encode_string(body, io.event);
+      encode_name(body, io.name);
+      put_int(body, io.pid);
+      put_varint(body, io.queue_size);
+      put_int(body, io.remaining);
+    }
+  }
+
+  if (mask & SECTION_MEMORY) {
+    encode_string(body, data.memory.event);
+    put_int(body, data.memory.frame_id);
+    encode_name(body, data.memory.name);
+    put_int(body, data.memory.page_id);
+    put_int(body, data.memory.pid);
+    put_int(body, data.memory.total_page_faults);
+    put_int(body, data.memory.total_replacements);
+  }
+
+  if (mask & SECTION_ANY_PAGE_TABLE) {
+    encode_name(body, data.page_table.name);
+    put_varint(body, data.page_table.pages.size());
+    for (const auto &entry : data.page_table.pages) {
+      put_int(body, entry.frame_id);
+      put_int(body, entry.page_id);
+      body += static_cast<char>((entry.modified ? 1 : 0) |
+                                (entry.referenced ? 2 : 0) |
+                                (entry.valid ? 4 : 0));
+    }
+    put_int(body, data.page_table.pid);
+  }
+
+  if (mask & SECTION_QUEUES) {
+    put_int_list(body, data.queue_snapshot.blocked_io_queue);
+    put_int_list(body, data.queue_snapshot.blocked_memory_queue);
+    put_int_list(body, data.queue_snapshot.ready_queue);
+    put_int(body, data.queue_snapshot.running_pid);
+  }
+
+  if (mask & SECTION_TRANSITIONS) {
+    put_varint(body, data.state_transitions.size());
+    for (const auto &st : data.state_transitions) {
+      encode_string(body, st.from_state);
+      encode_name(body, st.name);
+      put_int(body, st.pid);
+      encode_string(body, st.reason);
+      encode_string(body, st.to_state);
+    }
+  }
+
+  out += static_cast<char>(RECORD_TICK);
+  put_int(out, static_cast<int64_t>(tick) - last_binary_tick);
+  put_varint(out, mask);
+  out += body;
+  last_binary_tick = tick;
+}
+
+void MetricsCollector::encode_cpu_summary(
+    std::string &out, Tick total_time, double cpu_utilization,
+    double avg_waiting_time, double avg_turnaround_time,
+    double avg_response_time, int64_t context_switches,
+    const std::string &algorithm,
+    const std::vector<LatencySummary> &latencies) {
+  std::string body;
+  encode_string(body, algorithm);
+  put_int(body, total_time);
+  put_int(body, context_switches);
+  put_double(body, cpu_utilization);
+  put_double(body, avg_waiting_time);
+  put_double(body, avg_turnaround_time);
+  put_double(body, avg_response_time);
+  put_varint(body, latencies.size());
+  for (const auto &row : latencies) {
+    body += static_cast<char>(row.scope);
+    encode_string(body, row.key);
+    encode_string(body, row.metric);
+    put_varint(body, row.count);
+    put_int(body, row.p50);
+    put_int(body, row.p95);
+    put_int(body, row.p99);
+    put_int(body, row.max);
+  }
+
+  out += static_cast<char>(RECORD_CPU_SUMMARY);
+  out += body;
+}
+
+void MetricsCollector::encode_core_summary(std::string &out, int core,
+                                           Tick total_time, Tick busy_ticks,
+                                           int64_t context_switches,
+                                           int64_t migrations, int64_t steals) {
+  out += static_cast<char>(RECORD_CORE_SUMMARY);
+  put_int(out, core);
+  put_int(out, total_time);
+  put_int(out, busy_ticks);
+  put_int(out, context_switches);
+  put_int(out, migrations);
+  put_int(out, steals);
+}
+
+void MetricsCollector::encode_memory_summary(
+    std::string &out, int64_t total_page_faults, int64_t total_replacements,
+    int total_frames, int used_frames, const std::string &algorithm,
+    int64_t completed_processes, Tick total_time, int64_t deferred_admissions,
+    Tick deferral_ticks, int64_t tlb_hits, int64_t tlb_misses) {
+  std::string body;
+  encode_string(body, algorithm);
+  put_int(body, total_page_faults);
+  put_int(body, total_replacements);
+  put_int(body, total_frames);
+  put_int(body, used_frames);
+  put_int(body, completed_processes);
+  put_int(body, total_time);
+  put_int(body, deferred_admissions);
+  put_int(body, deferral_ticks);
+  put_int(body, tlb_hits);
+  put_int(body, tlb_misses);
+
+  out += static_cast<char>(RECORD_MEMORY_SUMMARY);
+  out += body;
+}
+
+void MetricsCollector::encode_numa_summary(std::string &out, int node,
+                                           int frames, int64_t page_faults,
+                                           int64_t local_accesses,
+                                           int64_t remote_accesses,
+                                           int64_t remote_loads,
+                                           Tick remote_stall_ticks) {
+  out += static_cast<char>(RECORD_NUMA_SUMMARY);
+  put_int(out, node);
+  put_int(out, frames);
+  put_int(out, page_faults);
+  put_int(out, local_accesses);
+  put_int(out, remote_accesses);
+  put_int(out, remote_loads);
+  put_int(out, remote_stall_ticks);
+}
+
+bool MetricsCollector::convert_binary_to_jsonl(const std::string &input,
+                                               const std::string &output) {
+  std::ifstream in(input, std::ios::in | std::ios::binary);
+  if (!in.is_open())
+    return false;
+  std::string bytes((std::istreambuf_iterator<char>(in)),
+                    std::istreambuf_iterator<char>());
+
+  if (bytes.size() < 8 || bytes.compare(0, 4, MAGIC, 4) != 0 ||
+      static_cast<uint8_t>(bytes[4]) != VERSION)
+    return false;
+
+  std::ofstream out(output, std::ios::out | std::ios::trunc);
+  if (!out.is_open())
+    return false;
+
+  TraceReader reader(bytes);
+  reader.raw(8);
+
+  std::vector<std::string> strings;
+  NameTable &names = name_table();
+  std::string line;
+  Tick tick = 0;
+  while (reader.ok() && !reader.at_end()) {
+    uint8_t type = reader.byte();
+    if (type == RECORD_STRING) {
+      strings.push_back(reader.raw(reader.count()));
+    } else if (type == RECORD_TICK) {
+      tick += reader.integer64();
+      uint64_t mask = reader.varint();
+      TickData data;
+
+      if (mask & SECTION_CORES) {
+        data.cores.resize(reader.count());
+        for (auto &core : data.cores) {
+          core.context_switch = reader.byte() != 0;
+          core.core = reader.integer();
+          core.event = reader.string(strings);
+          core.name = names.intern(reader.string(strings));
+          core.pid = reader.integer();
+          core.ready_queue_size = reader.varint();
+          core.remaining = reader.integer64();
+        }
+      }
+
+      if (mask & SECTION_CPU) {
+        data.has_cpu = true;
+        data.cpu.context_switch = reader.byte() != 0;
+        data.cpu.event = reader.string(strings);
+        data.cpu.name = names.intern(reader.string(strings));
+        data.cpu.pid = reader.integer();
+        data.cpu.ready_queue_size = reader.varint();
+        data.cpu.remaining = reader.integer64();
+      }
+
+      if (mask & SECTION_ANY_FRAME_STATUS) {
+        data.has_frame_status = true;
+        data.frame_status.keyframe = (mask & SECTION_FRAME_STATUS) != 0;
+        data.frame_status.frames.resize(reader.count());
+        for (auto &entry : data.frame_status.frames) {
+          entry.frame_id = reader.integer();
+          entry.occupied = reader.byte() != 0;
+          entry.page_id = reader.integer();
+          entry.pid = reader.integer();
+        }
+      }
+
+      if (mask & SECTION_IO) {
+        data.has_io = true;
+        data.io.device = names.intern(reader.string(strings));
+        data.io.event = reader.string(strings);
+        data.io.name = names.intern(reader.string(strings));
+        data.io.pid = reader.integer();
+        data.io.queue_size = reader.varint();
+        data.io.remaining = reader.integer64();
+      }
+
+      if (mask & SECTION_IO_DEVICES) {
+        data.io_devices.resize(reader.count());
+        for (auto &io : data.io_devices) {
+          io.device = names.intern(reader.string(strings));
+          io.event = reader.string(strings);
+          io.name = names.intern(reader.string(strings));
+          io.pid = reader.integer();
+          io.queue_size = reader.varint();
+          io.remaining = reader.integer64();
+        }
+      }
+
+      if (mask & SECTION_MEMORY) {
+        data.has_memory = true;
+        data.memory.event = reader.string(strings);
+        data.memory.frame_id = reader.integer();
+        data.memory.name = names.intern(reader.string(strings));
+        data.memory.page_id = reader.integer();
+        data.memory.pid = reader.integer();
+        data.memory.total_page_faults = reader.integer64();
+        data.memory.total_replacements = reader.integer64();
+      }
+
+      if (mask & SECTION_ANY_PAGE_TABLE) {
+        data.has_page_table = true;
+        data.page_table.keyframe = (mask & SECTION_PAGE_TABLE) != 0;
+        data.page_table.name = names.intern(reader.string(strings));
+        data.page_table.pages.resize(reader.count());
+        for (auto &entry : data.page_table.pages) {
+          entry.frame_id = reader.integer();
+          entry.page_id = reader.integer();
+          uint8_t flags = reader.byte();
+          entry.modified = flags & 1;
+          entry.referenced = flags & 2;
+          entry.valid = flags & 4;
+        }
+        data.page_table.pid = reader.integer();
+      }
+
+      if (mask & SECTION_QUEUES) {
+        data.has_queue_snapshot = true;
+        data.queue_snapshot.blocked_io_queue = reader.int_list();
+        data.queue_snapshot.blocked_memory_queue = reader.int_list();
+        data.queue_snapshot.ready_queue = reader.int_list();
+        data.queue_snapshot.running_pid = reader.integer();
+      }
+
+      if (mask & SECTION_TRANSITIONS) {
+        data.state_transitions.resize(reader.count());
+        for (auto &st : data.state_transitions) {
+          st.from_state = reader.string(strings);
+          st.name = names.intern(reader.string(strings));
+          st.pid = reader.integer();
+          st.reason = reader.string(strings);
+          st.to_state = reader.string(strings);
+        }
+      }
+
+      if (reader.ok()) {
+        serialize_tick(line, tick, data);
+        out << line << '\n';
+      }
+    } else if (type == RECORD_CPU_SUMMARY) {
+      std::string algorithm = reader.string(strings);
+      Tick total_time = reader.integer64();
+      int64_t context_switches = reader.integer64();
+      double cpu_utilization = reader.real();
+      double avg_waiting_time = reader.real();
+      double avg_turnaround_time = reader.real();
+      double avg_response_time = reader.real();
+      std::vector<LatencySummary> latencies(reader.count());
+      for (auto &row : latencies) {
+        row.scope = static_cast<LatencySummary::Scope>(reader.byte());
+        row.key = reader.string(strings);
+        row.metric = reader.string(strings);
+        row.count = reader.varint();
+        row.p50 = reader.integer64();
+        row.p95 = reader.integer64();
+        row.p99 = reader.integer64();
+        row.max = reader.integer64();
+      }
+      if (reader.ok())
+        out << cpu_summary_line(total_time, cpu_utilization, avg_waiting_time,
+                                avg_turnaround_time, avg_response_time,
+                                context_switches, algorithm, latencies)
+            << '\n';
+    } else if (type == RECORD_CORE_SUMMARY) {
+      int core = reader.integer();
+      Tick total_time = reader.integer64();
+      Tick busy_ticks = reader.integer64();
+      int64_t context_switches = reader.integer64();
+      int64_t migrations = reader.integer64();
+      int64_t steals = reader.integer64();
+      if (reader.ok())
+        out << core_summary_line(core, total_time, busy_ticks,
+                                 context_switches, migrations, steals)
+            << '\n';
+    } else if (type == RECORD_MEMORY_SUMMARY) {
+      std::string algorithm = reader.string(strings);
+      int64_t total_page_faults = reader.integer64();
+      int64_t total_replacements = reader.integer64();
+      int total_frames = reader.integer();
+      int used_frames = reader.integer();
+      int64_t completed_processes = reader.integer64();
+      Tick total_time = reader.integer64();
+      int64_t deferred_admissions = reader.integer64();
+      Tick deferral_ticks = reader.integer64();
+      int64_t tlb_hits = reader.integer64();
+      int64_t tlb_misses = reader.integer64();
+      if (reader.ok())
+        out << memory_summary_line(total_page_faults, total_replacements,
+                                   total_frames, used_frames, algorithm,
+                                   completed_processes, total_time,
+                                   deferred_admissions, deferral_ticks,
+                                   tlb_hits, tlb_misses)
+            << '\n';
+    } else if (type == RECORD_NUMA_SUMMARY) {
+      int node = reader.integer();
+      int frames = reader.integer();
+      int64_t page_faults = reader.integer64();
+      int64_t local_accesses = reader.integer64();
+      int64_t remote_accesses = reader.integer64();
+      int64_t remote_loads = reader.integer64();
+      Tick remote_stall_ticks = reader.integer64();
+      if (reader.ok())
+        out << numa_summary_line(node, frames, page_faults, local_accesses,
+                                 remote_accesses, remote_loads,
+                                 remote_stall_ticks)
+            << '\n';
+    } else {
+      return false;
+    }
+  }
+
+  return reader.ok() && out.good();
+}
+
+} // namespace OSSimulator
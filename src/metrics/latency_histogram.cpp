@@ -0,0 +1,207 @@
+#include "metrics/latency_histogram.hpp"
+#include "core/snapshot.hpp"
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+namespace OSSimulator {
+
+namespace {
+
+constexpr int64_t SUB_BUCKETS = int64_t{1}
+                                << LatencyHistogram::SUB_BUCKET_BITS;
+constexpr int64_t HALF_BUCKETS = SUB_BUCKETS / 2;
+
+} // namespace
+
+size_t LatencyHistogram::bucket_index(int64_t value) {
+  if (value < SUB_BUCKETS)
+    return static_cast<size_t>(value);
+
+  // La mantisa (value >> shift) queda en [HALF_BUCKETS, SUB_BUCKETS).
+  int shift = 1;
+  while ((value >> shift) >= SUB_BUCKETS)
+    ++shift;
+  return static_cast<size_t>(SUB_BUCKETS + (shift - 1) * HALF_BUCKETS +
+                             ((value >> shift) - HALF_BUCKETS));
+}
+
+int64_t LatencyHistogram::bucket_highest(size_t index) {
+  auto i = static_cast<int64_t>(index);
+  if (i < SUB_BUCKETS)
+    return i;
+
+  int64_t offset = i - SUB_BUCKETS;
+  int shift = static_cast<int>(offset / HALF_BUCKETS) + 1;
+  int64_t mantissa = HALF_BUCKETS + offset % HALF_BUCKETS;
+  return ((mantissa + 1) << shift) - 1;
+}
+
+void LatencyHistogram::record(int64_t value) {
+  value = std::max<int64_t>(value, 0);
+  size_t index = bucket_index(value);
+  if (index >= counts.size()) {
+    // La capacidad crece al doble: un nuevo máximo rara vez reserva memoria.
+    if (index >= counts.capacity())
+      counts.reserve(std::max(index + 1, counts.capacity() * 2));
+    counts.resize(index + 1, 0);
+  }
+  counts[index]++;
+
+  if (total_count == 0) {
+    min_value = max_value = value;
+  } else {
+    min_value = std::min(min_value, value);
+    max_value = std::max(max_value, value);
+  }
+  total_count++;
+  total_sum += value;
+}
+
+void LatencyHistogram::merge(const LatencyHistogram &other) {
+  if (other.total_count == 0)
+    return;
+  if (other.counts.size() > counts.size())
+    counts.resize(other.counts.size(), 0);
+  for (size_t i = 0; i < other.counts.size(); ++i)
+    counts[i] += other.counts[i];
+
+  if (total_count == 0) {
+    min_value = other.min_value;
+    max_value = other.max_value;
+  } else {
+    min_value = std::min(min_value, other.min_value);
+    max_value = std::max(max_value, other.max_value);
+  }
+  total_count += other.total_count;
+  total_sum += other.total_sum;
+}
+
+int64_t LatencyHistogram::value_at_percentile(double percentile) const {
+  if (total_count == 0)
+    return 0;
+
+  double clamped = std::min(100.0, std::max(0.0, percentile));
+  auto rank = static_cast<uint64_t>(
+      std::ceil(clamped / 100.0 * static_cast<double>(total_count)));
+  rank = std::max<uint64_t>(rank, 1);
+
+  uint64_t seen = 0;
+  for (size_t i = 0; i < counts.size(); ++i) {
+    seen += counts[i];
+    if (seen >= rank)
+      return std::min(std::max(bucket_highest(i), min_value), max_value);
+  }
+  return max_value;
+}
+
+double LatencyHistogram::mean() const {
+  if (total_count == 0)
+    return 0.0;
+  return static_cast<double>(total_sum) / total_count;
+}
+
+void LatencyHistogram::clear() {
+  counts.clear();
+  total_count = 0;
+  total_sum = 0;
+  min_value = max_value = 0;
+}
+
+void LatencyHistogram::save_state(SnapshotWriter &out) const {
+  // Solo las cubetas no vacías, como pares (índice, cuenta).
+  size_t used = static_cast<size_t>(
+      std::count_if(counts.begin(), counts.end(),
+                    [](uint64_t count) { return count > 0; }));
+  out.put_uint(used);
+  for (size_t i = 0; i < counts.size(); ++i) {
+    if (counts[i] > 0) {
+      out.put_uint(i);
+      out.put_uint(counts[i]);
+    }
+  }
+  out.put_uint(total_count);
+  out.put_int(total_sum);
+  out.put_int(min_value);
+  out.put_int(max_value);
+}
+
+void LatencyHistogram::load_state(SnapshotReader &in) {
+  counts.clear();
+  for (size_t i = in.get_count(); i > 0; --i) {
+    uint64_t index = in.get_uint();
+    if (index > bucket_index(INT64_MAX))
+      throw std::runtime_error("Instantánea corrupta");
+    if (index >= counts.size())
+      counts.resize(index + 1, 0);
+    counts[index] = in.get_uint();
+  }
+  total_count = in.get_uint();
+  total_sum = in.get_int64();
+  min_value = in.get_int64();
+  max_value = in.get_int64();
+}
+
+LatencySummary LatencySummary::from(Scope scope, std::string key,
+                                    std::string metric,
+                                    const LatencyHistogram &histogram) {
+  LatencySummary row;
+  row.scope = scope;
+  row.key = std::move(key);
+  row.metric = std::move(metric);
+  row.count = histogram.count();
+  row.p50 = histogram.value_at_percentile(50.0);
+  row.p95 = histogram.value_at_percentile(95.0);
+  row.p99 = histogram.value_at_percentile(99.0);
+  row.max = histogram.max();
+  return row;
+}
+
+void ProcessLatencyStats::record(int priority, Tick waiting, Tick turnaround,
+                                 Tick response) {
+  for (Histograms *histograms : {&overall, &by_priority[priority]}) {
+    histograms->waiting.record(waiting);
+    histograms->turnaround.record(turnaround);
+    histograms->response.record(response);
+  }
+}
+
+std::vector<LatencySummary> ProcessLatencyStats::summarize() const {
+  std::vector<LatencySummary> rows;
+  if (overall.waiting.count() == 0)
+    return rows;
+  append(rows, LatencySummary::Scope::ALL, "", overall);
+  for (const auto &[priority, histograms] : by_priority) {
+    if (histograms.waiting.count() > 0)
+      append(rows, LatencySummary::Scope::PRIORITY, std::to_string(priority),
+             histograms);
+  }
+  return rows;
+}
+
+void ProcessLatencyStats::clear() {
+  // Las prioridades y sus cubetas se conservan para la siguiente carga; las
+  // que queden vacías no aparecen en summarize().
+  auto clear = [](Histograms &histograms) {
+    histograms.waiting.clear();
+    histograms.turnaround.clear();
+    histograms.response.clear();
+  };
+  clear(overall);
+  for (auto &[priority, histograms] : by_priority)
+    clear(histograms);
+}
+
+void ProcessLatencyStats::append(std::vector<LatencySummary> &rows,
+                                 LatencySummary::Scope scope,
+                                 const std::string &key,
+                                 const Histograms &histograms) {
+  rows.push_back(
+      LatencySummary::from(scope, key, "waiting", histograms.waiting));
+  rows.push_back(
+      LatencySummary::from(scope, key, "turnaround", histograms.turnaround));
+  rows.push_back(
+      LatencySummary::from(scope, key, "response", histograms.response));
+}
+
+} // namespace OSSimulator
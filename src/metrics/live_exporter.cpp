@@ -0,0 +1,212 @@
+#include "metrics/live_exporter.hpp"
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+
+namespace OSSimulator {
+
+namespace {
+
+/// Tasas del intervalo entre dos muestras.
+struct Rates {
+  double ticks_per_second = 0.0;
+  double cpu_utilization = 0.0; //!< Fracción entre 0 y 1.
+  double page_fault_rate = 0.0; //!< Fallos por tick.
+  std::vector<double> device_utilization;
+};
+
+Rates compute_rates(const LiveExporter::Sample &current,
+                    const LiveExporter::Sample &previous) {
+  Rates rates;
+  int64_t ticks = current.tick - previous.tick;
+  double seconds =
+      std::chrono::duration<double>(current.time - previous.time).count();
+  if (seconds > 0.0)
+    rates.ticks_per_second = static_cast<double>(ticks) / seconds;
+  if (ticks > 0) {
+    rates.cpu_utilization =
+        static_cast<double>(current.cpu_busy_ticks - previous.cpu_busy_ticks) /
+        (static_cast<double>(ticks) * static_cast<double>(current.cores));
+    rates.page_fault_rate =
+        static_cast<double>(current.page_faults - previous.page_faults) /
+        static_cast<double>(ticks);
+  }
+  for (size_t i = 0; i < current.device_busy_ticks.size(); ++i) {
+    int64_t before =
+        i < previous.device_busy_ticks.size() ? previous.device_busy_ticks[i]
+                                              : 0;
+    rates.device_utilization.push_back(
+        ticks > 0 ? static_cast<double>(current.device_busy_ticks[i] - before) /
+                        static_cast<double>(ticks)
+                  : 0.0);
+  }
+  return rates;
+}
+
+} // namespace
+
+LiveStats::Device *LiveStats::add_device(const std::string &name) {
+  devices.push_back(std::make_unique<Device>(name));
+  return devices.back().get();
+}
+
+LiveExporter::LiveExporter(std::shared_ptr<const LiveStats> stats,
+                           std::chrono::milliseconds interval,
+                           std::string prometheus_file, std::ostream &out)
+    : stats(std::move(stats)), interval(interval),
+      prometheus_file(std::move(prometheus_file)), out(out) {}
+
+LiveExporter::~LiveExporter() { stop(); }
+
+void LiveExporter::start() {
+  if (worker.joinable())
+    return;
+  previous = sample(*stats);
+  stopping = false;
+  worker = std::thread(&LiveExporter::run, this);
+}
+
+void LiveExporter::stop() {
+  if (!worker.joinable())
+    return;
+  {
+    std::lock_guard<std::mutex> lock(wake_mutex);
+    stopping = true;
+  }
+  wake_cv.notify_all();
+  worker.join();
+  export_sample();
+}
+
+void LiveExporter::run() {
+  std::unique_lock<std::mutex> lock(wake_mutex);
+  while (!wake_cv.wait_for(lock, interval, [this] { return stopping; })) {
+    lock.unlock();
+    export_sample();
+    lock.lock();
+  }
+}
+
+void LiveExporter::export_sample() {
+  Sample current = sample(*stats);
+  if (prometheus_file.empty()) {
+    out << summary_line(*stats, current, previous) << std::endl;
+  } else if (!write_failed) {
+    // Se escribe aparte y se renombra para que el lector nunca vea un
+    // archivo a medio escribir. Un error no detiene la simulación.
+    std::string temporary = prometheus_file + ".tmp";
+    bool written;
+    {
+      std::ofstream file(temporary, std::ios::out | std::ios::trunc);
+      written = static_cast<bool>(
+          file << prometheus_text(*stats, current, previous));
+    }
+    std::remove(prometheus_file.c_str());
+    if (!written ||
+        std::rename(temporary.c_str(), prometheus_file.c_str()) != 0) {
+      out << "[ERROR] No se pudo escribir " << prometheus_file << std::endl;
+      write_failed = true;
+    }
+  }
+  previous = std::move(current);
+}
+
+LiveExporter::Sample LiveExporter::sample(const LiveStats &stats) {
+  constexpr auto relaxed = std::memory_order_relaxed;
+  Sample s;
+  s.time = std::chrono::steady_clock::now();
+  s.tick = stats.tick.load(relaxed);
+  s.cpu_busy_ticks = stats.cpu_busy_ticks.load(relaxed);
+  s.cores = std::max<int64_t>(stats.cores.load(relaxed), 1);
+  s.ready = stats.ready.load(relaxed);
+  s.memory_waiting = stats.memory_waiting.load(relaxed);
+  s.io_waiting = stats.io_waiting.load(relaxed);
+  s.arrived = stats.arrived.load(relaxed);
+  s.completed = stats.completed.load(relaxed);
+  s.context_switches = stats.context_switches.load(relaxed);
+  s.page_faults = stats.page_faults.load(relaxed);
+  for (const auto &device : stats.devices) {
+    s.device_busy_ticks.push_back(device->busy_ticks.load(relaxed));
+    s.device_queues.push_back(device->queue.load(relaxed));
+  }
+  return s;
+}
+
+std::string LiveExporter::summary_line(const LiveStats &stats,
+                                       const Sample &current,
+                                       const Sample &previous) {
+  Rates rates = compute_rates(current, previous);
+  std::ostringstream line;
+  line << std::fixed << std::setprecision(1) << "[MONITOR] tick=" << current.tick
+       << " ticks/s=" << rates.ticks_per_second << " listos=" << current.ready
+       << " mem=" << current.memory_waiting << " es=" << current.io_waiting
+       << " terminados=" << current.completed << "/" << current.arrived
+       << " cpu=" << rates.cpu_utilization * 100.0 << "%"
+       << std::setprecision(3) << " fallos/tick=" << rates.page_fault_rate;
+  line << std::setprecision(1);
+  for (size_t i = 0; i < stats.devices.size() && i < current.device_queues.size();
+       ++i) {
+    line << " " << stats.devices[i]->name << "="
+         << rates.device_utilization[i] * 100.0 << "%/"
+         << current.device_queues[i];
+  }
+  return line.str();
+}
+
+std::string LiveExporter::prometheus_text(const LiveStats &stats,
+                                          const Sample &current,
+                                          const Sample &previous) {
+  Rates rates = compute_rates(current, previous);
+  std::ostringstream text;
+  text << std::setprecision(6);
+  auto metric = [&text](const char *name, const char *type, const char *help,
+                        auto value) {
+    text << "# HELP " << name << " " << help << "\n"
+         << "# TYPE " << name << " " << type << "\n"
+         << name << " " << value << "\n";
+  };
+
+  metric("ossim_tick", "gauge", "Tick actual de la simulación.", current.tick);
+  metric("ossim_ticks_per_second", "gauge",
+         "Ticks simulados por segundo en el último intervalo.",
+         rates.ticks_per_second);
+  metric("ossim_ready_queue", "gauge", "Procesos en las colas de listos.",
+         current.ready);
+  metric("ossim_memory_waiting", "gauge", "Procesos esperando páginas.",
+         current.memory_waiting);
+  metric("ossim_io_waiting", "gauge", "Procesos bloqueados en E/S.",
+         current.io_waiting);
+  metric("ossim_arrived_processes_total", "counter", "Procesos llegados.",
+         current.arrived);
+  metric("ossim_completed_processes_total", "counter", "Procesos terminados.",
+         current.completed);
+  metric("ossim_cpu_utilization_ratio", "gauge",
+         "Utilización de CPU en el último intervalo.", rates.cpu_utilization);
+  metric("ossim_context_switches_total", "counter", "Cambios de contexto.",
+         current.context_switches);
+  metric("ossim_page_faults_total", "counter", "Fallos de página.",
+         current.page_faults);
+  metric("ossim_page_fault_rate", "gauge",
+         "Fallos de página por tick en el último intervalo.",
+         rates.page_fault_rate);
+
+  if (!stats.devices.empty()) {
+    text << "# HELP ossim_device_utilization_ratio Utilización del "
+            "dispositivo en el último intervalo.\n"
+         << "# TYPE ossim_device_utilization_ratio gauge\n";
+    for (size_t i = 0; i < stats.devices.size(); ++i)
+      text << "ossim_device_utilization_ratio{device=\""
+           << stats.devices[i]->name << "\"} " << rates.device_utilization[i]
+           << "\n";
+    text << "# HELP ossim_device_queue Solicitudes en cola del dispositivo.\n"
+         << "# TYPE ossim_device_queue gauge\n";
+    for (size_t i = 0; i < stats.devices.size(); ++i)
+      text << "ossim_device_queue{device=\"" << stats.devices[i]->name
+           << "\"} " << current.device_queues[i] << "\n";
+  }
+  return text.str();
+}
+
+} // namespace OSSimulator
@@ -0,0 +1,163 @@
+#include "metrics/metrics_aggregator.hpp"
+#include <algorithm>
+#include <nlohmann/json.hpp>
+
+using json = nlohmann::json;
+
+namespace OSSimulator {
+
+namespace {
+
+/**
+ * Parte total * part / whole redondeada hacia abajo, sin desbordar cuando
+ * el producto no cabe en 64 bits. Con part == whole devuelve total exacto,
+ * así que las diferencias entre segmentos suman siempre total.
+ */
+int64_t proportional(int64_t total, int64_t part, int64_t whole) {
+  if (part >= whole)
+    return total;
+  int64_t quotient = total / whole;
+  int64_t remainder = total % whole;
+  if (remainder == 0 || part <= INT64_MAX / remainder)
+    return quotient * part + remainder * part / whole;
+  return quotient * part +
+         static_cast<int64_t>(static_cast<long double>(remainder) * part /
+                              whole);
+}
+
+} // namespace
+
+void AggregateGauge::add(int value, Tick ticks, bool first) {
+  if (first) {
+    min = max = value;
+  } else {
+    min = std::min(min, value);
+    max = std::max(max, value);
+  }
+  sum += static_cast<int64_t>(value) * ticks;
+}
+
+std::string AggregateWindow::to_json() const {
+  Tick n = ticks();
+  auto per_tick = [n](int64_t count) {
+    return n > 0 ? static_cast<double>(count) / n : 0.0;
+  };
+  auto gauge = [n](const AggregateGauge &g) {
+    return json{{"min", g.min}, {"avg", g.average(n)}, {"max", g.max}};
+  };
+
+  json j;
+  j["window"] = width;
+  j["start"] = start;
+  j["end"] = end;
+  j["cpu_utilization"] =
+      n > 0 ? 100.0 * busy_ticks / (static_cast<double>(n) * cores) : 0.0;
+  j["ready"] = gauge(ready);
+  j["blocked_memory"] = gauge(blocked_memory);
+  j["blocked_io"] = gauge(blocked_io);
+  j["context_switches"] = context_switches;
+  j["page_faults"] = page_faults;
+  j["fault_rate"] = per_tick(page_faults);
+  j["io_completions"] = io_completions;
+  j["io_throughput"] = per_tick(io_completions);
+  j["completed"] = completed;
+  return j.dump();
+}
+
+MetricsAggregator::MetricsAggregator(const std::vector<int> &requested) {
+  for (int width : requested) {
+    if (width > 0 &&
+        std::find(widths.begin(), widths.end(), width) == widths.end())
+      widths.push_back(width);
+  }
+  std::sort(widths.begin(), widths.end());
+  for (int width : widths)
+    series.push_back({width, {}, false});
+}
+
+void MetricsAggregator::open_window(Series &s, Tick tick, int cores) {
+  s.current = AggregateWindow{};
+  s.current.width = s.width;
+  s.current.start = s.current.end = tick;
+  s.current.cores = std::max(cores, 1);
+  s.open = true;
+}
+
+void MetricsAggregator::add(const AggregateSample &sample,
+                            std::vector<AggregateWindow> &closed) {
+  if (!started) {
+    last = sample;
+    started = true;
+    return;
+  }
+
+  const Tick from = last.tick;
+  const Tick to = std::max(sample.tick, from);
+  const int64_t span = to - from;
+  const int64_t busy = sample.busy_ticks - last.busy_ticks;
+  const int64_t switches = sample.context_switches - last.context_switches;
+  const int64_t faults = sample.page_faults - last.page_faults;
+  const int64_t io = sample.io_completions - last.io_completions;
+  const int64_t completed = sample.completed - last.completed;
+  auto add_counters = [&](AggregateWindow &w) {
+    w.context_switches += switches;
+    w.page_faults += faults;
+    w.io_completions += io;
+    w.completed += completed;
+  };
+
+  for (auto &s : series) {
+    if (span == 0) {
+      if (busy != 0 || switches != 0 || faults != 0 || io != 0 ||
+          completed != 0) {
+        if (!s.open)
+          open_window(s, from, sample.cores);
+        s.current.busy_ticks += busy;
+        add_counters(s.current);
+      }
+      continue;
+    }
+
+    for (Tick t = from; t < to;) {
+      const Tick window_start = t - t % s.width;
+      const Tick window_end = window_start + s.width;
+      const Tick segment_end = std::min(to, window_end);
+      if (s.open && s.current.start / s.width != t / s.width) {
+        closed.push_back(s.current);
+        s.open = false;
+      }
+      if (!s.open)
+        open_window(s, t, sample.cores);
+
+      AggregateWindow &w = s.current;
+      const Tick ticks = segment_end - t;
+      const bool first = w.ticks() == 0;
+      w.ready.add(sample.ready, ticks, first);
+      w.blocked_memory.add(sample.blocked_memory, ticks, first);
+      w.blocked_io.add(sample.blocked_io, ticks, first);
+      // Reparto proporcional sin perder ticks por redondeo.
+      w.busy_ticks += proportional(busy, segment_end - from, span) -
+                      proportional(busy, t - from, span);
+      w.end = segment_end;
+      if (segment_end == to)
+        add_counters(w);
+      if (segment_end == window_end) {
+        closed.push_back(w);
+        s.open = false;
+      }
+      t = segment_end;
+    }
+  }
+  last = sample;
+  last.tick = to;
+}
+
+void MetricsAggregator::finish(std::vector<AggregateWindow> &closed) {
+  for (auto &s : series) {
+    if (s.open)
+      closed.push_back(s.current);
+    s.open = false;
+  }
+}
+
+} // namespace OSSimulator
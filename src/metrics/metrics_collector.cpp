@@ -1,4 +1,9 @@
 #include "metrics/metrics_collector.hpp"
+#include "core/profiler.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <filesystem>
 #include <iostream>
 
 #include <nlohmann/json.hpp>
@@ -6,23 +11,160 @@ using json = nlohmann::json;
 
 namespace OSSimulator {
 
+namespace {
+
+// Serializadores directos para los registros por tick. Las claves se emiten en
+// orden alfabético para producir la misma salida que json::dump().
+
+void append_string(std::string &out, const std::string &value) {
+  out += '"';
+  for (char c : value) {
+    switch (c) {
+    case '"':
+      out += "\\\"";
+      break;
+    case '\\':
+      out += "\\\\";
+      break;
+    case '\b':
+      out += "\\b";
+      break;
+    case '\f':
+      out += "\\f";
+      break;
+    case '\n':
+      out += "\\n";
+      break;
+    case '\r':
+      out += "\\r";
+      break;
+    case '\t':
+      out += "\\t";
+      break;
+    default:
+      if (static_cast<unsigned char>(c) < 0x20) {
+        char escaped[7];
+        std::snprintf(escaped, sizeof(escaped), "\\u%04x",
+                      static_cast<unsigned char>(c));
+        out += escaped;
+      } else {
+        out += c;
+      }
+    }
+  }
+  out += '"';
+}
+
+void append_key(std::string &out, const char *key) {
+  out += '"';
+  out += key;
+  out += "\":";
+}
+
+void append_field(std::string &out, const char *key, const std::string &value) {
+  append_key(out, key);
+  append_string(out, value);
+  out += ',';
+}
+
+template <typename T>
+void append_field(std::string &out, const char *key, T value) {
+  append_key(out, key);
+  out += std::to_string(value);
+  out += ',';
+}
+
+void append_field(std::string &out, const char *key, bool value) {
+  append_key(out, key);
+  out += value ? "true" : "false";
+  out += ',';
+}
+
+void append_field(std::string &out, const char *key,
+                  const std::vector<int> &values) {
+  append_key(out, key);
+  out += '[';
+  for (size_t i = 0; i < values.size(); ++i) {
+    if (i > 0)
+      out += ',';
+    out += std::to_string(values[i]);
+  }
+  out += "],";
+}
+
+void close_object(std::string &out) {
+  if (out.back() == ',')
+    out.back() = '}';
+  else
+    out += '}';
+}
+
+void close_array(std::string &out) {
+  if (out.back() == ',')
+    out.back() = ']';
+  else
+    out += ']';
+}
+
+bool same_entry(const MetricsCollector::PageTableEntry &a,
+                const MetricsCollector::PageTableEntry &b) {
+  return a.page_id == b.page_id && a.frame_id == b.frame_id &&
+         a.valid == b.valid && a.referenced == b.referenced &&
+         a.modified == b.modified;
+}
+
+bool same_entry(const MetricsCollector::FrameStatusEntry &a,
+                const MetricsCollector::FrameStatusEntry &b) {
+  return a.frame_id == b.frame_id && a.occupied == b.occupied &&
+         a.pid == b.pid && a.page_id == b.page_id;
+}
+
+// Combina un delta con el ya registrado en el mismo tick, sustituyendo las
+// entradas con la misma clave.
+template <typename Entry, typename Key>
+void merge_delta(std::vector<Entry> &into, const std::vector<Entry> &changed,
+                 Key key) {
+  for (const auto &entry : changed) {
+    bool replaced = false;
+    for (auto &existing : into) {
+      if (key(existing) == key(entry)) {
+        existing = entry;
+        replaced = true;
+        break;
+      }
+    }
+    if (!replaced)
+      into.push_back(entry);
+  }
+}
+
+} // namespace
+
 MetricsCollector::MetricsCollector()
-    : file_out(nullptr), mode(OutputMode::DISABLED) {}
+    : file_out(nullptr), mode(OutputMode::DISABLED), tick_ring(TICK_WINDOW) {}
 
 MetricsCollector::~MetricsCollector() { disable_output(); }
 
-bool MetricsCollector::enable_file_output(const std::string &path) {
+bool MetricsCollector::enable_file_output(const std::string &path,
+                                          TraceFormat trace_format) {
   std::lock_guard<std::mutex> lock(output_mutex);
 
   try {
-    file_out =
-        std::make_unique<std::ofstream>(path, std::ios::out | std::ios::trunc);
+    std::ios::openmode open_mode = std::ios::out | std::ios::trunc;
+    if (trace_format == TraceFormat::BINARY)
+      open_mode |= std::ios::binary;
+    file_out = std::make_unique<std::ofstream>(path, open_mode);
     if (!file_out->is_open()) {
       file_out.reset();
       mode = OutputMode::DISABLED;
       return false;
     }
     mode = OutputMode::FILE;
+    output_path = path;
+    format = trace_format;
+    reset_snapshot_state();
+    if (format == TraceFormat::BINARY)
+      start_binary_trace();
     return true;
   } catch (...) {
     file_out.reset();
@@ -33,29 +175,158 @@ bool MetricsCollector::enable_file_output(const std::string &path) {
 
 void MetricsCollector::enable_stdout_output() {
   std::lock_guard<std::mutex> lock(output_mutex);
+  flush_buffer();
   if (file_out && file_out->is_open()) {
     file_out->close();
   }
   file_out.reset();
+  output_path.clear();
   mode = OutputMode::STDOUT;
+  format = TraceFormat::JSONL;
+  reset_snapshot_state();
 }
 
 void MetricsCollector::disable_output() {
   flush_all();
+  disable_async();
+  finish_aggregates();
 
   std::lock_guard<std::mutex> lock(output_mutex);
+  flush_buffer();
   if (file_out && file_out->is_open()) {
     file_out->close();
   }
   file_out.reset();
+  output_path.clear();
   mode = OutputMode::DISABLED;
 }
 
+bool MetricsCollector::enable_aggregates(const std::vector<int> &widths,
+                                         const std::string &path) {
+  finish_aggregates();
+  auto series = std::make_unique<MetricsAggregator>(widths);
+  if (series->get_widths().empty())
+    return false;
+
+  std::string target = path;
+  if (target.empty()) {
+    if (output_path.empty())
+      return false;
+    target = std::filesystem::path(output_path)
+                 .replace_extension(".aggregates.jsonl")
+                 .string();
+  }
+  auto out = std::make_unique<std::ofstream>(target,
+                                             std::ios::out | std::ios::trunc);
+  if (!out->is_open())
+    return false;
+  aggregator = std::move(series);
+  aggregate_out = std::move(out);
+  return true;
+}
+
+void MetricsCollector::log_aggregate_sample(const AggregateSample &sample) {
+  if (!aggregator)
+    return;
+  aggregator->add(sample, closed_windows);
+  if (!closed_windows.empty())
+    write_windows();
+}
+
+void MetricsCollector::finish_aggregates() {
+  if (!aggregator)
+    return;
+  aggregator->finish(closed_windows);
+  write_windows();
+  aggregate_out->close();
+  aggregate_out.reset();
+  aggregator.reset();
+}
+
+void MetricsCollector::write_windows() {
+  for (const auto &window : closed_windows)
+    *aggregate_out << window.to_json() << '\n';
+  closed_windows.clear();
+}
+
+void MetricsCollector::set_buffer_size(size_t bytes) {
+  std::lock_guard<std::mutex> lock(output_mutex);
+  buffer_size = bytes;
+  if (buffer_size == 0) {
+    flush_buffer();
+  } else {
+    write_buffer.reserve(buffer_size + 1024);
+  }
+}
+
+void MetricsCollector::set_keyframe_interval(int ticks) {
+  std::lock_guard<std::mutex> lock(output_mutex);
+  keyframe_interval = std::max(0, ticks);
+  reset_snapshot_state();
+}
+
+void MetricsCollector::reset_snapshot_state() {
+  // El estado de los marcos se conserva: refleja la memoria, no la salida.
+  last_frame_keyframe = -1;
+  page_table_state.clear();
+}
+
+bool MetricsCollector::parse_categories(const std::string &list,
+                                        uint32_t &mask) {
+  static const std::pair<const char *, uint32_t> names[] = {
+      {"cpu", CATEGORY_CPU},
+      {"io", CATEGORY_IO},
+      {"memory", CATEGORY_MEMORY},
+      {"transitions", CATEGORY_STATE_TRANSITIONS},
+      {"queues", CATEGORY_QUEUES},
+      {"page_table", CATEGORY_PAGE_TABLE},
+      {"frame_status", CATEGORY_FRAME_STATUS},
+      {"all", CATEGORY_ALL},
+      {"none", 0},
+  };
+
+  uint32_t result = 0;
+  size_t start = 0;
+  while (start <= list.size()) {
+    size_t end = list.find(',', start);
+    if (end == std::string::npos)
+      end = list.size();
+
+    std::string name = list.substr(start, end - start);
+    name.erase(0, name.find_first_not_of(" \t"));
+    name.erase(name.find_last_not_of(" \t") + 1);
+
+    bool known = false;
+    for (const auto &[key, bits] : names) {
+      if (name == key) {
+        result |= bits;
+        known = true;
+        break;
+      }
+    }
+    if (!known)
+      return false;
+    start = end + 1;
+  }
+
+  mask = result;
+  return true;
+}
+
 void MetricsCollector::write_line(const std::string &json_line) {
   if (mode == OutputMode::DISABLED) {
     return;
   }
 
+  if (buffer_size > 0) {
+    write_buffer += json_line;
+    write_buffer += '\n';
+    if (write_buffer.size() >= buffer_size) {
+      flush_buffer();
+    }
+    return;
+  }
+
   if (mode == OutputMode::FILE && file_out) {
     (*file_out) << json_line << '\n';
     file_out->flush();
@@ -65,134 +336,464 @@ void MetricsCollector::write_line(const std::string &json_line) {
   }
 }
 
-void MetricsCollector::flush_tick(int tick) {
-  TickData data;
-  bool has_data = false;
+void MetricsCollector::write_raw(const std::string &bytes) {
+  if (mode == OutputMode::DISABLED) {
+    return;
+  }
 
-  {
-    std::lock_guard<std::mutex> lock(output_mutex);
+  write_buffer += bytes;
+  if (buffer_size == 0 || write_buffer.size() >= buffer_size) {
+    flush_buffer();
+  }
+}
 
-    auto it = tick_buffer.find(tick);
-    if (it == tick_buffer.end())
-      return;
+void MetricsCollector::flush_buffer() {
+  if (write_buffer.empty())
+    return;
+  OSSIM_PROFILE_SCOPE("metrics.write");
+  OSSIM_PROFILE_COUNT("metrics.bytes", write_buffer.size());
 
-    data = it->second;
-    has_data = true;
+  if (mode == OutputMode::FILE && file_out) {
+    file_out->write(write_buffer.data(),
+                    static_cast<std::streamsize>(write_buffer.size()));
+    file_out->flush();
+  } else if (mode == OutputMode::STDOUT) {
+    std::cout.write(write_buffer.data(),
+                    static_cast<std::streamsize>(write_buffer.size()));
+    std::cout.flush();
+  }
+  write_buffer.clear();
+}
 
-    if (!data.has_cpu && !data.has_io && !data.has_memory &&
-        data.state_transitions.empty() && !data.has_queue_snapshot &&
-        !data.has_page_table && !data.has_frame_status) {
-      tick_buffer.erase(it);
-      return;
+MetricsCollector::TickData &MetricsCollector::tick_slot(Tick tick) {
+  if (pending_ticks == 0) {
+    oldest_tick = newest_tick = tick;
+  } else if (tick > newest_tick) {
+    // Se vacían los ticks que el nuevo desplazaría del anillo.
+    flush_ticks_before(tick - TICK_WINDOW + 1);
+    if (pending_ticks == 0)
+      oldest_tick = tick;
+    newest_tick = tick;
+  } else if (tick < oldest_tick) {
+    if (newest_tick - tick >= TICK_WINDOW) {
+      // Un registro tan atrasado no cabe: se vacía todo y se empieza de nuevo.
+      flush_ticks_before(newest_tick + 1);
+      newest_tick = tick;
     }
+    oldest_tick = tick;
+  }
 
-    tick_buffer.erase(it);
-    last_flushed_tick = tick;
+  TickData &slot = tick_ring[static_cast<size_t>(tick) % TICK_WINDOW];
+  if (slot.tick != tick) {
+    slot.tick = tick;
+    ++pending_ticks;
   }
+  return slot;
+}
 
-  if (!has_data)
-    return;
+void MetricsCollector::flush_ticks_before(Tick limit) {
+  Tick tick = oldest_tick;
+  for (; pending_ticks > 0 && tick < limit; ++tick) {
+    TickData &slot = tick_ring[static_cast<size_t>(tick) % TICK_WINDOW];
+    if (slot.tick == tick)
+      flush_slot(slot);
+  }
+  oldest_tick = tick;
+}
 
-  json j;
-  j["tick"] = tick;
+void MetricsCollector::flush_slot(TickData &slot) {
+  if (slot.has_cpu || !slot.cores.empty() || slot.has_io || slot.has_memory ||
+      !slot.state_transitions.empty() || slot.has_queue_snapshot ||
+      slot.has_page_table || slot.has_frame_status) {
+    OSSIM_PROFILE_SCOPE("metrics.serialize");
+    tick_record.clear();
+    if (format == TraceFormat::BINARY) {
+      encode_tick(tick_record, slot.tick, slot);
+      write_raw(tick_record);
+    } else {
+      serialize_tick(tick_record, slot.tick, slot);
+      write_line(tick_record);
+    }
+    last_flushed_tick = slot.tick;
+  }
+
+  // Las cadenas y vectores conservan su capacidad para el siguiente uso.
+  slot.has_cpu = false;
+  slot.cores.clear();
+  slot.has_io = false;
+  slot.io_devices.clear();
+  slot.has_memory = false;
+  slot.has_queue_snapshot = false;
+  slot.has_page_table = false;
+  slot.has_frame_status = false;
+  slot.state_transitions.clear();
+  slot.tick = -1;
+  --pending_ticks;
+}
+
+void MetricsCollector::serialize_tick(std::string &out, Tick tick,
+                                      const TickData &data) {
+  const NameTable &names = name_table();
+  out.clear();
+  out.reserve(256 + data.frame_status.frames.size() * 48 +
+              data.page_table.pages.size() * 80);
+  out += '{';
+
+  if (!data.cores.empty()) {
+    append_key(out, "cores");
+    out += '[';
+    for (const auto &core : data.cores) {
+      out += '{';
+      append_field(out, "context_switch", core.context_switch);
+      append_field(out, "core", core.core);
+      append_field(out, "event", core.event);
+      append_field(out, "name", names.name(core.name));
+      append_field(out, "pid", core.pid);
+      append_field(out, "ready_queue", core.ready_queue_size);
+      append_field(out, "remaining", core.remaining);
+      close_object(out);
+      out += ',';
+    }
+    close_array(out);
+    out += ',';
+  }
 
   if (data.has_cpu) {
-    j["cpu"] = {{"event", data.cpu.event},
-                {"pid", data.cpu.pid},
-                {"name", data.cpu.name},
-                {"remaining", data.cpu.remaining},
-                {"ready_queue", data.cpu.ready_queue_size},
-                {"context_switch", data.cpu.context_switch}};
+    append_key(out, "cpu");
+    out += '{';
+    append_field(out, "context_switch", data.cpu.context_switch);
+    append_field(out, "event", data.cpu.event);
+    append_field(out, "name", names.name(data.cpu.name));
+    append_field(out, "pid", data.cpu.pid);
+    append_field(out, "ready_queue", data.cpu.ready_queue_size);
+    append_field(out, "remaining", data.cpu.remaining);
+    close_object(out);
+    out += ',';
+  }
+
+  if (data.has_frame_status) {
+    append_key(out, data.frame_status.keyframe ? "frame_status"
+                                               : "frame_status_delta");
+    out += '[';
+    for (const auto &entry : data.frame_status.frames) {
+      out += '{';
+      append_field(out, "frame", entry.frame_id);
+      append_field(out, "occupied", entry.occupied);
+      append_field(out, "page", entry.page_id);
+      append_field(out, "pid", entry.pid);
+      close_object(out);
+      out += ',';
+    }
+    close_array(out);
+    out += ',';
   }
 
   if (data.has_io) {
-    j["io"] = {{"device", data.io.device},
-               {"event", data.io.event},
-               {"pid", data.io.pid},
-               {"name", data.io.name},
-               {"remaining", data.io.remaining},
-               {"queue", data.io.queue_size}};
+    append_key(out, "io");
+    out += '{';
+    append_field(out, "device", names.name(data.io.device));
+    append_field(out, "event", data.io.event);
+    append_field(out, "name", names.name(data.io.name));
+    append_field(out, "pid", data.io.pid);
+    append_field(out, "queue", data.io.queue_size);
+    append_field(out, "remaining", data.io.remaining);
+    close_object(out);
+    out += ',';
+  }
+
+  if (!data.io_devices.empty()) {
+    append_key(out, "io_devices");
+    out += '[';
+    for (const auto &io : data.io_devices) {
+      out += '{';
+      append_field(out, "device", names.name(io.device));
+      append_field(out, "event", io.event);
+      append_field(out, "name", names.name(io.name));
+      append_field(out, "pid", io.pid);
+      append_field(out, "queue", io.queue_size);
+      append_field(out, "remaining", io.remaining);
+      close_object(out);
+      out += ',';
+    }
+    close_array(out);
+    out += ',';
   }
 
   if (data.has_memory) {
-    j["memory"] = {{"event", data.memory.event},
-                   {"pid", data.memory.pid},
-                   {"name", data.memory.name},
-                   {"page_id", data.memory.page_id},
-                   {"frame_id", data.memory.frame_id},
-                   {"total_page_faults", data.memory.total_page_faults},
-                   {"total_replacements", data.memory.total_replacements}};
+    append_key(out, "memory");
+    out += '{';
+    append_field(out, "event", data.memory.event);
+    append_field(out, "frame_id", data.memory.frame_id);
+    append_field(out, "name", names.name(data.memory.name));
+    append_field(out, "page_id", data.memory.page_id);
+    append_field(out, "pid", data.memory.pid);
+    append_field(out, "total_page_faults", data.memory.total_page_faults);
+    append_field(out, "total_replacements", data.memory.total_replacements);
+    close_object(out);
+    out += ',';
   }
 
-  if (!data.state_transitions.empty()) {
-    json transitions = json::array();
-    for (const auto &st : data.state_transitions) {
-      transitions.push_back({{"pid", st.pid},
-                             {"name", st.name},
-                             {"from", st.from_state},
-                             {"to", st.to_state},
-                             {"reason", st.reason}});
+  if (data.has_page_table) {
+    append_key(out, data.page_table.keyframe ? "page_table"
+                                             : "page_table_delta");
+    out += '{';
+    append_field(out, "name", names.name(data.page_table.name));
+    append_key(out, "pages");
+    out += '[';
+    for (const auto &entry : data.page_table.pages) {
+      out += '{';
+      append_field(out, "frame", entry.frame_id);
+      append_field(out, "modified", entry.modified);
+      append_field(out, "page", entry.page_id);
+      append_field(out, "referenced", entry.referenced);
+      append_field(out, "valid", entry.valid);
+      close_object(out);
+      out += ',';
     }
-    j["state_transitions"] = transitions;
+    close_array(out);
+    out += ',';
+    append_field(out, "pid", data.page_table.pid);
+    close_object(out);
+    out += ',';
   }
 
   if (data.has_queue_snapshot) {
-    j["queues"] = {{"ready", data.queue_snapshot.ready_queue},
-                   {"blocked_memory", data.queue_snapshot.blocked_memory_queue},
-                   {"blocked_io", data.queue_snapshot.blocked_io_queue},
-                   {"running", data.queue_snapshot.running_pid}};
+    append_key(out, "queues");
+    out += '{';
+    append_field(out, "blocked_io", data.queue_snapshot.blocked_io_queue);
+    append_field(out, "blocked_memory",
+                 data.queue_snapshot.blocked_memory_queue);
+    append_field(out, "ready", data.queue_snapshot.ready_queue);
+    append_field(out, "running", data.queue_snapshot.running_pid);
+    close_object(out);
+    out += ',';
   }
 
-  if (data.has_page_table) {
-    json pages = json::array();
-    for (const auto &entry : data.page_table.pages) {
-      pages.push_back({{"page", entry.page_id},
-                       {"frame", entry.frame_id},
-                       {"valid", entry.valid},
-                       {"referenced", entry.referenced},
-                       {"modified", entry.modified}});
+  if (!data.state_transitions.empty()) {
+    append_key(out, "state_transitions");
+    out += '[';
+    for (const auto &st : data.state_transitions) {
+      out += '{';
+      append_field(out, "from", st.from_state);
+      append_field(out, "name", names.name(st.name));
+      append_field(out, "pid", st.pid);
+      append_field(out, "reason", st.reason);
+      append_field(out, "to", st.to_state);
+      close_object(out);
+      out += ',';
     }
-    j["page_table"] = {{"pid", data.page_table.pid},
-                       {"name", data.page_table.name},
-                       {"pages", pages}};
+    close_array(out);
+    out += ',';
   }
 
-  if (data.has_frame_status) {
-    json frames = json::array();
-    for (const auto &entry : data.frame_status.frames) {
-      frames.push_back({{"frame", entry.frame_id},
-                        {"occupied", entry.occupied},
-                        {"pid", entry.pid},
-                        {"page", entry.page_id}});
+  append_field(out, "tick", tick);
+  close_object(out);
+}
+
+template <typename Fill>
+bool MetricsCollector::push_event(Fill &&fill, bool force_block) {
+  OSSIM_PROFILE_SCOPE("metrics.enqueue");
+  bool pushed = event_ring->try_push(fill);
+  while (!pushed) {
+    if (backpressure == BackpressurePolicy::DROP && !force_block) {
+      dropped_events.fetch_add(1, std::memory_order_relaxed);
+      return false;
     }
-    j["frame_status"] = frames;
+    {
+      std::lock_guard<std::mutex> lock(wake_mutex);
+      wake_cv.notify_one();
+    }
+    std::this_thread::yield();
+    pushed = event_ring->try_push(fill);
   }
 
-  write_line(j.dump());
+  if (writer_idle.load(std::memory_order_acquire)) {
+    std::lock_guard<std::mutex> lock(wake_mutex);
+    wake_cv.notify_one();
+  }
+  return true;
 }
 
 void MetricsCollector::flush_all() {
-  while (true) {
-    int next_tick;
-    {
-      std::lock_guard<std::mutex> lock(output_mutex);
+  if (aggregate_out)
+    aggregate_out->flush();
+  if (!async_active.load(std::memory_order_acquire)) {
+    flush_pending();
+    return;
+  }
 
-      if (tick_buffer.empty())
-        break;
+  uint64_t ticket;
+  {
+    std::lock_guard<std::mutex> lock(flush_mutex);
+    ticket = ++flush_requested;
+  }
+  push_event(
+      [](MetricsEvent &ev) { ev.kind = MetricsEvent::Kind::FLUSH; }, true);
+
+  std::unique_lock<std::mutex> lock(flush_mutex);
+  flush_cv.wait(lock, [&]() { return flush_completed >= ticket; });
+}
+
+void MetricsCollector::flush_pending() {
+  std::lock_guard<std::mutex> lock(output_mutex);
+  flush_ticks_before(newest_tick + 1);
+  flush_buffer();
+}
+
+bool MetricsCollector::enable_async(size_t capacity,
+                                    BackpressurePolicy policy) {
+  if (async_active.load())
+    return true;
 
-      next_tick = tick_buffer.begin()->first;
+  try {
+    event_ring = std::make_unique<MpscRing<MetricsEvent>>(capacity);
+  } catch (const std::bad_alloc &) {
+    return false;
+  }
+  backpressure = policy;
+  writer_stop = false;
+  writer_thread = std::thread(&MetricsCollector::writer_loop, this);
+  async_active.store(true, std::memory_order_release);
+  return true;
+}
+
+void MetricsCollector::disable_async() {
+  if (!async_active.exchange(false))
+    return;
+
+  writer_stop = true;
+  {
+    std::lock_guard<std::mutex> lock(wake_mutex);
+    wake_cv.notify_one();
+  }
+  if (writer_thread.joinable())
+    writer_thread.join();
+  event_ring.reset();
+}
+
+void MetricsCollector::writer_loop() {
+  auto drain = [this](MetricsEvent &ev) { apply_event(ev); };
+
+  while (true) {
+    if (event_ring->try_pop(drain))
+      continue;
+    if (writer_stop.load(std::memory_order_acquire)) {
+      while (event_ring->try_pop(drain)) {
+      }
+      break;
     }
-    flush_tick(next_tick);
+
+    std::unique_lock<std::mutex> lock(wake_mutex);
+    writer_idle.store(true, std::memory_order_release);
+    if (event_ring->empty() && !writer_stop.load(std::memory_order_acquire))
+      wake_cv.wait_for(lock, std::chrono::milliseconds(1));
+    writer_idle.store(false, std::memory_order_release);
   }
 }
 
-void MetricsCollector::log_cpu(int tick, const std::string &event, int pid,
-                               const std::string &name, int remaining,
+void MetricsCollector::apply_event(const MetricsEvent &ev) {
+  using Kind = MetricsEvent::Kind;
+
+  if (ev.kind == Kind::FLUSH) {
+    flush_pending();
+    std::lock_guard<std::mutex> lock(flush_mutex);
+    ++flush_completed;
+    flush_cv.notify_all();
+    return;
+  }
+
+  std::lock_guard<std::mutex> lock(output_mutex);
+  switch (ev.kind) {
+  case Kind::CPU:
+    record_cpu(ev.tick, ev.event, ev.pid, ev.name, ev.values[0], ev.count,
+               ev.flag);
+    break;
+  case Kind::CORE:
+    record_core(ev.tick, ev.values[1], ev.event, ev.pid, ev.name, ev.values[0],
+                ev.count, ev.flag);
+    break;
+  case Kind::IO:
+    record_io(ev.tick, ev.device, ev.event, ev.pid, ev.name, ev.values[0],
+              ev.count);
+    break;
+  case Kind::MEMORY:
+    record_memory(ev.tick, ev.event, ev.pid, ev.name, ev.values[0],
+                  ev.values[1], ev.values[2], ev.values[3]);
+    break;
+  case Kind::STATE_TRANSITION:
+    record_state_transition(ev.tick, ev.pid, ev.name, ev.from_state,
+                            ev.to_state, ev.text);
+    break;
+  case Kind::QUEUE_SNAPSHOT:
+    record_queue_snapshot(ev.tick, ev.ready_queue, ev.blocked_memory_queue,
+                          ev.blocked_io_queue, ev.pid);
+    break;
+  case Kind::PAGE_TABLE:
+    record_page_table(ev.tick, ev.pid, ev.name, ev.pages);
+    break;
+  case Kind::FRAME_STATUS:
+    record_frame_status(ev.tick, ev.frames);
+    break;
+  case Kind::FRAME_CHANGES:
+    record_frame_changes(ev.tick, ev.frames, ev.values[0]);
+    break;
+  case Kind::CPU_SUMMARY:
+    write_cpu_summary(ev.values[0], ev.reals[0], ev.reals[1], ev.reals[2],
+                      ev.reals[3], ev.values[1], ev.text, ev.latencies);
+    break;
+  case Kind::CORE_SUMMARY:
+    write_core_summary(ev.pid, ev.values[0], ev.values[1], ev.values[2],
+                       ev.values[3], static_cast<int>(ev.count));
+    break;
+  case Kind::MEMORY_SUMMARY:
+    write_memory_summary(ev.values[0], ev.values[1], ev.values[2],
+                         ev.values[3], ev.text, ev.values[4], ev.values[5],
+                         ev.values[6], ev.values[7], ev.values[8],
+                         ev.values[9]);
+    break;
+  case Kind::NUMA_SUMMARY:
+    write_numa_summary(ev.pid, static_cast<int>(ev.values[0]), ev.values[1],
+                       ev.values[2], ev.values[3], ev.values[4],
+                       ev.values[5]);
+    break;
+  case Kind::FLUSH:
+    break;
+  }
+}
+
+void MetricsCollector::log_cpu(Tick tick, const std::string &event, int pid,
+                               NameId name, Tick remaining,
                                size_t ready_queue_size,
                                bool context_switch_occurred) {
+  if (!should_log(CATEGORY_CPU, tick))
+    return;
+
+  if (async_active.load(std::memory_order_acquire)) {
+    push_event(
+        [&](MetricsEvent &ev) {
+          ev.kind = MetricsEvent::Kind::CPU;
+          ev.tick = tick;
+          ev.event = event;
+          ev.pid = pid;
+          ev.name = name;
+          ev.values[0] = remaining;
+          ev.count = ready_queue_size;
+          ev.flag = context_switch_occurred;
+        },
+        false);
+    return;
+  }
+
   std::lock_guard<std::mutex> lock(output_mutex);
+  record_cpu(tick, event, pid, name, remaining, ready_queue_size,
+             context_switch_occurred);
+}
 
-  auto &t = tick_buffer[tick];
+void MetricsCollector::record_cpu(Tick tick, const std::string &event, int pid,
+                                  NameId name, Tick remaining,
+                                  size_t ready_queue_size,
+                                  bool context_switch_occurred) {
+  auto &t = tick_slot(tick);
   t.cpu.event = event;
   t.cpu.pid = pid;
   t.cpu.name = name;
@@ -202,29 +803,141 @@ void MetricsCollector::log_cpu(int tick, const std::string &event, int pid,
   t.has_cpu = true;
 }
 
-void MetricsCollector::log_io(int tick, const std::string &device_name,
+void MetricsCollector::log_core(Tick tick, int core, const std::string &event,
+                                int pid, NameId name,
+                                Tick remaining, size_t ready_queue_size,
+                                bool context_switch_occurred) {
+  if (!should_log(CATEGORY_CPU, tick))
+    return;
+
+  if (async_active.load(std::memory_order_acquire)) {
+    push_event(
+        [&](MetricsEvent &ev) {
+          ev.kind = MetricsEvent::Kind::CORE;
+          ev.tick = tick;
+          ev.event = event;
+          ev.pid = pid;
+          ev.name = name;
+          ev.values[0] = remaining;
+          ev.values[1] = core;
+          ev.count = ready_queue_size;
+          ev.flag = context_switch_occurred;
+        },
+        false);
+    return;
+  }
+
+  std::lock_guard<std::mutex> lock(output_mutex);
+  record_core(tick, core, event, pid, name, remaining, ready_queue_size,
+              context_switch_occurred);
+}
+
+void MetricsCollector::record_core(Tick tick, int core,
+                                   const std::string &event, int pid,
+                                   NameId name, Tick remaining,
+                                   size_t ready_queue_size,
+                                   bool context_switch_occurred) {
+  auto &t = tick_slot(tick);
+  t.cores.emplace_back();
+  auto &entry = t.cores.back();
+  entry.core = core;
+  entry.event = event;
+  entry.pid = pid;
+  entry.name = name;
+  entry.remaining = remaining;
+  entry.ready_queue_size = ready_queue_size;
+  entry.context_switch = context_switch_occurred;
+}
+
+void MetricsCollector::log_io(Tick tick, NameId device_name,
                               const std::string &event, int pid,
-                              const std::string &name, int remaining,
+                              NameId name, Tick remaining,
                               size_t queue_size) {
+  if (!should_log(CATEGORY_IO, tick))
+    return;
+
+  if (async_active.load(std::memory_order_acquire)) {
+    push_event(
+        [&](MetricsEvent &ev) {
+          ev.kind = MetricsEvent::Kind::IO;
+          ev.tick = tick;
+          ev.device = device_name;
+          ev.event = event;
+          ev.pid = pid;
+          ev.name = name;
+          ev.values[0] = remaining;
+          ev.count = queue_size;
+        },
+        false);
+    return;
+  }
+
   std::lock_guard<std::mutex> lock(output_mutex);
+  record_io(tick, device_name, event, pid, name, remaining, queue_size);
+}
 
-  auto &t = tick_buffer[tick];
-  t.io.device = device_name;
-  t.io.event = event;
-  t.io.pid = pid;
-  t.io.name = name;
-  t.io.remaining = remaining;
-  t.io.queue_size = queue_size;
+void MetricsCollector::record_io(Tick tick, NameId device_name,
+                                 const std::string &event, int pid,
+                                 NameId name, Tick remaining,
+                                 size_t queue_size) {
+  auto &t = tick_slot(tick);
+  // El primer dispositivo del tick ocupa "io"; los demás van en "io_devices".
+  IoTickData *entry = &t.io;
+  if (t.has_io && t.io.device != device_name) {
+    auto it = std::find_if(
+        t.io_devices.begin(), t.io_devices.end(),
+        [&](const IoTickData &io) { return io.device == device_name; });
+    if (it == t.io_devices.end()) {
+      t.io_devices.emplace_back();
+      entry = &t.io_devices.back();
+    } else {
+      entry = &*it;
+    }
+  }
+  entry->device = device_name;
+  entry->event = event;
+  entry->pid = pid;
+  entry->name = name;
+  entry->remaining = remaining;
+  entry->queue_size = queue_size;
   t.has_io = true;
 }
 
-void MetricsCollector::log_memory(int tick, const std::string &event, int pid,
-                                  const std::string &name, int page_id,
-                                  int frame_id, int total_page_faults,
-                                  int total_replacements) {
+void MetricsCollector::log_memory(Tick tick, const std::string &event, int pid,
+                                  NameId name, int page_id,
+                                  int frame_id, int64_t total_page_faults,
+                                  int64_t total_replacements) {
+  if (!should_log(CATEGORY_MEMORY, tick))
+    return;
+
+  if (async_active.load(std::memory_order_acquire)) {
+    push_event(
+        [&](MetricsEvent &ev) {
+          ev.kind = MetricsEvent::Kind::MEMORY;
+          ev.tick = tick;
+          ev.event = event;
+          ev.pid = pid;
+          ev.name = name;
+          ev.values[0] = page_id;
+          ev.values[1] = frame_id;
+          ev.values[2] = total_page_faults;
+          ev.values[3] = total_replacements;
+        },
+        false);
+    return;
+  }
+
   std::lock_guard<std::mutex> lock(output_mutex);
+  record_memory(tick, event, pid, name, page_id, frame_id, total_page_faults,
+                total_replacements);
+}
 
-  auto &t = tick_buffer[tick];
+void MetricsCollector::record_memory(Tick tick, const std::string &event,
+                                     int pid, NameId name,
+                                     int page_id, int frame_id,
+                                     int64_t total_page_faults,
+                                     int64_t total_replacements) {
+  auto &t = tick_slot(tick);
   t.memory.event = event;
   t.memory.pid = pid;
   t.memory.name = name;
@@ -254,14 +967,39 @@ std::string MetricsCollector::process_state_to_string(ProcessState state) {
   }
 }
 
-void MetricsCollector::log_state_transition(int tick, int pid,
-                                            const std::string &name,
+void MetricsCollector::log_state_transition(Tick tick, int pid,
+                                            NameId name,
                                             ProcessState from_state,
                                             ProcessState to_state,
                                             const std::string &reason) {
+  if (!should_log(CATEGORY_STATE_TRANSITIONS, tick))
+    return;
+
+  if (async_active.load(std::memory_order_acquire)) {
+    push_event(
+        [&](MetricsEvent &ev) {
+          ev.kind = MetricsEvent::Kind::STATE_TRANSITION;
+          ev.tick = tick;
+          ev.pid = pid;
+          ev.name = name;
+          ev.from_state = from_state;
+          ev.to_state = to_state;
+          ev.text = reason;
+        },
+        false);
+    return;
+  }
+
   std::lock_guard<std::mutex> lock(output_mutex);
+  record_state_transition(tick, pid, name, from_state, to_state, reason);
+}
 
-  auto &t = tick_buffer[tick];
+void MetricsCollector::record_state_transition(Tick tick, int pid,
+                                               NameId name,
+                                               ProcessState from_state,
+                                               ProcessState to_state,
+                                               const std::string &reason) {
+  auto &t = tick_slot(tick);
   StateTransitionData st;
   st.pid = pid;
   st.name = name;
@@ -272,12 +1010,36 @@ void MetricsCollector::log_state_transition(int tick, int pid,
 }
 
 void MetricsCollector::log_queue_snapshot(
-    int tick, const std::vector<int> &ready_queue,
+    Tick tick, const std::vector<int> &ready_queue,
     const std::vector<int> &blocked_memory_queue,
     const std::vector<int> &blocked_io_queue, int running_pid) {
+  if (!should_log(CATEGORY_QUEUES, tick))
+    return;
+
+  if (async_active.load(std::memory_order_acquire)) {
+    push_event(
+        [&](MetricsEvent &ev) {
+          ev.kind = MetricsEvent::Kind::QUEUE_SNAPSHOT;
+          ev.tick = tick;
+          ev.ready_queue = ready_queue;
+          ev.blocked_memory_queue = blocked_memory_queue;
+          ev.blocked_io_queue = blocked_io_queue;
+          ev.pid = running_pid;
+        },
+        false);
+    return;
+  }
+
   std::lock_guard<std::mutex> lock(output_mutex);
+  record_queue_snapshot(tick, ready_queue, blocked_memory_queue,
+                        blocked_io_queue, running_pid);
+}
 
-  auto &t = tick_buffer[tick];
+void MetricsCollector::record_queue_snapshot(
+    Tick tick, const std::vector<int> &ready_queue,
+    const std::vector<int> &blocked_memory_queue,
+    const std::vector<int> &blocked_io_queue, int running_pid) {
+  auto &t = tick_slot(tick);
   t.queue_snapshot.ready_queue = ready_queue;
   t.queue_snapshot.blocked_memory_queue = blocked_memory_queue;
   t.queue_snapshot.blocked_io_queue = blocked_io_queue;
@@ -286,38 +1048,245 @@ void MetricsCollector::log_queue_snapshot(
 }
 
 void MetricsCollector::log_page_table(
-    int tick, int pid, const std::string &name,
+    Tick tick, int pid, NameId name,
     const std::vector<PageTableEntry> &page_table) {
+  if (!should_log(CATEGORY_PAGE_TABLE, tick))
+    return;
+
+  if (async_active.load(std::memory_order_acquire)) {
+    push_event(
+        [&](MetricsEvent &ev) {
+          ev.kind = MetricsEvent::Kind::PAGE_TABLE;
+          ev.tick = tick;
+          ev.pid = pid;
+          ev.name = name;
+          ev.pages = page_table;
+        },
+        false);
+    return;
+  }
+
   std::lock_guard<std::mutex> lock(output_mutex);
+  record_page_table(tick, pid, name, page_table);
+}
+
+void MetricsCollector::record_page_table(
+    Tick tick, int pid, NameId name,
+    const std::vector<PageTableEntry> &page_table) {
+  auto &t = tick_slot(tick);
+  auto &state = page_table_state[pid];
+
+  bool keyframe = keyframe_interval <= 0 || state.keyframe_tick < 0 ||
+                  tick - state.keyframe_tick >= keyframe_interval ||
+                  state.pages.size() != page_table.size();
+
+  if (t.has_page_table && t.page_table.pid != pid) {
+    // El tick solo guarda una tabla: la del otro proceso se pierde, así que
+    // su siguiente registro debe ser completo.
+    page_table_state[t.page_table.pid].keyframe_tick = -1;
+    t.has_page_table = false;
+  } else if (t.has_page_table && t.page_table.keyframe) {
+    keyframe = true;
+  }
+
+  if (keyframe) {
+    state.pages = page_table;
+    if (state.keyframe_tick < tick)
+      state.keyframe_tick = tick;
+    t.page_table.pages = page_table;
+  } else {
+    auto &changed = changed_pages;
+    changed.clear();
+    for (size_t i = 0; i < page_table.size(); ++i) {
+      if (!same_entry(state.pages[i], page_table[i])) {
+        state.pages[i] = page_table[i];
+        changed.push_back(page_table[i]);
+      }
+    }
+
+    if (t.has_page_table) {
+      merge_delta(t.page_table.pages, changed,
+                  [](const PageTableEntry &e) { return e.page_id; });
+    } else if (changed.empty()) {
+      return;
+    } else {
+      t.page_table.pages = changed;
+    }
+  }
 
-  auto &t = tick_buffer[tick];
   t.page_table.pid = pid;
   t.page_table.name = name;
-  t.page_table.pages = page_table;
+  t.page_table.keyframe = keyframe;
   t.has_page_table = true;
 }
 
 void MetricsCollector::log_frame_status(
-    int tick, const std::vector<FrameStatusEntry> &frame_status) {
+    Tick tick, const std::vector<FrameStatusEntry> &frame_status) {
+  if (!should_log(CATEGORY_FRAME_STATUS, tick))
+    return;
+
+  if (async_active.load(std::memory_order_acquire)) {
+    push_event(
+        [&](MetricsEvent &ev) {
+          ev.kind = MetricsEvent::Kind::FRAME_STATUS;
+          ev.tick = tick;
+          ev.frames = frame_status;
+        },
+        false);
+    return;
+  }
+
+  std::lock_guard<std::mutex> lock(output_mutex);
+  record_frame_status(tick, frame_status);
+}
+
+void MetricsCollector::record_frame_status(
+    Tick tick, const std::vector<FrameStatusEntry> &frame_status) {
+  if (frame_state.size() != frame_status.size())
+    last_frame_keyframe = -1;
+
+  std::vector<FrameStatusEntry> changed;
+  if (last_frame_keyframe >= 0) {
+    for (size_t i = 0; i < frame_status.size(); ++i) {
+      if (!same_entry(frame_state[i], frame_status[i]))
+        changed.push_back(frame_status[i]);
+    }
+  }
+  frame_state = frame_status;
+  emit_frame_status(tick, changed);
+}
+
+void MetricsCollector::log_frame_changes(
+    Tick tick, const std::vector<FrameStatusEntry> &changed, int total_frames) {
+  if (!should_log(CATEGORY_FRAME_STATUS, tick))
+    return;
+
+  if (async_active.load(std::memory_order_acquire)) {
+    push_event(
+        [&](MetricsEvent &ev) {
+          ev.kind = MetricsEvent::Kind::FRAME_CHANGES;
+          ev.tick = tick;
+          ev.frames = changed;
+          ev.values[0] = total_frames;
+        },
+        false);
+    return;
+  }
+
   std::lock_guard<std::mutex> lock(output_mutex);
+  record_frame_changes(tick, changed, total_frames);
+}
+
+void MetricsCollector::record_frame_changes(
+    Tick tick, const std::vector<FrameStatusEntry> &changed, int total_frames) {
+  if (static_cast<int>(frame_state.size()) != total_frames) {
+    size_t old_size = frame_state.size();
+    frame_state.resize(std::max(0, total_frames));
+    for (size_t i = old_size; i < frame_state.size(); ++i)
+      frame_state[i].frame_id = static_cast<int>(i);
+    last_frame_keyframe = -1;
+  }
+
+  auto &delta = changed_frames;
+  delta.clear();
+  for (const auto &entry : changed) {
+    if (entry.frame_id < 0 || entry.frame_id >= total_frames)
+      continue;
+    auto &current = frame_state[entry.frame_id];
+    if (!same_entry(current, entry)) {
+      current = entry;
+      delta.push_back(entry);
+    }
+  }
+  emit_frame_status(tick, delta);
+}
+
+void MetricsCollector::emit_frame_status(
+    Tick tick, const std::vector<FrameStatusEntry> &changed) {
+  auto &t = tick_slot(tick);
+
+  bool keyframe = keyframe_interval <= 0 || last_frame_keyframe < 0 ||
+                  tick - last_frame_keyframe >= keyframe_interval ||
+                  (t.has_frame_status && t.frame_status.keyframe);
+
+  if (keyframe) {
+    t.frame_status.frames = frame_state;
+    if (last_frame_keyframe < tick)
+      last_frame_keyframe = tick;
+  } else if (t.has_frame_status) {
+    merge_delta(t.frame_status.frames, changed,
+                [](const FrameStatusEntry &e) { return e.frame_id; });
+  } else if (changed.empty()) {
+    return;
+  } else {
+    t.frame_status.frames = changed;
+  }
 
-  auto &t = tick_buffer[tick];
-  t.frame_status.frames = frame_status;
+  t.frame_status.keyframe = keyframe;
   t.has_frame_status = true;
 }
 
-void MetricsCollector::log_cpu_summary(int total_time, double cpu_utilization,
+void MetricsCollector::log_cpu_summary(Tick total_time, double cpu_utilization,
                                        double avg_waiting_time,
                                        double avg_turnaround_time,
                                        double avg_response_time,
-                                       int context_switches,
-                                       const std::string &algorithm) {
+                                       int64_t context_switches,
+                                       const std::string &algorithm,
+                                       const std::vector<LatencySummary> &latencies) {
+  if (async_active.load(std::memory_order_acquire)) {
+    push_event(
+        [&](MetricsEvent &ev) {
+          ev.kind = MetricsEvent::Kind::CPU_SUMMARY;
+          ev.latencies = latencies;
+          ev.values[0] = total_time;
+          ev.values[1] = context_switches;
+          ev.reals[0] = cpu_utilization;
+          ev.reals[1] = avg_waiting_time;
+          ev.reals[2] = avg_turnaround_time;
+          ev.reals[3] = avg_response_time;
+          ev.text = algorithm;
+        },
+        true);
+    return;
+  }
+
   std::lock_guard<std::mutex> lock(output_mutex);
+  write_cpu_summary(total_time, cpu_utilization, avg_waiting_time,
+                    avg_turnaround_time, avg_response_time, context_switches,
+                    algorithm, latencies);
+}
 
+void MetricsCollector::write_cpu_summary(Tick total_time,
+                                         double cpu_utilization,
+                                         double avg_waiting_time,
+                                         double avg_turnaround_time,
+                                         double avg_response_time,
+                                         int64_t context_switches,
+                                         const std::string &algorithm,
+                                         const std::vector<LatencySummary> &latencies) {
   if (mode == OutputMode::DISABLED) {
     return;
   }
 
+  if (format == TraceFormat::BINARY) {
+    std::string record;
+    encode_cpu_summary(record, total_time, cpu_utilization, avg_waiting_time,
+                       avg_turnaround_time, avg_response_time,
+                       context_switches, algorithm, latencies);
+    write_raw(record);
+    return;
+  }
+
+  write_line(cpu_summary_line(total_time, cpu_utilization, avg_waiting_time,
+                              avg_turnaround_time, avg_response_time,
+                              context_switches, algorithm, latencies));
+}
+
+std::string MetricsCollector::cpu_summary_line(
+    Tick total_time, double cpu_utilization, double avg_waiting_time,
+    double avg_turnaround_time, double avg_response_time,
+    int64_t context_switches, const std::string &algorithm,
+    const std::vector<LatencySummary> &latencies) {
   json j;
   j["summary"] = "CPU_METRICS";
   j["total_time"] = total_time;
@@ -327,20 +1296,160 @@ void MetricsCollector::log_cpu_summary(int total_time, double cpu_utilization,
   j["avg_response_time"] = avg_response_time;
   j["context_switches"] = context_switches;
   j["algorithm"] = algorithm;
+  if (!latencies.empty()) {
+    // "waiting" / "turnaround" / "response" para el total, por prioridad en
+    // "by_priority" y la espera en cola de cada dispositivo en
+    // "io_queue_delay".
+    json latency = json::object();
+    for (const auto &row : latencies) {
+      json values = {{"count", row.count},
+                     {"p50", row.p50},
+                     {"p95", row.p95},
+                     {"p99", row.p99},
+                     {"max", row.max}};
+      switch (row.scope) {
+      case LatencySummary::Scope::ALL:
+        latency[row.metric] = std::move(values);
+        break;
+      case LatencySummary::Scope::PRIORITY:
+        latency["by_priority"][row.key][row.metric] = std::move(values);
+        break;
+      case LatencySummary::Scope::DEVICE:
+        latency["io_queue_delay"][row.key] = std::move(values);
+        break;
+      }
+    }
+    j["latency"] = std::move(latency);
+  }
+  return j.dump();
+}
+
+void MetricsCollector::log_core_summary(int core, Tick total_time,
+                                        Tick busy_ticks,
+                                        int64_t context_switches,
+                                        int64_t migrations, int64_t steals) {
+  if (async_active.load(std::memory_order_acquire)) {
+    push_event(
+        [&](MetricsEvent &ev) {
+          ev.kind = MetricsEvent::Kind::CORE_SUMMARY;
+          ev.pid = core;
+          ev.values[0] = total_time;
+          ev.values[1] = busy_ticks;
+          ev.values[2] = context_switches;
+          ev.values[3] = migrations;
+          ev.count = static_cast<size_t>(steals);
+        },
+        true);
+    return;
+  }
 
-  write_line(j.dump());
+  std::lock_guard<std::mutex> lock(output_mutex);
+  write_core_summary(core, total_time, busy_ticks, context_switches,
+                     migrations, steals);
 }
 
-void MetricsCollector::log_memory_summary(int total_page_faults,
-                                          int total_replacements,
-                                          int total_frames, int used_frames,
-                                          const std::string &algorithm) {
+void MetricsCollector::write_core_summary(int core, Tick total_time,
+                                          Tick busy_ticks,
+                                          int64_t context_switches,
+                                          int64_t migrations, int64_t steals) {
+  if (mode == OutputMode::DISABLED) {
+    return;
+  }
+
+  if (format == TraceFormat::BINARY) {
+    std::string record;
+    encode_core_summary(record, core, total_time, busy_ticks,
+                        context_switches, migrations, steals);
+    write_raw(record);
+    return;
+  }
+
+  write_line(core_summary_line(core, total_time, busy_ticks, context_switches,
+                               migrations, steals));
+}
+
+std::string MetricsCollector::core_summary_line(int core, Tick total_time,
+                                                Tick busy_ticks,
+                                                int64_t context_switches,
+                                                int64_t migrations,
+                                                int64_t steals) {
+  json j;
+  j["summary"] = "CORE_METRICS";
+  j["core"] = core;
+  j["total_time"] = total_time;
+  j["busy_ticks"] = busy_ticks;
+  j["utilization"] =
+      total_time > 0 ? 100.0 * busy_ticks / static_cast<double>(total_time)
+                     : 0.0;
+  j["context_switches"] = context_switches;
+  j["migrations"] = migrations;
+  j["steals"] = steals;
+  return j.dump();
+}
+
+void MetricsCollector::log_memory_summary(
+    int64_t total_page_faults, int64_t total_replacements, int total_frames,
+    int used_frames, const std::string &algorithm, int64_t completed_processes,
+    Tick total_time, int64_t deferred_admissions, Tick deferral_ticks,
+    int64_t tlb_hits, int64_t tlb_misses) {
+  if (async_active.load(std::memory_order_acquire)) {
+    push_event(
+        [&](MetricsEvent &ev) {
+          ev.kind = MetricsEvent::Kind::MEMORY_SUMMARY;
+          ev.values[0] = total_page_faults;
+          ev.values[1] = total_replacements;
+          ev.values[2] = total_frames;
+          ev.values[3] = used_frames;
+          ev.values[4] = completed_processes;
+          ev.values[5] = total_time;
+          ev.values[6] = deferred_admissions;
+          ev.values[7] = deferral_ticks;
+          ev.values[8] = tlb_hits;
+          ev.values[9] = tlb_misses;
+          ev.text = algorithm;
+        },
+        true);
+    return;
+  }
+
   std::lock_guard<std::mutex> lock(output_mutex);
+  write_memory_summary(total_page_faults, total_replacements, total_frames,
+                       used_frames, algorithm, completed_processes, total_time,
+                       deferred_admissions, deferral_ticks, tlb_hits,
+                       tlb_misses);
+}
 
+void MetricsCollector::write_memory_summary(
+    int64_t total_page_faults, int64_t total_replacements, int total_frames,
+    int used_frames, const std::string &algorithm, int64_t completed_processes,
+    Tick total_time, int64_t deferred_admissions, Tick deferral_ticks,
+    int64_t tlb_hits, int64_t tlb_misses) {
   if (mode == OutputMode::DISABLED) {
     return;
   }
 
+  if (format == TraceFormat::BINARY) {
+    std::string record;
+    encode_memory_summary(record, total_page_faults, total_replacements,
+                          total_frames, used_frames, algorithm,
+                          completed_processes, total_time, deferred_admissions,
+                          deferral_ticks, tlb_hits, tlb_misses);
+    write_raw(record);
+    return;
+  }
+
+  write_line(memory_summary_line(total_page_faults, total_replacements,
+                                 total_frames, used_frames, algorithm,
+                                 completed_processes, total_time,
+                                 deferred_admissions, deferral_ticks, tlb_hits,
+                                 tlb_misses));
+}
+
+std::string MetricsCollector::memory_summary_line(
+    int64_t total_page_faults, int64_t total_replacements, int total_frames,
+    int used_frames, const std::string &algorithm, int64_t completed_processes,
+    Tick total_time, int64_t deferred_admissions, Tick deferral_ticks,
+    int64_t tlb_hits, int64_t tlb_misses) {
   json j;
   j["summary"] = "MEMORY_METRICS";
   j["total_page_faults"] = total_page_faults;
@@ -350,8 +1459,89 @@ void MetricsCollector::log_memory_summary(int total_page_faults,
   j["frame_utilization"] =
       total_frames > 0 ? (100.0 * used_frames / total_frames) : 0.0;
   j["algorithm"] = algorithm;
+  j["completed_processes"] = completed_processes;
+  j["total_time"] = total_time;
+  j["throughput"] =
+      total_time > 0 ? static_cast<double>(completed_processes) / total_time
+                     : 0.0;
+  j["deferred_admissions"] = deferred_admissions;
+  j["deferral_ticks"] = deferral_ticks;
+  j["tlb_hits"] = tlb_hits;
+  j["tlb_misses"] = tlb_misses;
+  int64_t translations = tlb_hits + tlb_misses;
+  j["tlb_hit_rate"] =
+      translations > 0 ? (100.0 * tlb_hits / translations) : 0.0;
+  return j.dump();
+}
+
+void MetricsCollector::log_numa_summary(int node, int frames,
+                                        int64_t page_faults,
+                                        int64_t local_accesses,
+                                        int64_t remote_accesses,
+                                        int64_t remote_loads,
+                                        Tick remote_stall_ticks) {
+  if (async_active.load(std::memory_order_acquire)) {
+    push_event(
+        [&](MetricsEvent &ev) {
+          ev.kind = MetricsEvent::Kind::NUMA_SUMMARY;
+          ev.pid = node;
+          ev.values[0] = frames;
+          ev.values[1] = page_faults;
+          ev.values[2] = local_accesses;
+          ev.values[3] = remote_accesses;
+          ev.values[4] = remote_loads;
+          ev.values[5] = remote_stall_ticks;
+        },
+        true);
+    return;
+  }
 
-  write_line(j.dump());
+  std::lock_guard<std::mutex> lock(output_mutex);
+  write_numa_summary(node, frames, page_faults, local_accesses,
+                     remote_accesses, remote_loads, remote_stall_ticks);
+}
+
+void MetricsCollector::write_numa_summary(int node, int frames,
+                                          int64_t page_faults,
+                                          int64_t local_accesses,
+                                          int64_t remote_accesses,
+                                          int64_t remote_loads,
+                                          Tick remote_stall_ticks) {
+  if (mode == OutputMode::DISABLED) {
+    return;
+  }
+
+  if (format == TraceFormat::BINARY) {
+    std::string record;
+    encode_numa_summary(record, node, frames, page_faults, local_accesses,
+                        remote_accesses, remote_loads, remote_stall_ticks);
+    write_raw(record);
+    return;
+  }
+
+  write_line(numa_summary_line(node, frames, page_faults, local_accesses,
+                               remote_accesses, remote_loads,
+                               remote_stall_ticks));
+}
+
+std::string MetricsCollector::numa_summary_line(int node, int frames,
+                                                int64_t page_faults,
+                                                int64_t local_accesses,
+                                                int64_t remote_accesses,
+                                                int64_t remote_loads,
+                                                Tick remote_stall_ticks) {
+  json j;
+  j["summary"] = "NUMA_METRICS";
+  j["node"] = node;
+  j["frames"] = frames;
+  j["page_faults"] = page_faults;
+  j["local_accesses"] = local_accesses;
+  j["remote_accesses"] = remote_accesses;
+  int64_t accesses = local_accesses + remote_accesses;
+  j["locality"] = accesses > 0 ? (100.0 * local_accesses / accesses) : 0.0;
+  j["remote_loads"] = remote_loads;
+  j["remote_stall_ticks"] = remote_stall_ticks;
+  return j.dump();
 }
 
 } // namespace OSSimulator
@@ -4,22 +4,17 @@
  */
 
 #include "core/config_parser.hpp"
+#include "core/policy_registry.hpp"
 #include "cpu/cpu_scheduler.hpp"
 #include "cpu/fcfs_scheduler.hpp"
-#include "cpu/priority_scheduler.hpp"
-#include "cpu/round_robin_scheduler.hpp"
-#include "cpu/sjf_scheduler.hpp"
 #include "io/io_device.hpp"
-#include "io/io_fcfs_scheduler.hpp"
 #include "io/io_manager.hpp"
-#include "io/io_round_robin_scheduler.hpp"
-#include "memory/fifo_replacement.hpp"
-#include "memory/lru_replacement.hpp"
 #include "memory/memory_manager.hpp"
 #include "metrics/metrics_collector.hpp"
 #include <catch2/catch_test_macros.hpp>
 #include <filesystem>
 #include <memory>
+#include <stdexcept>
 #include <string>
 #include <vector>
 
@@ -39,40 +34,29 @@ bool run_simulation_combination(const std::string &process_file,
       return false;
     }
 
-    CPUScheduler scheduler;
-
-    if (cpu_algo == "FCFS") {
-      scheduler.set_scheduler(std::make_unique<FCFSScheduler>());
-    } else if (cpu_algo == "SJF") {
-      scheduler.set_scheduler(std::make_unique<SJFScheduler>());
-    } else if (cpu_algo == "RoundRobin") {
-      scheduler.set_scheduler(std::make_unique<RoundRobinScheduler>(quantum));
-    } else if (cpu_algo == "Priority") {
-      scheduler.set_scheduler(std::make_unique<PriorityScheduler>());
-    } else {
+    SimulatorConfig config;
+    config.quantum = quantum;
+    IODeviceConfig disk_config;
+    disk_config.name = "disk";
+    disk_config.scheduling_algorithm = io_algo;
+    disk_config.quantum = quantum;
+
+    auto cpu_policy = cpu_scheduler_registry().create(cpu_algo, config);
+    auto replacement_algo = replacement_registry().create(mem_algo, config);
+    auto io_policy = io_scheduler_registry().create(io_algo, disk_config);
+    if (!cpu_policy || !replacement_algo || !io_policy) {
       return false;
     }
 
-    std::unique_ptr<ReplacementAlgorithm> replacement_algo;
-    if (mem_algo == "FIFO") {
-      replacement_algo = std::make_unique<FIFOReplacement>();
-    } else if (mem_algo == "LRU") {
-      replacement_algo = std::make_unique<LRUReplacement>();
-    } else {
-      replacement_algo = std::make_unique<FIFOReplacement>();
-    }
+    CPUScheduler scheduler;
+    scheduler.set_scheduler(std::move(cpu_policy));
 
     auto memory_manager =
         std::make_shared<MemoryManager>(frames, std::move(replacement_algo), 1);
 
     auto io_manager = std::make_shared<IOManager>();
     auto disk_device = std::make_shared<IODevice>("disk");
-
-    if (io_algo == "RoundRobin") {
-      disk_device->set_scheduler(std::make_unique<IORoundRobinScheduler>(quantum));
-    } else {
-      disk_device->set_scheduler(std::make_unique<IOFCFSScheduler>());
-    }
+    disk_device->set_scheduler(std::move(io_policy));
     io_manager->add_device("disk", disk_device);
 
     scheduler.set_memory_manager(memory_manager);
@@ -145,6 +129,18 @@ TEST_CASE("Combinaciones de algoritmos representativas",
     REQUIRE(run_simulation_combination("data/procesos/procesos_priority_test.txt",
                                        "Priority", "LRU", "FCFS", output, 4, frames));
   }
+
+  SECTION("RoundRobin + Clock + IO FCFS") {
+    std::string output = output_dir + "rr_clock_iofcfs.jsonl";
+    REQUIRE(run_simulation_combination(process_file, "RoundRobin", "Clock",
+                                       "FCFS", output, 4, frames));
+  }
+
+  SECTION("RoundRobin + WSClock + IO FCFS") {
+    std::string output = output_dir + "rr_wsclock_iofcfs.jsonl";
+    REQUIRE(run_simulation_combination(process_file, "RoundRobin", "WSClock",
+                                       "FCFS", output, 4, frames));
+  }
 }
 
 TEST_CASE("Tests con cargas de trabajo específicas",
@@ -171,3 +167,52 @@ TEST_CASE("Tests con cargas de trabajo específicas",
                                        "SJF", "LRU", "FCFS", output, 10, frames));
   }
 }
+
+TEST_CASE("Registro de políticas", "[integration][registry]") {
+  SimulatorConfig config;
+  IODeviceConfig device;
+
+  SECTION("Los algoritmos del simulador están registrados") {
+    for (const auto &name : cpu_scheduler_registry().names()) {
+      auto policy = cpu_scheduler_registry().create(name, config);
+      REQUIRE(policy != nullptr);
+      REQUIRE(policy->create_empty() != nullptr);
+    }
+    REQUIRE(cpu_scheduler_registry().contains("CFS"));
+    REQUIRE(replacement_registry().contains("WSClock"));
+    REQUIRE(io_scheduler_registry().contains("CLOOK"));
+    REQUIRE(cpu_scheduler_registry().create("Nope", config) == nullptr);
+
+    SimulatorConfig bad_prediction = config;
+    bad_prediction.sjf_prediction = "exponencial";
+    REQUIRE_THROWS_AS(cpu_scheduler_registry().create("SRTF", bad_prediction),
+                      std::invalid_argument);
+
+    config.quantum = 7;
+    auto rr = cpu_scheduler_registry().create("RoundRobin", config);
+    Process proc(1, "P1", 0, 20);
+    REQUIRE(rr->get_quantum(proc) == 7);
+    REQUIRE(rr->is_time_sliced());
+
+    device.quantum = 3;
+    REQUIRE(io_scheduler_registry().create("RoundRobin", device)
+                ->get_quantum() == 3);
+    REQUIRE(io_scheduler_registry().create("SCAN", device)->get_quantum() ==
+            0);
+  }
+
+  SECTION("Una política nueva se agrega sin tocar el simulador") {
+    CPUSchedulerRegistry registry;
+    registry.add("FIFO", [](const SimulatorConfig &) {
+      return std::make_unique<FCFSScheduler>();
+    });
+    REQUIRE(registry.names() == std::vector<std::string>{"FIFO"});
+
+    CPUScheduler scheduler;
+    scheduler.set_scheduler(registry.create("FIFO", config));
+    scheduler.add_process(std::make_shared<Process>(1, "P1", 0, 3));
+    scheduler.add_process(std::make_shared<Process>(2, "P2", 0, 2));
+    scheduler.run_until_completion();
+    REQUIRE(scheduler.get_completed_processes().front()->pid == 1);
+  }
+}
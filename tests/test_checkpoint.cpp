@@ -0,0 +1,251 @@
+/**
+ * @file test_checkpoint.cpp
+ * @brief Tests de los puntos de control: una simulación restaurada termina
+ * igual que una sin interrupción.
+ */
+
+#include "core/config_parser.hpp"
+#include "core/policy_registry.hpp"
+#include "cpu/cpu_scheduler.hpp"
+#include "io/io_device.hpp"
+#include "io/io_manager.hpp"
+#include "memory/memory_manager.hpp"
+#include <catch2/catch_test_macros.hpp>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using namespace OSSimulator;
+
+namespace {
+
+const std::string PROCESS_FILE = "data/procesos/procesos_large.txt";
+const std::string CHECKPOINT_DIR = "data/test/checkpoint/";
+
+struct Outcome {
+  int total_time = 0;
+  int context_switches = 0;
+  double avg_waiting = 0.0;
+  double avg_turnaround = 0.0;
+  double avg_response = 0.0;
+  int page_faults = 0;
+  int replacements = 0;
+  int tlb_hits = 0;
+  std::vector<int> completion_order;
+  std::vector<LatencySummary> latencies;
+};
+
+/**
+ * Simulación armada a partir de una configuración, como en main.
+ */
+struct Simulation {
+  std::vector<std::shared_ptr<Process>> processes;
+  CPUScheduler scheduler;
+  std::shared_ptr<MemoryManager> memory_manager;
+  std::shared_ptr<IOManager> io_manager;
+
+  explicit Simulation(const SimulatorConfig &config) {
+    processes = ConfigParser::load_processes_from_file(PROCESS_FILE);
+    scheduler.set_execution_mode(ExecutionMode::INLINE);
+    scheduler.set_event_driven(config.simulation_engine == "event");
+    scheduler.set_scheduler(
+        cpu_scheduler_registry().create(config.scheduling_algorithm, config));
+    scheduler.set_core_count(config.cpu_cores);
+
+    memory_manager = std::make_shared<MemoryManager>(
+        config.total_memory_frames,
+        replacement_registry().create(config.page_replacement_algorithm,
+                                      config),
+        1);
+    memory_manager->set_demand_paging(config.paging_mode == "demand");
+    memory_manager->set_tlb(config.tlb_entries, config.tlb_ways,
+                            config.tlb_mode == "asid");
+
+    IODeviceConfig disk{"disk", config.io_scheduling_algorithm,
+                        config.io_quantum, 1, config.io_seek_speed,
+                        config.io_cylinders};
+    auto device = std::make_shared<IODevice>("disk");
+    device->set_scheduler(
+        io_scheduler_registry().create(disk.scheduling_algorithm, disk));
+    device->set_seek_speed(disk.seek_speed);
+    device->set_merge_limit(config.io_merge_limit);
+    io_manager = std::make_shared<IOManager>();
+    io_manager->add_device("disk", device);
+
+    scheduler.set_memory_manager(memory_manager);
+    scheduler.set_io_manager(io_manager);
+    scheduler.load_processes(processes);
+  }
+
+  Outcome finish() {
+    scheduler.run_until_completion();
+    Outcome outcome;
+    outcome.total_time = scheduler.get_current_time();
+    outcome.context_switches = scheduler.get_context_switches();
+    outcome.avg_waiting = scheduler.get_average_waiting_time();
+    outcome.avg_turnaround = scheduler.get_average_turnaround_time();
+    outcome.avg_response = scheduler.get_average_response_time();
+    outcome.page_faults = memory_manager->get_total_page_faults();
+    outcome.replacements = memory_manager->get_total_replacements();
+    outcome.tlb_hits = memory_manager->get_tlb_hits();
+    for (const auto &proc : scheduler.get_completed_processes())
+      outcome.completion_order.push_back(proc->pid);
+    outcome.latencies = scheduler.get_latency_summaries();
+    return outcome;
+  }
+};
+
+void require_same(const Outcome &a, const Outcome &b) {
+  REQUIRE(a.total_time == b.total_time);
+  REQUIRE(a.context_switches == b.context_switches);
+  REQUIRE(a.avg_waiting == b.avg_waiting);
+  REQUIRE(a.avg_turnaround == b.avg_turnaround);
+  REQUIRE(a.avg_response == b.avg_response);
+  REQUIRE(a.page_faults == b.page_faults);
+  REQUIRE(a.replacements == b.replacements);
+  REQUIRE(a.tlb_hits == b.tlb_hits);
+  REQUIRE(a.completion_order == b.completion_order);
+  REQUIRE(a.latencies.size() == b.latencies.size());
+  for (size_t i = 0; i < a.latencies.size(); ++i) {
+    REQUIRE(a.latencies[i].key == b.latencies[i].key);
+    REQUIRE(a.latencies[i].metric == b.latencies[i].metric);
+    REQUIRE(a.latencies[i].count == b.latencies[i].count);
+    REQUIRE(a.latencies[i].p95 == b.latencies[i].p95);
+    REQUIRE(a.latencies[i].max == b.latencies[i].max);
+  }
+}
+
+/**
+ * Ejecuta la configuración sin interrupción y restaurando un punto de
+ * control guardado en el tick dado, y compara los resultados.
+ */
+void check_resume(const SimulatorConfig &config, int tick,
+                  const std::string &name) {
+  std::filesystem::create_directories(CHECKPOINT_DIR);
+  const std::string path = CHECKPOINT_DIR + name + ".bin";
+
+  Simulation uninterrupted(config);
+  Outcome expected = uninterrupted.finish();
+  REQUIRE(expected.completion_order.size() == uninterrupted.processes.size());
+
+  {
+    Simulation first(config);
+    first.scheduler.run_until(tick);
+    REQUIRE(first.scheduler.get_current_time() >= tick);
+    first.scheduler.save_checkpoint(path);
+  }
+
+  Simulation resumed(config);
+  resumed.scheduler.restore_checkpoint(path);
+  REQUIRE(resumed.scheduler.get_current_time() >= tick);
+  require_same(resumed.finish(), expected);
+}
+
+SimulatorConfig base_config() {
+  SimulatorConfig config;
+  config.total_memory_frames = 64;
+  config.scheduling_algorithm = "RoundRobin";
+  config.page_replacement_algorithm = "LRU";
+  return config;
+}
+
+} // namespace
+
+TEST_CASE("Una simulación restaurada termina igual que sin interrupción",
+          "[checkpoint]") {
+  SECTION("Round Robin + LRU + SCAN con búsqueda y fusión") {
+    auto config = base_config();
+    config.io_scheduling_algorithm = "SCAN";
+    config.io_seek_speed = 3;
+    config.io_merge_limit = 8;
+    check_resume(config, 100, "rr_lru_scan");
+  }
+
+  SECTION("MLFQ con paginación por demanda y TLB") {
+    auto config = base_config();
+    config.scheduling_algorithm = "MLFQ";
+    config.paging_mode = "demand";
+    config.tlb_entries = 16;
+    config.total_memory_frames = 32;
+    check_resume(config, 150, "mlfq_demand_tlb");
+  }
+
+  SECTION("CFS multinúcleo + NRU con motor por eventos") {
+    auto config = base_config();
+    config.scheduling_algorithm = "CFS";
+    config.page_replacement_algorithm = "NRU";
+    config.cpu_cores = 4;
+    config.simulation_engine = "event";
+    check_resume(config, 60, "cfs_cores_nru");
+  }
+
+  SECTION("SRTF + WSClock") {
+    auto config = base_config();
+    config.scheduling_algorithm = "SRTF";
+    config.page_replacement_algorithm = "WSClock";
+    check_resume(config, 120, "srtf_wsclock");
+  }
+}
+
+TEST_CASE("Un punto de control no se restaura con otra configuración",
+          "[checkpoint]") {
+  std::filesystem::create_directories(CHECKPOINT_DIR);
+  const std::string path = CHECKPOINT_DIR + "mismatch.bin";
+  auto config = base_config();
+  {
+    Simulation first(config);
+    first.scheduler.run_until(50);
+    first.scheduler.save_checkpoint(path);
+  }
+
+  SECTION("Otro algoritmo de planificación") {
+    auto other = config;
+    other.scheduling_algorithm = "FCFS";
+    Simulation resumed(other);
+    REQUIRE_THROWS_AS(resumed.scheduler.restore_checkpoint(path),
+                      std::runtime_error);
+  }
+
+  SECTION("Otra cantidad de marcos") {
+    auto other = config;
+    other.total_memory_frames = 32;
+    Simulation resumed(other);
+    REQUIRE_THROWS_AS(resumed.scheduler.restore_checkpoint(path),
+                      std::runtime_error);
+  }
+}
+
+TEST_CASE("Un punto de control dañado se rechaza", "[checkpoint]") {
+  std::filesystem::create_directories(CHECKPOINT_DIR);
+  const std::string path = CHECKPOINT_DIR + "damaged.bin";
+  auto config = base_config();
+  {
+    Simulation first(config);
+    first.scheduler.run_until(50);
+    first.scheduler.save_checkpoint(path);
+  }
+
+  SECTION("Archivo truncado") {
+    std::filesystem::resize_file(path, std::filesystem::file_size(path) / 2);
+    Simulation resumed(config);
+    REQUIRE_THROWS_AS(resumed.scheduler.restore_checkpoint(path),
+                      std::runtime_error);
+  }
+
+  SECTION("Archivo que no es un punto de control") {
+    std::ofstream(path, std::ios::trunc) << "no es una instantánea";
+    Simulation resumed(config);
+    REQUIRE_THROWS_AS(resumed.scheduler.restore_checkpoint(path),
+                      std::runtime_error);
+  }
+
+  SECTION("Archivo inexistente") {
+    Simulation resumed(config);
+    REQUIRE_THROWS_AS(
+        resumed.scheduler.restore_checkpoint(CHECKPOINT_DIR + "missing.bin"),
+        std::runtime_error);
+  }
+}
@@ -1,6 +1,8 @@
 #include "core/config_parser.hpp"
+#include "core/process_stream.hpp"
 #include <catch2/catch_test_macros.hpp>
 #include <fstream>
+#include <stdexcept>
 
 using namespace OSSimulator;
 
@@ -38,6 +40,43 @@ TEST_CASE("ConfigParser parse burst sequence", "[config_parser]") {
     REQUIRE(bursts[3].duration == 2);
     REQUIRE(bursts[4].duration == 4);
   }
+
+  SECTION("Parse IO bursts with named devices") {
+    std::string burst_str = "CPU(2),E/S[nvme0](12),CPU(1),E/S(3)";
+    auto bursts = ConfigParser::parse_burst_sequence(burst_str);
+
+    REQUIRE(bursts.size() == 4);
+    REQUIRE(bursts[0].io_device.empty());
+    REQUIRE(bursts[1].type == BurstType::IO);
+    REQUIRE(bursts[1].duration == 12);
+    REQUIRE(bursts[1].io_device == "nvme0");
+    REQUIRE(bursts[3].io_device == "disk");
+  }
+
+  SECTION("Parse IO bursts with cylinders") {
+    auto bursts =
+        ConfigParser::parse_burst_sequence("E/S[disk@120](6),E/S[@7](2),E/S(1)");
+
+    REQUIRE(bursts.size() == 3);
+    REQUIRE(bursts[0].io_device == "disk");
+    REQUIRE(bursts[0].cylinder == 120);
+    REQUIRE(bursts[0].duration == 6);
+    REQUIRE(bursts[1].io_device == "disk");
+    REQUIRE(bursts[1].cylinder == 7);
+    REQUIRE(bursts[2].cylinder == 0);
+  }
+
+  SECTION("Skip text that is not a burst") {
+    auto bursts = ConfigParser::parse_burst_sequence(
+        "xCPU(2);E/S[bad@](3),E/S[a b](4),CPU(),E/S[ok@9](5)");
+
+    REQUIRE(bursts.size() == 2);
+    REQUIRE(bursts[0].type == BurstType::CPU);
+    REQUIRE(bursts[0].duration == 2);
+    REQUIRE(bursts[1].io_device == "ok");
+    REQUIRE(bursts[1].cylinder == 9);
+    REQUIRE(bursts[1].duration == 5);
+  }
 }
 
 TEST_CASE("ConfigParser parse process line", "[config_parser]") {
@@ -75,6 +114,64 @@ TEST_CASE("ConfigParser parse process line", "[config_parser]") {
     REQUIRE(process->burst_sequence[0].duration == 8);
   }
 
+  SECTION("Parse process with access trace") {
+    std::string line = "P4 0 CPU(4) 1 3 0,1,0,2";
+    auto process = ConfigParser::parse_process_line(line);
+
+    REQUIRE(process != nullptr);
+    REQUIRE(process->memory_required == 3);
+    REQUIRE(process->memory_access_trace == std::vector<int>{0, 1, 0, 2});
+  }
+
+  SECTION("Reject trace referencing missing pages") {
+    REQUIRE(ConfigParser::parse_process_line("P4 0 CPU(4) 1 2 0,1,2") ==
+            nullptr);
+    REQUIRE(ConfigParser::parse_process_line("P4 0 CPU(4) 1 2 0,x") ==
+            nullptr);
+  }
+
+  SECTION("Parse shared mappings and write accesses") {
+    auto process =
+        ConfigParser::parse_process_line("P6 0 CPU(4) 1 6 0,4w,5 libc@4:2");
+
+    REQUIRE(process != nullptr);
+    REQUIRE(process->memory_access_trace == std::vector<int>{0, 4, 5});
+    REQUIRE(process->memory_write_trace ==
+            std::vector<bool>{false, true, false});
+    REQUIRE(process->shared_mappings.size() == 1);
+    REQUIRE(process->shared_mappings[0].region == "libc");
+    REQUIRE(process->shared_mappings[0].first_page == 4);
+    REQUIRE(process->shared_mappings[0].pages == 2);
+
+    auto untraced =
+        ConfigParser::parse_process_line("P7 0 CPU(4) 1 6 libc@0:3 heap@3:1");
+    REQUIRE(untraced != nullptr);
+    REQUIRE(untraced->memory_access_trace.empty());
+    REQUIRE(untraced->memory_write_trace.empty());
+    REQUIRE(untraced->shared_mappings.size() == 2);
+    REQUIRE(untraced->shared_mappings[1].region == "heap");
+  }
+
+  SECTION("Reject invalid or overlapping shared mappings") {
+    for (const char *line : {"P6 0 CPU(4) 1 6 libc@5:2",
+                             "P6 0 CPU(4) 1 6 a@0:2 b@1:2",
+                             "P6 0 CPU(4) 1 6 a@0:1 a@2:1",
+                             "P6 0 CPU(4) 1 6 0,1 libc@x:1",
+                             "P6 0 CPU(4) 1 6 @1:1", "P6 0 CPU(4) 1 6 a@1:0"})
+      REQUIRE(ConfigParser::parse_process_line(line) == nullptr);
+  }
+
+  SECTION("Optional fields stop at the first invalid one") {
+    auto process = ConfigParser::parse_process_line("P5 3 CPU(2) x 4 0,1");
+
+    REQUIRE(process != nullptr);
+    REQUIRE(process->priority == 0);
+    REQUIRE(process->memory_required == 0);
+    REQUIRE(process->memory_access_trace.empty());
+    REQUIRE(ConfigParser::parse_process_line("P5 x CPU(2)") == nullptr);
+    REQUIRE(ConfigParser::parse_process_line("Px 0 CPU(2)") == nullptr);
+  }
+
   SECTION("Skip comment line") {
     std::string line = "# This is a comment";
     auto process = ConfigParser::parse_process_line(line);
@@ -117,6 +214,46 @@ TEST_CASE("ConfigParser load processes from file", "[config_parser]") {
   }
 }
 
+TEST_CASE("ProcessStream reads processes one at a time", "[config_parser]") {
+  std::string temp_file = "test_procesos_stream.txt";
+  {
+    std::ofstream out(temp_file, std::ios::binary);
+    out << "# Windows line endings\r\n";
+    out << "P1 0 CPU(4) 1 4\r\n";
+    out << "invalid line\n";
+    // Una línea más larga que el bloque de lectura.
+    out << "P2 5 CPU(1)";
+    for (int i = 0; i < 20000; ++i)
+      out << ",CPU(1)";
+    out << "\n";
+    out << "P3 9 E/S[nvme0](2) 0 2";
+  }
+
+  SECTION("Peek and consume in file order") {
+    ProcessStream stream(temp_file);
+    REQUIRE(stream.peek_arrival() == 0);
+    REQUIRE(stream.next()->name == "P1");
+    REQUIRE(stream.peek_arrival() == 5);
+    REQUIRE(stream.next()->burst_sequence.size() == 20001);
+    auto last = stream.next();
+    REQUIRE(last->pid == 3);
+    REQUIRE(last->burst_sequence[0].io_device == "nvme0");
+    REQUIRE(stream.done());
+    REQUIRE(stream.peek_arrival() == -1);
+    REQUIRE(stream.next() == nullptr);
+  }
+
+  SECTION("Validator rejects processes as they are read") {
+    ProcessStream stream(temp_file, [](const Process &process) {
+      if (process.pid == 2)
+        throw std::runtime_error("rechazado");
+    });
+    REQUIRE_THROWS_AS(stream.next(), std::runtime_error);
+  }
+
+  std::remove(temp_file.c_str());
+}
+
 TEST_CASE("ConfigParser load simulator config", "[config_parser]") {
   SECTION("Load valid config file") {
     std::string temp_file = "test_config.txt";
@@ -127,6 +264,7 @@ TEST_CASE("ConfigParser load simulator config", "[config_parser]") {
     out << "scheduling_algorithm=RoundRobin\n";
     out << "page_replacement_algorithm=LRU\n";
     out << "quantum=4\n";
+    out << "replacement_seed=42\n";
     out.close();
 
     auto config = ConfigParser::load_simulator_config(temp_file);
@@ -136,6 +274,7 @@ TEST_CASE("ConfigParser load simulator config", "[config_parser]") {
     REQUIRE(config.scheduling_algorithm == "RoundRobin");
     REQUIRE(config.page_replacement_algorithm == "LRU");
     REQUIRE(config.quantum == 4);
+    REQUIRE(config.replacement_seed == 42);
 
     std::remove(temp_file.c_str());
   }
@@ -155,9 +294,113 @@ TEST_CASE("ConfigParser load simulator config", "[config_parser]") {
     std::remove(temp_file.c_str());
   }
 
+  SECTION("Load declared IO devices") {
+    std::string temp_file = "test_config_devices.txt";
+    std::ofstream out(temp_file);
+    out << "io_device=nvme0:RoundRobin:2:4\n";
+    out << "io_device=net\n";
+    out << "io_device=hdd1:SCAN:4:1:50:500\n";
+    out << "io_seek_speed=20\n";
+    out.close();
+
+    auto config = ConfigParser::load_simulator_config(temp_file);
+
+    REQUIRE(config.io_devices.size() == 3);
+    REQUIRE(config.io_devices[0].name == "nvme0");
+    REQUIRE(config.io_devices[0].scheduling_algorithm == "RoundRobin");
+    REQUIRE(config.io_devices[0].quantum == 2);
+    REQUIRE(config.io_devices[0].service_rate == 4);
+    REQUIRE(config.io_devices[1].name == "net");
+    REQUIRE(config.io_devices[1].scheduling_algorithm == "FCFS");
+    REQUIRE(config.io_devices[1].service_rate == 1);
+    REQUIRE(config.io_devices[1].seek_speed == 0);
+    REQUIRE(config.io_devices[2].scheduling_algorithm == "SCAN");
+    REQUIRE(config.io_devices[2].seek_speed == 50);
+    REQUIRE(config.io_devices[2].cylinders == 500);
+    REQUIRE(config.io_seek_speed == 20);
+    REQUIRE(config.io_cylinders == 200);
+
+    std::remove(temp_file.c_str());
+  }
+
+  SECTION("Reject invalid IO device declarations") {
+    REQUIRE_THROWS_AS(ConfigParser::parse_io_device(""),
+                      std::invalid_argument);
+    REQUIRE_THROWS_AS(ConfigParser::parse_io_device("nvme0:FCFS:4:0"),
+                      std::invalid_argument);
+    REQUIRE_THROWS_AS(ConfigParser::parse_io_device("hdd1:SCAN:4:1:-1"),
+                      std::invalid_argument);
+  }
+
+  SECTION("Parse MLFQ quanta") {
+    REQUIRE(ConfigParser::parse_mlfq_quanta("2:4:8") ==
+            std::vector<int>{2, 4, 8});
+    REQUIRE(ConfigParser::parse_mlfq_quanta("5") == std::vector<int>{5});
+    REQUIRE_THROWS_AS(ConfigParser::parse_mlfq_quanta(""),
+                      std::invalid_argument);
+    REQUIRE_THROWS_AS(ConfigParser::parse_mlfq_quanta("2:0"),
+                      std::invalid_argument);
+  }
+
   SECTION("Throw exception for non-existent config file") {
     REQUIRE_THROWS_AS(
         ConfigParser::load_simulator_config("non_existent_config.txt"),
         std::runtime_error);
   }
 }
+
+TEST_CASE("ConfigParser load parameter grid", "[config_parser]") {
+  SECTION("Load grid values in file order") {
+    std::string temp_file = "test_grid.txt";
+    std::ofstream out(temp_file);
+    out << "# Sweep grid\n";
+    out << "scheduling_algorithm=FCFS, RoundRobin\n";
+    out << "total_memory_frames=16,32,64\n";
+    out.close();
+
+    auto grid = ConfigParser::load_parameter_grid(temp_file);
+
+    REQUIRE(grid.size() == 2);
+    REQUIRE(grid[0].first == "scheduling_algorithm");
+    REQUIRE(grid[0].second == std::vector<std::string>{"FCFS", "RoundRobin"});
+    REQUIRE(grid[1].first == "total_memory_frames");
+    REQUIRE(grid[1].second.size() == 3);
+
+    SimulatorConfig config;
+    REQUIRE(ConfigParser::apply_config_value(config, grid[1].first,
+                                             grid[1].second[2]));
+    REQUIRE(config.total_memory_frames == 64);
+
+    std::remove(temp_file.c_str());
+  }
+
+  SECTION("Reject unknown parameters") {
+    std::string temp_file = "test_grid_unknown.txt";
+    std::ofstream out(temp_file);
+    out << "frames=16,32\n";
+    out.close();
+
+    REQUIRE_THROWS_AS(ConfigParser::load_parameter_grid(temp_file),
+                      std::runtime_error);
+
+    std::remove(temp_file.c_str());
+  }
+
+  SECTION("Parse sweep shards") {
+    int index = -1;
+    int count = -1;
+    REQUIRE(ConfigParser::parse_shard("2/8", index, count));
+    REQUIRE(index == 2);
+    REQUIRE(count == 8);
+    REQUIRE(ConfigParser::parse_shard("0/1", index, count));
+    REQUIRE(index == 0);
+    REQUIRE(count == 1);
+
+    REQUIRE_FALSE(ConfigParser::parse_shard("8/8", index, count));
+    REQUIRE_FALSE(ConfigParser::parse_shard("0/0", index, count));
+    REQUIRE_FALSE(ConfigParser::parse_shard("-1/4", index, count));
+    REQUIRE_FALSE(ConfigParser::parse_shard("1/4x", index, count));
+    REQUIRE_FALSE(ConfigParser::parse_shard("3", index, count));
+    REQUIRE(index == 0);
+  }
+}
@@ -3,17 +3,29 @@
  * @brief Tests de integración para el CPU Scheduler con todos los algoritmos
  */
 
+#include "core/config_parser.hpp"
 #include "core/process.hpp"
+#include "core/process_stream.hpp"
+#include "cpu/cfs_scheduler.hpp"
 #include "cpu/cpu_scheduler.hpp"
 #include "cpu/fcfs_scheduler.hpp"
+#include "cpu/mlfq_scheduler.hpp"
 #include "cpu/priority_scheduler.hpp"
 #include "cpu/round_robin_scheduler.hpp"
 #include "cpu/sjf_scheduler.hpp"
 #include "io/io_device.hpp"
 #include "io/io_fcfs_scheduler.hpp"
 #include "io/io_manager.hpp"
+#include "memory/fifo_replacement.hpp"
+#include "memory/memory_manager.hpp"
+#include "metrics/metrics_collector.hpp"
+#include <algorithm>
 #include <catch2/catch_test_macros.hpp>
 #include <catch2/matchers/catch_matchers_floating_point.hpp>
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+#include <string>
 
 using namespace OSSimulator;
 
@@ -27,6 +39,71 @@ std::shared_ptr<IOManager> build_test_io_manager() {
   return io_manager;
 }
 
+std::vector<std::string>
+run_mixed_workload(ExecutionMode mode, const std::string &path,
+                   bool event_driven = false,
+                   CoreLocking locking = CoreLocking::NONE,
+                   int numa_remote_latency = 0) {
+  std::filesystem::create_directories("data/test/resultados");
+  auto metrics = std::make_shared<MetricsCollector>();
+  REQUIRE(metrics->enable_file_output(path));
+
+  CPUScheduler cpu_scheduler;
+  cpu_scheduler.set_execution_mode(mode);
+  cpu_scheduler.set_event_driven(event_driven);
+  cpu_scheduler.set_core_locking(locking);
+  cpu_scheduler.set_scheduler(std::make_unique<RoundRobinScheduler>(2));
+  auto memory_manager = std::make_shared<MemoryManager>(
+      4, std::make_unique<FIFOReplacement>(), 1);
+  if (numa_remote_latency > 0) {
+    memory_manager->set_numa(2, NumaPolicy::INTERLEAVE, numa_remote_latency,
+                             1);
+  }
+  cpu_scheduler.set_memory_manager(memory_manager);
+  cpu_scheduler.set_io_manager(build_test_io_manager());
+  cpu_scheduler.set_metrics_collector(metrics);
+
+  std::vector<std::shared_ptr<Process>> processes = {
+      std::make_shared<Process>(
+          1, "P1", 0,
+          std::vector<Burst>{Burst(BurstType::CPU, 3),
+                             Burst(BurstType::IO, 2, "disk"),
+                             Burst(BurstType::CPU, 2)},
+          1, 2),
+      std::make_shared<Process>(
+          2, "P2", 1, std::vector<Burst>{Burst(BurstType::CPU, 5)}, 2, 3),
+      std::make_shared<Process>(
+          3, "P3", 6,
+          std::vector<Burst>{Burst(BurstType::CPU, 1),
+                             Burst(BurstType::IO, 3, "disk"),
+                             Burst(BurstType::CPU, 1)},
+          0, 1),
+      std::make_shared<Process>(
+          4, "P4", 40,
+          std::vector<Burst>{Burst(BurstType::CPU, 2),
+                             Burst(BurstType::IO, 12, "disk"),
+                             Burst(BurstType::CPU, 1)},
+          1, 2)};
+
+  cpu_scheduler.load_processes(processes);
+  cpu_scheduler.run_until_completion();
+  metrics->flush_all();
+  metrics->disable_output();
+
+  REQUIRE(cpu_scheduler.get_completed_processes().size() == 4);
+  for (const auto &proc : processes) {
+    REQUIRE_FALSE(proc->is_thread_running());
+  }
+
+  std::vector<std::string> lines;
+  std::ifstream in(path);
+  std::string line;
+  while (std::getline(in, line)) {
+    lines.push_back(line);
+  }
+  return lines;
+}
+
 } // namespace
 
 // ============================================================================
@@ -140,6 +217,81 @@ TEST_CASE("CPU Scheduler - SJF Integration", "[cpu_scheduler][sjf]") {
     REQUIRE(completed[1]->waiting_time == 2);
     REQUIRE(completed[1]->turnaround_time == 8);
   }
+
+  SECTION("Ready queue ordering and arbitrary removal") {
+    SJFScheduler sjf;
+    auto p1 = std::make_shared<Process>(1, "P1", 3, 5);
+    sjf.add_process(p1);
+    sjf.add_process(std::make_shared<Process>(2, "P2", 1, 5));
+    sjf.add_process(std::make_shared<Process>(3, "P3", 0, 7));
+    sjf.add_process(std::make_shared<Process>(4, "P4", 2, 9));
+
+    REQUIRE(sjf.size() == 4);
+    REQUIRE(sjf.get_next_process()->pid == 2);
+    REQUIRE(sjf.get_last_process()->pid == 4);
+
+    sjf.remove_process(2);
+    REQUIRE(sjf.get_next_process()->pid == 1);
+
+    // El tiempo restante del proceso al frente cambia mientras está en la
+    // cola; la siguiente inserción debe ordenarlo con su valor actual.
+    p1->remaining_time = 8;
+    sjf.add_process(std::make_shared<Process>(5, "P5", 4, 6));
+    REQUIRE(sjf.size() == 4);
+    REQUIRE(sjf.get_next_process()->pid == 5);
+
+    sjf.remove_process(5);
+    REQUIRE(sjf.get_next_process()->pid == 3);
+
+    sjf.remove_process(99);
+    REQUIRE(sjf.size() == 3);
+    sjf.clear();
+    REQUIRE_FALSE(sjf.has_processes());
+    REQUIRE(sjf.get_next_process() == nullptr);
+    REQUIRE(sjf.get_last_process() == nullptr);
+  }
+
+  SECTION("SRTF preempts when a shorter job arrives") {
+    CPUScheduler cpu_scheduler;
+    cpu_scheduler.set_scheduler(std::make_unique<SJFScheduler>(true));
+
+    auto p1 = std::make_shared<Process>(1, "P1", 0, 8);
+    auto p2 = std::make_shared<Process>(2, "P2", 2, 2);
+
+    cpu_scheduler.add_process(p1);
+    cpu_scheduler.add_process(p2);
+
+    cpu_scheduler.run_until_completion();
+
+    const auto &completed = cpu_scheduler.get_completed_processes();
+    REQUIRE(completed.size() == 2);
+    REQUIRE(completed[0]->pid == 2);
+    REQUIRE(completed[0]->completion_time == 4);
+    REQUIRE(completed[1]->completion_time == 10);
+  }
+
+  SECTION("Exponential prediction averages past CPU bursts") {
+    SJFScheduler sjf(false, BurstPrediction::EXPONENTIAL, 0.5, 10);
+    auto proc = std::make_shared<Process>(
+        1, "P1", 0,
+        std::vector<Burst>{Burst(BurstType::CPU, 6),
+                           Burst(BurstType::IO, 2, "disk"),
+                           Burst(BurstType::CPU, 2),
+                           Burst(BurstType::IO, 1, "disk"),
+                           Burst(BurstType::CPU, 4)});
+
+    REQUIRE(sjf.predict_burst(*proc) == 10.0);
+    proc->current_burst_index = 2;
+    REQUIRE(sjf.predict_burst(*proc) == 8.0);
+    proc->current_burst_index = 4;
+    REQUIRE(sjf.predict_burst(*proc) == 5.0);
+
+    // La cola usa la estimación, no la duración real de la ráfaga.
+    auto fresh = std::make_shared<Process>(2, "P2", 0, 7);
+    sjf.add_process(proc);
+    sjf.add_process(fresh);
+    REQUIRE(sjf.get_next_process()->pid == 1);
+  }
 }
 
 // ============================================================================
@@ -208,6 +360,68 @@ TEST_CASE("CPU Scheduler - Round Robin Integration",
 // ============================================================================
 
 TEST_CASE("CPU Scheduler - Priority Integration", "[cpu_scheduler][priority]") {
+  SECTION("Ready queue orders by priority then arrival") {
+    PriorityScheduler priority;
+    for (int pid = 1; pid <= 200; ++pid) {
+      priority.add_process(
+          std::make_shared<Process>(pid, "P", 200 - pid, 3, pid % 5));
+    }
+    REQUIRE(priority.size() == 200);
+
+    int last_priority = -1;
+    int last_arrival = -1;
+    while (priority.has_processes()) {
+      auto next = priority.get_next_process();
+      if (next->priority == last_priority) {
+        REQUIRE(next->arrival_time > last_arrival);
+      } else {
+        REQUIRE(next->priority > last_priority);
+      }
+      last_priority = next->priority;
+      last_arrival = next->arrival_time;
+      priority.remove_process(next->pid);
+    }
+    REQUIRE(priority.size() == 0);
+  }
+
+  SECTION("Aging raises the effective priority of waiting processes") {
+    PriorityScheduler priority(4);
+    auto low = std::make_shared<Process>(1, "Low", 0, 20, 3);
+    auto high = std::make_shared<Process>(2, "High", 0, 20, 0);
+    priority.add_process(low);
+    priority.add_process(high);
+
+    // Low gana un nivel cada 4 ticks de espera; High no gana nada mientras
+    // se ejecuta.
+    for (int tick = 0; tick < 12; ++tick) {
+      priority.advance_time(tick);
+      REQUIRE(priority.get_next_process()->pid == 2);
+      priority.on_cpu_time(*high, 1);
+    }
+    priority.advance_time(12);
+    REQUIRE(priority.get_effective_priority(*low) == 0);
+    REQUIRE(priority.get_effective_priority(*high) == 0);
+    priority.advance_time(13);
+    REQUIRE(priority.get_next_process()->pid == 1);
+  }
+
+  SECTION("Aging bounds starvation under high priority load") {
+    CPUScheduler cpu_scheduler;
+    cpu_scheduler.set_scheduler(std::make_unique<PriorityScheduler>(2));
+
+    cpu_scheduler.add_process(std::make_shared<Process>(1, "Low", 0, 2, 5));
+    for (int pid = 2; pid <= 6; ++pid) {
+      cpu_scheduler.add_process(
+          std::make_shared<Process>(pid, "High", (pid - 2) * 4, 4, 0));
+    }
+
+    cpu_scheduler.run_until_completion();
+
+    const auto &completed = cpu_scheduler.get_completed_processes();
+    REQUIRE(completed.size() == 6);
+    REQUIRE(completed.back()->pid != 1);
+  }
+
   SECTION("Higher priority executes first") {
     CPUScheduler cpu_scheduler;
     cpu_scheduler.set_scheduler(std::make_unique<PriorityScheduler>());
@@ -280,6 +494,415 @@ TEST_CASE("CPU Scheduler - Priority Integration", "[cpu_scheduler][priority]") {
   }
 }
 
+// ============================================================================
+// MLFQ TESTS
+// ============================================================================
+
+TEST_CASE("CPU Scheduler - MLFQ Integration", "[cpu_scheduler][mlfq]") {
+  SECTION("Processes are demoted after using their level quantum") {
+    MLFQScheduler mlfq({2, 4}, 0);
+    auto p1 = std::make_shared<Process>(1, "P1", 0, 10);
+    auto p2 = std::make_shared<Process>(2, "P2", 0, 10);
+    mlfq.add_process(p1);
+    mlfq.add_process(p2);
+
+    REQUIRE(mlfq.get_next_process()->pid == 1);
+    REQUIRE(mlfq.get_quantum(*p1) == 2);
+    mlfq.on_cpu_time(*p1, 1);
+    REQUIRE(mlfq.get_level(1) == 0);
+    REQUIRE(mlfq.get_quantum(*p1) == 1);
+    mlfq.on_cpu_time(*p1, 1);
+    REQUIRE(mlfq.get_level(1) == 1);
+    REQUIRE(mlfq.get_quantum(*p1) == 4);
+
+    // P2 sigue en el nivel 0 y se despacha antes; además desalojaría a P1.
+    REQUIRE(mlfq.get_next_process()->pid == 2);
+    REQUIRE(mlfq.get_last_process()->pid == 1);
+    REQUIRE(mlfq.should_preempt(*p2, *p1));
+    REQUIRE_FALSE(mlfq.should_preempt(*p1, *p2));
+
+    // El último nivel no baja más: reinicia el consumo.
+    mlfq.on_cpu_time(*p1, 4);
+    REQUIRE(mlfq.get_level(1) == 1);
+    REQUIRE(mlfq.get_quantum(*p1) == 4);
+    REQUIRE(mlfq.size() == 2);
+  }
+
+  SECTION("Boost returns every process to the top level") {
+    MLFQScheduler mlfq({1, 1, 1}, 10);
+    auto p1 = std::make_shared<Process>(1, "P1", 0, 10);
+    auto p2 = std::make_shared<Process>(2, "P2", 0, 10);
+    mlfq.add_process(p1);
+    mlfq.add_process(p2);
+    mlfq.on_cpu_time(*p1, 1);
+    mlfq.on_cpu_time(*p1, 1);
+    mlfq.on_cpu_time(*p2, 1);
+    REQUIRE(mlfq.get_level(1) == 2);
+    REQUIRE(mlfq.get_level(2) == 1);
+
+    mlfq.advance_time(9);
+    REQUIRE(mlfq.get_level(1) == 2);
+    mlfq.advance_time(10);
+    REQUIRE(mlfq.get_level(1) == 0);
+    REQUIRE(mlfq.get_level(2) == 0);
+    // Se conserva el orden relativo: P2 estaba en un nivel superior.
+    REQUIRE(mlfq.get_next_process()->pid == 2);
+  }
+
+  SECTION("Short interactive jobs finish before long ones") {
+    CPUScheduler cpu_scheduler;
+    cpu_scheduler.set_scheduler(
+        std::make_unique<MLFQScheduler>(std::vector<int>{2, 4, 8}, 0));
+
+    auto p1 = std::make_shared<Process>(1, "Long", 0, 20);
+    auto p2 = std::make_shared<Process>(2, "Short", 3, 2);
+
+    cpu_scheduler.add_process(p1);
+    cpu_scheduler.add_process(p2);
+
+    cpu_scheduler.run_until_completion();
+
+    const auto &completed = cpu_scheduler.get_completed_processes();
+    REQUIRE(completed.size() == 2);
+    REQUIRE(completed[0]->pid == 2);
+    REQUIRE(cpu_scheduler.get_current_time() == 22);
+  }
+
+  SECTION("Completed processes are forgotten across boosts") {
+    auto queue = std::make_unique<MLFQScheduler>(std::vector<int>{1, 2}, 5);
+    MLFQScheduler *mlfq = queue.get();
+    CPUScheduler cpu_scheduler;
+    cpu_scheduler.set_execution_mode(ExecutionMode::INLINE);
+    cpu_scheduler.set_scheduler(std::move(queue));
+
+    // Cada proceso baja de nivel y termina antes de que llegue el siguiente
+    // grupo; en el camino hay decenas de elevaciones.
+    std::vector<std::shared_ptr<Process>> processes;
+    for (int pid = 1; pid <= 300; ++pid) {
+      processes.push_back(
+          std::make_shared<Process>(pid, "P", (pid - 1) / 2 * 8, 3));
+    }
+    cpu_scheduler.load_processes(processes);
+
+    size_t most_tracked = 0;
+    while (cpu_scheduler.has_pending_processes()) {
+      cpu_scheduler.execute_step(0);
+      most_tracked = std::max(most_tracked, mlfq->get_tracked_count());
+    }
+
+    REQUIRE(cpu_scheduler.get_completed_processes().size() == 300);
+    REQUIRE(most_tracked <= 2);
+    REQUIRE(mlfq->get_tracked_count() == 0);
+  }
+}
+
+// ============================================================================
+// CFS TESTS
+// ============================================================================
+
+TEST_CASE("CPU Scheduler - CFS Integration", "[cpu_scheduler][cfs]") {
+  SECTION("Lowest vruntime runs next and weights scale vruntime") {
+    CFSScheduler cfs(12, 2);
+    auto heavy = std::make_shared<Process>(1, "Heavy", 0, 20, -5);
+    auto light = std::make_shared<Process>(2, "Light", 0, 20, 5);
+    cfs.add_process(heavy);
+    cfs.add_process(light);
+
+    REQUIRE(CFSScheduler::weight_for(0) == CFSScheduler::NICE_0_WEIGHT);
+    REQUIRE(CFSScheduler::weight_for(-5) > CFSScheduler::weight_for(5));
+
+    // El turno reparte la latencia según el peso.
+    REQUIRE(cfs.get_quantum(*heavy) > cfs.get_quantum(*light));
+    REQUIRE(cfs.get_quantum(*light) == 2);
+
+    REQUIRE(cfs.get_next_process()->pid == 1);
+    cfs.on_cpu_time(*heavy, 4);
+    REQUIRE(cfs.get_vruntime(1) < 4.0);
+    REQUIRE(cfs.get_next_process()->pid == 2);
+    cfs.on_cpu_time(*light, 4);
+    REQUIRE(cfs.get_vruntime(2) > 4.0);
+    REQUIRE(cfs.get_next_process()->pid == 1);
+    REQUIRE(cfs.get_last_process()->pid == 2);
+    REQUIRE(cfs.should_preempt(*heavy, *light));
+    REQUIRE_FALSE(cfs.should_preempt(*light, *heavy));
+  }
+
+  SECTION("Terminated processes are not retained") {
+    CFSScheduler cfs(12, 2);
+    auto proc = std::make_shared<Process>(1, "P1", 0, 4);
+    std::weak_ptr<Process> watch = proc;
+    cfs.add_process(proc);
+    cfs.on_cpu_time(*proc, 2);
+    REQUIRE(cfs.get_vruntime(1) == 2.0);
+
+    // Fuera de la cola el planificador solo guarda su vruntime.
+    cfs.remove_process(1);
+    proc.reset();
+    REQUIRE(watch.expired());
+    REQUIRE(cfs.get_vruntime(1) == 2.0);
+
+    cfs.on_process_exit(1);
+    REQUIRE(cfs.get_vruntime(1) == 0.0);
+    REQUIRE_FALSE(cfs.has_processes());
+  }
+
+  SECTION("A waking process keeps a bounded credit") {
+    CFSScheduler cfs(12, 2);
+    auto sleeper = std::make_shared<Process>(1, "Sleeper", 0, 20, 0);
+    auto runner = std::make_shared<Process>(2, "Runner", 0, 20, 0);
+    cfs.add_process(sleeper);
+    cfs.add_process(runner);
+    cfs.remove_process(1);
+
+    cfs.on_cpu_time(*runner, 40);
+    cfs.add_process(sleeper);
+    REQUIRE(cfs.get_vruntime(1) == 34.0);
+    REQUIRE(cfs.get_next_process()->pid == 1);
+    REQUIRE(cfs.size() == 2);
+  }
+
+  SECTION("Equal priorities share the CPU evenly") {
+    CPUScheduler cpu_scheduler;
+    cpu_scheduler.set_scheduler(std::make_unique<CFSScheduler>(12, 2));
+
+    auto p1 = std::make_shared<Process>(1, "P1", 0, 12, 0);
+    auto p2 = std::make_shared<Process>(2, "P2", 0, 12, 0);
+    auto p3 = std::make_shared<Process>(3, "P3", 0, 12, 0);
+
+    cpu_scheduler.add_process(p1);
+    cpu_scheduler.add_process(p2);
+    cpu_scheduler.add_process(p3);
+
+    cpu_scheduler.run_until_completion();
+
+    const auto &completed = cpu_scheduler.get_completed_processes();
+    REQUIRE(completed.size() == 3);
+    REQUIRE(cpu_scheduler.get_current_time() == 36);
+    REQUIRE(completed[0]->completion_time >= 28);
+    REQUIRE(cpu_scheduler.get_context_switches() >= 9);
+  }
+}
+
+// ============================================================================
+// EXECUTION MODE TESTS
+// ============================================================================
+
+TEST_CASE("CPU Scheduler - Inline execution mode", "[cpu_scheduler][inline]") {
+  SECTION("Inline mode does not spawn process threads") {
+    CPUScheduler cpu_scheduler;
+    cpu_scheduler.set_execution_mode(ExecutionMode::INLINE);
+    cpu_scheduler.set_scheduler(std::make_unique<FCFSScheduler>());
+
+    auto p1 = std::make_shared<Process>(1, "P1", 0, 4);
+    cpu_scheduler.add_process(p1);
+    REQUIRE_FALSE(p1->is_thread_running());
+
+    cpu_scheduler.run_until_completion();
+    REQUIRE(p1->completion_time == 4);
+  }
+
+  SECTION("Switching to inline stops existing threads") {
+    CPUScheduler cpu_scheduler;
+    cpu_scheduler.set_scheduler(std::make_unique<FCFSScheduler>());
+
+    auto p1 = std::make_shared<Process>(1, "P1", 0, 4);
+    cpu_scheduler.add_process(p1);
+    REQUIRE(p1->is_thread_running());
+
+    cpu_scheduler.set_execution_mode(ExecutionMode::INLINE);
+    REQUIRE_FALSE(p1->is_thread_running());
+  }
+
+  SECTION("Inline and threaded modes produce identical metrics") {
+    auto threaded = run_mixed_workload(
+        ExecutionMode::THREADED, "data/test/resultados/mode_threaded.jsonl");
+    auto inline_run = run_mixed_workload(
+        ExecutionMode::INLINE, "data/test/resultados/mode_inline.jsonl");
+
+    REQUIRE_FALSE(threaded.empty());
+    REQUIRE(threaded == inline_run);
+  }
+}
+
+TEST_CASE("CPU Scheduler - Event-driven engine", "[cpu_scheduler][event]") {
+  SECTION("Metrics are identical to the tick engine") {
+    auto tick_run = run_mixed_workload(
+        ExecutionMode::INLINE, "data/test/resultados/engine_tick.jsonl");
+    auto event_run =
+        run_mixed_workload(ExecutionMode::INLINE,
+                           "data/test/resultados/engine_event.jsonl", true);
+
+    REQUIRE_FALSE(tick_run.empty());
+    REQUIRE(tick_run == event_run);
+  }
+
+  SECTION("Remote page loads are logged when they finish") {
+    auto tick_run = run_mixed_workload(
+        ExecutionMode::INLINE, "data/test/resultados/engine_numa_tick.jsonl",
+        false, CoreLocking::NONE, 2);
+    auto event_run = run_mixed_workload(
+        ExecutionMode::INLINE, "data/test/resultados/engine_numa_event.jsonl",
+        true, CoreLocking::NONE, 2);
+
+    REQUIRE_FALSE(tick_run.empty());
+    REQUIRE(tick_run == event_run);
+  }
+
+  SECTION("Idle gaps are skipped without changing completion times") {
+    auto run = [](bool event_driven) {
+      CPUScheduler cpu_scheduler;
+      cpu_scheduler.set_execution_mode(ExecutionMode::INLINE);
+      cpu_scheduler.set_event_driven(event_driven);
+      cpu_scheduler.set_scheduler(std::make_unique<FCFSScheduler>());
+      cpu_scheduler.set_io_manager(build_test_io_manager());
+
+      std::vector<std::shared_ptr<Process>> processes = {
+          std::make_shared<Process>(
+              1, "P1", 0,
+              std::vector<Burst>{Burst(BurstType::CPU, 2),
+                                 Burst(BurstType::IO, 50, "disk"),
+                                 Burst(BurstType::CPU, 1)},
+              0, 1),
+          std::make_shared<Process>(
+              2, "P2", 500, std::vector<Burst>{Burst(BurstType::CPU, 3)}, 0,
+              1)};
+      cpu_scheduler.load_processes(processes);
+      cpu_scheduler.run_until_completion();
+
+      std::vector<int> result;
+      for (const auto &proc : processes) {
+        result.push_back(proc->completion_time);
+      }
+      result.push_back(cpu_scheduler.get_current_time());
+      return result;
+    };
+
+    auto tick_result = run(false);
+    REQUIRE(tick_result == run(true));
+    REQUIRE(tick_result.back() == 503);
+  }
+}
+
+TEST_CASE("CPU Scheduler - Core locking", "[cpu_scheduler][locking]") {
+  SECTION("Coarse locking does not change the metrics") {
+    if (!CORE_LOCKING_AVAILABLE)
+      return;
+    auto unlocked = run_mixed_workload(
+        ExecutionMode::THREADED, "data/test/resultados/locking_none.jsonl");
+    auto coarse = run_mixed_workload(ExecutionMode::THREADED,
+                                     "data/test/resultados/locking_coarse.jsonl",
+                                     false, CoreLocking::COARSE);
+
+    REQUIRE_FALSE(unlocked.empty());
+    REQUIRE(unlocked == coarse);
+  }
+
+  SECTION("Coarse locking is rejected without core mutexes") {
+    CPUScheduler cpu_scheduler;
+    REQUIRE(cpu_scheduler.get_core_locking() == CoreLocking::NONE);
+    if (CORE_LOCKING_AVAILABLE) {
+      cpu_scheduler.set_core_locking(CoreLocking::COARSE);
+      REQUIRE(cpu_scheduler.get_core_locking() == CoreLocking::COARSE);
+    } else {
+      REQUIRE_THROWS_AS(cpu_scheduler.set_core_locking(CoreLocking::COARSE),
+                        std::runtime_error);
+      REQUIRE(cpu_scheduler.get_core_locking() == CoreLocking::NONE);
+    }
+  }
+}
+
+TEST_CASE("CPU Scheduler - Multi-core mode", "[cpu_scheduler][multicore]") {
+  SECTION("Idle core steals work from a busy core") {
+    CPUScheduler cpu_scheduler;
+    cpu_scheduler.set_execution_mode(ExecutionMode::INLINE);
+    cpu_scheduler.set_scheduler(std::make_unique<FCFSScheduler>());
+    cpu_scheduler.set_core_count(2);
+    REQUIRE(cpu_scheduler.get_core_count() == 2);
+
+    std::vector<std::shared_ptr<Process>> processes = {
+        std::make_shared<Process>(1, "P1", 0, 10),
+        std::make_shared<Process>(2, "P2", 0, 2),
+        std::make_shared<Process>(3, "P3", 0, 2)};
+    cpu_scheduler.load_processes(processes);
+    cpu_scheduler.run_until_completion();
+
+    REQUIRE(processes[0]->completion_time == 10);
+    REQUIRE(processes[1]->completion_time == 2);
+    REQUIRE(processes[2]->completion_time == 4);
+    REQUIRE(cpu_scheduler.get_current_time() == 10);
+
+    auto stats = cpu_scheduler.get_core_stats();
+    REQUIRE(stats.size() == 2);
+    REQUIRE(stats[0].busy_ticks == 10);
+    REQUIRE(stats[1].busy_ticks == 4);
+    REQUIRE(stats[1].steals == 1);
+    REQUIRE_THAT(cpu_scheduler.get_cpu_utilization(),
+                 Catch::Matchers::WithinAbs(70.0, 0.01));
+  }
+
+  SECTION("Stealing takes the tail of the victim's queue") {
+    CPUScheduler cpu_scheduler;
+    cpu_scheduler.set_execution_mode(ExecutionMode::INLINE);
+    cpu_scheduler.set_scheduler(std::make_unique<RoundRobinScheduler>(2));
+    cpu_scheduler.set_core_count(2);
+    cpu_scheduler.set_migration_cost(1);
+
+    // P1 y P3 quedan en el núcleo 0. Al agotar P1 su quantum la cola es
+    // [P3, P1] y el núcleo 1, ya sin trabajo, debe llevarse a P1.
+    std::vector<std::shared_ptr<Process>> processes = {
+        std::make_shared<Process>(1, "P1", 0, 4),
+        std::make_shared<Process>(2, "P2", 0, 2),
+        std::make_shared<Process>(3, "P3", 0, 4)};
+    cpu_scheduler.load_processes(processes);
+    cpu_scheduler.run_until_completion();
+
+    REQUIRE(processes[0]->completion_time == 5);
+    REQUIRE(processes[1]->completion_time == 2);
+    REQUIRE(processes[2]->completion_time == 6);
+
+    auto stats = cpu_scheduler.get_core_stats();
+    REQUIRE(stats[1].steals == 1);
+    REQUIRE(stats[1].migrations == 1);
+    REQUIRE(stats[0].migrations == 0);
+  }
+
+  SECTION("Engines and execution modes agree") {
+    auto run = [](ExecutionMode mode, bool event_driven) {
+      CPUScheduler cpu_scheduler;
+      cpu_scheduler.set_execution_mode(mode);
+      cpu_scheduler.set_event_driven(event_driven);
+      cpu_scheduler.set_scheduler(std::make_unique<RoundRobinScheduler>(2));
+      cpu_scheduler.set_core_count(2);
+      cpu_scheduler.set_migration_cost(1);
+      cpu_scheduler.set_io_manager(build_test_io_manager());
+
+      std::vector<std::shared_ptr<Process>> processes;
+      for (int pid = 1; pid <= 4; ++pid) {
+        processes.push_back(std::make_shared<Process>(
+            pid, "P" + std::to_string(pid), 0,
+            std::vector<Burst>{Burst(BurstType::CPU, 4),
+                               Burst(BurstType::IO, 3, "disk"),
+                               Burst(BurstType::CPU, 2)},
+            0, 1));
+      }
+      cpu_scheduler.load_processes(processes);
+      cpu_scheduler.run_until_completion();
+
+      std::vector<int> result;
+      for (const auto &proc : processes) {
+        result.push_back(proc->completion_time);
+      }
+      result.push_back(cpu_scheduler.get_current_time());
+      return result;
+    };
+
+    auto inline_run = run(ExecutionMode::INLINE, false);
+    REQUIRE(inline_run.back() == 20);
+    REQUIRE(inline_run == run(ExecutionMode::INLINE, true));
+    REQUIRE(inline_run == run(ExecutionMode::THREADED, false));
+  }
+}
+
 // ============================================================================
 // METRICS & UTILITY TESTS
 // ============================================================================
@@ -391,6 +1014,112 @@ TEST_CASE("CPU Scheduler - Arrival Time Handling", "[cpu_scheduler][arrival]") {
     REQUIRE(completed.size() == 3);
     REQUIRE(cpu_scheduler.get_current_time() >= 10);
   }
+
+  SECTION("Processes loaded out of arrival order") {
+    CPUScheduler cpu_scheduler;
+    cpu_scheduler.set_scheduler(std::make_unique<FCFSScheduler>());
+
+    auto p1 = std::make_shared<Process>(1, "P1", 6, 2);
+    auto p2 = std::make_shared<Process>(2, "P2", 0, 2);
+    auto p3 = std::make_shared<Process>(3, "P3", 3, 2);
+    cpu_scheduler.load_processes({p1, p2, p3});
+
+    cpu_scheduler.run_until_completion();
+
+    REQUIRE(p2->start_time == 0);
+    REQUIRE(p3->start_time == 3);
+    REQUIRE(p1->start_time == 6);
+  }
+
+  SECTION("Process added after the simulation started") {
+    CPUScheduler cpu_scheduler;
+    cpu_scheduler.set_scheduler(std::make_unique<FCFSScheduler>());
+    cpu_scheduler.set_execution_mode(ExecutionMode::INLINE);
+
+    auto p1 = std::make_shared<Process>(1, "P1", 0, 2);
+    cpu_scheduler.add_process(p1);
+    for (int i = 0; i < 4; i++) {
+      cpu_scheduler.execute_step();
+    }
+
+    Tick added_at = cpu_scheduler.get_current_time();
+    auto p2 = std::make_shared<Process>(2, "P2", 1, 2);
+    cpu_scheduler.add_process(p2);
+    cpu_scheduler.run_until_completion();
+
+    REQUIRE(cpu_scheduler.get_completed_processes().size() == 2);
+    REQUIRE(p2->start_time == added_at);
+  }
+
+  SECTION("Streamed processes are created on arrival") {
+    std::filesystem::create_directories("data/test");
+    const std::string path = "data/test/procesos_stream.txt";
+    {
+      std::ofstream out(path);
+      out << "P1 0 CPU(3)\nP2 1 CPU(2)\nP3 20 CPU(1)\n";
+    }
+
+    CPUScheduler eager;
+    eager.set_scheduler(std::make_unique<RoundRobinScheduler>(2));
+    eager.set_execution_mode(ExecutionMode::INLINE);
+    eager.load_processes(ConfigParser::load_processes_from_file(path));
+    eager.run_until_completion();
+
+    CPUScheduler streamed;
+    streamed.set_scheduler(std::make_unique<RoundRobinScheduler>(2));
+    streamed.set_execution_mode(ExecutionMode::INLINE);
+    streamed.stream_processes(std::make_unique<ProcessStream>(path));
+    streamed.execute_step();
+    REQUIRE(streamed.get_all_processes().size() == 1);
+    std::weak_ptr<Process> first = streamed.get_all_processes().front();
+    streamed.run_until_completion();
+
+    // Los terminados se liberan; sus métricas quedan en los promedios.
+    REQUIRE(first.expired());
+    REQUIRE(streamed.get_completed_processes().empty());
+    REQUIRE(streamed.get_completed_count() == 3);
+    REQUIRE(eager.get_completed_count() == 3);
+    REQUIRE(streamed.get_current_time() == eager.get_current_time());
+    REQUIRE(streamed.get_average_waiting_time() ==
+            eager.get_average_waiting_time());
+    REQUIRE(streamed.get_context_switches() == eager.get_context_switches());
+  }
+
+  SECTION("Times beyond the 32-bit range") {
+    CPUScheduler cpu_scheduler;
+    cpu_scheduler.set_scheduler(std::make_unique<FCFSScheduler>());
+    cpu_scheduler.set_execution_mode(ExecutionMode::INLINE);
+    cpu_scheduler.set_event_driven(true);
+
+    auto p1 =
+        ConfigParser::parse_process_line("P1 5000000000 CPU(3000000000)");
+    auto p2 = ConfigParser::parse_process_line("P2 5000000001 CPU(2)");
+    REQUIRE(p1 != nullptr);
+    REQUIRE(p2 != nullptr);
+    cpu_scheduler.load_processes({p1, p2});
+    cpu_scheduler.run_until_completion();
+
+    REQUIRE(cpu_scheduler.get_completed_processes().size() == 2);
+    REQUIRE(p1->completion_time == 8000000000);
+    REQUIRE(p1->turnaround_time == 3000000000);
+    REQUIRE(p2->waiting_time == 2999999999);
+    REQUIRE(cpu_scheduler.get_current_time() == 8000000002);
+  }
+
+  SECTION("Streaming rejects files out of arrival order") {
+    std::filesystem::create_directories("data/test");
+    const std::string path = "data/test/procesos_desordenados.txt";
+    {
+      std::ofstream out(path);
+      out << "P1 5 CPU(3)\nP2 1 CPU(2)\n";
+    }
+
+    CPUScheduler streamed;
+    streamed.set_scheduler(std::make_unique<FCFSScheduler>());
+    streamed.set_execution_mode(ExecutionMode::INLINE);
+    streamed.stream_processes(std::make_unique<ProcessStream>(path));
+    REQUIRE_THROWS_AS(streamed.run_until_completion(), std::runtime_error);
+  }
 }
 
 TEST_CASE("CPU Scheduler - Context Switch Counting",
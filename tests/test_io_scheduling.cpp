@@ -1,12 +1,20 @@
 #include "core/burst.hpp"
 #include "core/process.hpp"
+#include "io/io_clook_scheduler.hpp"
+#include "io/io_cscan_scheduler.hpp"
 #include "io/io_device.hpp"
 #include "io/io_fcfs_scheduler.hpp"
 #include "io/io_manager.hpp"
 #include "io/io_request.hpp"
+#include "io/io_request_pool.hpp"
 #include "io/io_round_robin_scheduler.hpp"
+#include "io/io_scan_scheduler.hpp"
+#include "io/io_sstf_scheduler.hpp"
 #include <catch2/catch_test_macros.hpp>
 #include <memory>
+#include <string>
+#include <utility>
+#include <vector>
 
 using namespace OSSimulator;
 
@@ -115,6 +123,43 @@ TEST_CASE("IO Request management", "[io][request]") {
   }
 }
 
+TEST_CASE("IO Request pool", "[io][request][pool]") {
+  auto proc = std::make_shared<Process>(1, "P1", 0, 10);
+  Burst io_burst(BurstType::IO, 5, "disk");
+  IORequestPool pool;
+
+  auto first = pool.acquire(proc, io_burst, 10, 2);
+  REQUIRE(first->process == proc);
+  REQUIRE(first->burst.duration == 5);
+  REQUIRE(first->arrival_time == 10);
+  REQUIRE(first->priority == 2);
+  REQUIRE(pool.allocated() == 1);
+  REQUIRE(pool.available() == 0);
+
+  first.reset();
+  REQUIRE(pool.available() == 1);
+
+  SECTION("Released blocks are reused") {
+    for (int i = 0; i < 100; i++) {
+      auto request = pool.acquire(proc, io_burst, i);
+      REQUIRE(request->arrival_time == i);
+      REQUIRE(request->start_time == -1);
+    }
+    REQUIRE(pool.allocated() == 1);
+    REQUIRE(pool.available() == 1);
+  }
+
+  SECTION("Requests outlive the pool") {
+    std::shared_ptr<IORequest> survivor;
+    {
+      IORequestPool scoped;
+      survivor = scoped.acquire(proc, io_burst, 3);
+    }
+    REQUIRE(survivor->arrival_time == 3);
+    REQUIRE(survivor->process == proc);
+  }
+}
+
 TEST_CASE("IO FCFS Scheduler", "[io][scheduler][fcfs]") {
   IOFCFSScheduler scheduler;
 
@@ -178,6 +223,69 @@ TEST_CASE("IO Round Robin Scheduler", "[io][scheduler][rr]") {
   REQUIRE(scheduler.size() == 0);
 }
 
+TEST_CASE("IO elevator schedulers", "[io][scheduler][elevator]") {
+  // Cola clásica con el cabezal en el cilindro 53, subiendo.
+  auto run = [](IOScheduler &scheduler) {
+    auto proc = std::make_shared<Process>(1, "P1", 0, 10);
+    scheduler.add_request(std::make_shared<IORequest>(
+        proc, Burst(BurstType::IO, 1, "disk", 53), 0));
+    scheduler.get_next_request();
+    scheduler.take_seek_distance();
+
+    for (int cylinder : {98, 183, 37, 122, 14, 124, 65, 67}) {
+      scheduler.add_request(std::make_shared<IORequest>(
+          proc, Burst(BurstType::IO, 1, "disk", cylinder), 0));
+    }
+    std::vector<int> order;
+    while (auto request = scheduler.get_next_request()) {
+      order.push_back(request->cylinder);
+    }
+    return std::make_pair(order, scheduler.take_seek_distance());
+  };
+
+  SECTION("SSTF") {
+    IOSSTFScheduler scheduler;
+    REQUIRE(scheduler.get_algorithm() == IOSchedulingAlgorithm::SSTF);
+    auto [order, distance] = run(scheduler);
+    REQUIRE(order == std::vector<int>{65, 67, 37, 14, 98, 122, 124, 183});
+    REQUIRE(distance == 236);
+  }
+
+  SECTION("SCAN") {
+    IOSCANScheduler scheduler(200);
+    auto [order, distance] = run(scheduler);
+    REQUIRE(order == std::vector<int>{65, 67, 98, 122, 124, 183, 37, 14});
+    REQUIRE(distance == 146 + 185);
+  }
+
+  SECTION("C-SCAN") {
+    IOCSCANScheduler scheduler(200);
+    auto [order, distance] = run(scheduler);
+    REQUIRE(order == std::vector<int>{65, 67, 98, 122, 124, 183, 14, 37});
+    REQUIRE(distance == 146 + 199 + 37);
+  }
+
+  SECTION("C-LOOK") {
+    IOCLOOKScheduler scheduler;
+    auto [order, distance] = run(scheduler);
+    REQUIRE(order == std::vector<int>{65, 67, 98, 122, 124, 183, 14, 37});
+    REQUIRE(distance == 130 + 169 + 23);
+  }
+
+  SECTION("Same cylinder keeps arrival order") {
+    IOSSTFScheduler scheduler;
+    auto proc = std::make_shared<Process>(1, "P1", 0, 10);
+    auto first = std::make_shared<IORequest>(
+        proc, Burst(BurstType::IO, 1, "disk", 10), 0);
+    auto second = std::make_shared<IORequest>(
+        proc, Burst(BurstType::IO, 1, "disk", 10), 1);
+    scheduler.add_request(first);
+    scheduler.add_request(second);
+    REQUIRE(scheduler.get_next_request() == first);
+    REQUIRE(scheduler.get_next_request() == second);
+  }
+}
+
 TEST_CASE("IO Device with FCFS scheduling", "[io][device]") {
   IODevice device("disk");
   device.set_scheduler(std::make_unique<IOFCFSScheduler>());
@@ -205,6 +313,103 @@ TEST_CASE("IO Device with FCFS scheduling", "[io][device]") {
   REQUIRE_FALSE(device.has_pending_requests());
 }
 
+TEST_CASE("IO Device service rate", "[io][device]") {
+  IODevice device("nvme0");
+  device.set_scheduler(std::make_unique<IOFCFSScheduler>());
+  device.set_service_rate(3);
+  REQUIRE(device.get_service_rate() == 3);
+
+  std::vector<int> completion_times;
+  device.set_completion_callback(
+      [&](std::shared_ptr<Process> /*proc*/, int time) {
+        completion_times.push_back(time);
+      });
+
+  auto proc1 = std::make_shared<Process>(1, "P1", 0, 10);
+  auto proc2 = std::make_shared<Process>(2, "P2", 0, 10);
+  device.add_io_request(std::make_shared<IORequest>(
+      proc1, Burst(BurstType::IO, 7, "nvme0"), 0));
+  device.add_io_request(std::make_shared<IORequest>(
+      proc2, Burst(BurstType::IO, 3, "nvme0"), 0));
+
+  // 7 unidades a 3 por tick ocupan 3 ticks; 3 unidades, uno.
+  REQUIRE(device.get_ticks_until_next_event() == 1);
+  device.execute_step(2, 0);
+  REQUIRE(device.get_ticks_until_next_event() == 1);
+  device.execute_step(1, 2);
+  device.execute_step(0, 3);
+
+  REQUIRE(completion_times == std::vector<int>{3, 4});
+  REQUIRE(device.get_total_io_time() == 4);
+  REQUIRE_FALSE(device.has_pending_requests());
+}
+
+TEST_CASE("IO Device seek time", "[io][device]") {
+  IODevice device("disk");
+  device.set_scheduler(std::make_unique<IOFCFSScheduler>());
+  device.set_seek_speed(10);
+
+  std::vector<int> completion_times;
+  device.set_completion_callback(
+      [&](std::shared_ptr<Process> /*proc*/, int time) {
+        completion_times.push_back(time);
+      });
+
+  auto proc1 = std::make_shared<Process>(1, "P1", 0, 10);
+  auto proc2 = std::make_shared<Process>(2, "P2", 0, 10);
+  device.add_io_request(std::make_shared<IORequest>(
+      proc1, Burst(BurstType::IO, 2, "disk", 25), 0));
+  device.add_io_request(std::make_shared<IORequest>(
+      proc2, Burst(BurstType::IO, 1, "disk", 5), 0));
+
+  // 25 cilindros a 10 por tick: 3 ticks de búsqueda antes de atender.
+  device.execute_step(1, 0);
+  REQUIRE(device.get_ticks_until_next_event() == 4);
+  for (int tick = 1; tick < 5; ++tick) {
+    device.execute_step(1, tick);
+  }
+  // De 25 a 5: 2 ticks de búsqueda y 1 de servicio.
+  device.execute_step(0, 5);
+
+  REQUIRE(completion_times == std::vector<int>{5, 8});
+  REQUIRE(device.get_total_seek_time() == 5);
+  REQUIRE(device.get_total_io_time() == 3);
+}
+
+TEST_CASE("IO Device request merging", "[io][device][merge]") {
+  IODevice device("disk");
+  device.set_scheduler(std::make_unique<IOFCFSScheduler>());
+  device.set_merge_limit(12);
+
+  std::vector<std::pair<int, int>> completions;
+  device.set_completion_callback([&](std::shared_ptr<Process> proc, int time) {
+    completions.emplace_back(proc->pid, time);
+  });
+
+  auto submit = [&](int pid, int cylinder, int units) {
+    auto proc = std::make_shared<Process>(pid, "P" + std::to_string(pid), 0, 1);
+    device.add_io_request(std::make_shared<IORequest>(
+        proc, Burst(BurstType::IO, units, "disk", cylinder), 0));
+  };
+
+  submit(1, 10, 4); // [10, 14)
+  submit(2, 14, 2); // Adyacente: [10, 16)
+  submit(3, 8, 3);  // Solapada por delante: [8, 16)
+  submit(4, 40, 2); // Lejana
+  submit(5, 0, 10); // La unión [0, 16) supera el límite
+  REQUIRE(device.get_total_merges() == 2);
+  REQUIRE(device.get_queue_size() == 3);
+
+  device.execute_step(0, 0);
+  device.execute_step(0, 8);
+  device.execute_step(0, 10);
+
+  REQUIRE(completions == std::vector<std::pair<int, int>>{
+                             {1, 8}, {2, 8}, {3, 8}, {4, 10}, {5, 20}});
+  REQUIRE(device.get_total_requests_completed() == 5);
+  REQUIRE(device.get_total_io_time() == 20);
+}
+
 TEST_CASE("IO Device with Round Robin scheduling", "[io][device][rr]") {
   IODevice device("disk");
   device.set_scheduler(std::make_unique<IORoundRobinScheduler>(4));
@@ -285,3 +490,48 @@ TEST_CASE("IO Manager with multiple devices", "[io][manager]") {
   REQUIRE(completed_count == 1);
   REQUIRE_FALSE(manager.has_pending_io());
 }
+
+TEST_CASE("IO Manager batches completions across devices", "[io][manager]") {
+  IOManager manager;
+
+  auto disk_device = std::make_shared<IODevice>("disk");
+  disk_device->set_scheduler(std::make_unique<IOFCFSScheduler>());
+  auto net_device = std::make_shared<IODevice>("net");
+  net_device->set_scheduler(std::make_unique<IORoundRobinScheduler>(2));
+
+  manager.add_device("disk", disk_device);
+  manager.add_device("net", net_device);
+
+  std::vector<std::vector<std::pair<int, int>>> batches;
+  manager.set_batch_completion_callback(
+      [&](const std::vector<IOCompletion> &completions) {
+        std::vector<std::pair<int, int>> batch;
+        for (const auto &completion : completions) {
+          batch.emplace_back(completion.process->pid,
+                             completion.completion_time);
+        }
+        batches.push_back(batch);
+      });
+
+  auto proc1 = std::make_shared<Process>(1, "P1", 0, 10);
+  auto proc2 = std::make_shared<Process>(2, "P2", 0, 10);
+  auto proc3 = std::make_shared<Process>(3, "P3", 0, 10);
+  auto proc4 = std::make_shared<Process>(4, "P4", 0, 10);
+  manager.submit_io_request(
+      std::make_shared<IORequest>(proc1, Burst(BurstType::IO, 3, "disk"), 0));
+  manager.submit_io_request(
+      std::make_shared<IORequest>(proc2, Burst(BurstType::IO, 4, "disk"), 0));
+  manager.submit_io_request(
+      std::make_shared<IORequest>(proc3, Burst(BurstType::IO, 3, "net"), 0));
+  manager.submit_io_request(
+      std::make_shared<IORequest>(proc4, Burst(BurstType::IO, 2, "net"), 0));
+
+  manager.execute_all_devices(10, 0);
+
+  // Un solo lote por paso, ordenado por tiempo y, en empates, por
+  // dispositivo.
+  REQUIRE(batches.size() == 1);
+  REQUIRE(batches[0] == std::vector<std::pair<int, int>>{
+                            {1, 3}, {4, 4}, {3, 5}, {2, 7}});
+  REQUIRE_FALSE(manager.has_pending_io());
+}
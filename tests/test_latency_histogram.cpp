@@ -0,0 +1,156 @@
+/**
+ * @file test_latency_histogram.cpp
+ * @brief Tests de los percentiles de latencia: precisión del histograma,
+ * estadísticas por prioridad y su registro en el resumen de CPU.
+ */
+
+#include "metrics/latency_histogram.hpp"
+#include "metrics/metrics_collector.hpp"
+#include <algorithm>
+#include <catch2/catch_test_macros.hpp>
+#include <cmath>
+#include <filesystem>
+#include <fstream>
+#include <nlohmann/json.hpp>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace OSSimulator;
+
+namespace {
+
+int64_t nearest_rank(std::vector<int64_t> sorted, double percentile) {
+  std::sort(sorted.begin(), sorted.end());
+  auto rank = static_cast<size_t>(
+      std::ceil(percentile / 100.0 * static_cast<double>(sorted.size())));
+  return sorted[std::max<size_t>(rank, 1) - 1];
+}
+
+} // namespace
+
+TEST_CASE("Los valores pequeños se cuentan de forma exacta", "[latency]") {
+  LatencyHistogram histogram;
+  std::vector<int64_t> values;
+  for (int i = 0; i < 200; ++i) {
+    values.push_back((i * 37) % 250);
+    histogram.record(values.back());
+  }
+
+  for (double p : {1.0, 50.0, 90.0, 95.0, 99.0, 100.0})
+    REQUIRE(histogram.value_at_percentile(p) == nearest_rank(values, p));
+  REQUIRE(histogram.count() == 200);
+  REQUIRE(histogram.min() == *std::min_element(values.begin(), values.end()));
+  REQUIRE(histogram.max() == *std::max_element(values.begin(), values.end()));
+}
+
+TEST_CASE("Los valores grandes tienen error relativo acotado", "[latency]") {
+  LatencyHistogram histogram;
+  std::vector<int64_t> values;
+  std::mt19937 generator(3);
+  std::exponential_distribution<double> latency(1.0 / 5000.0);
+  int64_t sum = 0;
+  for (int i = 0; i < 20000; ++i) {
+    values.push_back(static_cast<int64_t>(latency(generator)));
+    sum += values.back();
+    histogram.record(values.back());
+  }
+
+  for (double p : {50.0, 95.0, 99.0}) {
+    double exact = static_cast<double>(nearest_rank(values, p));
+    double estimate = static_cast<double>(histogram.value_at_percentile(p));
+    REQUIRE(estimate >= exact);
+    REQUIRE(estimate - exact <= exact / 128.0 + 1.0);
+  }
+  REQUIRE(histogram.value_at_percentile(100.0) == histogram.max());
+  REQUIRE(histogram.mean() == static_cast<double>(sum) / values.size());
+}
+
+TEST_CASE("Unir histogramas equivale a registrar todos los valores",
+          "[latency]") {
+  LatencyHistogram a, b, all;
+  for (int i = 0; i < 1000; ++i) {
+    int64_t value = (i * 7919) % 100000;
+    (i % 2 ? a : b).record(value);
+    all.record(value);
+  }
+  a.merge(b);
+  REQUIRE(a.count() == all.count());
+  REQUIRE(a.sum() == all.sum());
+  for (double p : {10.0, 50.0, 99.0})
+    REQUIRE(a.value_at_percentile(p) == all.value_at_percentile(p));
+
+  LatencyHistogram empty;
+  REQUIRE(empty.value_at_percentile(50.0) == 0);
+  REQUIRE(empty.mean() == 0.0);
+}
+
+TEST_CASE("Las latencias de procesos se agrupan por prioridad", "[latency]") {
+  ProcessLatencyStats stats;
+  stats.record(1, 10, 30, 2);
+  stats.record(1, 20, 40, 4);
+  stats.record(3, 5, 15, 1);
+
+  auto rows = stats.summarize();
+  REQUIRE(rows.size() == 9);
+  REQUIRE(rows[0].scope == LatencySummary::Scope::ALL);
+  REQUIRE(rows[0].metric == "waiting");
+  REQUIRE(rows[0].count == 3);
+  REQUIRE(rows[0].max == 20);
+  REQUIRE(rows[3].scope == LatencySummary::Scope::PRIORITY);
+  REQUIRE(rows[3].key == "1");
+  REQUIRE(rows[3].p50 == 10);
+  REQUIRE(rows[8].key == "3");
+  REQUIRE(rows[8].metric == "response");
+  REQUIRE(rows[8].p99 == 1);
+  REQUIRE(stats.turnaround().mean() == 85.0 / 3.0);
+
+  stats.clear();
+  REQUIRE(stats.summarize().empty());
+}
+
+TEST_CASE("El resumen de CPU incluye los percentiles en JSONL y binario",
+          "[latency]") {
+  ProcessLatencyStats stats;
+  stats.record(2, 10, 30, 2);
+  stats.record(2, 30, 50, 6);
+  auto rows = stats.summarize();
+  LatencyHistogram delay;
+  delay.record(4);
+  rows.push_back(LatencySummary::from(LatencySummary::Scope::DEVICE, "disk",
+                                      "queue_delay", delay));
+
+  std::filesystem::create_directories("data/test/resultados");
+  const std::string jsonl = "data/test/resultados/test_latency.jsonl";
+  const std::string binary = "data/test/resultados/test_latency.bin";
+  const std::string converted = "data/test/resultados/test_latency_bin.jsonl";
+
+  for (auto format : {MetricsCollector::TraceFormat::JSONL,
+                      MetricsCollector::TraceFormat::BINARY}) {
+    MetricsCollector metrics;
+    bool is_jsonl = format == MetricsCollector::TraceFormat::JSONL;
+    REQUIRE(metrics.enable_file_output(is_jsonl ? jsonl : binary, format));
+    metrics.log_cpu_summary(100, 80.0, 20.0, 40.0, 4.0, 7, "FCFS", rows);
+    metrics.flush_all();
+    metrics.disable_output();
+  }
+  REQUIRE(MetricsCollector::convert_binary_to_jsonl(binary, converted));
+
+  std::string line, converted_line;
+  std::getline(std::ifstream(jsonl) >> std::ws, line);
+  std::getline(std::ifstream(converted) >> std::ws, converted_line);
+  REQUIRE(line == converted_line);
+
+  auto summary = nlohmann::json::parse(line);
+  REQUIRE(summary["summary"] == "CPU_METRICS");
+  const auto &latency = summary["latency"];
+  REQUIRE(latency["waiting"]["p50"] == 10);
+  REQUIRE(latency["waiting"]["max"] == 30);
+  REQUIRE(latency["by_priority"]["2"]["response"]["p99"] == 6);
+  REQUIRE(latency["io_queue_delay"]["disk"]["count"] == 1);
+  REQUIRE(latency["io_queue_delay"]["disk"]["p95"] == 4);
+
+  std::filesystem::remove(jsonl);
+  std::filesystem::remove(binary);
+  std::filesystem::remove(converted);
+}
@@ -0,0 +1,143 @@
+/**
+ * @file test_live_exporter.cpp
+ * @brief Tests del monitor en vivo: tasas por intervalo, formatos de salida y
+ * contadores publicados por el planificador.
+ */
+
+#include "core/config_parser.hpp"
+#include "core/policy_registry.hpp"
+#include "cpu/cpu_scheduler.hpp"
+#include "io/io_device.hpp"
+#include "io/io_manager.hpp"
+#include "memory/memory_manager.hpp"
+#include "metrics/live_exporter.hpp"
+#include <catch2/catch_test_macros.hpp>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <memory>
+#include <sstream>
+#include <string>
+
+using namespace OSSimulator;
+
+namespace {
+
+LiveExporter::Sample make_sample(int64_t tick, int64_t busy,
+                                 int64_t page_faults, int64_t device_busy) {
+  LiveExporter::Sample s;
+  s.time = std::chrono::steady_clock::time_point(std::chrono::seconds(tick));
+  s.tick = tick;
+  s.cpu_busy_ticks = busy;
+  s.cores = 2;
+  s.ready = 3;
+  s.page_faults = page_faults;
+  s.completed = 4;
+  s.arrived = 9;
+  s.device_busy_ticks = {device_busy};
+  s.device_queues = {5};
+  return s;
+}
+
+} // namespace
+
+TEST_CASE("Las tasas se calculan sobre el último intervalo", "[live]") {
+  LiveStats stats;
+  stats.add_device("disk");
+  auto previous = make_sample(100, 150, 10, 20);
+  auto current = make_sample(200, 300, 35, 70);
+
+  std::string line = LiveExporter::summary_line(stats, current, previous);
+  REQUIRE(line.find("[MONITOR] tick=200") == 0);
+  REQUIRE(line.find("ticks/s=1.0") != std::string::npos);
+  REQUIRE(line.find("listos=3") != std::string::npos);
+  REQUIRE(line.find("terminados=4/9") != std::string::npos);
+  REQUIRE(line.find("cpu=75.0%") != std::string::npos);
+  REQUIRE(line.find("fallos/tick=0.250") != std::string::npos);
+  REQUIRE(line.find("disk=50.0%/5") != std::string::npos);
+
+  std::string text = LiveExporter::prometheus_text(stats, current, previous);
+  REQUIRE(text.find("# TYPE ossim_tick gauge\nossim_tick 200\n") !=
+          std::string::npos);
+  REQUIRE(text.find("\nossim_cpu_utilization_ratio 0.75\n") !=
+          std::string::npos);
+  REQUIRE(text.find("\nossim_page_faults_total 35\n") != std::string::npos);
+  REQUIRE(text.find("\nossim_device_utilization_ratio{device=\"disk\"} 0.5\n") !=
+          std::string::npos);
+  REQUIRE(text.find("\nossim_device_queue{device=\"disk\"} 5\n") !=
+          std::string::npos);
+}
+
+TEST_CASE("El planificador publica sus contadores en cada paso", "[live]") {
+  SimulatorConfig config;
+  config.total_memory_frames = 64;
+  config.scheduling_algorithm = "RoundRobin";
+  config.page_replacement_algorithm = "LRU";
+  auto processes =
+      ConfigParser::load_processes_from_file("data/procesos/procesos_large.txt");
+  CPUScheduler scheduler;
+  scheduler.set_execution_mode(ExecutionMode::INLINE);
+  scheduler.set_scheduler(
+      cpu_scheduler_registry().create(config.scheduling_algorithm, config));
+  scheduler.set_core_count(config.cpu_cores);
+  auto memory_manager = std::make_shared<MemoryManager>(
+      config.total_memory_frames,
+      replacement_registry().create(config.page_replacement_algorithm, config),
+      1);
+  IODeviceConfig disk{"disk", config.io_scheduling_algorithm, config.io_quantum,
+                      1, config.io_seek_speed, config.io_cylinders};
+  auto device = std::make_shared<IODevice>("disk");
+  device->set_scheduler(
+      io_scheduler_registry().create(disk.scheduling_algorithm, disk));
+  auto io_manager = std::make_shared<IOManager>();
+  io_manager->add_device("disk", device);
+  scheduler.set_memory_manager(memory_manager);
+  scheduler.set_io_manager(io_manager);
+  scheduler.load_processes(processes);
+
+  auto stats = std::make_shared<LiveStats>();
+  scheduler.set_live_stats(stats);
+  REQUIRE(stats->devices.size() == 1);
+  REQUIRE(stats->devices[0]->name == "disk");
+
+  scheduler.run_until(20);
+  REQUIRE(stats->tick.load() == scheduler.get_current_time());
+
+  scheduler.run_until_completion();
+  REQUIRE(stats->tick.load() == scheduler.get_current_time());
+  REQUIRE(stats->completed.load() == static_cast<int64_t>(processes.size()));
+  REQUIRE(stats->arrived.load() == static_cast<int64_t>(processes.size()));
+  REQUIRE(stats->ready.load() == 0);
+  REQUIRE(stats->context_switches.load() == scheduler.get_context_switches());
+  REQUIRE(stats->page_faults.load() == memory_manager->get_total_page_faults());
+  REQUIRE(stats->devices[0]->busy_ticks.load() == device->get_total_io_time());
+  REQUIRE(stats->devices[0]->busy_ticks.load() > 0);
+}
+
+TEST_CASE("Al detenerse se exporta una última muestra", "[live]") {
+  std::filesystem::create_directories("data/test/resultados");
+  const std::string file = "data/test/resultados/test_live.prom";
+  std::filesystem::remove(file);
+
+  auto stats = std::make_shared<LiveStats>();
+  std::ostringstream lines;
+  {
+    LiveExporter exporter(stats, std::chrono::hours(1), file, lines);
+    exporter.start();
+    stats->tick.store(42);
+    exporter.stop();
+  }
+  std::ifstream in(file);
+  std::string text((std::istreambuf_iterator<char>(in)),
+                   std::istreambuf_iterator<char>());
+  REQUIRE(text.find("\nossim_tick 42\n") != std::string::npos);
+  REQUIRE(!std::filesystem::exists(file + ".tmp"));
+  REQUIRE(lines.str().empty());
+
+  LiveExporter summary(stats, std::chrono::hours(1), "", lines);
+  summary.start();
+  summary.stop();
+  REQUIRE(lines.str().find("[MONITOR] tick=42") == 0);
+  std::filesystem::remove(file);
+}
@@ -1,6 +1,13 @@
 #include "core/process.hpp"
+#include "memory/clock_replacement.hpp"
 #include "memory/fifo_replacement.hpp"
+#include "memory/free_frame_set.hpp"
+#include "memory/lru_replacement.hpp"
 #include "memory/memory_manager.hpp"
+#include "memory/nru_replacement.hpp"
+#include "memory/optimal_replacement.hpp"
+#include "memory/tlb.hpp"
+#include "memory/wsclock_replacement.hpp"
 #include <catch2/catch_test_macros.hpp>
 
 using namespace OSSimulator;
@@ -18,7 +25,7 @@ TEST_CASE("Process waits until all pages are loaded", "[memory]") {
   MemoryManager mm(2, std::move(algo), 1);
 
   bool callback_called = false;
-  mm.set_ready_callback([&](std::shared_ptr<Process> proc) {
+  mm.set_ready_callback([&](const std::shared_ptr<Process> &proc, Tick) {
     REQUIRE(proc);
     callback_called = true;
     proc->state = ProcessState::READY;
@@ -69,3 +76,719 @@ TEST_CASE("Referenced pages block eviction until released", "[memory]") {
   REQUIRE(procB->active_pages_count == 1);
   REQUIRE(mm.get_total_replacements() == 1);
 }
+
+TEST_CASE("Processes mapping a shared region load its pages once",
+          "[memory]") {
+  MemoryManager mm(4, std::make_unique<FIFOReplacement>(), 1);
+
+  auto procA = std::make_shared<Process>(1, "A", 0, 5, 0, 2);
+  auto procB = std::make_shared<Process>(2, "B", 0, 5, 0, 3);
+  procA->shared_mappings = {{"lib", 0, 2}};
+  procB->shared_mappings = {{"lib", 1, 2}};
+  for (const auto &proc : {procA, procB}) {
+    mm.allocate_initial_memory(*proc);
+    mm.register_process(proc);
+  }
+
+  REQUIRE_FALSE(mm.prepare_process_for_cpu(procA, 0));
+  mm.advance_fault_queue(2, 0);
+  REQUIRE(mm.prepare_process_for_cpu(procA, 2));
+
+  // B solo falla en su página privada; las compartidas ya están cargadas.
+  REQUIRE_FALSE(mm.prepare_process_for_cpu(procB, 2));
+  REQUIRE(procB->page_faults == 1);
+  REQUIRE(procB->page_table[1].get_frame_number() ==
+          procA->page_table[0].get_frame_number());
+  REQUIRE(procB->page_table[2].get_frame_number() ==
+          procA->page_table[1].get_frame_number());
+  mm.advance_fault_queue(1, 2);
+  REQUIRE(mm.prepare_process_for_cpu(procB, 3));
+  REQUIRE(mm.get_total_page_faults() == 3);
+  REQUIRE(mm.get_peak_used_frames() == 3);
+}
+
+TEST_CASE("Writing a shared page copies it on write", "[memory]") {
+  MemoryManager mm(4, std::make_unique<FIFOReplacement>(), 1);
+  mm.set_demand_paging(true);
+
+  auto reader = std::make_shared<Process>(
+      1, "R", 0, std::vector<Burst>{Burst(BurstType::CPU, 4)}, 0, 1);
+  auto writer = std::make_shared<Process>(
+      2, "W", 0, std::vector<Burst>{Burst(BurstType::CPU, 4)}, 0, 1);
+  reader->memory_access_trace = {0, 0};
+  reader->memory_write_trace = {false, true};
+  writer->memory_access_trace = {0};
+  writer->memory_write_trace = {true};
+  for (const auto &proc : {reader, writer}) {
+    proc->shared_mappings = {{"heap", 0, 1}};
+    mm.allocate_initial_memory(*proc);
+    mm.register_process(proc);
+  }
+
+  REQUIRE_FALSE(mm.prepare_process_for_cpu(reader, 0));
+  mm.advance_fault_queue(1, 0);
+  REQUIRE(mm.prepare_process_for_cpu(reader, 1));
+  mm.mark_process_inactive(*reader);
+
+  // La página está residente y compartida: escribirla pide una copia.
+  REQUIRE_FALSE(mm.prepare_process_for_cpu(writer, 1));
+  REQUIRE(writer->page_faults == 1);
+  REQUIRE(mm.get_cow_faults() == 1);
+  mm.advance_fault_queue(1, 1);
+  REQUIRE(mm.prepare_process_for_cpu(writer, 2));
+  REQUIRE(writer->page_table[0].get_frame_number() !=
+          reader->page_table[0].get_frame_number());
+  REQUIRE(writer->page_table[0].is_modified());
+  REQUIRE(writer->active_pages_count == 1);
+
+  // El lector quedó como único mapeador: escribe sin copiar.
+  REQUIRE(mm.prepare_process_for_cpu(reader, 2));
+  REQUIRE(mm.access_pages(*reader, 2, 2) == 2);
+  REQUIRE(reader->page_table[0].is_modified());
+  REQUIRE(mm.get_cow_faults() == 1);
+  REQUIRE(mm.get_total_page_faults() == 2);
+}
+
+TEST_CASE("Evicting a shared frame unmaps it from every process",
+          "[memory]") {
+  MemoryManager mm(2, std::make_unique<FIFOReplacement>(), 1);
+
+  auto procA = std::make_shared<Process>(1, "A", 0, 5, 0, 1);
+  auto procB = std::make_shared<Process>(2, "B", 0, 5, 0, 1);
+  auto procC = std::make_shared<Process>(3, "C", 0, 5, 0, 2);
+  procA->shared_mappings = {{"lib", 0, 1}};
+  procB->shared_mappings = {{"lib", 0, 1}};
+  for (const auto &proc : {procA, procB, procC}) {
+    mm.allocate_initial_memory(*proc);
+    mm.register_process(proc);
+  }
+
+  REQUIRE_FALSE(mm.prepare_process_for_cpu(procA, 0));
+  mm.advance_fault_queue(1, 0);
+  REQUIRE(mm.prepare_process_for_cpu(procA, 1));
+  REQUIRE(mm.prepare_process_for_cpu(procB, 1));
+
+  // El marco sigue referenciado mientras B esté en CPU.
+  mm.mark_process_inactive(*procA);
+  REQUIRE_FALSE(mm.prepare_process_for_cpu(procC, 1));
+  mm.advance_fault_queue(2, 1);
+  REQUIRE(procC->active_pages_count == 1);
+  REQUIRE(mm.get_total_replacements() == 0);
+
+  mm.mark_process_inactive(*procB);
+  mm.advance_fault_queue(1, 3);
+  REQUIRE(procC->active_pages_count == 2);
+  REQUIRE(mm.get_total_replacements() == 1);
+  REQUIRE_FALSE(procA->page_table[0].is_valid());
+  REQUIRE_FALSE(procB->page_table[0].is_valid());
+  REQUIRE(procA->active_pages_count == 0);
+  REQUIRE(procB->active_pages_count == 0);
+}
+
+TEST_CASE("A shared frame passes to another mapper when its owner exits",
+          "[memory]") {
+  MemoryManager mm(1, std::make_unique<FIFOReplacement>(), 1);
+
+  auto procA = std::make_shared<Process>(1, "A", 0, 5, 0, 1);
+  auto procB = std::make_shared<Process>(2, "B", 0, 5, 0, 1);
+  auto procC = std::make_shared<Process>(3, "C", 0, 5, 0, 1);
+  procA->shared_mappings = {{"lib", 0, 1}};
+  procB->shared_mappings = {{"lib", 0, 1}};
+  for (const auto &proc : {procA, procB, procC}) {
+    mm.allocate_initial_memory(*proc);
+    mm.register_process(proc);
+  }
+
+  REQUIRE_FALSE(mm.prepare_process_for_cpu(procA, 0));
+  mm.advance_fault_queue(1, 0);
+  REQUIRE(mm.prepare_process_for_cpu(procA, 1));
+  REQUIRE(mm.prepare_process_for_cpu(procB, 1));
+  mm.mark_process_inactive(*procA);
+  mm.mark_process_inactive(*procB);
+  mm.release_process_memory(procA->pid);
+  REQUIRE(procB->page_table[0].is_valid());
+
+  // El reemplazo se cuenta al nuevo dueño.
+  REQUIRE_FALSE(mm.prepare_process_for_cpu(procC, 2));
+  mm.advance_fault_queue(1, 2);
+  REQUIRE(procC->active_pages_count == 1);
+  REQUIRE_FALSE(procB->page_table[0].is_valid());
+  REQUIRE(procB->replacements == 1);
+  REQUIRE(procA->replacements == 0);
+}
+
+TEST_CASE("Page loads with latency complete in a single long advance",
+          "[memory]") {
+  auto algo = std::make_unique<FIFOReplacement>();
+  MemoryManager mm(4, std::move(algo), 3);
+
+  int ready_calls = 0;
+  mm.set_ready_callback([&](const std::shared_ptr<Process> &proc, Tick) {
+    ready_calls++;
+    proc->state = ProcessState::READY;
+  });
+
+  auto proc = std::make_shared<Process>(1, "P1", 0, 5, 0, 2);
+  mm.allocate_initial_memory(*proc);
+  mm.register_process(proc);
+
+  REQUIRE_FALSE(mm.prepare_process_for_cpu(proc, 0));
+  REQUIRE(mm.get_next_event_time(0) == 0);
+
+  mm.advance_fault_queue(2, 0);
+  REQUIRE(proc->active_pages_count == 0);
+  REQUIRE(mm.get_next_event_time(2) == 2);
+
+  mm.advance_fault_queue(100, 2);
+  REQUIRE(proc->active_pages_count == 2);
+  REQUIRE(ready_calls == 1);
+  REQUIRE(mm.get_next_event_time(102) == -1);
+  REQUIRE(mm.prepare_process_for_cpu(proc, 102));
+}
+
+TEST_CASE("Parallel fault channels overlap page loads", "[memory]") {
+  auto algo = std::make_unique<FIFOReplacement>();
+  MemoryManager mm(4, std::move(algo), 3);
+  mm.set_fault_channels(2);
+
+  int ready_calls = 0;
+  mm.set_ready_callback([&](const std::shared_ptr<Process> &proc, Tick) {
+    ready_calls++;
+    proc->state = ProcessState::READY;
+  });
+
+  auto proc = std::make_shared<Process>(1, "P1", 0, 5, 0, 4);
+  mm.allocate_initial_memory(*proc);
+  mm.register_process(proc);
+
+  REQUIRE_FALSE(mm.prepare_process_for_cpu(proc, 0));
+  mm.advance_fault_queue(3, 0);
+  REQUIRE(proc->active_pages_count == 2);
+  REQUIRE(mm.get_next_event_time(3) == 5);
+
+  mm.advance_fault_queue(3, 3);
+  REQUIRE(proc->active_pages_count == 4);
+  REQUIRE(ready_calls == 1);
+  REQUIRE(mm.get_total_page_faults() == 4);
+}
+
+TEST_CASE("Prefetch loads a process's missing pages in one batch",
+          "[memory]") {
+  auto algo = std::make_unique<FIFOReplacement>();
+  MemoryManager mm(4, std::move(algo), 3);
+  mm.set_prefetch_pages(3);
+
+  int ready_calls = 0;
+  mm.set_ready_callback([&](const std::shared_ptr<Process> &proc, Tick) {
+    ready_calls++;
+    proc->state = ProcessState::READY;
+  });
+
+  auto proc = std::make_shared<Process>(1, "P1", 0, 5, 0, 4);
+  mm.allocate_initial_memory(*proc);
+  mm.register_process(proc);
+
+  // Un lote de 3 páginas y otro con la restante.
+  REQUIRE_FALSE(mm.prepare_process_for_cpu(proc, 0));
+  mm.advance_fault_queue(3, 0);
+  REQUIRE(proc->active_pages_count == 3);
+  REQUIRE(ready_calls == 0);
+
+  mm.advance_fault_queue(3, 3);
+  REQUIRE(proc->active_pages_count == 4);
+  REQUIRE(ready_calls == 1);
+  REQUIRE(mm.get_total_page_faults() == 4);
+}
+
+TEST_CASE("Demand paging faults only on referenced pages", "[memory]") {
+  auto algo = std::make_unique<FIFOReplacement>();
+  MemoryManager mm(4, std::move(algo), 1);
+  mm.set_demand_paging(true);
+
+  auto proc = std::make_shared<Process>(
+      1, "P1", 0, std::vector<Burst>{Burst(BurstType::CPU, 4)}, 0, 4);
+  proc->memory_access_trace = {0, 0, 1, 0};
+  mm.allocate_initial_memory(*proc);
+  mm.register_process(proc);
+
+  REQUIRE_FALSE(mm.prepare_process_for_cpu(proc, 0));
+  REQUIRE(proc->page_faults == 1);
+  mm.advance_fault_queue(1, 0);
+  REQUIRE(mm.prepare_process_for_cpu(proc, 1));
+
+  // El tercer acceso (página 1) no está residente: solo corren dos ticks.
+  REQUIRE(mm.access_pages(*proc, 4, 1) == 2);
+  proc->execute(2, 1);
+
+  REQUIRE_FALSE(mm.prepare_process_for_cpu(proc, 3));
+  REQUIRE(proc->page_faults == 2);
+  mm.advance_fault_queue(1, 3);
+  REQUIRE(mm.prepare_process_for_cpu(proc, 4));
+  REQUIRE(mm.access_pages(*proc, 2, 4) == 2);
+
+  REQUIRE(proc->active_pages_count == 2);
+  REQUIRE(mm.get_total_page_faults() == 2);
+}
+
+TEST_CASE("Huge pages map a region with one entry and one fault",
+          "[memory]") {
+  MemoryManager mm(16, std::make_unique<LRUReplacement>(), 1);
+  mm.set_huge_pages(4, 2, std::make_unique<LRUReplacement>());
+  mm.set_fault_channels(4);
+
+  auto proc = std::make_shared<Process>(
+      1, "P1", 0, std::vector<Burst>{Burst(BurstType::CPU, 4)}, 0, 10);
+  proc->memory_access_trace = {9, 0, 5, 3};
+  mm.allocate_initial_memory(*proc);
+  mm.register_process(proc);
+
+  // Dos regiones de 4 páginas y 2 páginas base: 4 entradas.
+  REQUIRE(proc->page_table.size() == 4);
+  REQUIRE(proc->page_table.first_page(1) == 4);
+  REQUIRE(proc->page_table.entry_size(1) == 4);
+  REQUIRE(proc->page_table.first_page(3) == 9);
+  REQUIRE(proc->page_table.entry_size(3) == 1);
+
+  REQUIRE_FALSE(mm.prepare_process_for_cpu(proc, 0));
+  mm.advance_fault_queue(1, 0);
+  REQUIRE(mm.prepare_process_for_cpu(proc, 1));
+  REQUIRE(mm.get_total_page_faults() == 4);
+
+  // Los marcos grandes van tras los 8 marcos base.
+  REQUIRE(proc->page_table[0].get_frame_number() >= 8);
+  REQUIRE(proc->page_table[1].get_frame_number() >= 8);
+  REQUIRE(proc->page_table[2].get_frame_number() < 8);
+  REQUIRE(mm.get_peak_used_frames() == 10);
+  REQUIRE(mm.access_pages(*proc, 4, 1) == 4);
+
+  // Sin marcos grandes libres, la región de otro proceso reemplaza una
+  // página grande y no una base.
+  mm.mark_process_inactive(*proc);
+  auto other = std::make_shared<Process>(2, "P2", 0, 5, 0, 4);
+  mm.allocate_initial_memory(*other);
+  mm.register_process(other);
+  REQUIRE(other->page_table.size() == 1);
+  REQUIRE_FALSE(mm.prepare_process_for_cpu(other, 2));
+  mm.advance_fault_queue(1, 2);
+  REQUIRE(other->page_table[0].get_frame_number() >= 8);
+  REQUIRE(mm.get_total_replacements() == 1);
+  REQUIRE(proc->page_table[2].is_valid());
+  REQUIRE(proc->page_table[3].is_valid());
+}
+
+TEST_CASE("Page table entries are packed in one word", "[memory]") {
+  REQUIRE(sizeof(Page) == 4);
+
+  Page page;
+  REQUIRE(page.get_frame_number() == -1);
+  page.set_frame_number(12345);
+  page.set_valid(true);
+  page.set_modified(true);
+  REQUIRE(page.get_frame_number() == 12345);
+  REQUIRE(page.is_valid());
+  REQUIRE_FALSE(page.is_referenced());
+  REQUIRE(page.is_modified());
+  page.set_valid(false);
+  page.set_frame_number(-1);
+  REQUIRE(page.get_frame_number() == -1);
+  REQUIRE(page.is_modified());
+
+  // Un proceso de 1M páginas ocupa 4 MB; los tiempos de acceso son aparte.
+  PageTable table;
+  table.reset(1 << 20);
+  REQUIRE(table.memory_bytes() == (4u << 20));
+  REQUIRE(table.last_access_time(7) == -1);
+  table.reset(1 << 20, 0, 1, true);
+  table.touch(7, 42);
+  REQUIRE(table.last_access_time(7) == 42);
+  // Cada tiempo de acceso es un Tick de 8 bytes.
+  REQUIRE(table.memory_bytes() == (12u << 20));
+
+  table.reset(10, 2, 4);
+  REQUIRE(table.size() == 4);
+  REQUIRE(table.entry_for_page(5) == 1);
+  REQUIRE(table.entry_for_page(9) == 3);
+  REQUIRE(table.entry_for_page(10) == -1);
+}
+
+TEST_CASE("Load control defers arrivals whose working set does not fit",
+          "[memory]") {
+  auto algo = std::make_unique<FIFOReplacement>();
+  MemoryManager mm(4, std::move(algo), 1);
+  mm.set_demand_paging(true);
+  mm.set_load_control(true, 4);
+
+  auto make = [&mm](int pid, std::vector<int> trace) {
+    auto proc = std::make_shared<Process>(
+        pid, "P" + std::to_string(pid), 0,
+        std::vector<Burst>{Burst(BurstType::CPU, 8)}, 0, 6);
+    proc->memory_access_trace = std::move(trace);
+    mm.allocate_initial_memory(*proc);
+    return proc;
+  };
+
+  // Conjuntos de trabajo de 3, 2 y 1 páginas en 4 marcos.
+  auto first = make(1, {0, 1, 2, 0});
+  auto second = make(2, {0, 1, 0, 1});
+  auto third = make(3, {5, 5, 5, 5});
+
+  REQUIRE(mm.admit_process(*first, 0));
+  REQUIRE_FALSE(mm.admit_process(*second, 1));
+  REQUIRE_FALSE(mm.admit_process(*second, 2));
+  REQUIRE(mm.admit_process(*third, 2));
+  REQUIRE(mm.get_deferred_admissions() == 1);
+
+  mm.register_process(first);
+  mm.unregister_process(first->pid);
+  REQUIRE(mm.admit_process(*second, 5));
+  REQUIRE(mm.get_deferral_ticks() == 4);
+
+  // Sin control de carga todo se admite.
+  MemoryManager open(1, std::make_unique<FIFOReplacement>(), 1);
+  REQUIRE(open.admit_process(*first, 0));
+  REQUIRE(open.admit_process(*second, 0));
+}
+
+TEST_CASE("TLB caches translations per set and per address space",
+          "[memory]") {
+  // 4 entradas en 2 conjuntos de 2 vías: las páginas pares van al conjunto 0.
+  TLB tlb(4, 2, false);
+  REQUIRE_FALSE(tlb.translate(1, 0));
+  REQUIRE_FALSE(tlb.translate(1, 2));
+  REQUIRE(tlb.translate(1, 0));
+  REQUIRE_FALSE(tlb.translate(1, 4)); // Reemplaza la página 2 (LRU).
+  REQUIRE(tlb.translate(1, 0));
+  REQUIRE_FALSE(tlb.translate(1, 2));
+  tlb.invalidate(1, 2);
+  REQUIRE_FALSE(tlb.translate(1, 2));
+  REQUIRE(tlb.get_hits() == 2);
+  REQUIRE(tlb.get_misses() == 5);
+
+  // Sin ASID el cambio de contexto vacía la TLB; con ASID no.
+  tlb.switch_context();
+  REQUIRE_FALSE(tlb.translate(1, 2));
+  TLB tagged(4, 2, true);
+  tagged.translate(1, 1);
+  tagged.translate(2, 1);
+  tagged.switch_context();
+  REQUIRE(tagged.translate(1, 1));
+  REQUIRE(tagged.translate(2, 1));
+  tagged.invalidate_process(2);
+  REQUIRE_FALSE(tagged.translate(2, 1));
+
+  // El gestor consulta la TLB en cada acceso, también sin paginación por
+  // demanda, y la invalida al desalojar la página.
+  MemoryManager mm(8, std::make_unique<FIFOReplacement>(), 1);
+  mm.set_tlb(4, 2, false);
+  auto proc = std::make_shared<Process>(
+      1, "P1", 0, std::vector<Burst>{Burst(BurstType::CPU, 8)}, 0, 3);
+  proc->memory_access_trace = {0, 1, 0, 1, 2, 0};
+  mm.allocate_initial_memory(*proc);
+  mm.register_process(proc);
+  REQUIRE_FALSE(mm.prepare_process_for_cpu(proc, 0));
+  mm.advance_fault_queue(3, 0);
+  REQUIRE(mm.prepare_process_for_cpu(proc, 3));
+  REQUIRE(mm.access_pages(*proc, 6, 3) == 6);
+  REQUIRE(mm.get_tlb_misses() == 3);
+  REQUIRE(mm.get_tlb_hits() == 3);
+  mm.switch_context(0);
+  REQUIRE(mm.access_pages(*proc, 1, 9) == 1);
+  REQUIRE(mm.get_tlb_misses() == 4);
+}
+
+TEST_CASE("NUMA first touch places pages on the faulting core's node",
+          "[memory]") {
+  // Dos nodos de 4 marcos; el núcleo 1 pertenece al nodo 1 (marcos 4 a 7).
+  MemoryManager mm(8, std::make_unique<FIFOReplacement>(), 1);
+  mm.set_numa(2, NumaPolicy::FIRST_TOUCH, 2, 2);
+  auto proc = std::make_shared<Process>(1, "P1", 0, 5, 0, 2);
+  mm.allocate_initial_memory(*proc);
+  mm.register_process(proc);
+
+  REQUIRE_FALSE(mm.prepare_process_for_cpu(proc, 0, 1));
+  mm.advance_fault_queue(2, 0);
+  REQUIRE(proc->page_table[0].get_frame_number() == 4);
+  REQUIRE(proc->page_table[1].get_frame_number() == 5);
+
+  // En su nodo no hay espera; desde el núcleo 0 el acceso es remoto y la
+  // latencia se cobra una sola vez.
+  Tick stall = -1;
+  REQUIRE(mm.prepare_process_for_cpu(proc, 2, 1, &stall));
+  REQUIRE(stall == 0);
+  REQUIRE(mm.prepare_process_for_cpu(proc, 2, 0, &stall));
+  REQUIRE(stall == 2);
+  REQUIRE(mm.prepare_process_for_cpu(proc, 3, 0, &stall));
+  REQUIRE(stall == 0);
+  REQUIRE(mm.access_pages(*proc, 1, 4, 0) == 1);
+
+  const auto &stats = mm.get_numa_stats();
+  REQUIRE(stats.size() == 2);
+  REQUIRE(stats[0].frames == 4);
+  REQUIRE(stats[1].page_faults == 2);
+  REQUIRE(stats[1].remote_loads == 0);
+  REQUIRE(stats[0].remote_accesses == 1);
+  REQUIRE(stats[0].local_accesses == 0);
+  REQUIRE(stats[0].remote_stall_ticks == 2);
+}
+
+TEST_CASE("NUMA interleave alternates nodes and falls back when one is full",
+          "[memory]") {
+  MemoryManager mm(4, std::make_unique<FIFOReplacement>(), 1);
+  mm.set_numa(2, NumaPolicy::INTERLEAVE, 3, 1);
+  auto first = std::make_shared<Process>(1, "P1", 0, 5, 0, 3);
+  mm.allocate_initial_memory(*first);
+  mm.register_process(first);
+  REQUIRE_FALSE(mm.prepare_process_for_cpu(first, 0));
+  // La página 1 va al nodo 1, remoto para el núcleo 0: tarda 1 + 3 ticks.
+  mm.advance_fault_queue(5, 0);
+  REQUIRE_FALSE(first->page_table[2].is_valid());
+  mm.advance_fault_queue(1, 5);
+  REQUIRE(first->page_table[0].get_frame_number() == 0);
+  REQUIRE(first->page_table[1].get_frame_number() == 2);
+  REQUIRE(first->page_table[2].get_frame_number() == 1);
+
+  // El nodo 0 está lleno: la página 0 del segundo proceso va al nodo 1.
+  auto second = std::make_shared<Process>(2, "P2", 0, 5, 0, 1);
+  mm.allocate_initial_memory(*second);
+  mm.register_process(second);
+  REQUIRE_FALSE(mm.prepare_process_for_cpu(second, 6));
+  mm.advance_fault_queue(4, 6);
+  REQUIRE(second->page_table[0].get_frame_number() == 3);
+  REQUIRE(mm.get_numa_stats()[0].remote_loads == 2);
+  REQUIRE(mm.get_numa_stats()[0].page_faults == 4);
+}
+
+TEST_CASE("FreeFrameSet returns the lowest free frame", "[memory]") {
+  FreeFrameSet set(5000);
+  REQUIRE(set.free_count() == 5000);
+  REQUIRE(set.first_free() == 0);
+
+  for (int i = 0; i < 4200; ++i) {
+    set.mark_used(i);
+  }
+  REQUIRE(set.first_free() == 4200);
+  REQUIRE(set.free_count() == 800);
+
+  set.mark_free(4097);
+  set.mark_free(63);
+  REQUIRE(set.first_free() == 63);
+  set.mark_used(63);
+  REQUIRE(set.first_free() == 4097);
+
+  for (int i = 0; i < 5000; ++i) {
+    set.mark_used(i);
+  }
+  REQUIRE(set.free_count() == 0);
+  REQUIRE(set.first_free() == -1);
+  REQUIRE_FALSE(set.is_free(-1));
+  REQUIRE_FALSE(set.is_free(5000));
+}
+
+TEST_CASE("Released frames are reused lowest first", "[memory]") {
+  auto algo = std::make_unique<FIFOReplacement>();
+  MemoryManager mm(1 << 20, std::move(algo), 1);
+
+  auto load = [&mm](const std::shared_ptr<Process> &proc, int start) {
+    mm.allocate_initial_memory(*proc);
+    mm.register_process(proc);
+    REQUIRE_FALSE(mm.prepare_process_for_cpu(proc, start));
+    mm.advance_fault_queue(static_cast<int>(proc->memory_required), start);
+    REQUIRE(proc->active_pages_count ==
+            static_cast<int>(proc->memory_required));
+  };
+
+  auto procA = std::make_shared<Process>(1, "A", 0, 5, 0, 2);
+  auto procB = std::make_shared<Process>(2, "B", 0, 5, 0, 1);
+  load(procA, 0);
+  load(procB, 2);
+  REQUIRE(procA->page_table[0].get_frame_number() == 0);
+  REQUIRE(procA->page_table[1].get_frame_number() == 1);
+  REQUIRE(procB->page_table[0].get_frame_number() == 2);
+
+  mm.mark_process_inactive(*procA);
+  mm.release_process_memory(procA->pid);
+
+  auto procC = std::make_shared<Process>(3, "C", 0, 5, 0, 3);
+  load(procC, 3);
+  REQUIRE(procC->page_table[0].get_frame_number() == 0);
+  REQUIRE(procC->page_table[1].get_frame_number() == 1);
+  REQUIRE(procC->page_table[2].get_frame_number() == 3);
+  REQUIRE(mm.get_total_replacements() == 0);
+}
+
+TEST_CASE("LRU picks the least recently loaded unreferenced frame",
+          "[memory]") {
+  auto proc = std::make_shared<Process>(1, "A", 0, 5, 0, 3);
+  proc->page_table.reset(3);
+  std::unordered_map<int, std::shared_ptr<Process>> process_map{{1, proc}};
+  std::vector<Frame> frames = {{0, 1, 0, true}, {1, 1, 1, true},
+                               {2, 1, 2, true}};
+
+  LRUReplacement lru;
+  lru.on_page_access(2);
+  lru.on_page_access(0);
+  lru.on_page_access(1);
+  REQUIRE(lru.select_victim(frames, process_map, 0) == 2);
+
+  lru.on_page_access(2);
+  REQUIRE(lru.select_victim(frames, process_map, 0) == 0);
+
+  proc->page_table[0].set_referenced(true);
+  REQUIRE(lru.select_victim(frames, process_map, 0) == 1);
+
+  lru.on_frame_release(1);
+  lru.on_frame_release(2);
+  REQUIRE(lru.select_victim(frames, process_map, 0) == -1);
+}
+
+TEST_CASE("FIFO ring keeps arrival order across releases", "[memory]") {
+  std::unordered_map<int, std::shared_ptr<Process>> process_map;
+  std::vector<Frame> frames;
+  for (int i = 0; i < 20; ++i)
+    frames.push_back({i, 1, i, true});
+
+  FIFOReplacement fifo;
+  REQUIRE(fifo.select_victim(frames, process_map, 0) == -1);
+
+  for (int i = 0; i < 20; ++i)
+    fifo.on_page_access(i);
+  fifo.on_page_access(0);
+  REQUIRE(fifo.select_victim(frames, process_map, 0) == 0);
+
+  for (int i = 0; i < 19; i += 2)
+    fifo.on_frame_release(i);
+  REQUIRE(fifo.select_victim(frames, process_map, 0) == 1);
+
+  // Reencolar liberados obliga a compactar el anillo.
+  for (int i = 0; i < 19; i += 2)
+    fifo.on_page_access(i);
+  fifo.on_frame_release(1);
+  REQUIRE(fifo.select_victim(frames, process_map, 0) == 3);
+
+  for (int i = 3; i < 20; i += 2)
+    fifo.on_frame_release(i);
+  REQUIRE(fifo.select_victim(frames, process_map, 0) == 0);
+
+  frames[0].occupied = false;
+  REQUIRE(fifo.select_victim(frames, process_map, 0) == -1);
+}
+
+TEST_CASE("Optimal evicts the page whose next use is farthest", "[memory]") {
+  auto proc = std::make_shared<Process>(1, "A", 0, 5, 0, 4);
+  proc->page_table.reset(4);
+  proc->memory_access_trace = {0, 1, 2, 0, 1, 0, 3};
+  for (int i = 0; i < 4; ++i) {
+    proc->page_table[i].set_valid(true);
+    proc->page_table[i].set_frame_number(i);
+  }
+  std::unordered_map<int, std::shared_ptr<Process>> process_map{{1, proc}};
+  std::vector<Frame> frames = {{0, 1, 0, true},
+                               {1, 1, 1, true},
+                               {2, 1, 2, true},
+                               {3, 1, 3, true}};
+
+  OptimalReplacement opt;
+  opt.on_process_referenced(*proc, false);
+  REQUIRE(opt.select_victim(frames, process_map, 0) == 3);
+
+  opt.on_process_referenced(*proc, true);
+  REQUIRE(opt.select_victim(frames, process_map, 0) == -1);
+
+  // Tras consumir tres accesos la página 2 ya no vuelve a usarse.
+  proc->current_access_index = 3;
+  opt.on_process_referenced(*proc, false);
+  REQUIRE(opt.select_victim(frames, process_map, 0) == 2);
+
+  opt.on_frame_release(2);
+  REQUIRE(opt.select_victim(frames, process_map, 0) == 3);
+}
+
+TEST_CASE("NRU prefers unmodified frames and is reproducible", "[memory]") {
+  auto proc = std::make_shared<Process>(1, "A", 0, 5, 0, 100);
+  std::unordered_map<int, std::shared_ptr<Process>> process_map{{1, proc}};
+  std::vector<Frame> frames;
+  proc->page_table.reset(100);
+  for (int i = 0; i < 100; ++i) {
+    Page &page = proc->page_table[i];
+    page.set_valid(true);
+    page.set_frame_number(i);
+    page.set_modified(i % 10 != 7);
+    frames.push_back({i, 1, i, true});
+  }
+
+  NRUReplacement first(7);
+  NRUReplacement second(7);
+  first.on_process_referenced(*proc, false);
+  second.on_process_referenced(*proc, false);
+
+  for (int round = 0; round < 20; ++round) {
+    int victim = first.select_victim(frames, process_map, 0);
+    REQUIRE(victim % 10 == 7);
+    REQUIRE(second.select_victim(frames, process_map, 0) == victim);
+  }
+
+  for (int i = 7; i < 100; i += 10) {
+    first.on_frame_release(i);
+  }
+  int victim = first.select_victim(frames, process_map, 0);
+  REQUIRE(victim != -1);
+  REQUIRE(victim % 10 != 7);
+
+  first.on_process_referenced(*proc, true);
+  REQUIRE(first.select_victim(frames, process_map, 0) == -1);
+}
+
+TEST_CASE("Clock gives used frames a second chance", "[memory]") {
+  auto proc = std::make_shared<Process>(1, "A", 0, 5, 0, 3);
+  proc->page_table.reset(3);
+  for (int i = 0; i < 3; ++i) {
+    proc->page_table[i].set_valid(true);
+    proc->page_table[i].set_frame_number(i);
+  }
+  std::unordered_map<int, std::shared_ptr<Process>> process_map{{1, proc}};
+  std::vector<Frame> frames = {{0, 1, 0, true}, {1, 1, 1, true},
+                               {2, 1, 2, true}};
+
+  ClockReplacement clock;
+  for (int i = 0; i < 3; ++i)
+    clock.on_page_access(i);
+  REQUIRE(clock.select_victim(frames, process_map, 0) == -1);
+
+  clock.on_process_referenced(*proc, false);
+  REQUIRE(clock.select_victim(frames, process_map, 0) == 0);
+
+  clock.on_page_access(1);
+  clock.on_process_referenced(*proc, false);
+  REQUIRE(clock.select_victim(frames, process_map, 0) == 2);
+  REQUIRE(clock.select_victim(frames, process_map, 0) == 0);
+}
+
+TEST_CASE("WSClock evicts clean frames outside the working set", "[memory]") {
+  auto proc = std::make_shared<Process>(1, "A", 0, 5, 0, 3);
+  proc->page_table.reset(3);
+  for (int i = 0; i < 3; ++i) {
+    proc->page_table[i].set_valid(true);
+    proc->page_table[i].set_frame_number(i);
+  }
+  proc->page_table[0].set_modified(true);
+  std::unordered_map<int, std::shared_ptr<Process>> process_map{{1, proc}};
+  std::vector<Frame> frames = {{0, 1, 0, true}, {1, 1, 1, true},
+                               {2, 1, 2, true}};
+
+  WSClockReplacement wsclock(5);
+  for (int i = 0; i < 3; ++i)
+    wsclock.on_page_access(i);
+  wsclock.on_process_referenced(*proc, false);
+
+  // Dentro de la ventana no hay candidatos viejos: se elige el primero libre
+  // de uso.
+  REQUIRE(wsclock.select_victim(frames, process_map, 0) == 0);
+
+  // Fuera de la ventana se salta el marco modificado.
+  REQUIRE(wsclock.select_victim(frames, process_map, 20) == 1);
+
+  proc->page_table[1].set_modified(true);
+  proc->page_table[2].set_modified(true);
+  int dirty = wsclock.select_victim(frames, process_map, 40);
+  REQUIRE(dirty != -1);
+}
@@ -17,6 +17,7 @@
 #include <catch2/catch_test_macros.hpp>
 #include <filesystem>
 #include <fstream>
+#include <map>
 #include <nlohmann/json.hpp>
 
 using namespace OSSimulator;
@@ -123,6 +124,59 @@ TEST_CASE("MetricsCollector - CPU Logging", "[metrics][cpu]") {
   }
 }
 
+TEST_CASE("MetricsCollector - Interned names", "[metrics][names]") {
+  NameId id = name_table().intern("Interned");
+  REQUIRE(name_table().intern("Interned") == id);
+  REQUIRE(name_table().name(id) == "Interned");
+  REQUIRE(name_table().intern("") == NameTable::EMPTY);
+
+  Process proc(7, "Interned", 0, 5, 1, 1024);
+  REQUIRE(proc.name_id == id);
+
+  std::filesystem::create_directories("data/test/resultados");
+  const std::string path = "data/test/resultados/test_names.jsonl";
+  const std::string binary_path = "data/test/resultados/test_names.bin";
+  const std::string converted_path =
+      "data/test/resultados/test_names_converted.jsonl";
+  auto log_names = [&](MetricsCollector &metrics) {
+    metrics.log_cpu(0, "EXEC", proc.pid, proc.name_id, 5, 0, false);
+    metrics.log_io(0, name_table().intern("disk"), "STEP", proc.pid,
+                   proc.name_id, 3, 0);
+    metrics.log_state_transition(1, proc.pid, proc.name_id,
+                                 ProcessState::RUNNING, ProcessState::WAITING,
+                                 "io_request");
+  };
+
+  MetricsCollector metrics;
+  REQUIRE(metrics.enable_file_output(path));
+  log_names(metrics);
+  metrics.disable_output();
+
+  std::ifstream in(path);
+  std::string line;
+  REQUIRE(std::getline(in, line));
+  json j = json::parse(line);
+  REQUIRE(j["cpu"]["name"] == "Interned");
+  REQUIRE(j["io"]["device"] == "disk");
+  REQUIRE(j["io"]["name"] == "Interned");
+  REQUIRE(std::getline(in, line));
+  REQUIRE(json::parse(line)["state_transitions"][0]["name"] == "Interned");
+
+  MetricsCollector binary_metrics;
+  REQUIRE(binary_metrics.enable_file_output(
+      binary_path, MetricsCollector::TraceFormat::BINARY));
+  log_names(binary_metrics);
+  binary_metrics.disable_output();
+  REQUIRE(MetricsCollector::convert_binary_to_jsonl(binary_path,
+                                                    converted_path));
+  std::ifstream a(path), b(converted_path);
+  std::string expected((std::istreambuf_iterator<char>(a)),
+                       std::istreambuf_iterator<char>());
+  std::string actual((std::istreambuf_iterator<char>(b)),
+                     std::istreambuf_iterator<char>());
+  REQUIRE(actual == expected);
+}
+
 TEST_CASE("MetricsCollector - CPU Summary", "[metrics][cpu][summary]") {
   std::filesystem::create_directories("data/test/resultados");
   const std::string path = "data/test/resultados/test_cpu_summary.jsonl";
@@ -262,6 +316,24 @@ TEST_CASE("MetricsCollector - IO Logging", "[metrics][io]") {
     REQUIRE(j["io"]["event"] == "IO_COMPLETE");
     REQUIRE(j["io"]["remaining"] == 0);
   }
+
+  SECTION("Several devices in the same tick") {
+    metrics->log_io(4, "disk", "STEP", 1, "P1", 2, 0);
+    metrics->log_io(4, "nvme0", "COMPLETED", 2, "P2", 0, 1);
+    metrics->log_io(4, "nvme0", "STEP", 3, "P3", 5, 0);
+    metrics->flush_all();
+    metrics->disable_output();
+
+    std::ifstream in(path);
+    std::string line;
+    REQUIRE(std::getline(in, line));
+
+    json j = json::parse(line);
+    REQUIRE(j["io"]["device"] == "disk");
+    REQUIRE(j["io_devices"].size() == 1);
+    REQUIRE(j["io_devices"][0]["device"] == "nvme0");
+    REQUIRE(j["io_devices"][0]["pid"] == 3);
+  }
 }
 
 TEST_CASE("MetricsCollector - IO Manager Integration",
@@ -371,7 +443,7 @@ TEST_CASE("MetricsCollector - Memory Summary", "[metrics][memory][summary]") {
   auto metrics = std::make_shared<MetricsCollector>();
   REQUIRE(metrics->enable_file_output(path));
 
-  metrics->log_memory_summary(25, 10, 64, 48, "LRU");
+  metrics->log_memory_summary(25, 10, 64, 48, "LRU", 5, 200, 2, 30, 90, 10);
   metrics->flush_all();
   metrics->disable_output();
 
@@ -385,6 +457,12 @@ TEST_CASE("MetricsCollector - Memory Summary", "[metrics][memory][summary]") {
   REQUIRE(j["total_replacements"] == 10);
   REQUIRE(j["frame_utilization"] == 75.0);
   REQUIRE(j["algorithm"] == "LRU");
+  REQUIRE(j["throughput"] == 0.025);
+  REQUIRE(j["deferred_admissions"] == 2);
+  REQUIRE(j["deferral_ticks"] == 30);
+  REQUIRE(j["tlb_hits"] == 90);
+  REQUIRE(j["tlb_misses"] == 10);
+  REQUIRE(j["tlb_hit_rate"] == 90.0);
 }
 
 TEST_CASE("MetricsCollector - Memory Manager Integration",
@@ -495,3 +573,336 @@ TEST_CASE("MetricsCollector - Tick Ordering", "[metrics][ordering]") {
   json j2 = json::parse(line);
   REQUIRE(j2["tick"] == 2);
 }
+
+TEST_CASE("MetricsCollector - Long Runs", "[metrics][ordering]") {
+  std::filesystem::create_directories("data/test/resultados");
+  const std::string path = "data/test/resultados/test_long_run.jsonl";
+
+  auto metrics = std::make_shared<MetricsCollector>();
+  REQUIRE(metrics->enable_file_output(path));
+
+  // Más ticks de los que caben pendientes a la vez
+  for (int tick = 0; tick < 5000; tick += 2) {
+    metrics->log_cpu(tick, "EXEC", 1, "P1", 5000 - tick, 0, false);
+    metrics->log_io(tick, "disk", "IO_START", 2, "P2", tick, 1);
+  }
+  metrics->log_memory(4998, "PAGE_FAULT", 1, "P1", 0, -1, 1, 0);
+
+  metrics->flush_all();
+  metrics->disable_output();
+
+  std::ifstream in(path);
+  std::string line;
+  int expected_tick = 0;
+  while (std::getline(in, line)) {
+    json j = json::parse(line);
+    REQUIRE(j["tick"] == expected_tick);
+    REQUIRE(j.contains("cpu"));
+    REQUIRE(j.contains("io"));
+    REQUIRE(j.contains("memory") == (expected_tick == 4998));
+    expected_tick += 2;
+  }
+  REQUIRE(expected_tick == 5000);
+}
+
+TEST_CASE("MetricsCollector - Category Filter and Sampling",
+          "[metrics][filter]") {
+  std::filesystem::create_directories("data/test/resultados");
+  const std::string path = "data/test/resultados/test_filter.jsonl";
+
+  SECTION("Parses category lists") {
+    uint32_t mask = 0;
+    REQUIRE(MetricsCollector::parse_categories("cpu, queues", mask));
+    REQUIRE(mask == (MetricsCollector::CATEGORY_CPU |
+                     MetricsCollector::CATEGORY_QUEUES));
+    REQUIRE(MetricsCollector::parse_categories("all", mask));
+    REQUIRE(mask == MetricsCollector::CATEGORY_ALL);
+    REQUIRE_FALSE(MetricsCollector::parse_categories("cpu,gantt", mask));
+  }
+
+  SECTION("Only enabled categories on sampled ticks are written") {
+    MetricsCollector metrics;
+    REQUIRE(metrics.enable_file_output(path));
+    metrics.set_categories(MetricsCollector::CATEGORY_CPU);
+    metrics.set_sample_rate(4);
+
+    REQUIRE(metrics.should_log(MetricsCollector::CATEGORY_CPU, 8));
+    REQUIRE_FALSE(metrics.should_log(MetricsCollector::CATEGORY_CPU, 9));
+    REQUIRE_FALSE(metrics.should_log(MetricsCollector::CATEGORY_QUEUES, 8));
+
+    for (int tick = 0; tick < 10; ++tick) {
+      metrics.log_cpu(tick, "EXEC", 1, "P1", 10 - tick, 0, false);
+      metrics.log_queue_snapshot(tick, {1}, {}, {}, 1);
+      metrics.log_state_transition(tick, 1, "P1", ProcessState::READY,
+                                   ProcessState::RUNNING, "scheduled");
+    }
+    metrics.disable_output();
+
+    std::ifstream in(path);
+    std::string line;
+    std::vector<int> ticks;
+    while (std::getline(in, line)) {
+      json j = json::parse(line);
+      REQUIRE(j.contains("cpu"));
+      REQUIRE_FALSE(j.contains("queues"));
+      REQUIRE_FALSE(j.contains("state_transitions"));
+      ticks.push_back(j["tick"]);
+    }
+    REQUIRE(ticks == std::vector<int>{0, 4, 8});
+  }
+}
+
+// ============================================================================
+// BUFFERED OUTPUT TESTS
+// ============================================================================
+
+TEST_CASE("MetricsCollector - Buffered Output", "[metrics][buffer]") {
+  std::filesystem::create_directories("data/test/resultados");
+  const std::string path = "data/test/resultados/test_buffered.jsonl";
+
+  if (std::filesystem::exists(path)) {
+    std::filesystem::remove(path);
+  }
+
+  auto metrics = std::make_shared<MetricsCollector>();
+  REQUIRE(metrics->enable_file_output(path));
+  metrics->set_buffer_size(1 << 20);
+
+  metrics->log_cpu(0, "EXEC", 1, "P\"1\\\n", 10, 2, true);
+  metrics->log_io(0, "disk", "IO_START", 2, "P2", 3, 1);
+  metrics->log_queue_snapshot(0, {1, 2}, {}, {3}, 1);
+  metrics->log_frame_status(0, {{0, true, 1, 0}, {1, false, -1, -1}});
+  metrics->log_cpu_summary(1, 100.0, 0.0, 1.0, 0.0, 0, "FCFS");
+
+  SECTION("Nothing is written until flush_all") {
+    REQUIRE(std::filesystem::file_size(path) == 0);
+    metrics->flush_all();
+    REQUIRE(std::filesystem::file_size(path) > 0);
+  }
+
+  SECTION("Records keep the json::dump layout") {
+    metrics->disable_output();
+
+    std::ifstream in(path);
+    std::string line;
+
+    REQUIRE(std::getline(in, line));
+    json summary = json::parse(line);
+    REQUIRE(summary["summary"] == "CPU_METRICS");
+
+    REQUIRE(std::getline(in, line));
+    json tick = json::parse(line);
+    REQUIRE(tick.dump() == line);
+    REQUIRE(tick["cpu"]["name"] == "P\"1\\\n");
+    REQUIRE(tick["io"]["queue"] == 1);
+    REQUIRE(tick["queues"]["ready"] == json::array({1, 2}));
+    REQUIRE(tick["queues"]["blocked_memory"].empty());
+    REQUIRE(tick["frame_status"].size() == 2);
+    REQUIRE(tick["frame_status"][1]["pid"] == -1);
+  }
+}
+
+TEST_CASE("MetricsCollector - Async Writer", "[metrics][async]") {
+  std::filesystem::create_directories("data/test/resultados");
+  const std::string sync_path = "data/test/resultados/test_sync_writer.jsonl";
+  const std::string async_path = "data/test/resultados/test_async_writer.jsonl";
+
+  auto log_workload = [](MetricsCollector &metrics) {
+    metrics.log_cpu_summary(0, 0.0, 0.0, 0.0, 0.0, 0, "FCFS");
+    for (int tick = 0; tick < 500; ++tick) {
+      metrics.log_cpu(tick, "EXEC", 1, "P1", 500 - tick, 2, tick % 7 == 0);
+      metrics.log_memory(tick, "PAGE_LOADED", 1, "P1", tick % 4, tick % 8,
+                         tick, 0);
+      metrics.log_state_transition(tick, 1, "P1", ProcessState::READY,
+                                   ProcessState::RUNNING, "scheduled");
+      if (tick % 10 == 0)
+        metrics.log_queue_snapshot(tick, {2, 3}, {4}, {}, 1);
+    }
+  };
+
+  auto read_all = [](const std::string &path) {
+    std::ifstream in(path);
+    return std::string(std::istreambuf_iterator<char>(in),
+                       std::istreambuf_iterator<char>());
+  };
+
+  SECTION("Produces the same output as the synchronous writer") {
+    MetricsCollector sync_metrics;
+    REQUIRE(sync_metrics.enable_file_output(sync_path));
+    log_workload(sync_metrics);
+    sync_metrics.disable_output();
+
+    MetricsCollector async_metrics;
+    REQUIRE(async_metrics.enable_file_output(async_path));
+    REQUIRE(async_metrics.enable_async(64));
+    REQUIRE(async_metrics.is_async());
+    log_workload(async_metrics);
+    async_metrics.flush_all();
+    async_metrics.disable_output();
+    REQUIRE_FALSE(async_metrics.is_async());
+
+    REQUIRE(async_metrics.get_dropped_events() == 0);
+    REQUIRE(read_all(async_path) == read_all(sync_path));
+  }
+
+  SECTION("Drop policy counts discarded events") {
+    MetricsCollector metrics;
+    REQUIRE(metrics.enable_file_output(async_path));
+    REQUIRE(metrics.enable_async(
+        2, MetricsCollector::BackpressurePolicy::DROP));
+    for (int tick = 0; tick < 2000; ++tick)
+      metrics.log_cpu(tick, "EXEC", 1, "P1", 0, 0, false);
+    metrics.disable_output();
+
+    std::ifstream in(async_path);
+    std::string line;
+    uint64_t lines = 0;
+    while (std::getline(in, line))
+      ++lines;
+    REQUIRE(lines + metrics.get_dropped_events() == 2000);
+  }
+}
+
+TEST_CASE("MetricsCollector - Binary Trace", "[metrics][binary]") {
+  std::filesystem::create_directories("data/test/resultados");
+  const std::string jsonl_path = "data/test/resultados/test_trace.jsonl";
+  const std::string binary_path = "data/test/resultados/test_trace.bin";
+  const std::string converted_path =
+      "data/test/resultados/test_trace_converted.jsonl";
+
+  auto log_workload = [](MetricsCollector &metrics) {
+    for (int tick = 0; tick < 200; tick += 1 + tick % 3) {
+      metrics.log_cpu(tick, "EXEC", tick % 3, "P\"" + std::to_string(tick % 3),
+                      200 - tick, tick % 5, tick % 7 == 0);
+      metrics.log_io(tick, "disk\n", "IO_START", 2, "P2", tick, 1);
+      if (tick % 4 == 0) {
+        metrics.log_io(tick, "nvme0", "STEP", 3, "P3", tick / 4, 0);
+      }
+      metrics.log_memory(tick, "PAGE_FAULT", 1, "P1", tick % 4, -1, tick, 0);
+      metrics.log_state_transition(tick, 1, "P1", ProcessState::READY,
+                                   ProcessState::RUNNING, "scheduled");
+      metrics.log_queue_snapshot(tick, {2, 3}, {}, {-1}, tick % 2 ? 1 : -1);
+      metrics.log_page_table(tick, 1, "P1",
+                             {{0, tick % 8, true, tick % 2 == 0, false},
+                              {1, -1, false, false, true}});
+      metrics.log_frame_status(tick, {{0, true, 1, 0}, {1, false, -1, -1}});
+    }
+    metrics.log_cpu_summary(200, 87.5, 1.25, 3.0, 0.1, 42, "RR");
+    metrics.log_memory_summary(17, 5, 8, 3, "LRU", 4, 200, 1, 12, 30, 6);
+  };
+
+  auto read_all = [](const std::string &path) {
+    std::ifstream in(path, std::ios::binary);
+    return std::string(std::istreambuf_iterator<char>(in),
+                       std::istreambuf_iterator<char>());
+  };
+
+  MetricsCollector jsonl_metrics;
+  REQUIRE(jsonl_metrics.enable_file_output(jsonl_path));
+  log_workload(jsonl_metrics);
+  jsonl_metrics.disable_output();
+
+  MetricsCollector binary_metrics;
+  REQUIRE(binary_metrics.enable_file_output(
+      binary_path, MetricsCollector::TraceFormat::BINARY));
+  log_workload(binary_metrics);
+  binary_metrics.disable_output();
+
+  SECTION("Converts back to the JSONL output") {
+    REQUIRE(std::filesystem::file_size(binary_path) * 4 <
+            std::filesystem::file_size(jsonl_path));
+    REQUIRE(MetricsCollector::convert_binary_to_jsonl(binary_path,
+                                                      converted_path));
+    REQUIRE(read_all(converted_path) == read_all(jsonl_path));
+  }
+
+  SECTION("Rejects files that are not binary traces") {
+    REQUIRE_FALSE(MetricsCollector::convert_binary_to_jsonl(jsonl_path,
+                                                            converted_path));
+  }
+
+  SECTION("Rejects truncated traces") {
+    std::string bytes = read_all(binary_path);
+    {
+      std::ofstream out(binary_path, std::ios::binary | std::ios::trunc);
+      out << bytes.substr(0, bytes.size() - 3);
+    }
+    REQUIRE_FALSE(MetricsCollector::convert_binary_to_jsonl(binary_path,
+                                                            converted_path));
+  }
+}
+
+TEST_CASE("MetricsCollector - Keyframe Deltas", "[metrics][memory][delta]") {
+  std::filesystem::create_directories("data/test/resultados");
+  const std::string path = "data/test/resultados/test_keyframes.jsonl";
+  const std::string binary_path = "data/test/resultados/test_keyframes.bin";
+  const std::string converted_path =
+      "data/test/resultados/test_keyframes_converted.jsonl";
+
+  auto log_workload = [](MetricsCollector &metrics) {
+    metrics.set_keyframe_interval(10);
+    metrics.log_frame_status(0, {{0, false, -1, -1}, {1, false, -1, -1}});
+    metrics.log_page_table(0, 1, "P1",
+                           {{0, -1, false, false, false},
+                            {1, -1, false, false, false}});
+    metrics.log_frame_changes(1, {{1, true, 1, 0}}, 2);
+    metrics.log_page_table(1, 1, "P1",
+                           {{0, 1, true, true, false},
+                            {1, -1, false, false, false}});
+    metrics.log_frame_status(2, {{0, false, -1, -1}, {1, true, 1, 0}});
+    metrics.log_frame_changes(12, {{0, true, 1, 1}}, 2);
+    metrics.log_page_table(12, 1, "P1",
+                           {{0, 1, true, true, false},
+                            {1, 0, true, true, false}});
+  };
+
+  MetricsCollector metrics;
+  REQUIRE(metrics.enable_file_output(path));
+  log_workload(metrics);
+  metrics.disable_output();
+
+  std::map<int, json> ticks;
+  std::ifstream in(path);
+  std::string line;
+  while (std::getline(in, line)) {
+    json j = json::parse(line);
+    ticks[j["tick"]] = j;
+  }
+
+  SECTION("Only changed entries are logged between keyframes") {
+    REQUIRE(ticks[0]["frame_status"].size() == 2);
+    REQUIRE(ticks[0]["page_table"]["pages"].size() == 2);
+
+    REQUIRE_FALSE(ticks[1].contains("frame_status"));
+    REQUIRE(ticks[1]["frame_status_delta"].size() == 1);
+    REQUIRE(ticks[1]["frame_status_delta"][0]["frame"] == 1);
+    REQUIRE(ticks[1]["page_table_delta"]["pages"].size() == 1);
+    REQUIRE(ticks[1]["page_table_delta"]["pages"][0]["page"] == 0);
+
+    REQUIRE(ticks.count(2) == 0);
+  }
+
+  SECTION("Keyframes carry the full state") {
+    REQUIRE(ticks[12]["frame_status"].size() == 2);
+    REQUIRE(ticks[12]["frame_status"][0]["pid"] == 1);
+    REQUIRE(ticks[12]["frame_status"][1]["page"] == 0);
+    REQUIRE(ticks[12]["page_table"]["pages"][1]["frame"] == 0);
+  }
+
+  SECTION("Binary traces keep the deltas") {
+    MetricsCollector binary_metrics;
+    REQUIRE(binary_metrics.enable_file_output(
+        binary_path, MetricsCollector::TraceFormat::BINARY));
+    log_workload(binary_metrics);
+    binary_metrics.disable_output();
+
+    REQUIRE(MetricsCollector::convert_binary_to_jsonl(binary_path,
+                                                      converted_path));
+    std::ifstream a(path), b(converted_path);
+    std::string expected((std::istreambuf_iterator<char>(a)),
+                         std::istreambuf_iterator<char>());
+    std::string actual((std::istreambuf_iterator<char>(b)),
+                       std::istreambuf_iterator<char>());
+    REQUIRE(actual == expected);
+  }
+}
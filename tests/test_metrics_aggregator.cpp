@@ -0,0 +1,111 @@
+/**
+ * @file test_metrics_aggregator.cpp
+ * @brief Tests de las series agregadas por ventanas: reparto de pasos largos,
+ * base al restaurar y archivo escrito por el recolector.
+ */
+
+#include "core/config_parser.hpp"
+#include "metrics/metrics_aggregator.hpp"
+#include "metrics/metrics_collector.hpp"
+#include <catch2/catch_test_macros.hpp>
+#include <filesystem>
+#include <fstream>
+#include <nlohmann/json.hpp>
+#include <string>
+#include <vector>
+
+using namespace OSSimulator;
+
+namespace {
+
+AggregateSample make_sample(int tick, int64_t busy, int64_t faults, int ready) {
+  AggregateSample s;
+  s.tick = tick;
+  s.busy_ticks = busy;
+  s.page_faults = faults;
+  s.ready = ready;
+  return s;
+}
+
+} // namespace
+
+TEST_CASE("Un paso largo se reparte entre las ventanas que atraviesa",
+          "[aggregate]") {
+  MetricsAggregator aggregator({10, 10, 0});
+  REQUIRE(aggregator.get_widths() == std::vector<int>{10});
+
+  std::vector<AggregateWindow> closed;
+  aggregator.add(make_sample(0, 0, 0, 0), closed);
+  aggregator.add(make_sample(4, 4, 1, 3), closed);
+  aggregator.add(make_sample(25, 14, 6, 1), closed);
+  REQUIRE(closed.size() == 2);
+  REQUIRE(closed[0].start == 0);
+  REQUIRE(closed[0].end == 10);
+  REQUIRE(closed[0].busy_ticks == 4 + 2);
+  REQUIRE(closed[0].page_faults == 1);
+  REQUIRE(closed[0].ready.min == 1);
+  REQUIRE(closed[0].ready.max == 3);
+  REQUIRE(closed[0].ready.sum == 4 * 3 + 6 * 1);
+  REQUIRE(closed[1].busy_ticks == 5);
+  REQUIRE(closed[1].page_faults == 0);
+
+  aggregator.finish(closed);
+  REQUIRE(closed.size() == 3);
+  REQUIRE(closed[2].start == 20);
+  REQUIRE(closed[2].end == 25);
+  REQUIRE(closed[2].busy_ticks == 3);
+  REQUIRE(closed[2].page_faults == 5);
+
+  auto line = nlohmann::json::parse(closed[2].to_json());
+  REQUIRE(line["cpu_utilization"].get<double>() == 60.0);
+  REQUIRE(line["fault_rate"].get<double>() == 1.0);
+  REQUIRE(line["ready"]["avg"].get<double>() == 1.0);
+}
+
+TEST_CASE("La primera muestra es la base de las series", "[aggregate]") {
+  MetricsAggregator aggregator({100});
+  std::vector<AggregateWindow> closed;
+  aggregator.add(make_sample(537, 400, 90, 2), closed);
+  aggregator.add(make_sample(540, 403, 91, 2), closed);
+  aggregator.finish(closed);
+  REQUIRE(closed.size() == 1);
+  REQUIRE(closed[0].start == 537);
+  REQUIRE(closed[0].end == 540);
+  REQUIRE(closed[0].busy_ticks == 3);
+  REQUIRE(closed[0].page_faults == 1);
+}
+
+TEST_CASE("El recolector escribe las series junto a las métricas",
+          "[aggregate]") {
+  REQUIRE(ConfigParser::parse_aggregate_windows("0").empty());
+  auto widths = ConfigParser::parse_aggregate_windows("100:10");
+  REQUIRE(widths == std::vector<int>{100, 10});
+
+  std::filesystem::create_directories("data/test/resultados");
+  const std::string file = "data/test/resultados/test_aggregate.jsonl";
+  const std::string series = "data/test/resultados/test_aggregate.aggregates.jsonl";
+  {
+    MetricsCollector metrics;
+    REQUIRE(!metrics.enable_aggregates(widths));
+    REQUIRE(metrics.enable_file_output(file));
+    REQUIRE(metrics.enable_aggregates(widths));
+    for (int tick = 0; tick <= 120; ++tick)
+      metrics.log_aggregate_sample(make_sample(tick, tick, 0, 1));
+    metrics.disable_output();
+    REQUIRE(!metrics.aggregates_enabled());
+  }
+
+  std::ifstream in(series);
+  std::vector<nlohmann::json> lines;
+  std::string line;
+  while (std::getline(in, line))
+    lines.push_back(nlohmann::json::parse(line));
+  // 12 ventanas de 10 ticks, la de 100 y la parcial [100, 120).
+  REQUIRE(lines.size() == 14);
+  for (const auto &window : lines)
+    REQUIRE(window["cpu_utilization"].get<double>() == 100.0);
+  REQUIRE(lines.back()["window"] == 100);
+  REQUIRE(lines.back()["start"] == 100);
+  std::filesystem::remove(file);
+  std::filesystem::remove(series);
+}
@@ -0,0 +1,121 @@
+/**
+ * @file test_profiler.cpp
+ * @brief Tests del perfilador interno: totales por fase, contadores de varios
+ * hilos y traza en formato de Chrome.
+ */
+
+#include "core/config_parser.hpp"
+#include "core/profiler.hpp"
+#include <catch2/catch_test_macros.hpp>
+#include <cstdio>
+#include <fstream>
+#include <nlohmann/json.hpp>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace OSSimulator;
+
+TEST_CASE("El perfilador acumula llamadas, total y máximo por fase",
+          "[profiler]") {
+  Profiler profiler;
+  profiler.record("fase.a", 100, 150);
+  profiler.record("fase.a", 200, 300);
+  profiler.record("fase.b", 0, 10);
+
+  auto phases = profiler.phases();
+  REQUIRE(phases.size() == 2);
+  REQUIRE(phases[0].name == "fase.a");
+  REQUIRE(phases[0].calls == 2);
+  REQUIRE(phases[0].total_ns == 150);
+  REQUIRE(phases[0].max_ns == 100);
+  REQUIRE(phases[1].name == "fase.b");
+  REQUIRE(phases[1].total_ns == 10);
+
+  std::ostringstream report;
+  profiler.print_report(report);
+  REQUIRE(report.str().find("[PERFIL]") != std::string::npos);
+  REQUIRE(report.str().find("fase.a") != std::string::npos);
+
+  profiler.reset();
+  REQUIRE(profiler.phases().empty());
+}
+
+TEST_CASE("Los contadores de varios hilos se suman en el informe",
+          "[profiler]") {
+  Profiler profiler;
+  std::vector<std::thread> threads;
+  for (int t = 0; t < 4; ++t) {
+    threads.emplace_back([&profiler]() {
+      for (int i = 0; i < 1000; ++i) {
+        profiler.count("contador", 2);
+        profiler.record("fase", 0, 1);
+      }
+    });
+  }
+  for (auto &thread : threads)
+    thread.join();
+
+  auto counters = profiler.counters();
+  REQUIRE(counters.size() == 1);
+  REQUIRE(counters[0].value == 8000);
+  REQUIRE(profiler.phases()[0].calls == 4000);
+}
+
+TEST_CASE("La traza de Chrome guarda los eventos hasta el máximo",
+          "[profiler]") {
+  Profiler profiler;
+  profiler.enable_trace(3);
+  uint64_t start = Profiler::now_ns();
+  for (int i = 0; i < 5; ++i)
+    profiler.record("fase", start, start + 2000);
+  REQUIRE(profiler.get_dropped_events() == 2);
+  REQUIRE(profiler.phases()[0].calls == 5);
+
+  const std::string filename = "test_profiler_trace.json";
+  profiler.write_chrome_trace(filename);
+  std::ifstream in(filename);
+  auto trace = nlohmann::json::parse(in);
+  in.close();
+  std::remove(filename.c_str());
+
+  int complete = 0;
+  for (const auto &event : trace["traceEvents"]) {
+    if (event["ph"] == "X") {
+      REQUIRE(event["name"] == "fase");
+      REQUIRE(event["dur"].get<double>() == 2.0);
+      ++complete;
+    }
+  }
+  REQUIRE(complete == 3);
+  REQUIRE(trace["otherData"]["dropped_events"] == 2);
+
+  REQUIRE_THROWS_AS(profiler.write_chrome_trace("/nonexistent/dir/t.json"),
+                    std::runtime_error);
+}
+
+TEST_CASE("El temporizador de ámbito registra en el perfilador global",
+          "[profiler]") {
+  Profiler::instance().reset();
+  {
+    ScopedTimer timer("test.scope");
+  }
+  bool found = false;
+  for (const auto &phase : Profiler::instance().phases())
+    found = found || (phase.name == "test.scope" && phase.calls == 1);
+  REQUIRE(found);
+  Profiler::instance().reset();
+}
+
+TEST_CASE("profile_trace_file se lee de la configuración", "[profiler]") {
+  const std::string filename = "test_profiler_config.txt";
+  {
+    std::ofstream out(filename);
+    out << "total_memory_frames=16\nprofile_trace_file=perfil.json\n";
+  }
+  auto config = ConfigParser::load_simulator_config(filename);
+  std::remove(filename.c_str());
+  REQUIRE(config.profile_trace_file == "perfil.json");
+}
@@ -1,6 +1,9 @@
 #include "cpu/cpu_scheduler.hpp"
 #include "cpu/fcfs_scheduler.hpp"
 #include "cpu/round_robin_scheduler.hpp"
+#include "io/io_device.hpp"
+#include "io/io_fcfs_scheduler.hpp"
+#include "io/io_manager.hpp"
 #include "metrics/metrics_collector.hpp"
 #include <catch2/catch_test_macros.hpp>
 #include <filesystem>
@@ -119,3 +122,45 @@ TEST_CASE("Queue snapshots track process states correctly",
 
   REQUIRE(queue_snapshots_found > 0);
 }
+
+TEST_CASE("Queue membership follows state transitions", "[metrics][queues]") {
+  CPUScheduler cpu_scheduler;
+  cpu_scheduler.set_scheduler(std::make_unique<FCFSScheduler>());
+
+  auto io_manager = std::make_shared<IOManager>();
+  auto disk = std::make_shared<IODevice>("disk");
+  disk->set_scheduler(std::make_unique<IOFCFSScheduler>());
+  io_manager->add_device("disk", disk);
+  cpu_scheduler.set_io_manager(io_manager);
+
+  std::vector<std::shared_ptr<Process>> processes;
+  processes.push_back(std::make_shared<Process>(
+      1, "P1", 0,
+      std::vector<Burst>{Burst(BurstType::CPU, 1),
+                         Burst(BurstType::IO, 4, "disk"),
+                         Burst(BurstType::CPU, 1)}));
+  processes.push_back(std::make_shared<Process>(
+      2, "P2", 0, std::vector<Burst>{Burst(BurstType::CPU, 3)}));
+  processes.push_back(std::make_shared<Process>(
+      3, "P3", 0, std::vector<Burst>{Burst(BurstType::CPU, 2)}));
+
+  cpu_scheduler.load_processes(processes);
+  REQUIRE(cpu_scheduler.has_pending_processes());
+  REQUIRE(cpu_scheduler.get_ready_queue_pids().empty());
+
+  cpu_scheduler.execute_step(1);
+  REQUIRE(cpu_scheduler.get_ready_queue_pids() == std::vector<int>{1, 2, 3});
+
+  cpu_scheduler.execute_step(1);
+  REQUIRE(cpu_scheduler.get_io_waiting_pids() == std::vector<int>{1});
+  REQUIRE(cpu_scheduler.get_ready_queue_pids() == std::vector<int>{2, 3});
+
+  cpu_scheduler.run_until_completion();
+  REQUIRE_FALSE(cpu_scheduler.has_pending_processes());
+  REQUIRE(cpu_scheduler.get_ready_queue_pids().empty());
+  REQUIRE(cpu_scheduler.get_io_waiting_pids().empty());
+  REQUIRE(cpu_scheduler.get_memory_waiting_pids().empty());
+
+  cpu_scheduler.reset();
+  REQUIRE(cpu_scheduler.has_pending_processes());
+}
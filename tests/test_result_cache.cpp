@@ -0,0 +1,165 @@
+/**
+ * @file test_result_cache.cpp
+ * @brief Tests de la caché de resultados: claves normalizadas, entradas con
+ * traza y desalojo por tamaño.
+ */
+
+#include "core/config_parser.hpp"
+#include "core/result_cache.hpp"
+#include <catch2/catch_test_macros.hpp>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <memory>
+#include <string>
+#include <vector>
+
+using namespace OSSimulator;
+
+namespace {
+
+const std::string CACHE_DIR = "data/test/result_cache";
+
+std::vector<std::shared_ptr<Process>>
+parse_processes(const std::vector<std::string> &lines) {
+  std::vector<std::shared_ptr<Process>> processes;
+  for (const auto &line : lines)
+    processes.push_back(ConfigParser::parse_process_line(line));
+  return processes;
+}
+
+CacheKey key_for(const SimulatorConfig &config,
+                 const std::vector<std::string> &lines) {
+  return ResultCache::make_key(ResultCache::describe(config),
+                               ResultCache::describe(parse_processes(lines)),
+                               "trace=none");
+}
+
+void set_age(const std::filesystem::path &file, int seconds_ago) {
+  std::filesystem::last_write_time(
+      file, std::filesystem::file_time_type::clock::now() -
+                std::chrono::seconds(seconds_ago));
+}
+
+} // namespace
+
+TEST_CASE("La clave depende del contenido normalizado", "[cache]") {
+  SimulatorConfig config;
+  config.scheduling_algorithm = "RoundRobin";
+  config.page_replacement_algorithm = "LRU";
+  std::vector<std::string> lines = {"P1 0 CPU(4),E/S(3),CPU(2) 1 4 0,1w,2",
+                                    "P2 2 CPU(5) 2 2"};
+  CacheKey key = key_for(config, lines);
+
+  SECTION("El formato del archivo de procesos no cambia la clave") {
+    auto spaced = key_for(config, {"P1  0  CPU(4),E/S(3),CPU(2)  1  4  0,1w,2",
+                                   "P2 2 CPU(5) 2 2   "});
+    REQUIRE(spaced.hash == key.hash);
+    REQUIRE(spaced.check == key.check);
+  }
+
+  SECTION("Los parámetros sin efecto en el resultado no cambian la clave") {
+    SimulatorConfig other = config;
+    other.live_metrics_interval = 100;
+    other.profile_trace_file = "perfil.json";
+    other.result_cache_dir = "otra";
+    other.execution_mode = "inline";
+    other.core_locking = "coarse";
+    other.metrics_writer = "async";
+    other.metrics_buffer_size = 0;
+    other.metrics_queue_capacity = 64;
+    REQUIRE(key_for(other, lines).hash == key.hash);
+  }
+
+  SECTION("Cualquier cambio de la simulación cambia la clave") {
+    SimulatorConfig other = config;
+    other.quantum = 5;
+    REQUIRE(key_for(other, lines).hash != key.hash);
+    REQUIRE(key_for(config, {"P1 0 CPU(4),E/S(3),CPU(2) 1 4 0,1,2",
+                             "P2 2 CPU(5) 2 2"})
+                .hash != key.hash);
+    auto traced = ResultCache::make_key(
+        ResultCache::describe(config),
+        ResultCache::describe(parse_processes(lines)), "trace=jsonl");
+    REQUIRE(traced.hash != key.hash);
+  }
+
+  SECTION("No se guardan simulaciones con puntos de control o en stream") {
+    REQUIRE(ResultCache::cacheable(config, true));
+    SimulatorConfig other = config;
+    other.restore_file = "ckpt.bin";
+    REQUIRE_FALSE(ResultCache::cacheable(other, false));
+    other = config;
+    other.process_loading = "stream";
+    REQUIRE_FALSE(ResultCache::cacheable(other, false));
+    other = config;
+    other.metrics_aggregate_windows = {10};
+    REQUIRE(ResultCache::cacheable(other, false));
+    REQUIRE_FALSE(ResultCache::cacheable(other, true));
+  }
+}
+
+TEST_CASE("Una entrada guardada se recupera con su traza", "[cache]") {
+  std::filesystem::remove_all(CACHE_DIR);
+  ResultCache cache(CACHE_DIR, 1 << 20);
+  CacheKey key;
+  key.add("simulación");
+  CacheKey other;
+  other.add("otra simulación");
+
+  std::string summary;
+  REQUIRE_FALSE(cache.load(key, summary));
+
+  std::filesystem::create_directories("data/test");
+  const std::string trace = "data/test/result_cache_trace.jsonl";
+  {
+    std::ofstream out(trace, std::ios::trunc);
+    out << "{\"tick\":1}\n{\"tick\":2}\n";
+  }
+  REQUIRE(cache.store(key, "{\"total_time\":31}", trace));
+  REQUIRE(cache.store(other, "{\"total_time\":7}"));
+
+  REQUIRE(cache.load(key, summary, true));
+  REQUIRE(summary == "{\"total_time\":31}");
+  REQUIRE(cache.load(other, summary));
+  REQUIRE(summary == "{\"total_time\":7}");
+  REQUIRE_FALSE(cache.load(other, summary, true));
+
+  const std::string copy = "data/test/result_cache_copy.jsonl";
+  REQUIRE(cache.copy_trace(key, copy));
+  std::ifstream in(copy);
+  std::string text((std::istreambuf_iterator<char>(in)),
+                   std::istreambuf_iterator<char>());
+  REQUIRE(text == "{\"tick\":1}\n{\"tick\":2}\n");
+
+  SECTION("Una colisión del nombre no se confunde con la entrada") {
+    CacheKey collision = key;
+    collision.check ^= 1;
+    REQUIRE_FALSE(cache.load(collision, summary));
+  }
+}
+
+TEST_CASE("Se desalojan las entradas usadas hace más tiempo", "[cache]") {
+  std::filesystem::remove_all(CACHE_DIR);
+  const std::string summary(100, 'x');
+  std::vector<CacheKey> keys(3);
+  for (size_t i = 0; i < keys.size(); ++i)
+    keys[i].add("entrada " + std::to_string(i));
+
+  // Cada entrada ocupa 117 bytes: caben dos.
+  ResultCache cache(CACHE_DIR, 250);
+  REQUIRE(cache.store(keys[0], summary));
+  REQUIRE(cache.store(keys[1], summary));
+  set_age(CACHE_DIR + "/" + keys[0].name() + ".result", 20);
+  set_age(CACHE_DIR + "/" + keys[1].name() + ".result", 10);
+
+  std::string loaded;
+  REQUIRE(cache.load(keys[0], loaded));
+  REQUIRE(cache.store(keys[2], summary));
+
+  REQUIRE(cache.size_bytes() <= 250);
+  REQUIRE(cache.load(keys[0], loaded));
+  REQUIRE_FALSE(cache.load(keys[1], loaded));
+  REQUIRE(cache.load(keys[2], loaded));
+}
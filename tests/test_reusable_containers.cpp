@@ -0,0 +1,135 @@
+/**
+ * @file test_reusable_containers.cpp
+ * @brief Tests de los contenedores que conservan su capacidad entre ticks:
+ * RingQueue frente a std::deque e IndexSet frente a std::set.
+ */
+
+#include "core/index_set.hpp"
+#include "core/ring_queue.hpp"
+#include <catch2/catch_test_macros.hpp>
+#include <deque>
+#include <memory>
+#include <random>
+#include <set>
+#include <vector>
+
+using namespace OSSimulator;
+
+TEST_CASE("RingQueue se comporta como std::deque", "[containers]") {
+  RingQueue<int> queue;
+  std::deque<int> expected;
+  std::mt19937 generator(7);
+
+  for (int step = 0; step < 5000; ++step) {
+    int op = static_cast<int>(generator() % 5);
+    if (op <= 1 || expected.empty()) {
+      queue.push_back(step);
+      expected.push_back(step);
+    } else if (op == 2) {
+      queue.pop_front();
+      expected.pop_front();
+    } else if (op == 3) {
+      queue.pop_back();
+      expected.pop_back();
+    } else {
+      auto offset = static_cast<std::ptrdiff_t>(generator() % expected.size());
+      auto next = queue.erase(queue.begin() + offset);
+      expected.erase(expected.begin() + offset);
+      REQUIRE(next - queue.begin() == offset);
+    }
+    REQUIRE(std::vector<int>(queue.begin(), queue.end()) ==
+            std::vector<int>(expected.begin(), expected.end()));
+  }
+}
+
+TEST_CASE("RingQueue no reserva al rotar con tamaño estable", "[containers]") {
+  RingQueue<int> queue;
+  for (int i = 0; i < 10; ++i)
+    queue.push_back(i);
+  size_t capacity = queue.capacity();
+
+  for (int i = 10; i < 1000; ++i) {
+    queue.pop_front();
+    queue.push_back(i);
+  }
+  REQUIRE(queue.capacity() == capacity);
+  REQUIRE(queue.front() == 990);
+  REQUIRE(queue.back() == 999);
+
+  queue.clear();
+  REQUIRE(queue.empty());
+  REQUIRE(queue.capacity() == capacity);
+}
+
+TEST_CASE("RingQueue suelta los punteros que retira", "[containers]") {
+  RingQueue<std::shared_ptr<int>> queue;
+  auto value = std::make_shared<int>(1);
+  queue.push_back(value);
+  queue.push_back(std::make_shared<int>(2));
+  REQUIRE(value.use_count() == 2);
+
+  queue.pop_front();
+  REQUIRE(value.use_count() == 1);
+
+  queue.push_back(value);
+  queue.erase(queue.begin() + 1);
+  REQUIRE(value.use_count() == 1);
+}
+
+TEST_CASE("RingQueue borra rangos conservando el orden", "[containers]") {
+  RingQueue<int> queue;
+  for (int i = 0; i < 6; ++i)
+    queue.push_back(i);
+
+  auto next = queue.erase(queue.begin() + 1, queue.begin() + 4);
+  REQUIRE(*next == 4);
+  REQUIRE(std::vector<int>(queue.begin(), queue.end()) ==
+          std::vector<int>{0, 4, 5});
+}
+
+TEST_CASE("IndexSet se comporta como std::set", "[containers]") {
+  IndexSet set;
+  std::set<size_t> expected;
+  std::mt19937 generator(11);
+
+  for (int step = 0; step < 5000; ++step) {
+    size_t index = generator() % 300;
+    if (generator() % 2 == 0) {
+      REQUIRE(set.insert(index) == expected.insert(index).second);
+    } else {
+      REQUIRE(set.erase(index) == (expected.erase(index) == 1));
+    }
+    REQUIRE(set.size() == expected.size());
+    REQUIRE(std::vector<size_t>(set.begin(), set.end()) ==
+            std::vector<size_t>(expected.begin(), expected.end()));
+  }
+}
+
+TEST_CASE("IndexSet permite eliminar el índice actual al recorrer",
+          "[containers]") {
+  IndexSet set;
+  for (size_t index : {3, 64, 65, 130})
+    set.insert(index);
+
+  std::vector<size_t> seen;
+  for (auto it = set.begin(); it != set.end();) {
+    size_t index = *it++;
+    seen.push_back(index);
+    set.erase(index);
+  }
+  REQUIRE(seen == std::vector<size_t>{3, 64, 65, 130});
+  REQUIRE(set.empty());
+  REQUIRE(set.next(0) == IndexSet::npos);
+}
+
+TEST_CASE("IndexSet::reserve no agrega índices", "[containers]") {
+  IndexSet set;
+  set.reserve(200);
+  REQUIRE(set.empty());
+  REQUIRE_FALSE(set.contains(199));
+
+  set.insert(199);
+  REQUIRE(set.contains(199));
+  REQUIRE(set.next(0) == 199);
+  REQUIRE(set.next(200) == IndexSet::npos);
+}
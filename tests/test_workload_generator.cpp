@@ -0,0 +1,210 @@
+/**
+ * @file test_workload_generator.cpp
+ * @brief Tests del generador de cargas sintéticas: reproducibilidad, formato
+ * de las líneas y uso directo en la simulación.
+ */
+
+#include "core/config_parser.hpp"
+#include "core/policy_registry.hpp"
+#include "core/process_stream.hpp"
+#include "core/workload_generator.hpp"
+#include "cpu/cpu_scheduler.hpp"
+#include <catch2/catch_test_macros.hpp>
+#include <cstdio>
+#include <fstream>
+#include <memory>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using namespace OSSimulator;
+
+namespace {
+
+std::vector<std::string> generate(const WorkloadSpec &spec) {
+  WorkloadGenerator generator(spec);
+  std::vector<std::string> lines;
+  std::string_view line;
+  while (generator.next_line(line))
+    lines.emplace_back(line);
+  return lines;
+}
+
+WorkloadSpec small_spec() {
+  WorkloadSpec spec;
+  spec.seed = 7;
+  spec.processes = 2000;
+  spec.arrival_rate = 0.5;
+  return spec;
+}
+
+} // namespace
+
+TEST_CASE("Una misma semilla genera la misma carga", "[workload]") {
+  auto spec = small_spec();
+  auto first = generate(spec);
+  REQUIRE(first.size() == spec.processes);
+  REQUIRE(generate(spec) == first);
+
+  spec.seed = 8;
+  REQUIRE(generate(spec) != first);
+}
+
+TEST_CASE("Las líneas generadas son procesos válidos", "[workload]") {
+  auto spec = small_spec();
+  spec.cpu_bursts = {Distribution::Kind::UNIFORM, 2, 4};
+  spec.priority = {Distribution::Kind::CONSTANT, 3, 3};
+  spec.pages = {Distribution::Kind::UNIFORM, 2, 6};
+
+  for (const char *arrival : {"poisson", "bursty"}) {
+    spec.arrival = arrival;
+    auto lines = generate(spec);
+    int last_arrival = 0;
+    int shared_ticks = 0;
+    for (size_t i = 0; i < lines.size(); ++i) {
+      auto process = ConfigParser::parse_process_line(lines[i]);
+      REQUIRE(process != nullptr);
+      REQUIRE(process->pid == static_cast<int>(i + 1));
+      REQUIRE(process->arrival_time >= last_arrival);
+      if (i > 0 && process->arrival_time == last_arrival)
+        shared_ticks++;
+      last_arrival = process->arrival_time;
+
+      size_t bursts = process->burst_sequence.size();
+      REQUIRE(bursts % 2 == 1);
+      REQUIRE(bursts >= 3);
+      REQUIRE(bursts <= 7);
+      REQUIRE(process->burst_sequence[1].type == BurstType::IO);
+      REQUIRE(process->priority == 3);
+      REQUIRE(process->memory_required >= 2);
+      REQUIRE(process->memory_required <= 6);
+    }
+    // Con tasa 0.5 se espera un tiempo total cercano a 4000 ticks.
+    REQUIRE(last_arrival > 3000);
+    REQUIRE(last_arrival < 5000);
+    // En ráfagas la mayoría de las llegadas comparte el tick con otra.
+    if (spec.arrival == "bursty")
+      REQUIRE(shared_ticks > static_cast<int>(lines.size()) / 2);
+  }
+}
+
+TEST_CASE("La carga escrita a archivo se lee igual que la generada",
+          "[workload]") {
+  std::string temp_file = "test_procesos_workload.txt";
+  auto spec = small_spec();
+  spec.arrival = "bursty";
+  {
+    std::ofstream out(temp_file);
+    WorkloadGenerator(spec).write(out);
+  }
+
+  auto from_file = ConfigParser::load_processes_from_file(temp_file);
+  auto expected = generate(spec);
+  REQUIRE(from_file.size() == expected.size());
+
+  auto generator = std::make_shared<WorkloadGenerator>(spec);
+  ProcessStream stream([generator](std::string_view &line) {
+    return generator->next_line(line);
+  });
+  for (const auto &process : from_file) {
+    auto streamed = stream.next();
+    REQUIRE(streamed->name == process->name);
+    REQUIRE(streamed->arrival_time == process->arrival_time);
+    REQUIRE(streamed->burst_time == process->burst_time);
+  }
+  REQUIRE(stream.done());
+
+  std::remove(temp_file.c_str());
+}
+
+TEST_CASE("Una carga generada se simula directamente", "[workload]") {
+  auto spec = small_spec();
+  spec.processes = 300;
+  SimulatorConfig config;
+  config.scheduling_algorithm = "RoundRobin";
+
+  auto run = [&](bool streaming) {
+    CPUScheduler scheduler;
+    scheduler.set_execution_mode(ExecutionMode::INLINE);
+    scheduler.set_scheduler(
+        cpu_scheduler_registry().create(config.scheduling_algorithm, config));
+    if (streaming) {
+      auto generator = std::make_shared<WorkloadGenerator>(spec);
+      scheduler.stream_processes(
+          std::make_unique<ProcessStream>([generator](std::string_view &line) {
+            return generator->next_line(line);
+          }));
+    } else {
+      std::vector<std::shared_ptr<Process>> processes;
+      for (const auto &line : generate(spec))
+        processes.push_back(ConfigParser::parse_process_line(line));
+      scheduler.load_processes(processes);
+    }
+    scheduler.run_until_completion();
+    REQUIRE(scheduler.get_completed_count() == spec.processes);
+    return scheduler.get_average_turnaround_time();
+  };
+
+  REQUIRE(run(true) == run(false));
+}
+
+TEST_CASE("Parámetros de carga sintética", "[workload]") {
+  SECTION("Distribuciones") {
+    auto uniform = ConfigParser::parse_distribution("uniform:1:8");
+    REQUIRE(uniform.kind == Distribution::Kind::UNIFORM);
+    REQUIRE(uniform.a == 1);
+    REQUIRE(uniform.b == 8);
+    auto exponential = ConfigParser::parse_distribution("exponential:6");
+    REQUIRE(exponential.kind == Distribution::Kind::EXPONENTIAL);
+    REQUIRE(exponential.a == 6);
+    REQUIRE(ConfigParser::parse_distribution("4").kind ==
+            Distribution::Kind::CONSTANT);
+    REQUIRE_THROWS_AS(ConfigParser::parse_distribution("normal:3:1"),
+                      std::invalid_argument);
+  }
+
+  SECTION("Archivo de parámetros") {
+    std::string temp_file = "test_procesos_workload_spec.txt";
+    {
+      std::ofstream out(temp_file);
+      out << "# Carga de prueba\n";
+      out << "seed=99\n";
+      out << "processes=5000000\n";
+      out << "arrival=bursty\n";
+      out << "pages=constant:2\n";
+    }
+    auto spec = ConfigParser::load_workload_spec(temp_file);
+    REQUIRE(spec.seed == 99);
+    REQUIRE(spec.processes == 5000000);
+    REQUIRE(spec.arrival == "bursty");
+    REQUIRE(spec.pages.kind == Distribution::Kind::CONSTANT);
+    REQUIRE(spec.cpu_burst.kind == Distribution::Kind::EXPONENTIAL);
+
+    {
+      std::ofstream out(temp_file);
+      out << "arrival_rte=2\n";
+    }
+    REQUIRE_THROWS_AS(ConfigParser::load_workload_spec(temp_file),
+                      std::runtime_error);
+    {
+      std::ofstream out(temp_file);
+      out << "cpu_burst=uniform:x\n";
+    }
+    REQUIRE_THROWS_AS(ConfigParser::load_workload_spec(temp_file),
+                      std::runtime_error);
+    std::remove(temp_file.c_str());
+  }
+
+  SECTION("Parámetros no válidos") {
+    auto spec = small_spec();
+    spec.arrival = "uniform";
+    REQUIRE_THROWS_AS(WorkloadGenerator(spec), std::invalid_argument);
+    spec = small_spec();
+    spec.arrival_rate = 0;
+    REQUIRE_THROWS_AS(WorkloadGenerator(spec), std::invalid_argument);
+    spec = small_spec();
+    spec.pages = {Distribution::Kind::UNIFORM, 8, 1};
+    REQUIRE_THROWS_AS(WorkloadGenerator(spec), std::invalid_argument);
+  }
+}
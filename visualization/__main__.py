@@ -1,3 +1,4 @@
+import os
 import sys
 
 from visualization.visualizer import MetricsVisualizer
@@ -13,11 +14,13 @@ NOMBRE
     visualization - Generador de diagramas para métricas del simulador
 
 SINOPSIS
-    python -m visualization [archivo_metricas] [directorio_salida]
-    python -m visualization --batch <directorio_entrada> [directorio_salida]
+    python -m visualization [-j N] [archivo_metricas] [directorio_salida]
+    python -m visualization [-j N] --batch <directorio_entrada> [directorio_salida]
 
 DESCRIPCIÓN
     Lee archivos de métricas en formato JSONL y genera diagramas de visualización.
+    Las métricas procesadas se guardan junto a cada archivo (<archivo>.cache)
+    y se reutilizan mientras el archivo no cambie.
 
 MODOS DE OPERACIÓN
     Modo individual (por defecto):
@@ -40,6 +43,11 @@ OPCIONES
         Activa el modo por lotes. Procesa todos los archivos .jsonl
         encontrados en el directorio de entrada.
 
+    -j, --jobs <N>
+        Procesos para cargar los archivos y generar los diagramas en
+        paralelo (1 = en secuencia).
+        Por defecto: número de núcleos.
+
     -h, --help
         Muestra esta ayuda.
 
@@ -58,6 +66,9 @@ EJEMPLOS
 
     # Modo por lotes con directorio de salida personalizado
     python -m visualization --batch data/resultados/ output/diagramas_batch/
+
+    # Modo por lotes con 4 procesos
+    python -m visualization -j 4 --batch data/resultados/
 """)
 
 
@@ -69,34 +80,43 @@ def main():
     - Modo individual: procesa un único archivo de métricas<br>
     - Modo por lotes (--batch): procesa múltiples archivos en un directorio<br>
     """
-    if len(sys.argv) > 1 and sys.argv[1] in ["-h", "--help"]:
+    args = sys.argv[1:]
+    if args and args[0] in ["-h", "--help"]:
         print_usage()
         return
 
-    if len(sys.argv) > 1 and sys.argv[1] == "--batch":
-        if len(sys.argv) < 3:
+    jobs = os.cpu_count() or 1
+    if args and args[0] in ["-j", "--jobs"]:
+        if len(args) < 2 or not args[1].isdigit() or int(args[1]) < 1:
+            print("[ERROR] -j requiere un número de procesos mayor que 0")
+            sys.exit(1)
+        jobs = int(args[1])
+        args = args[2:]
+
+    if args and args[0] == "--batch":
+        if len(args) < 2:
             print("[ERROR] Modo por lotes requiere directorio de entrada")
             print(
                 "Uso: python -m visualization --batch <directorio_entrada> [directorio_salida]"
             )
             sys.exit(1)
 
-        input_dir = sys.argv[2]
-        output_dir = sys.argv[3] if len(sys.argv) > 3 else "data/diagramas/batch"
+        input_dir = args[1]
+        output_dir = args[2] if len(args) > 2 else "data/diagramas/batch"
 
-        processor = BatchProcessor(input_dir, output_dir)
+        processor = BatchProcessor(input_dir, output_dir, jobs)
         processor.process_all()
         return
 
     metrics_file = "data/resultados/metrics.jsonl"
     output_dir = "data/diagramas"
 
-    if len(sys.argv) > 1:
-        metrics_file = sys.argv[1]
-    if len(sys.argv) > 2:
-        output_dir = sys.argv[2]
+    if len(args) > 0:
+        metrics_file = args[0]
+    if len(args) > 1:
+        output_dir = args[1]
 
-    visualizer = MetricsVisualizer(metrics_file, output_dir)
+    visualizer = MetricsVisualizer(metrics_file, output_dir, jobs)
     visualizer.generate_all()
 
 
@@ -6,12 +6,15 @@ Proporciona funcionalidad para generar diagramas de múltiples archivos
 de métricas en una sola ejecución.
 """
 
-import os
+from concurrent.futures import ProcessPoolExecutor
 from pathlib import Path
 from typing import List, Optional
 
-from visualization.data_loader import MetricsLoader
-from visualization.visualizer import MetricsVisualizer
+from visualization.visualizer import (
+    MetricsVisualizer,
+    load_metrics,
+    reset_output_dir,
+)
 
 
 class BatchProcessor:
@@ -19,17 +22,23 @@ class BatchProcessor:
     @brief Procesador por lotes para generación de diagramas.
 
     Permite procesar múltiples archivos de métricas JSONL y generar
-    diagramas para cada uno en subdirectorios separados.
+    diagramas para cada uno en subdirectorios separados. Con más de un
+    proceso, la carga de los archivos y cada diagrama se reparten en un
+    mismo pool: los diagramas de un archivo se encolan apenas termina su
+    carga, mientras los demás archivos siguen cargándose.
     """
 
-    def __init__(self, input_dir: str, output_dir: str):
+    def __init__(self, input_dir: str, output_dir: str, jobs: int = 1):
         """
         @brief Constructor de BatchProcessor.
         @param input_dir Directorio con archivos de métricas JSONL.
         @param output_dir Directorio base de salida para diagramas.
+        @param jobs Procesos para cargar archivos y generar diagramas
+        (1 = en secuencia).
         """
         self._input_dir = Path(input_dir)
         self._output_dir = Path(output_dir)
+        self._jobs = jobs
         self._processed_files: List[str] = []
         self._failed_files: List[str] = []
 
@@ -102,9 +111,49 @@ class BatchProcessor:
 
         self._output_dir.mkdir(parents=True, exist_ok=True)
 
+        if self._jobs > 1:
+            self._process_parallel(metrics_files)
+            return
+
         for i, metrics_file in enumerate(metrics_files, 1):
             relative_path = metrics_file.relative_to(self._input_dir)
             output_subdir = str(relative_path.parent / relative_path.stem)
 
             print(f"\n[{i}/{len(metrics_files)}] Procesando: {relative_path}")
             self.process_file(metrics_file, output_subdir)
+
+    def _process_parallel(self, metrics_files: List[Path]) -> None:
+        """
+        @brief Procesa los archivos en un pool de procesos.
+        @param metrics_files Archivos de métricas a procesar.
+        """
+        with ProcessPoolExecutor(max_workers=self._jobs) as pool:
+            loads = [pool.submit(load_metrics, str(f)) for f in metrics_files]
+
+            # Los diagramas de cada archivo se encolan al terminar su carga.
+            charts = []
+            for metrics_file, load in zip(metrics_files, loads):
+                relative_path = metrics_file.relative_to(self._input_dir)
+                output_path = self._output_dir / relative_path.parent / relative_path.stem
+                visualizer = MetricsVisualizer(str(metrics_file), str(output_path))
+                try:
+                    load.result()
+                    reset_output_dir(output_path)
+                    charts.append(visualizer.submit_charts(pool))
+                except Exception as e:
+                    charts.append(e)
+
+            for i, (metrics_file, load, futures) in enumerate(
+                zip(metrics_files, loads, charts), 1
+            ):
+                relative_path = metrics_file.relative_to(self._input_dir)
+                print(f"\n[{i}/{len(metrics_files)}] Procesando: {relative_path}")
+                if isinstance(futures, Exception):
+                    print(f"[ERROR] Error procesando {metrics_file}: {futures}")
+                    self._failed_files.append(str(metrics_file))
+                    continue
+                event_count, processes = load.result()
+                print(f"[INFO] Cargados {event_count} eventos")
+                print(f"[INFO] Procesos encontrados: {', '.join(processes)}")
+                MetricsVisualizer.report(futures)
+                self._processed_files.append(str(metrics_file))
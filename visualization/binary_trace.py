@@ -0,0 +1,347 @@
+import mmap
+import struct
+from typing import Any, Dict, Iterator, List
+
+MAGIC = b"OSST"
+VERSION = 4
+HEADER_SIZE = 8
+
+RECORD_STRING = 0x01
+RECORD_TICK = 0x02
+RECORD_CPU_SUMMARY = 0x03
+RECORD_MEMORY_SUMMARY = 0x04
+RECORD_CORE_SUMMARY = 0x05
+RECORD_NUMA_SUMMARY = 0x06
+
+SECTION_CPU = 1 << 0
+SECTION_IO = 1 << 1
+SECTION_MEMORY = 1 << 2
+SECTION_TRANSITIONS = 1 << 3
+SECTION_QUEUES = 1 << 4
+SECTION_PAGE_TABLE = 1 << 5
+SECTION_FRAME_STATUS = 1 << 6
+SECTION_PAGE_TABLE_DELTA = 1 << 7
+SECTION_FRAME_STATUS_DELTA = 1 << 8
+SECTION_CORES = 1 << 9
+SECTION_IO_DEVICES = 1 << 10
+
+LATENCY_ALL = 0
+LATENCY_PRIORITY = 1
+LATENCY_DEVICE = 2
+
+
+def is_binary_trace(path: str) -> bool:
+    """
+    @brief Indica si un archivo de métricas usa el formato binario compacto.
+    @param path Ruta al archivo de métricas.
+    @return True si el archivo comienza con la cabecera de la traza binaria.
+    """
+    with open(path, "rb") as f:
+        return f.read(len(MAGIC)) == MAGIC
+
+
+class _Reader:
+    """
+    @brief Lector secuencial sobre el contenido mapeado de una traza binaria.
+    """
+
+    def __init__(self, data):
+        self._data = data
+        self.pos = HEADER_SIZE
+        self.strings: List[str] = []
+
+    def at_end(self) -> bool:
+        return self.pos >= len(self._data)
+
+    def byte(self) -> int:
+        value = self._data[self.pos]
+        self.pos += 1
+        return value
+
+    def varint(self) -> int:
+        value = 0
+        shift = 0
+        while True:
+            b = self.byte()
+            value |= (b & 0x7F) << shift
+            if not b & 0x80:
+                return value
+            shift += 7
+
+    def integer(self) -> int:
+        raw = self.varint()
+        return (raw >> 1) ^ -(raw & 1)
+
+    def real(self) -> float:
+        (value,) = struct.unpack_from("<d", self._data, self.pos)
+        self.pos += 8
+        return value
+
+    def string(self) -> str:
+        return self.strings[self.varint()]
+
+    def int_list(self) -> List[int]:
+        return [self.integer() for _ in range(self.varint())]
+
+
+def _read_io(r: _Reader) -> Dict[str, Any]:
+    return {
+        "device": r.string(),
+        "event": r.string(),
+        "name": r.string(),
+        "pid": r.integer(),
+        "queue": r.varint(),
+        "remaining": r.integer(),
+    }
+
+
+def _read_latency(r: _Reader) -> Dict[str, Any]:
+    """
+    @brief Lee las filas de percentiles de latencia de un resumen de CPU.
+
+    @return Diccionario con la misma forma que la clave "latency" de la traza
+            JSONL (vacío si no hay filas).
+    """
+    latency: Dict[str, Any] = {}
+    for _ in range(r.varint()):
+        scope = r.byte()
+        key = r.string()
+        metric = r.string()
+        values = {"count": r.varint()}
+        for name in ("p50", "p95", "p99", "max"):
+            values[name] = r.integer()
+        if scope == LATENCY_ALL:
+            latency[metric] = values
+        elif scope == LATENCY_PRIORITY:
+            latency.setdefault("by_priority", {}).setdefault(
+                key, {})[metric] = values
+        elif scope == LATENCY_DEVICE:
+            latency.setdefault("io_queue_delay", {})[key] = values
+    return latency
+
+
+def _read_tick(r: _Reader, tick: int) -> Dict[str, Any]:
+    mask = r.varint()
+    record: Dict[str, Any] = {}
+
+    if mask & SECTION_CORES:
+        cores = []
+        for _ in range(r.varint()):
+            cores.append({
+                "context_switch": r.byte() != 0,
+                "core": r.integer(),
+                "event": r.string(),
+                "name": r.string(),
+                "pid": r.integer(),
+                "ready_queue": r.varint(),
+                "remaining": r.integer(),
+            })
+        record["cores"] = cores
+
+    if mask & SECTION_CPU:
+        record["cpu"] = {
+            "context_switch": r.byte() != 0,
+            "event": r.string(),
+            "name": r.string(),
+            "pid": r.integer(),
+            "ready_queue": r.varint(),
+            "remaining": r.integer(),
+        }
+
+    if mask & (SECTION_FRAME_STATUS | SECTION_FRAME_STATUS_DELTA):
+        frames = []
+        for _ in range(r.varint()):
+            frames.append({
+                "frame": r.integer(),
+                "occupied": r.byte() != 0,
+                "page": r.integer(),
+                "pid": r.integer(),
+            })
+        key = ("frame_status" if mask & SECTION_FRAME_STATUS
+               else "frame_status_delta")
+        record[key] = frames
+
+    if mask & SECTION_IO:
+        record["io"] = _read_io(r)
+
+    if mask & SECTION_IO_DEVICES:
+        record["io_devices"] = [_read_io(r) for _ in range(r.varint())]
+
+    if mask & SECTION_MEMORY:
+        record["memory"] = {
+            "event": r.string(),
+            "frame_id": r.integer(),
+            "name": r.string(),
+            "page_id": r.integer(),
+            "pid": r.integer(),
+            "total_page_faults": r.integer(),
+            "total_replacements": r.integer(),
+        }
+
+    if mask & (SECTION_PAGE_TABLE | SECTION_PAGE_TABLE_DELTA):
+        name = r.string()
+        pages = []
+        for _ in range(r.varint()):
+            frame = r.integer()
+            page = r.integer()
+            flags = r.byte()
+            pages.append({
+                "frame": frame,
+                "modified": bool(flags & 1),
+                "page": page,
+                "referenced": bool(flags & 2),
+                "valid": bool(flags & 4),
+            })
+        key = "page_table" if mask & SECTION_PAGE_TABLE else "page_table_delta"
+        record[key] = {"name": name, "pages": pages, "pid": r.integer()}
+
+    if mask & SECTION_QUEUES:
+        record["queues"] = {
+            "blocked_io": r.int_list(),
+            "blocked_memory": r.int_list(),
+            "ready": r.int_list(),
+            "running": r.integer(),
+        }
+
+    if mask & SECTION_TRANSITIONS:
+        transitions = []
+        for _ in range(r.varint()):
+            transitions.append({
+                "from": r.string(),
+                "name": r.string(),
+                "pid": r.integer(),
+                "reason": r.string(),
+                "to": r.string(),
+            })
+        record["state_transitions"] = transitions
+
+    record["tick"] = tick
+    return record
+
+
+def iter_binary_trace(path: str) -> Iterator[Dict[str, Any]]:
+    """
+    @brief Decodifica una traza binaria registro a registro, con los mismos
+    diccionarios que produciría el archivo JSONL equivalente.
+
+    El archivo se mapea en memoria y se decodifica en una sola pasada, sin
+    retener los registros ya entregados.
+
+    @param path Ruta a la traza binaria.
+    @return Iterador de registros (ticks y resúmenes) en orden de escritura.
+    """
+    with open(path, "rb") as f:
+        with mmap.mmap(f.fileno(), 0, access=mmap.ACCESS_READ) as data:
+            if data[:len(MAGIC)] != MAGIC or data[len(MAGIC)] != VERSION:
+                raise ValueError(f"Traza binaria no válida: {path}")
+
+            r = _Reader(data)
+            tick = 0
+            while not r.at_end():
+                kind = r.byte()
+                if kind == RECORD_STRING:
+                    length = r.varint()
+                    r.strings.append(
+                        bytes(data[r.pos:r.pos + length]).decode("utf-8"))
+                    r.pos += length
+                elif kind == RECORD_TICK:
+                    tick += r.integer()
+                    yield _read_tick(r, tick)
+                elif kind == RECORD_CPU_SUMMARY:
+                    algorithm = r.string()
+                    total_time = r.integer()
+                    context_switches = r.integer()
+                    utilization, waiting, turnaround, response = (
+                        r.real() for _ in range(4))
+                    latency = _read_latency(r)
+                    record = {
+                        "algorithm": algorithm,
+                        "avg_response_time": response,
+                        "avg_turnaround_time": turnaround,
+                        "avg_waiting_time": waiting,
+                        "context_switches": context_switches,
+                        "cpu_utilization": utilization,
+                        "summary": "CPU_METRICS",
+                        "total_time": total_time,
+                    }
+                    if latency:
+                        record["latency"] = latency
+                    yield record
+                elif kind == RECORD_CORE_SUMMARY:
+                    core, total_time, busy, switches, migrations, steals = (
+                        r.integer() for _ in range(6))
+                    yield {
+                        "busy_ticks": busy,
+                        "context_switches": switches,
+                        "core": core,
+                        "migrations": migrations,
+                        "steals": steals,
+                        "summary": "CORE_METRICS",
+                        "total_time": total_time,
+                        "utilization":
+                            100.0 * busy / total_time
+                            if total_time > 0 else 0.0,
+                    }
+                elif kind == RECORD_MEMORY_SUMMARY:
+                    algorithm = r.string()
+                    faults = r.integer()
+                    replacements = r.integer()
+                    total_frames = r.integer()
+                    used_frames = r.integer()
+                    completed = r.integer()
+                    total_time = r.integer()
+                    deferred = r.integer()
+                    deferral_ticks = r.integer()
+                    tlb_hits = r.integer()
+                    tlb_misses = r.integer()
+                    translations = tlb_hits + tlb_misses
+                    yield {
+                        "algorithm": algorithm,
+                        "completed_processes": completed,
+                        "deferral_ticks": deferral_ticks,
+                        "deferred_admissions": deferred,
+                        "frame_utilization":
+                            100.0 * used_frames / total_frames
+                            if total_frames > 0 else 0.0,
+                        "summary": "MEMORY_METRICS",
+                        "throughput":
+                            completed / total_time if total_time > 0 else 0.0,
+                        "tlb_hit_rate":
+                            100.0 * tlb_hits / translations
+                            if translations > 0 else 0.0,
+                        "tlb_hits": tlb_hits,
+                        "tlb_misses": tlb_misses,
+                        "total_frames": total_frames,
+                        "total_page_faults": faults,
+                        "total_replacements": replacements,
+                        "total_time": total_time,
+                        "used_frames": used_frames,
+                    }
+                elif kind == RECORD_NUMA_SUMMARY:
+                    (node, frames, faults, local, remote, remote_loads,
+                     stall) = (r.integer() for _ in range(7))
+                    accesses = local + remote
+                    yield {
+                        "frames": frames,
+                        "local_accesses": local,
+                        "locality":
+                            100.0 * local / accesses if accesses > 0 else 0.0,
+                        "node": node,
+                        "page_faults": faults,
+                        "remote_accesses": remote,
+                        "remote_loads": remote_loads,
+                        "remote_stall_ticks": stall,
+                        "summary": "NUMA_METRICS",
+                    }
+                else:
+                    raise ValueError(
+                        f"Registro desconocido {kind:#x} en {path}")
+
+
+def load_binary_trace(path: str) -> List[Dict[str, Any]]:
+    """
+    @brief Carga una traza binaria completa en memoria.
+    @param path Ruta a la traza binaria.
+    @return Lista de registros (ticks y resúmenes) en orden de escritura.
+    """
+    return list(iter_binary_trace(path))
@@ -0,0 +1,141 @@
+from pathlib import Path
+from typing import Dict, List, Any, Tuple
+from collections import defaultdict
+
+import matplotlib.pyplot as plt
+
+from visualization.base_generator import BaseGenerator
+from visualization.data_loader import MetricsLoader
+
+
+class CoreGanttChartGenerator(BaseGenerator):
+    """
+    @brief Generador de diagrama de Gantt por núcleo de CPU.
+
+    Muestra, para cada núcleo del modo multinúcleo, qué proceso ocupó el
+    núcleo en cada tick. Los ticks de migración y de espera por memoria
+    NUMA remota se dibujan rayados.
+    Las trazas de un solo núcleo no incluyen eventos por núcleo y se omiten.
+    """
+
+    def __init__(self, output_dir: Path):
+        """
+        @brief Constructor de CoreGanttChartGenerator.
+        @param output_dir Directorio de salida para el gráfico.
+        """
+        super().__init__(output_dir)
+
+    def generate(self, loader: MetricsLoader) -> None:
+        """
+        @brief Genera el diagrama de Gantt por núcleo.
+        @param loader Instancia de MetricsLoader con datos cargados.
+        """
+        core_events = loader.get_core_events()
+
+        if not core_events:
+            print("[INFO] No hay eventos por núcleo para visualizar")
+            return
+
+        segments = self._build_segments(core_events)
+        num_cores = max(e["core"] for e in core_events) + 1
+        max_tick = loader.get_max_tick()
+
+        fig, ax = plt.subplots(figsize=(18, max(4, num_cores * 0.8 + 2)))
+
+        migrate_legend_added = False
+        for core in range(num_cores):
+            for name, start, end, migrating in segments.get(core, []):
+                label = None
+                if migrating and not migrate_legend_added:
+                    label = "Migración o espera remota"
+                    migrate_legend_added = True
+                ax.barh(
+                    core,
+                    end - start,
+                    left=start,
+                    height=0.7,
+                    color=self.get_process_color(name),
+                    alpha=0.5 if migrating else 0.9,
+                    hatch="///" if migrating else None,
+                    edgecolor="#374151",
+                    linewidth=self.STYLE["bar_edge_width"],
+                    label=label,
+                )
+                if not migrating and end - start >= 3:
+                    ax.text(
+                        start + (end - start) / 2,
+                        core,
+                        name,
+                        ha="center",
+                        va="center",
+                        fontsize=self.FONT_SIZES["annotation"],
+                        fontweight="bold",
+                        color="black",
+                    )
+
+        ax.set_yticks(list(range(num_cores)))
+        ax.set_yticklabels(
+            [f"Núcleo {core}" for core in range(num_cores)],
+            fontsize=self.FONT_SIZES["tick_label"],
+            fontweight="bold",
+        )
+
+        self.style_axis(
+            ax,
+            xlabel="Tiempo (ticks)",
+            ylabel="Núcleo",
+            title="Diagrama de Gantt - Núcleos de CPU",
+            grid_axis="x",
+        )
+
+        self.configure_axis_ticks(
+            ax, x_data=list(range(max_tick + 1)), integer_x=True, integer_y=False
+        )
+        ax.set_xlim(left=0)
+
+        if migrate_legend_added:
+            ax.legend(loc="upper right", fontsize=self.FONT_SIZES["legend"])
+
+        self.save_figure("11_core_gantt_chart.png")
+
+    def _build_segments(
+        self, core_events: List[Dict[str, Any]]
+    ) -> Dict[int, List[Tuple[str, int, int, bool]]]:
+        """
+        @brief Agrupa los ticks consecutivos de un mismo proceso en un núcleo.
+        @param core_events Lista de eventos por núcleo.
+        @return Diccionario con el núcleo como clave y segmentos
+        (proceso, inicio, fin, migración).
+        """
+        segments: Dict[int, List[Tuple[str, int, int, bool]]] = defaultdict(list)
+        open_segments: Dict[int, List[Any]] = {}
+
+        for event in sorted(core_events, key=lambda e: (e["core"], e["tick"])):
+            core = event["core"]
+            tick = event["tick"]
+            name = event["name"]
+            migrating = event["event"] in ("MIGRATE", "REMOTE_STALL")
+
+            if event["event"] == "IDLE" or not name:
+                if core in open_segments:
+                    segments[core].append(tuple(open_segments.pop(core)))
+                continue
+
+            current = open_segments.get(core)
+            if (
+                current is not None
+                and current[0] == name
+                and current[2] == tick
+                and current[3] == migrating
+            ):
+                current[2] = tick + 1
+                continue
+
+            if current is not None:
+                segments[core].append(tuple(current))
+            open_segments[core] = [name, tick, tick + 1, migrating]
+
+        for core, current in open_segments.items():
+            segments[core].append(tuple(current))
+
+        return segments
@@ -1,6 +1,234 @@
 import json
+import os
+import sys
+from array import array
 from pathlib import Path
-from typing import List, Dict, Any, Set
+from typing import List, Dict, Any, Iterable, Optional
+
+from visualization.binary_trace import is_binary_trace, iter_binary_trace
+
+try:
+    from orjson import loads as _json_loads
+except ImportError:
+    from json import loads as _json_loads
+
+
+class _Strings:
+    """
+    @brief Tabla de cadenas internadas: cada columna de texto guarda índices.
+    """
+
+    def __init__(self):
+        self.values: List[Optional[str]] = []
+        self._ids: Dict[Optional[str], int] = {}
+
+    def id(self, value: Optional[str]) -> int:
+        """
+        @brief Obtiene el índice de una cadena, agregándola si es nueva.
+        @param value Cadena a internar (None se admite como valor).
+        @return Índice de la cadena en values.
+        """
+        index = self._ids.get(value)
+        if index is None:
+            index = self._ids[value] = len(self.values)
+            self.values.append(value)
+        return index
+
+
+class _ColumnBuilder:
+    """
+    @brief Construye las columnas de MetricsLoader en una sola pasada.
+
+    Cada registro se reduce a los valores que usan los diagramas y se
+    descarta; los números se acumulan en arreglos compactos y los textos
+    como índices de una tabla de cadenas. Los deltas de marcos y tablas de
+    páginas se aplican sobre el último estado conocido sin reconstruir las
+    instantáneas completas de cada tick.
+    """
+
+    def __init__(self):
+        self.strings = _Strings()
+        self.columns: Dict[str, array] = {
+            name: array("q")
+            for name in (
+                # Transiciones de estado.
+                "transition_tick", "transition_name", "transition_from",
+                "transition_to", "transition_reason",
+                # Cambios de contexto de procesos (pid > 0).
+                "switch_tick", "switch_name", "switch_event",
+                # Colas.
+                "queue_tick", "queue_ready", "queue_blocked_memory",
+                "queue_blocked_io",
+                # Memoria.
+                "frame_tick", "frame_used", "fault_tick", "fault_total",
+                # Dispositivos de E/S.
+                "io_tick", "io_device", "io_event", "io_pid", "io_name",
+                "io_remaining", "io_queue",
+                # Núcleos.
+                "core_tick", "core", "core_event", "core_pid", "core_name",
+                "core_remaining", "core_queue",
+            )
+        }
+        self.event_count = 0
+        self.max_tick = 0
+        self.context_switches = 0
+        self.max_page_faults = 0
+        self.max_replacements = 0
+        self.processes = set()
+        self.frames: Dict[int, Dict[str, Any]] = {}
+        self.occupied = 0
+        self.page_tables: Dict[int, Dict[int, Dict[str, Any]]] = {}
+        self.page_table_headers: Dict[str, Dict[str, Any]] = {}
+
+    def add_all(self, events: Iterable[Dict[str, Any]]) -> None:
+        """
+        @brief Agrega una secuencia de registros.
+        @param events Registros en orden de escritura.
+        """
+        for event in events:
+            self.add(event)
+
+    def add(self, event: Dict[str, Any]) -> None:
+        """
+        @brief Agrega un registro (tick o resumen).
+        @param event Registro tal como aparece en el archivo JSONL.
+        """
+        c = self.columns
+        sid = self.strings.id
+        self.event_count += 1
+        self.max_tick = max(self.max_tick, event.get("tick", 0))
+        tick = event.get("tick", -1)
+
+        cpu = event.get("cpu")
+        if cpu is not None:
+            pid = cpu.get("pid", -1)
+            if pid > 0:
+                self.processes.add(cpu["name"])
+            if cpu.get("context_switch", False):
+                self.context_switches += 1
+                if pid > 0:
+                    c["switch_tick"].append(tick)
+                    c["switch_name"].append(sid(cpu.get("name")))
+                    c["switch_event"].append(sid(cpu.get("event")))
+
+        transitions = event.get("state_transitions")
+        if transitions is not None:
+            for trans in transitions:
+                self.processes.add(trans["name"])
+                c["transition_tick"].append(tick)
+                c["transition_name"].append(sid(trans["name"]))
+                c["transition_from"].append(sid(trans.get("from")))
+                c["transition_to"].append(sid(trans["to"]))
+                c["transition_reason"].append(sid(trans.get("reason")))
+
+        queues = event.get("queues")
+        if queues is not None:
+            c["queue_tick"].append(tick)
+            c["queue_ready"].append(len(queues.get("ready", [])))
+            c["queue_blocked_memory"].append(
+                len(queues.get("blocked_memory", [])))
+            c["queue_blocked_io"].append(len(queues.get("blocked_io", [])))
+
+        if "frame_status" in event:
+            self.frames = {f["frame"]: f for f in event["frame_status"]}
+            self.occupied = sum(
+                1 for f in self.frames.values() if f.get("occupied", False))
+            c["frame_tick"].append(tick)
+            c["frame_used"].append(self.occupied)
+        elif "frame_status_delta" in event:
+            for f in event["frame_status_delta"]:
+                old = self.frames.get(f["frame"])
+                if old is not None and old.get("occupied", False):
+                    self.occupied -= 1
+                if f.get("occupied", False):
+                    self.occupied += 1
+                self.frames[f["frame"]] = f
+            c["frame_tick"].append(tick)
+            c["frame_used"].append(self.occupied)
+
+        memory = event.get("memory")
+        if memory is not None:
+            total_faults = memory.get("total_page_faults", 0)
+            if total_faults > 0:
+                c["fault_tick"].append(tick)
+                c["fault_total"].append(total_faults)
+            self.max_page_faults = max(self.max_page_faults, total_faults)
+            self.max_replacements = max(
+                self.max_replacements, memory.get("total_replacements", 0))
+
+        if "page_table" in event:
+            pt = event["page_table"]
+            self.page_tables[pt["pid"]] = {p["page"]: p for p in pt["pages"]}
+            self._add_page_table_header(pt)
+        elif "page_table_delta" in event:
+            pt = event["page_table_delta"]
+            pages = self.page_tables.setdefault(pt["pid"], {})
+            for p in pt["pages"]:
+                pages[p["page"]] = p
+            self._add_page_table_header(pt)
+
+        if "io" in event:
+            self._add_io(tick, event["io"])
+        for io in event.get("io_devices", ()):
+            self._add_io(tick, io)
+
+        for core in event.get("cores", ()):
+            c["core_tick"].append(tick)
+            c["core"].append(core.get("core", 0))
+            c["core_event"].append(sid(core.get("event", "")))
+            c["core_pid"].append(core.get("pid", -1))
+            c["core_name"].append(sid(core.get("name", "")))
+            c["core_remaining"].append(core.get("remaining", 0))
+            c["core_queue"].append(core.get("ready_queue", 0))
+
+    def _add_io(self, tick: int, io: Dict[str, Any]) -> None:
+        c = self.columns
+        sid = self.strings.id
+        c["io_tick"].append(tick)
+        c["io_device"].append(sid(io.get("device", "")))
+        c["io_event"].append(sid(io.get("event", "")))
+        c["io_pid"].append(io.get("pid", -1))
+        c["io_name"].append(sid(io.get("name", "")))
+        c["io_remaining"].append(io.get("remaining", 0))
+        c["io_queue"].append(io.get("queue", 0))
+
+    def _add_page_table_header(self, pt: Dict[str, Any]) -> None:
+        name = pt.get("name")
+        if name:
+            self.page_table_headers[name] = {
+                k: v for k, v in pt.items() if k != "pages"}
+
+    def finish(self) -> Dict[str, Any]:
+        """
+        @brief Entrega las columnas y los estados finales.
+        @return Diccionario serializable con los datos cargados.
+        """
+        page_tables = {}
+        for name, header in self.page_table_headers.items():
+            pages = self.page_tables.get(header["pid"], {})
+            page_tables[name] = dict(
+                header, pages=[pages[k] for k in sorted(pages)])
+
+        def sort_key(name: str):
+            if name and len(name) > 1:
+                try:
+                    return int(name[1:])
+                except ValueError:
+                    pass
+            return float("inf")
+
+        return {
+            "columns": self.columns,
+            "strings": self.strings.values,
+            "event_count": self.event_count,
+            "max_tick": self.max_tick,
+            "context_switches": self.context_switches,
+            "max_page_faults": self.max_page_faults,
+            "max_replacements": self.max_replacements,
+            "processes": sorted(self.processes, key=sort_key),
+            "page_tables": page_tables,
+            "final_frame_status": [self.frames[k] for k in sorted(self.frames)],
+        }
 
 
 class MetricsLoader:
@@ -8,25 +236,43 @@ class MetricsLoader:
     @brief Clase encargada de cargar métricas desde archivos JSONL.
 
     Proporciona funcionalidad para leer archivos de métricas en formato JSONL
-    y extraer información sobre procesos y eventos del sistema.
+    o traza binaria y extraer información sobre procesos y eventos del
+    sistema. Los registros se leen por bloques y se reducen a columnas
+    (arreglos de enteros y una tabla de cadenas) sin conservar los
+    diccionarios de cada tick; el resultado se guarda junto al archivo de
+    entrada (sufijo CACHE_SUFFIX) y se reutiliza mientras el archivo no
+    cambie.
     """
 
-    def __init__(self, metrics_file: str):
+    CACHE_SUFFIX = ".cache"
+    """@brief Sufijo del archivo con las columnas ya procesadas."""
+
+    CACHE_MAGIC = b"OSSIMCOL"
+    """@brief Bytes iniciales de un archivo de caché."""
+
+    CACHE_VERSION = 2
+    """@brief Versión del formato de la caché; otra versión se descarta."""
+
+    CHUNK_BYTES = 1 << 24
+    """@brief Bytes de JSONL leídos por bloque."""
+
+    def __init__(self, metrics_file: str, use_cache: bool = True):
         """
         @brief Constructor de MetricsLoader.
         @param metrics_file Ruta al archivo de métricas en formato JSONL.
+        @param use_cache Si leer y escribir la caché junto al archivo.
         """
         self._metrics_file = metrics_file
-        self._metrics: List[Dict[str, Any]] = []
-        self._processes: List[str] = []
+        self._use_cache = use_cache
+        self._data: Dict[str, Any] = _ColumnBuilder().finish()
 
     @property
-    def metrics(self) -> List[Dict[str, Any]]:
+    def event_count(self) -> int:
         """
-        @brief Obtiene la lista de métricas cargadas.
-        @return Lista de diccionarios con las métricas.
+        @brief Obtiene la cantidad de registros leídos.
+        @return Número de registros (ticks y resúmenes).
         """
-        return self._metrics
+        return self._data["event_count"]
 
     @property
     def processes(self) -> List[str]:
@@ -34,52 +280,135 @@ class MetricsLoader:
         @brief Obtiene la lista de procesos identificados.
         @return Lista de nombres de procesos ordenados.
         """
-        return self._processes
+        return self._data["processes"]
 
-    def load(self) -> None:
+    @property
+    def cache_file(self) -> Path:
         """
-        @brief Carga las métricas desde el archivo JSONL.
-
-        Lee el archivo línea por línea, parseando cada línea como JSON.
-        Identifica automáticamente todos los procesos presentes en los datos.
+        @brief Obtiene la ruta de la caché de columnas.
+        @return Ruta del archivo de caché junto al archivo de métricas.
         """
-        with open(self._metrics_file, "r") as f:
-            self._metrics = [json.loads(line) for line in f if line.strip()]
-
-        self._extract_processes()
+        return Path(str(self._metrics_file) + self.CACHE_SUFFIX)
 
-    def _extract_processes(self) -> None:
+    def load(self) -> None:
         """
-        @brief Extrae los nombres de procesos únicos de las métricas.
+        @brief Carga las métricas desde la caché, el archivo JSONL o la traza
+        binaria.
 
-        Busca procesos en eventos de CPU y transiciones de estado.
-        Ordena los procesos numéricamente (P1, P2, P10) en lugar de alfabéticamente.
+        Si la caché existe y corresponde al archivo actual (mismo tamaño y
+        fecha de modificación) se usa directamente. Si no, el JSONL se lee
+        por bloques de CHUNK_BYTES y cada línea se decodifica con orjson si
+        está instalado; una traza binaria se decodifica registro a registro.
+        Identifica automáticamente todos los procesos presentes en los datos.
         """
-        processes: Set[str] = set()
-
-        for event in self._metrics:
-            if "cpu" in event and event["cpu"].get("pid", -1) > 0:
-                processes.add(event["cpu"]["name"])
-            if "state_transitions" in event:
-                for trans in event["state_transitions"]:
-                    processes.add(trans["name"])
-
-        def sort_key(name: str):
-            if name and len(name) > 1:
-                try:
-                    return int(name[1:])
-                except ValueError:
-                    pass
-            return float("inf")
-
-        self._processes = sorted(list(processes), key=sort_key)
+        if self._use_cache and self._load_cache():
+            return
+
+        builder = _ColumnBuilder()
+        if is_binary_trace(self._metrics_file):
+            builder.add_all(iter_binary_trace(self._metrics_file))
+        else:
+            with open(self._metrics_file, "rb") as f:
+                while True:
+                    lines = f.readlines(self.CHUNK_BYTES)
+                    if not lines:
+                        break
+                    builder.add_all(
+                        _json_loads(line) for line in lines if line.strip())
+        self._data = builder.finish()
+
+        if self._use_cache:
+            self._save_cache()
+
+    def _source_signature(self) -> List[int]:
+        stat = os.stat(self._metrics_file)
+        return [stat.st_size, stat.st_mtime_ns]
+
+    def _load_cache(self) -> bool:
+        """
+        @brief Carga las columnas desde la caché si es válida.
+
+        La caché solo contiene datos: una cabecera JSON y los bytes de cada
+        columna. La cabecera se valida (versión, archivo de origen, orden de
+        bytes, nombres y largos de las columnas) antes de construir los
+        arreglos; cualquier discrepancia descarta la caché.
+
+        @return True si se usó la caché.
+        """
+        try:
+            with open(self.cache_file, "rb") as f:
+                if f.read(len(self.CACHE_MAGIC)) != self.CACHE_MAGIC:
+                    return False
+                header_size = int.from_bytes(f.read(8), "little")
+                header = _json_loads(f.read(header_size))
+                if (header["version"] != self.CACHE_VERSION
+                        or header["source"] != self._source_signature()
+                        or header["byteorder"] != sys.byteorder):
+                    return False
+
+                data = _ColumnBuilder().finish()
+                lengths = header["columns"]
+                if (not isinstance(lengths, dict)
+                        or lengths.keys() != data["columns"].keys()
+                        or header["data"].keys() != data.keys() - {"columns"}):
+                    return False
+                for name, column in data["columns"].items():
+                    length = lengths[name]
+                    if not isinstance(length, int) or length < 0:
+                        return False
+                    blob = f.read(length * column.itemsize)
+                    if len(blob) != length * column.itemsize:
+                        return False
+                    column.frombytes(blob)
+                if f.read(1):
+                    return False
+            data.update(header["data"])
+            self._data = data
+            return True
+        except (OSError, AttributeError, KeyError, TypeError, ValueError):
+            return False
+
+    def _save_cache(self) -> None:
+        """
+        @brief Guarda las columnas junto al archivo de métricas.
+
+        Se escribe en un archivo temporal y se renombra, para que otro
+        proceso nunca lea una caché a medio escribir. Un error al escribir
+        (por ejemplo, un directorio de solo lectura) no es fatal.
+        """
+        columns = self._data["columns"]
+        header = json.dumps({
+            "version": self.CACHE_VERSION,
+            "source": self._source_signature(),
+            "byteorder": sys.byteorder,
+            "columns": {name: len(column) for name, column in columns.items()},
+            "data": {k: v for k, v in self._data.items() if k != "columns"},
+        }).encode("utf-8")
+
+        temporary = Path(f"{self.cache_file}.{os.getpid()}.tmp")
+        try:
+            with open(temporary, "wb") as f:
+                f.write(self.CACHE_MAGIC)
+                f.write(len(header).to_bytes(8, "little"))
+                f.write(header)
+                for column in columns.values():
+                    f.write(column.tobytes())
+            os.replace(temporary, self.cache_file)
+        except OSError:
+            try:
+                temporary.unlink()
+            except OSError:
+                pass
+
+    def _column(self, name: str) -> array:
+        return self._data["columns"][name]
 
     def get_max_tick(self) -> int:
         """
         @brief Obtiene el tick máximo registrado en las métricas.
         @return Valor del tick máximo.
         """
-        return max(e.get("tick", 0) for e in self._metrics)
+        return self._data["max_tick"]
 
     def get_state_transitions(self) -> Dict[str, List[Dict[str, Any]]]:
         """
@@ -87,17 +416,18 @@ class MetricsLoader:
         @return Diccionario con nombre de proceso como clave y lista de transiciones.
         """
         process_states: Dict[str, List[Dict[str, Any]]] = {
-            proc: [] for proc in self._processes
+            proc: [] for proc in self.processes
         }
 
-        for event in self._metrics:
-            tick = event.get("tick", -1)
-            if "state_transitions" in event:
-                for trans in event["state_transitions"]:
-                    name = trans["name"]
-                    to_state = trans["to"]
-                    if name in process_states:
-                        process_states[name].append({"tick": tick, "state": to_state})
+        strings = self._data["strings"]
+        for tick, name, to_state in zip(
+            self._column("transition_tick"),
+            self._column("transition_name"),
+            self._column("transition_to"),
+        ):
+            states = process_states.get(strings[name])
+            if states is not None:
+                states.append({"tick": tick, "state": strings[to_state]})
 
         return process_states
 
@@ -106,26 +436,11 @@ class MetricsLoader:
         @brief Extrae datos de evolución de colas.
         @return Diccionario con ticks y conteos de cada tipo de cola.
         """
-        ticks = []
-        ready_counts = []
-        blocked_memory_counts = []
-        blocked_io_counts = []
-
-        for event in self._metrics:
-            if "queues" in event:
-                tick = event.get("tick", -1)
-                queues = event["queues"]
-
-                ticks.append(tick)
-                ready_counts.append(len(queues.get("ready", [])))
-                blocked_memory_counts.append(len(queues.get("blocked_memory", [])))
-                blocked_io_counts.append(len(queues.get("blocked_io", [])))
-
         return {
-            "ticks": ticks,
-            "ready": ready_counts,
-            "blocked_memory": blocked_memory_counts,
-            "blocked_io": blocked_io_counts,
+            "ticks": self._column("queue_tick").tolist(),
+            "ready": self._column("queue_ready").tolist(),
+            "blocked_memory": self._column("queue_blocked_memory").tolist(),
+            "blocked_io": self._column("queue_blocked_io").tolist(),
         }
 
     def get_memory_data(self) -> Dict[str, List[Any]]:
@@ -133,101 +448,72 @@ class MetricsLoader:
         @brief Extrae datos de uso de memoria.
         @return Diccionario con información de frames y fallos de página.
         """
-        ticks = []
-        used_frames = []
-        page_faults = []
-
-        for event in self._metrics:
-            tick = event.get("tick", -1)
-
-            if "frame_status" in event:
-                frames = event["frame_status"]
-                occupied = sum(1 for f in frames if f.get("occupied", False))
-                ticks.append(tick)
-                used_frames.append(occupied)
-
-            if "memory" in event:
-                mem = event["memory"]
-                total_faults = mem.get("total_page_faults", 0)
-                if total_faults > 0:
-                    page_faults.append({"tick": tick, "total": total_faults})
-
-        return {"ticks": ticks, "used_frames": used_frames, "page_faults": page_faults}
+        page_faults = [
+            {"tick": tick, "total": total}
+            for tick, total in zip(
+                self._column("fault_tick"), self._column("fault_total"))
+        ]
+        return {
+            "ticks": self._column("frame_tick").tolist(),
+            "used_frames": self._column("frame_used").tolist(),
+            "page_faults": page_faults,
+        }
 
     def get_page_tables(self) -> Dict[str, Dict[str, Any]]:
         """
         @brief Obtiene las tablas de páginas finales por proceso.
         @return Diccionario con nombre de proceso y su tabla de páginas.
         """
-        process_page_tables = {}
-
-        for event in self._metrics:
-            if "page_table" in event:
-                pt = event["page_table"]
-                proc_name = pt.get("name")
-                if proc_name:
-                    process_page_tables[proc_name] = pt
-
-        return process_page_tables
+        return self._data["page_tables"]
 
     def get_final_frame_status(self) -> List[Dict[str, Any]]:
         """
         @brief Obtiene el estado final de los marcos de memoria.
         @return Lista de estados de marcos o lista vacía si no hay datos.
         """
-        for event in reversed(self._metrics):
-            if "frame_status" in event:
-                return event["frame_status"]
-        return []
+        return self._data["final_frame_status"]
 
     def get_context_switches(self) -> List[Dict[str, Any]]:
         """
         @brief Extrae los cambios de contexto de CPU.
         @return Lista de eventos de cambio de contexto.
         """
-        context_switches = []
-
-        for event in self._metrics:
-            tick = event.get("tick", -1)
-            if "cpu" in event:
-                cpu = event["cpu"]
-                if cpu.get("context_switch", False) and cpu.get("pid", -1) > 0:
-                    context_switches.append(
-                        {
-                            "tick": tick,
-                            "process": cpu.get("name"),
-                            "event": cpu.get("event"),
-                        }
-                    )
-
-        return context_switches
+        strings = self._data["strings"]
+        return [
+            {"tick": tick, "process": strings[name], "event": strings[event]}
+            for tick, name, event in zip(
+                self._column("switch_tick"),
+                self._column("switch_name"),
+                self._column("switch_event"),
+            )
+        ]
 
     def get_io_operations(self) -> List[Dict[str, Any]]:
         """
         @brief Extrae operaciones de E/S desde transiciones de estado.
         @return Lista de operaciones de E/S (inicio y fin).
         """
+        strings = self._data["strings"]
         io_operations = []
 
-        for event in self._metrics:
-            tick = event.get("tick", -1)
-
-            if "state_transitions" in event:
-                for trans in event["state_transitions"]:
-                    if (
-                        trans.get("to") == "WAITING"
-                        and trans.get("reason") == "io_request"
-                    ):
-                        io_operations.append(
-                            {"start": tick, "name": trans["name"], "type": "start"}
-                        )
-                    elif (
-                        trans.get("from") == "WAITING"
-                        and trans.get("reason") == "io_completed"
-                    ):
-                        io_operations.append(
-                            {"end": tick, "name": trans["name"], "type": "end"}
-                        )
+        for tick, name, from_state, to_state, reason in zip(
+            self._column("transition_tick"),
+            self._column("transition_name"),
+            self._column("transition_from"),
+            self._column("transition_to"),
+            self._column("transition_reason"),
+        ):
+            if strings[to_state] == "WAITING" and strings[reason] == "io_request":
+                io_operations.append(
+                    {"start": tick, "name": strings[name], "type": "start"}
+                )
+            elif (
+                strings[from_state] == "WAITING"
+                and strings[reason] == "io_completed"
+            ):
+                io_operations.append(
+                    {"end": tick, "name": strings[name], "type": "end"}
+                )
 
         return io_operations
 
@@ -236,61 +522,72 @@ class MetricsLoader:
         @brief Extrae eventos de dispositivos de E/S.
         @return Lista de eventos de dispositivos con tick, device, event, pid, name, remaining, queue.
         """
-        io_device_events = []
-
-        for event in self._metrics:
-            tick = event.get("tick", -1)
-
-            if "io" in event:
-                io = event["io"]
-                io_device_events.append(
-                    {
-                        "tick": tick,
-                        "device": io.get("device", ""),
-                        "event": io.get("event", ""),
-                        "pid": io.get("pid", -1),
-                        "name": io.get("name", ""),
-                        "remaining": io.get("remaining", 0),
-                        "queue_size": io.get("queue", 0),
-                    }
-                )
-
-        return io_device_events
+        strings = self._data["strings"]
+        return [
+            {
+                "tick": tick,
+                "device": strings[device],
+                "event": strings[event],
+                "pid": pid,
+                "name": strings[name],
+                "remaining": remaining,
+                "queue_size": queue,
+            }
+            for tick, device, event, pid, name, remaining, queue in zip(
+                self._column("io_tick"),
+                self._column("io_device"),
+                self._column("io_event"),
+                self._column("io_pid"),
+                self._column("io_name"),
+                self._column("io_remaining"),
+                self._column("io_queue"),
+            )
+        ]
+
+    def get_core_events(self) -> List[Dict[str, Any]]:
+        """
+        @brief Extrae los eventos por núcleo del modo multinúcleo.
+        @return Lista de eventos con tick, core, event, pid, name, remaining y queue_size.
+        """
+        strings = self._data["strings"]
+        return [
+            {
+                "tick": tick,
+                "core": core,
+                "event": strings[event],
+                "pid": pid,
+                "name": strings[name],
+                "remaining": remaining,
+                "queue_size": queue,
+            }
+            for tick, core, event, pid, name, remaining, queue in zip(
+                self._column("core_tick"),
+                self._column("core"),
+                self._column("core_event"),
+                self._column("core_pid"),
+                self._column("core_name"),
+                self._column("core_remaining"),
+                self._column("core_queue"),
+            )
+        ]
 
     def get_summary_metrics(self) -> Dict[str, Any]:
         """
         @brief Calcula métricas resumen de la simulación.
         @return Diccionario con métricas agregadas.
         """
-        total_ticks = self.get_max_tick()
-        total_context_switches = sum(
-            1 for e in self._metrics if e.get("cpu", {}).get("context_switch", False)
-        )
-
-        total_page_faults = 0
-        total_replacements = 0
-        for event in self._metrics:
-            if "memory" in event:
-                total_page_faults = max(
-                    total_page_faults, event["memory"].get("total_page_faults", 0)
-                )
-                total_replacements = max(
-                    total_replacements, event["memory"].get("total_replacements", 0)
-                )
-
+        strings = self._data["strings"]
         state_counts: Dict[str, int] = {}
-        for event in self._metrics:
-            if "state_transitions" in event:
-                for trans in event["state_transitions"]:
-                    state = trans["to"]
-                    state_counts[state] = state_counts.get(state, 0) + 1
+        for to_state in self._column("transition_to"):
+            state = strings[to_state]
+            state_counts[state] = state_counts.get(state, 0) + 1
 
         return {
-            "total_ticks": total_ticks,
-            "total_context_switches": total_context_switches,
-            "total_page_faults": total_page_faults,
-            "total_replacements": total_replacements,
-            "num_processes": len(self._processes),
+            "total_ticks": self.get_max_tick(),
+            "total_context_switches": self._data["context_switches"],
+            "total_page_faults": self._data["max_page_faults"],
+            "total_replacements": self._data["max_replacements"],
+            "num_processes": len(self.processes),
             "state_counts": state_counts,
         }
 
@@ -299,58 +596,52 @@ class MetricsLoader:
         @brief Calcula métricas de CPU: tiempo de espera, retorno y utilización.
         @return Diccionario con avg_waiting_time, avg_turnaround_time, cpu_utilization.
         """
+        strings = self._data["strings"]
         processes_data = {}
 
-        for event in self._metrics:
-            tick = event.get("tick", -1)
-
-            if "state_transitions" in event:
-                for trans in event["state_transitions"]:
-                    name = trans["name"]
-                    from_state = trans["from"]
-                    to_state = trans["to"]
-
-                    if name not in processes_data:
-                        processes_data[name] = {
-                            "arrival": None,
-                            "completion": None,
-                            "ready_periods": [],
-                            "running_periods": [],
-                            "current_state": None,
-                            "state_enter_tick": None,
-                        }
-
-                    p = processes_data[name]
-
-                    if p["current_state"] is not None and p["state_enter_tick"] is not None:
-                        duration = tick - p["state_enter_tick"]
-                        if p["current_state"] == "READY":
-                            p["ready_periods"].append(duration)
-                        elif p["current_state"] == "RUNNING":
-                            p["running_periods"].append(duration)
-
-                    if p["arrival"] is None and to_state == "READY":
-                        p["arrival"] = tick
-
-                    if to_state == "TERMINATED":
-                        p["completion"] = tick
-
-                    p["current_state"] = to_state
-                    p["state_enter_tick"] = tick
+        for tick, name, to_id in zip(
+            self._column("transition_tick"),
+            self._column("transition_name"),
+            self._column("transition_to"),
+        ):
+            to_state = strings[to_id]
+            p = processes_data.get(name)
+            if p is None:
+                p = processes_data[name] = {
+                    "arrival": None,
+                    "completion": None,
+                    "waiting": 0,
+                    "running": 0,
+                    "current_state": None,
+                    "state_enter_tick": None,
+                }
+
+            if p["current_state"] is not None and p["state_enter_tick"] is not None:
+                duration = tick - p["state_enter_tick"]
+                if p["current_state"] == "READY":
+                    p["waiting"] += duration
+                elif p["current_state"] == "RUNNING":
+                    p["running"] += duration
+
+            if p["arrival"] is None and to_state == "READY":
+                p["arrival"] = tick
+
+            if to_state == "TERMINATED":
+                p["completion"] = tick
+
+            p["current_state"] = to_state
+            p["state_enter_tick"] = tick
 
         total_waiting = 0
         total_turnaround = 0
         total_cpu_time = 0
         completed_processes = 0
 
-        for name, p in processes_data.items():
+        for p in processes_data.values():
             if p["arrival"] is not None and p["completion"] is not None:
-                waiting_time = sum(p["ready_periods"])
-                turnaround_time = p["completion"] - p["arrival"]
-
-                total_waiting += waiting_time
-                total_turnaround += turnaround_time
-                total_cpu_time += sum(p["running_periods"])
+                total_waiting += p["waiting"]
+                total_turnaround += p["completion"] - p["arrival"]
+                total_cpu_time += p["running"]
                 completed_processes += 1
 
         if completed_processes == 0:
@@ -368,3 +659,25 @@ class MetricsLoader:
             "avg_turnaround_time": total_turnaround / completed_processes,
             "cpu_utilization": cpu_utilization,
         }
+
+
+def load_aggregates(aggregates_file: str) -> Dict[int, List[Dict[str, Any]]]:
+    """
+    @brief Carga las series agregadas que escribe el simulador con
+    metrics_aggregate_windows.
+
+    Cada línea resume una ventana de ticks (utilización de CPU, colas
+    mín/prom/máx, fault_rate e io_throughput), así que el archivo ocupa
+    kilobytes aun en simulaciones de millones de ticks.
+    @param aggregates_file Ruta del archivo .aggregates.jsonl.
+    @return Ventanas de cada ancho, ordenadas por tick de inicio.
+    """
+    series: Dict[int, List[Dict[str, Any]]] = {}
+    with open(aggregates_file, "rb") as f:
+        for line in f:
+            if line.strip():
+                window = _json_loads(line)
+                series.setdefault(window["window"], []).append(window)
+    for windows in series.values():
+        windows.sort(key=lambda w: w["start"])
+    return series
@@ -193,8 +193,9 @@ class IOGanttChartGenerator(BaseGenerator):
         """
         @brief Extrae los ticks donde cada proceso está siendo activamente atendido.
 
-        Usa los eventos STEP y COMPLETED del dispositivo para determinar qué proceso está
-        siendo servido en cada tick.
+        Usa los eventos STEP, SEEK y COMPLETED del dispositivo para determinar qué
+        proceso está siendo servido en cada tick; la búsqueda del cabezal cuenta
+        como servicio.
 
         @param io_device_events Lista de eventos del dispositivo de E/S.
         @return Diccionario con nombre de proceso como clave y conjunto de ticks activos.
@@ -209,7 +210,7 @@ class IOGanttChartGenerator(BaseGenerator):
             event_type = event.get("event", "")
             name = event.get("name", "")
 
-            if event_type in ("STEP", "COMPLETED") and name:
+            if event_type in ("STEP", "SEEK", "COMPLETED") and name:
                 active_ticks[name].add(tick)
 
         return active_ticks
@@ -1,6 +1,7 @@
 import shutil
+from concurrent.futures import Executor, Future, ProcessPoolExecutor
 from pathlib import Path
-from typing import List
+from typing import Dict, List, Optional, Tuple, Type
 
 from visualization.data_loader import MetricsLoader
 from visualization.base_generator import BaseGenerator
@@ -13,6 +14,7 @@ from visualization.memory_usage import (
 )
 from visualization.io_operations import IOOperationsGenerator
 from visualization.io_gantt_chart import IOGanttChartGenerator
+from visualization.core_gantt_chart import CoreGanttChartGenerator
 from visualization.context_switches import ContextSwitchesGenerator
 from visualization.summary_dashboard import (
     SummaryDashboardGenerator,
@@ -20,84 +22,150 @@ from visualization.summary_dashboard import (
 )
 
 
+CHARTS: List[Tuple[str, Type[BaseGenerator]]] = [
+    ("Diagrama de Gantt", GanttChartGenerator),
+    ("Evolución de Colas", QueueEvolutionGenerator),
+    ("Uso de Memoria", MemoryUsageGenerator),
+    ("Tablas de Páginas", PageTableGenerator),
+    ("Asignación de Frames", FrameAllocationGenerator),
+    ("Operaciones E/S", IOOperationsGenerator),
+    ("Diagrama de Gantt E/S", IOGanttChartGenerator),
+    ("Cambios de Contexto", ContextSwitchesGenerator),
+    ("Dashboard Resumen", SummaryDashboardGenerator),
+    ("Distribución de Estados", StateDistributionGenerator),
+    ("Diagrama de Gantt por Núcleo", CoreGanttChartGenerator),
+]
+"""@brief Diagramas generados, en orden: nombre y clase del generador."""
+
+_process_loaders: Dict[str, MetricsLoader] = {}
+
+
+def _process_loader(metrics_file: str) -> MetricsLoader:
+    """
+    @brief Obtiene el cargador de un archivo dentro del proceso actual.
+
+    Cada proceso del pool conserva solo el último archivo cargado, de modo
+    que los diagramas de un mismo archivo reutilizan las columnas.
+
+    @param metrics_file Ruta al archivo de métricas.
+    @return Cargador con los datos ya cargados.
+    """
+    loader = _process_loaders.get(metrics_file)
+    if loader is None:
+        _process_loaders.clear()
+        loader = MetricsLoader(metrics_file)
+        loader.load()
+        _process_loaders[metrics_file] = loader
+    return loader
+
+
+def load_metrics(metrics_file: str) -> Tuple[int, List[str]]:
+    """
+    @brief Carga un archivo de métricas, dejando su caché escrita.
+    @param metrics_file Ruta al archivo de métricas.
+    @return Cantidad de registros y procesos encontrados.
+    """
+    loader = _process_loader(metrics_file)
+    return loader.event_count, loader.processes
+
+
+def render_chart(metrics_file: str, output_dir: str, index: int) -> Optional[str]:
+    """
+    @brief Genera un diagrama; pensada para ejecutarse en un pool de procesos.
+    @param metrics_file Ruta al archivo de métricas.
+    @param output_dir Directorio de salida (ya creado).
+    @param index Posición del diagrama en CHARTS.
+    @return None si se generó, o el mensaje de error.
+    """
+    try:
+        generator = CHARTS[index][1](Path(output_dir))
+        generator.generate(_process_loader(metrics_file))
+        return None
+    except Exception as e:
+        return str(e)
+
+
+def reset_output_dir(output_dir: Path) -> None:
+    """
+    @brief Prepara un directorio de salida: lo elimina si existe y lo crea
+    vacío.
+    @param output_dir Directorio a preparar.
+    """
+    if output_dir.exists():
+        shutil.rmtree(output_dir)
+    output_dir.mkdir(parents=True, exist_ok=True)
+
+
 class MetricsVisualizer:
     """
     @brief Orquestador principal para generación de todas las visualizaciones.
 
     Coordina la carga de datos y la ejecución de todos los generadores
-    de gráficos en secuencia.
+    de gráficos, en secuencia o repartidos en un pool de procesos.
     """
 
-    def __init__(self, metrics_file: str, output_dir: str):
+    def __init__(self, metrics_file: str, output_dir: str, jobs: int = 1):
         """
         @brief Constructor de MetricsVisualizer.
         @param metrics_file Ruta al archivo de métricas JSONL.
         @param output_dir Directorio de salida para los gráficos.
+        @param jobs Procesos para generar los diagramas (1 = en secuencia).
         """
         self._metrics_file = metrics_file
         self._output_dir = Path(output_dir)
         self._loader = MetricsLoader(metrics_file)
-        self._generators: List[BaseGenerator] = []
-
-    def _setup_output_dir(self) -> None:
-        """
-        @brief Prepara el directorio de salida.
-
-        Elimina el directorio si existe y lo crea vacío.
-        """
-        if self._output_dir.exists():
-            shutil.rmtree(self._output_dir)
-        self._output_dir.mkdir(parents=True, exist_ok=True)
-
-    def _create_generators(self) -> None:
-        """
-        @brief Crea todas las instancias de generadores de gráficos.
-        """
-        self._generators = [
-            GanttChartGenerator(self._output_dir),
-            QueueEvolutionGenerator(self._output_dir),
-            MemoryUsageGenerator(self._output_dir),
-            PageTableGenerator(self._output_dir),
-            FrameAllocationGenerator(self._output_dir),
-            IOOperationsGenerator(self._output_dir),
-            IOGanttChartGenerator(self._output_dir),
-            ContextSwitchesGenerator(self._output_dir),
-            SummaryDashboardGenerator(self._output_dir),
-            StateDistributionGenerator(self._output_dir),
-        ]
+        self._jobs = jobs
 
     def generate_all(self) -> None:
         """
         @brief Genera todas las visualizaciones.
 
-        Carga los datos, prepara el directorio de salida y ejecuta
-        cada generador en secuencia.
+        Carga los datos, prepara el directorio de salida y ejecuta cada
+        generador. Con más de un proceso, los diagramas se generan en
+        paralelo: cada proceso lee las columnas desde la caché que deja la
+        carga inicial.
         """
         self._loader.load()
-        print(f"[INFO] Cargados {len(self._loader.metrics)} eventos")
+        print(f"[INFO] Cargados {self._loader.event_count} eventos")
         print(f"[INFO] Procesos encontrados: {', '.join(self._loader.processes)}")
 
-        self._setup_output_dir()
+        reset_output_dir(self._output_dir)
         print(f"[INFO] Directorio de salida creado: {self._output_dir}")
 
-        self._create_generators()
-
-        generator_names = [
-            "Diagrama de Gantt",
-            "Evolución de Colas",
-            "Uso de Memoria",
-            "Tablas de Páginas",
-            "Asignación de Frames",
-            "Operaciones E/S",
-            "Diagrama de Gantt E/S",
-            "Cambios de Contexto",
-            "Dashboard Resumen",
-            "Distribución de Estados",
+        if self._jobs <= 1:
+            for name, generator_class in CHARTS:
+                print(f"[INFO] Generando {name}...")
+                try:
+                    generator_class(self._output_dir).generate(self._loader)
+                except Exception as e:
+                    print(f"[ERROR] Error generando {name}: {e}")
+            return
+
+        with ProcessPoolExecutor(max_workers=self._jobs) as pool:
+            self.report(self.submit_charts(pool))
+
+    def submit_charts(self, executor: Executor) -> List[Future]:
+        """
+        @brief Encola todos los diagramas en un pool de procesos. El
+        directorio de salida ya debe existir.
+        @param executor Pool de procesos.
+        @return Futuros de render_chart, en el orden de CHARTS.
+        """
+        return [
+            executor.submit(
+                render_chart, self._metrics_file, str(self._output_dir), index)
+            for index in range(len(CHARTS))
         ]
 
-        for generator, name in zip(self._generators, generator_names):
-            print(f"[INFO] Generando {name}...")
-            try:
-                generator.generate(self._loader)
-            except Exception as e:
-                print(f"[ERROR] Error generando {name}: {e}")
+    @staticmethod
+    def report(futures: List[Future]) -> None:
+        """
+        @brief Espera los diagramas encolados e informa cada resultado.
+        @param futures Futuros devueltos por submit_charts.
+        """
+        for (name, _), future in zip(CHARTS, futures):
+            error = future.result()
+            if error is None:
+                print(f"[INFO] Generado {name}")
+            else:
+                print(f"[ERROR] Error generando {name}: {error}")